@@ -32,6 +32,7 @@ target_compile_definitions(bsl INTERFACE
     BSL_PAGE_SIZE=${BSL_PAGE_SIZE}
     BSL_PERFORCE=${BSL_PERFORCE}
     BSL_CONSTEXPR=${BSL_CONSTEXPR}
+    BSL_CONSTEVAL=${BSL_CONSTEVAL}
 )
 
 target_include_directories(bsl INTERFACE
@@ -22,7 +22,9 @@
 if(CMAKE_BUILD_TYPE STREQUAL PERFORCE)
     set(BSL_PERFORCE "true")
     set(BSL_CONSTEXPR "")
+    set(BSL_CONSTEVAL "constexpr")
 else()
     set(BSL_PERFORCE "false")
     set(BSL_CONSTEXPR "constexpr")
+    set(BSL_CONSTEVAL "consteval")
 endif()
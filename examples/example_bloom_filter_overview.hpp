@@ -0,0 +1,59 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+#include <bsl/bloom_filter.hpp>
+#include <bsl/array.hpp>
+#include <bsl/byte.hpp>
+#include <bsl/convert.hpp>
+#include <bsl/debug.hpp>
+#include <bsl/span.hpp>
+
+namespace bsl
+{
+    /// <!-- description -->
+    ///   @brief Provides the example's main function
+    ///
+    inline void
+    example_bloom_filter_overview() noexcept
+    {
+        constexpr bsl::safe_uint64 shared_frame{bsl::to_u64(0x42000)};
+        constexpr bsl::safe_uint64 private_frame{bsl::to_u64(0x43000)};
+
+        static bsl::bloom_filter<4096, 7> shared{};
+        static bsl::array<bsl::byte, 512> buf{};
+
+        shared.add(shared_frame);
+        if (shared.contains(shared_frame)) {
+            bsl::print() << "0x42000 is probably shared" << bsl::endl;
+        }
+
+        if (!shared.contains(private_frame)) {
+            bsl::print() << "0x43000 is definitely not shared" << bsl::endl;
+        }
+
+        if (shared.serialize({buf.data(), buf.size()})) {
+            bsl::print() << "serialized " << shared.size_bytes() << " bytes" << bsl::endl;
+        }
+    }
+}
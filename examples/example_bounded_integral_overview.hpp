@@ -0,0 +1,60 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+#include <bsl/array.hpp>
+#include <bsl/bounded_integral.hpp>
+#include <bsl/convert.hpp>
+#include <bsl/debug.hpp>
+#include <bsl/safe_integral.hpp>
+
+namespace bsl
+{
+    /// <!-- description -->
+    ///   @brief Provides the example's main function
+    ///
+    inline void
+    example_bounded_integral_overview() noexcept
+    {
+        constexpr bsl::uintmax rows{4U};
+        constexpr bsl::uintmax cols{8U};
+        bsl::array<bsl::safe_uint32, rows * cols> grid{};
+
+        /// NOTE:
+        /// - The range of each index is checked once, here. After that,
+        ///   row * cols + col is known to be in [0, 31] at compile-time,
+        ///   so neither the math nor the indexing needs a check.
+        ///
+
+        auto const row{bsl::to_bounded<bsl::bounded_index<rows>>(bsl::to_umax(2))};
+        auto const col{bsl::to_bounded<bsl::bounded_index<cols>>(bsl::to_umax(5))};
+        if (row.failure() || col.failure()) {
+            return;
+        }
+
+        auto const idx{*row.get_if() * bsl::bounded_constant<bsl::uintmax, cols> + *col.get_if()};
+        *grid.at_if(idx) = bsl::to_u32(42);
+
+        bsl::print() << "grid[" << idx << "]: " << *grid.at_if(idx) << bsl::endl;
+    }
+}
@@ -0,0 +1,62 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+#include <bsl/event_loop.hpp>
+#include <bsl/debug.hpp>
+#include <bsl/safe_integral.hpp>
+
+namespace bsl
+{
+    /// <!-- description -->
+    ///   @brief Provides the example's main function
+    ///
+    inline void
+    example_event_loop_overview() noexcept
+    {
+        constexpr bsl::safe_uintmax one_ms{bsl::to_umax(1000000)};
+        bsl::event_loop<8> loop{};
+
+        bsl::safe_uintmax ticks{};
+        auto const on_tick{[&loop, &ticks](
+                               bsl::int32 const fd, bsl::uint32 const events) noexcept {
+            bsl::discard(fd);
+            bsl::discard(events);
+
+            ++ticks;
+            if (bsl::to_umax(3) == ticks) {
+                loop.stop();
+            }
+        }};
+
+        auto const timer{loop.add_timer(one_ms, true, on_tick)};
+        if (!timer) {
+            return;
+        }
+
+        loop.run();
+        bsl::discard(loop.remove(*timer.get_if()));
+
+        bsl::print() << "success\n";
+    }
+}
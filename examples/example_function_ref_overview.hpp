@@ -0,0 +1,65 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+#include <bsl/function_ref.hpp>
+#include <bsl/debug.hpp>
+#include <bsl/safe_integral.hpp>
+
+namespace bsl
+{
+    /// <!-- description -->
+    ///   @brief Calls the provided callback once for each of the first n
+    ///     integers.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param n the number of integers to visit
+    ///   @param cb the callback to call for each integer
+    ///
+    inline void
+    example_function_ref_visit(
+        bsl::safe_uintmax const &n,
+        bsl::function_ref<void(bsl::safe_uintmax const &)> const &cb) noexcept
+    {
+        for (bsl::safe_uintmax i{}; i < n; ++i) {
+            cb(i);
+        }
+    }
+
+    /// <!-- description -->
+    ///   @brief Provides the example's main function
+    ///
+    inline void
+    example_function_ref_overview() noexcept
+    {
+        bsl::safe_uintmax sum{};
+        auto const func{[&sum](bsl::safe_uintmax const &val) noexcept {
+            sum += val;
+        }};
+
+        example_function_ref_visit(bsl::to_umax(5), func);
+        if (bsl::to_umax(10) == sum) {
+            bsl::print() << "success\n";
+        }
+    }
+}
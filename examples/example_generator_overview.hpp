@@ -0,0 +1,71 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+#include <bsl/generator.hpp>
+#include <bsl/array.hpp>
+#include <bsl/debug.hpp>
+#include <bsl/frame_pool.hpp>
+
+namespace bsl
+{
+    /// <!-- description -->
+    ///   @brief Yields the first n powers of two
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param pool the bsl::frame_pool to allocate the generator's frame from
+    ///   @param n the number of values to yield
+    ///   @return Returns a bsl::generator that yields the first n powers of two
+    ///
+    [[nodiscard]] inline bsl::generator<bsl::safe_uintmax>
+    example_generator_powers_of_two(bsl::frame_pool &pool, bsl::safe_uintmax const n) noexcept
+    {
+        bsl::discard(pool);
+
+        bsl::safe_uintmax val{bsl::to_umax(1)};
+        for (bsl::safe_uintmax i{}; i < n; ++i) {
+            co_yield val;
+            val *= bsl::to_umax(2);
+        }
+    }
+
+    /// <!-- description -->
+    ///   @brief Provides the example's main function
+    ///
+    inline void
+    example_generator_overview() noexcept
+    {
+        alignas(64) bsl::array<bsl::byte, 1024> buf{};
+        bsl::frame_pool pool{{buf.data(), buf.size()}, bsl::to_umax(1008)};
+
+        bsl::safe_uintmax sum{};
+        auto gen{example_generator_powers_of_two(pool, bsl::to_umax(4))};
+        while (gen.next()) {
+            sum += *gen.get_if();
+        }
+
+        if (bsl::to_umax(15) == sum) {
+            bsl::print() << "success\n";
+        }
+    }
+}
@@ -0,0 +1,52 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+#include <bsl/hex.hpp>
+#include <bsl/array.hpp>
+#include <bsl/byte.hpp>
+#include <bsl/debug.hpp>
+#include <bsl/fixed_string.hpp>
+#include <bsl/span.hpp>
+
+namespace bsl
+{
+    /// <!-- description -->
+    ///   @brief Provides the example's main function
+    ///
+    inline void
+    example_hex_overview() noexcept
+    {
+        constexpr bsl::array<bsl::uint8, 4> hash{0xDEU, 0xADU, 0xBEU, 0xEFU};
+
+        bsl::fixed_string<32> str{"hash: "};
+        if (bsl::hex_encode(bsl::as_bytes(hash.data(), hash.size()), str)) {
+            bsl::print() << str << bsl::endl;
+        }
+
+        bsl::array<bsl::uint8, 4> bytes{};
+        if (bsl::hex_decode("CAFEF00D", bsl::as_writable_bytes(bytes.data(), bytes.size()))) {
+            bsl::print() << "first byte: " << bsl::fmt{"#04x", *bytes.front_if()} << bsl::endl;
+        }
+    }
+}
@@ -0,0 +1,62 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+#include <bsl/k_way_merge.hpp>
+#include <bsl/array.hpp>
+#include <bsl/convert.hpp>
+#include <bsl/debug.hpp>
+#include <bsl/safe_integral.hpp>
+#include <bsl/span.hpp>
+
+namespace bsl
+{
+    /// <!-- description -->
+    ///   @brief Provides the example's main function
+    ///
+    inline void
+    example_k_way_merge_overview() noexcept
+    {
+        bsl::array<bsl::safe_uint64, 2> const cpu0{bsl::to_u64(10), bsl::to_u64(40)};
+        bsl::array<bsl::safe_uint64, 2> const cpu1{bsl::to_u64(20), bsl::to_u64(30)};
+        bsl::array<bsl::safe_uint64, 1> const cpu2{bsl::to_u64(25)};
+
+        /// NOTE:
+        /// - Sorted files mapped with bsl::ifmap can be used as runs
+        ///   directly using bsl::as_span<T>(map.data(), map.size()).
+        ///
+
+        bsl::array<bsl::span<bsl::safe_uint64 const>, 3> const runs{
+            bsl::span{cpu0.data(), cpu0.size()},
+            bsl::span{cpu1.data(), cpu1.size()},
+            bsl::span{cpu2.data(), cpu2.size()}};
+
+        auto const ret{bsl::k_way_merge(runs, [](bsl::safe_uint64 const &timestamp) noexcept {
+            bsl::print() << "timestamp: " << timestamp << bsl::endl;
+        })};
+
+        if (ret) {
+            bsl::print() << "merged " << *ret.get_if() << " entries" << bsl::endl;
+        }
+    }
+}
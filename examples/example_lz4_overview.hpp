@@ -0,0 +1,63 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+#include <bsl/lz4.hpp>
+#include <bsl/array.hpp>
+#include <bsl/byte.hpp>
+#include <bsl/debug.hpp>
+#include <bsl/span.hpp>
+#include <bsl/string_view.hpp>
+
+namespace bsl
+{
+    /// <!-- description -->
+    ///   @brief Provides the example's main function
+    ///
+    inline void
+    example_lz4_overview() noexcept
+    {
+        bsl::string_view const msg{"the quick brown fox, the quick brown fox, the quick fox"};
+
+        static bsl::array<bsl::byte, 0x100U> frame{};
+        static bsl::array<bsl::char_type, 0x100U> block{};
+        alignas(bsl::uint32) static bsl::array<bsl::byte, bsl::lz4_scratch_size.get()> scratch{};
+
+        auto const size{bsl::lz4_frame_compress(
+            bsl::as_bytes(msg.data(), msg.size()),
+            {frame.data(), frame.size()},
+            {scratch.data(), scratch.size()})};
+
+        bsl::lz4_frame_reader reader{{frame.data(), size}};
+        while (!reader.done()) {
+            auto const ret{reader.next(bsl::as_writable_bytes(block.data(), block.size()))};
+            if (!ret.is_pos()) {
+                break;
+            }
+
+            bsl::print() << "block: " << bsl::string_view{block.data(), ret} << bsl::endl;
+        }
+
+        bsl::print() << "compressed " << msg.size() << " bytes to " << size << bsl::endl;
+    }
+}
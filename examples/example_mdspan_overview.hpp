@@ -0,0 +1,68 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+#include <bsl/mdspan.hpp>
+#include <bsl/array.hpp>
+#include <bsl/convert.hpp>
+#include <bsl/debug.hpp>
+#include <bsl/extents.hpp>
+#include <bsl/for_each.hpp>
+#include <bsl/layout_left.hpp>
+#include <bsl/safe_integral.hpp>
+
+namespace bsl
+{
+    /// <!-- description -->
+    ///   @brief Provides the example's main function
+    ///
+    inline void
+    example_mdspan_overview() noexcept
+    {
+        using matrix_type = bsl::mdspan<bsl::safe_int32, bsl::extents<2, 3>>;
+        using column_major_type =
+            bsl::mdspan<bsl::safe_int32, bsl::extents<3, 2>, bsl::layout_left>;
+
+        bsl::array<bsl::safe_int32, 6> arr{};
+        matrix_type mat{arr.data()};
+
+        bsl::safe_int32 val{};
+        bsl::for_each(mat, [&val](bsl::safe_int32 &elem) noexcept {
+            elem = val;
+            ++val;
+        });
+
+        if (bsl::safe_int32 const *const elem{mat.at_if(bsl::to_umax(1), bsl::to_umax(2))}) {
+            bsl::print() << "mat[1][2]: " << *elem << bsl::endl;
+        }
+
+        if (nullptr == mat.at_if(bsl::to_umax(2), bsl::to_umax(0))) {
+            bsl::print() << "mat[2][0] is out of bounds" << bsl::endl;
+        }
+
+        column_major_type const trans{arr.data()};
+        if (bsl::safe_int32 const *const elem{trans.at_if(bsl::to_umax(2), bsl::to_umax(1))}) {
+            bsl::print() << "trans[2][1]: " << *elem << bsl::endl;
+        }
+    }
+}
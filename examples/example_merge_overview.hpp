@@ -0,0 +1,54 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+#include <bsl/merge.hpp>
+#include <bsl/array.hpp>
+#include <bsl/convert.hpp>
+#include <bsl/debug.hpp>
+#include <bsl/safe_integral.hpp>
+#include <bsl/span.hpp>
+
+namespace bsl
+{
+    /// <!-- description -->
+    ///   @brief Provides the example's main function
+    ///
+    inline void
+    example_merge_overview() noexcept
+    {
+        bsl::array<bsl::safe_uint64, 3> const lhs{
+            bsl::to_u64(1), bsl::to_u64(4), bsl::to_u64(9)};
+        bsl::array<bsl::safe_uint64, 2> const rhs{bsl::to_u64(2), bsl::to_u64(8)};
+        bsl::array<bsl::safe_uint64, 5> dst{};
+
+        auto const ret{bsl::merge(
+            bsl::span<bsl::safe_uint64 const>{lhs.data(), lhs.size()},
+            bsl::span<bsl::safe_uint64 const>{rhs.data(), rhs.size()},
+            bsl::span<bsl::safe_uint64>{dst.data(), dst.size()})};
+
+        if (ret) {
+            bsl::print() << "merged: " << bsl::span{dst.data(), dst.size()} << bsl::endl;
+        }
+    }
+}
@@ -0,0 +1,75 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+#include <bsl/bitfield.hpp>
+#include <bsl/convert.hpp>
+#include <bsl/cstdint.hpp>
+#include <bsl/debug.hpp>
+#include <bsl/register_value.hpp>
+
+namespace bsl
+{
+    /// @class bsl::example_cr0
+    ///
+    /// <!-- description -->
+    ///   @brief Describes the CR0 register for this example
+    ///
+    class example_cr0 final
+    {
+    public:
+        /// @brief the type used to store CR0
+        using value_type = bsl::uint64;
+    };
+
+    /// @brief CR0.PE (protection enable)
+    using example_cr0_pe = bsl::bitfield<example_cr0, 0U, 1U>;
+    /// @brief CR0.NE (numeric error)
+    using example_cr0_ne = bsl::bitfield<example_cr0, 5U, 1U>;
+    /// @brief CR0.CD (cache disable)
+    using example_cr0_cd = bsl::bitfield<example_cr0, 30U, 1U>;
+    /// @brief CR0.PG (paging)
+    using example_cr0_pg = bsl::bitfield<example_cr0, 31U, 1U>;
+
+    /// <!-- description -->
+    ///   @brief Provides the example's main function
+    ///
+    inline void
+    example_register_value_overview() noexcept
+    {
+        bsl::register_value<example_cr0> cr0{bsl::to_u64(0x60000010)};
+
+        cr0.set<example_cr0_pe, example_cr0_ne, example_cr0_pg>();
+        if (!cr0.write<example_cr0_cd>(bsl::to_u64(0))) {
+            bsl::error() << "failure\n";
+            return;
+        }
+
+        if (cr0.is_set<example_cr0_pe, example_cr0_pg>()) {
+            bsl::print() << "cr0: " << cr0 << bsl::endl;
+        }
+        else {
+            bsl::error() << "failure\n";
+        }
+    }
+}
@@ -0,0 +1,78 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+#include <bsl/run_queue.hpp>
+#include <bsl/array.hpp>
+#include <bsl/debug.hpp>
+#include <bsl/frame_pool.hpp>
+#include <bsl/task.hpp>
+
+namespace bsl
+{
+    /// <!-- description -->
+    ///   @brief Performs a multi-step operation, yielding to the other
+    ///     tasks in the queue after each step.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param pool the bsl::frame_pool to allocate the task's frame from
+    ///   @param rq the bsl::run_queue that is executing the task
+    ///   @param steps the number of steps to perform
+    ///   @return Returns the number of steps that were performed
+    ///
+    [[nodiscard]] inline bsl::task<bsl::safe_uintmax>
+    example_run_queue_worker(
+        bsl::frame_pool &pool, bsl::run_queue<4> &rq, bsl::safe_uintmax const steps) noexcept
+    {
+        bsl::discard(pool);
+
+        bsl::safe_uintmax i{};
+        for (; i < steps; ++i) {
+            co_await rq.schedule();
+        }
+
+        co_return i;
+    }
+
+    /// <!-- description -->
+    ///   @brief Provides the example's main function
+    ///
+    inline void
+    example_run_queue_overview() noexcept
+    {
+        alignas(64) bsl::array<bsl::byte, 4096> buf{};
+        bsl::frame_pool pool{{buf.data(), buf.size()}, bsl::to_umax(1008)};
+        bsl::run_queue<4> rq{};
+
+        auto const tsk1{example_run_queue_worker(pool, rq, bsl::to_umax(2))};
+        auto const tsk2{example_run_queue_worker(pool, rq, bsl::to_umax(3))};
+
+        bsl::discard(rq.spawn(tsk1));
+        bsl::discard(rq.spawn(tsk2));
+        bsl::discard(rq.run());
+
+        if (tsk1.done() && tsk2.done()) {
+            bsl::print() << "success\n";
+        }
+    }
+}
@@ -0,0 +1,57 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+#include <bsl/soa_array.hpp>
+#include <bsl/convert.hpp>
+#include <bsl/debug.hpp>
+#include <bsl/for_each.hpp>
+#include <bsl/safe_integral.hpp>
+
+namespace bsl
+{
+    /// <!-- description -->
+    ///   @brief Provides the example's main function
+    ///
+    inline void
+    example_soa_array_overview() noexcept
+    {
+        constexpr bsl::uintmax exits{0U};
+        constexpr bsl::uintmax cycles{1U};
+
+        static bsl::soa_array<4, bsl::safe_uint64, bsl::safe_uint64> stats{};
+
+        auto const vcpu1{stats.element(bsl::to_umax(1))};
+        *vcpu1.get_if<exits>() = bsl::to_u64(10);
+        *vcpu1.get_if<cycles>() = bsl::to_u64(5000);
+
+        bsl::safe_uint64 total{};
+        bsl::for_each<exits>(stats, [&total](bsl::safe_uint64 const &val) noexcept {
+            total += val;
+        });
+
+        bsl::print() << "total exits: " << total << bsl::endl;
+        bsl::print() << "cycles column: " << stats.column<cycles>().size() << " entries"
+                     << bsl::endl;
+    }
+}
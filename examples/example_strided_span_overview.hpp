@@ -0,0 +1,60 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+#include <bsl/strided_span.hpp>
+#include <bsl/array.hpp>
+#include <bsl/convert.hpp>
+#include <bsl/debug.hpp>
+#include <bsl/for_each.hpp>
+#include <bsl/safe_integral.hpp>
+#include <bsl/span.hpp>
+
+namespace bsl
+{
+    /// <!-- description -->
+    ///   @brief Provides the example's main function
+    ///
+    inline void
+    example_strided_span_overview() noexcept
+    {
+        constexpr bsl::array<bsl::safe_int32, 6> samples{
+            bsl::to_i32(4),
+            bsl::to_i32(8),
+            bsl::to_i32(15),
+            bsl::to_i32(16),
+            bsl::to_i32(23),
+            bsl::to_i32(42)};
+
+        bsl::span<bsl::safe_int32 const> const all{samples.data(), samples.size()};
+        bsl::strided_span<bsl::safe_int32 const> const left{all, bsl::to_umax(2)};
+
+        bsl::safe_int32 sum{};
+        bsl::for_each(left, [&sum](bsl::safe_int32 const &elem) noexcept {
+            sum += elem;
+        });
+
+        bsl::print() << "left channel samples: " << left.size() << bsl::endl;
+        bsl::print() << "left channel sum: " << sum << bsl::endl;
+    }
+}
@@ -0,0 +1,91 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+#include <bsl/task.hpp>
+#include <bsl/array.hpp>
+#include <bsl/debug.hpp>
+#include <bsl/frame_pool.hpp>
+
+namespace bsl
+{
+    /// <!-- description -->
+    ///   @brief Reads a register from an emulated device
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param pool the bsl::frame_pool to allocate the task's frame from
+    ///   @param reg the register to read
+    ///   @return Returns the value of the register
+    ///
+    [[nodiscard]] inline bsl::task<bsl::safe_uintmax>
+    example_task_read_reg(bsl::frame_pool &pool, bsl::safe_uintmax const reg) noexcept
+    {
+        bsl::discard(pool);
+        if (reg > bsl::to_umax(0xFF)) {
+            co_return bsl::errc_index_out_of_bounds;
+        }
+
+        co_return reg + bsl::to_umax(1);
+    }
+
+    /// <!-- description -->
+    ///   @brief Reads two registers from an emulated device and returns
+    ///     their sum.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param pool the bsl::frame_pool to allocate the task's frame from
+    ///   @return Returns the sum of the registers
+    ///
+    [[nodiscard]] inline bsl::task<bsl::safe_uintmax>
+    example_task_read_regs(bsl::frame_pool &pool) noexcept
+    {
+        auto const reg1{co_await example_task_read_reg(pool, bsl::to_umax(0x10))};
+        if (!reg1) {
+            co_return reg1.errc();
+        }
+
+        auto const reg2{co_await example_task_read_reg(pool, bsl::to_umax(0x20))};
+        if (!reg2) {
+            co_return reg2.errc();
+        }
+
+        co_return *reg1.get_if() + *reg2.get_if();
+    }
+
+    /// <!-- description -->
+    ///   @brief Provides the example's main function
+    ///
+    inline void
+    example_task_overview() noexcept
+    {
+        alignas(64) bsl::array<bsl::byte, 4096> buf{};
+        bsl::frame_pool pool{{buf.data(), buf.size()}, bsl::to_umax(1008)};
+
+        auto const tsk{example_task_read_regs(pool)};
+        bsl::discard(tsk.resume());
+
+        if (tsk.get() == bsl::result<bsl::safe_uintmax>{bsl::to_umax(0x32)}) {
+            bsl::print() << "success\n";
+        }
+    }
+}
@@ -0,0 +1,60 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+#include <bsl/transform_exclusive_scan.hpp>
+#include <bsl/array.hpp>
+#include <bsl/convert.hpp>
+#include <bsl/debug.hpp>
+#include <bsl/safe_integral.hpp>
+#include <bsl/span.hpp>
+
+namespace bsl
+{
+    /// <!-- description -->
+    ///   @brief Provides the example's main function
+    ///
+    inline void
+    example_transform_exclusive_scan_overview() noexcept
+    {
+        constexpr bsl::safe_uint64 mask{bsl::to_u64(7)};
+
+        bsl::array<bsl::safe_uint64, 4> const sizes{
+            bsl::to_u64(3), bsl::to_u64(8), bsl::to_u64(5), bsl::to_u64(1)};
+        bsl::array<bsl::safe_uint64, 4> offsets{};
+
+        auto const ret{bsl::transform_exclusive_scan(
+            bsl::span<bsl::safe_uint64 const>{sizes.data(), sizes.size()},
+            bsl::span<bsl::safe_uint64>{offsets.data(), offsets.size()},
+            bsl::to_u64(0),
+            [&mask](bsl::safe_uint64 const &size) noexcept -> bsl::safe_uint64 {
+                return (size + mask) & ~mask;
+            })};
+
+        if (ret) {
+            for (bsl::safe_uintmax i{}; i < offsets.size(); ++i) {
+                bsl::print() << "offset [" << i << "] = " << *offsets.at_if(i) << bsl::endl;
+            }
+        }
+    }
+}
@@ -45,6 +45,9 @@
 #include "arguments/example_arguments_ostream.hpp"
 #include "arguments/example_arguments_pos.hpp"
 #include "arguments/example_arguments_size.hpp"
+#include "example_all_of_overview.hpp"
+#include "example_any_of_overview.hpp"
+#include "example_apply_overview.hpp"
 #include "example_array_overview.hpp"
 #include "array/example_array_at_if.hpp"
 #include "array/example_array_back_if.hpp"
@@ -67,6 +70,8 @@
 #include "array/example_array_size_bytes.hpp"
 #include "array/example_array_size.hpp"
 #include "example_as_const_overview.hpp"
+#include "example_base64_overview.hpp"
+#include "example_basic_addr_overview.hpp"
 #include "example_basic_errc_type_overview.hpp"
 #include "basic_errc_type/example_basic_errc_type_constructor_t.hpp"
 #include "basic_errc_type/example_basic_errc_type_default_constructor.hpp"
@@ -111,7 +116,9 @@
 #include "basic_string_view/example_basic_string_view_size.hpp"
 #include "basic_string_view/example_basic_string_view_starts_with.hpp"
 #include "basic_string_view/example_basic_string_view_substr.hpp"
+#include "example_bloom_filter_overview.hpp"
 #include "example_bool_constant_overview.hpp"
+#include "example_bounded_integral_overview.hpp"
 #include "example_byte_overview.hpp"
 #include "byte/example_byte_and_assign.hpp"
 #include "byte/example_byte_and.hpp"
@@ -177,6 +184,9 @@
 #include "debug/example_debug_debug.hpp"
 #include "debug/example_debug_error.hpp"
 #include "debug/example_debug_print.hpp"
+#include "example_convert_n_overview.hpp"
+#include "example_count_overview.hpp"
+#include "example_count_if_overview.hpp"
 #include "example_decay_overview.hpp"
 #include "example_declval_overview.hpp"
 #include "example_destroy_at_overview.hpp"
@@ -184,8 +194,12 @@
 #include "example_detected_overview.hpp"
 #include "example_discard_overview.hpp"
 #include "example_disjunction_overview.hpp"
+#include "example_divider_overview.hpp"
 #include "example_enable_if_overview.hpp"
+#include "example_error_trace_overview.hpp"
+#include "example_event_loop_overview.hpp"
 #include "example_exchange_overview.hpp"
+#include "example_exclusive_scan_overview.hpp"
 #include "example_extent_overview.hpp"
 #include "example_false_type_overview.hpp"
 #include "example_fill_overview.hpp"
@@ -200,10 +214,18 @@
 #include "fmt/example_fmt_sign_aware.hpp"
 #include "fmt/example_fmt_sign.hpp"
 #include "fmt/example_fmt_width.hpp"
+#include "example_find_if_overview.hpp"
+#include "example_fixed_string_overview.hpp"
+#include "example_flight_recorder_overview.hpp"
 #include "example_for_each_overview.hpp"
 #include "example_forward_overview.hpp"
+#include "example_frame_pool_overview.hpp"
 #include "example_from_chars_overview.hpp"
 // #include "example_has_unique_object_representations_overview.hpp"
+#include "example_function_ref_overview.hpp"
+#if !BSL_PERFORCE && defined(__cpp_impl_coroutine)
+#include "example_generator_overview.hpp"
+#endif
 #include "example_has_virtual_destructor_overview.hpp"
 // #include "example_ifmap_overview.hpp"
 // #include "ifmap/example_ifmap_constructor.hpp"
@@ -214,14 +236,18 @@
 // #include "ifmap/example_ifmap_operator_bool.hpp"
 // #include "ifmap/example_ifmap_size_bytes.hpp"
 // #include "ifmap/example_ifmap_size.hpp"
+#include "example_hex_overview.hpp"
 #include "example_in_place_overview.hpp"
 // #include "example_integer_sequence_overview.hpp"
 // #include "integer_sequence/example_integer_sequence_max.hpp"
 // #include "integer_sequence/example_integer_sequence_min.hpp"
 // #include "integer_sequence/example_integer_sequence_size.hpp"
+#include "example_inclusive_scan_overview.hpp"
 #include "example_integral_constant_overview.hpp"
+#include "example_intern_table_overview.hpp"
 #include "example_invoke_result_overview.hpp"
 #include "example_invoke_overview.hpp"
+#include "example_iota_overview.hpp"
 #include "example_is_abstract_overview.hpp"
 // #include "example_is_aggregate_overview.hpp"
 #include "example_is_arithmetic_overview.hpp"
@@ -301,28 +327,43 @@
 #include "example_is_unbounded_array_overview.hpp"
 #include "example_is_unsigned_overview.hpp"
 #include "example_is_void_overview.hpp"
+#include "example_k_way_merge_overview.hpp"
 #include "example_lock_guard_overview.hpp"
 #include "lock_guard/example_lock_guard_constructor_adopt.hpp"
 #include "lock_guard/example_lock_guard_constructor_lck.hpp"
+#include "example_lz4_overview.hpp"
 #include "example_make_signed_overview.hpp"
 #include "example_make_unsigned_overview.hpp"
 #include "example_max_align_t_overview.hpp"
+#include "example_max_element_overview.hpp"
+#include "example_mdspan_overview.hpp"
+#include "example_merge_overview.hpp"
+#include "example_min_element_overview.hpp"
+#include "example_minmax_element_overview.hpp"
 #include "example_move_if_noexcept_overview.hpp"
 #include "example_move_overview.hpp"
 #include "example_negation_overview.hpp"
+#include "example_none_of_overview.hpp"
+#include "example_nth_element_overview.hpp"
 #include "example_numeric_limits_overview.hpp"
+#include "example_page_span_overview.hpp"
+#include "example_partial_sort_overview.hpp"
+#include "example_partial_sort_copy_overview.hpp"
+#include "example_partition_overview.hpp"
 #include "example_rank_overview.hpp"
 #include "example_reference_wrapper_overview.hpp"
 #include "reference_wrapper/example_reference_wrapper_constructor.hpp"
 #include "reference_wrapper/example_reference_wrapper_functor.hpp"
 #include "reference_wrapper/example_reference_wrapper_get.hpp"
 #include "reference_wrapper/example_reference_wrapper_ostream.hpp"
+#include "example_register_value_overview.hpp"
 #include "example_remove_all_extents_overview.hpp"
 #include "example_remove_const_overview.hpp"
 #include "example_remove_cv_overview.hpp"
 #include "example_remove_cvext_overview.hpp"
 #include "example_remove_cvref_overview.hpp"
 #include "example_remove_extent_overview.hpp"
+#include "example_remove_if_overview.hpp"
 #include "example_remove_pointer_overview.hpp"
 #include "example_remove_reference_overview.hpp"
 #include "example_result_overview.hpp"
@@ -343,6 +384,7 @@
 #include "result/example_result_t_copy_constructor.hpp"
 #include "result/example_result_t_in_place_constructor.hpp"
 #include "result/example_result_t_move_constructor.hpp"
+#include "example_reverse_overview.hpp"
 #include "example_reverse_iterator_overview.hpp"
 #include "reverse_iterator/example_reverse_iterator_data.hpp"
 #include "reverse_iterator/example_reverse_iterator_decrement.hpp"
@@ -360,6 +402,10 @@
 #include "reverse_iterator/example_reverse_iterator_operator_bool.hpp"
 #include "reverse_iterator/example_reverse_iterator_ostream.hpp"
 #include "reverse_iterator/example_reverse_iterator_size.hpp"
+#include "example_rotate_overview.hpp"
+#if !BSL_PERFORCE && defined(__cpp_impl_coroutine)
+#include "example_run_queue_overview.hpp"
+#endif
 #include "example_safe_integral_overview.hpp"
 #include "safe_integral/example_safe_integral_add.hpp"
 #include "safe_integral/example_safe_integral_and.hpp"
@@ -407,6 +453,9 @@
 #include "safe_integral/example_safe_integral_sub.hpp"
 #include "safe_integral/example_safe_integral_unary.hpp"
 #include "safe_integral/example_safe_integral_xor.hpp"
+#include "example_shift_left_overview.hpp"
+#include "example_shift_right_overview.hpp"
+#include "example_soa_array_overview.hpp"
 #include "example_source_location_overview.hpp"
 #include "source_location/example_source_location_current.hpp"
 #include "source_location/example_source_location_default_constructor.hpp"
@@ -417,6 +466,7 @@
 #include "source_location/example_source_location_ostream.hpp"
 #include "example_span_overview.hpp"
 #include "span/example_span_as_bytes.hpp"
+#include "span/example_span_as_span.hpp"
 #include "span/example_span_as_writable_bytes.hpp"
 #include "span/example_span_at_if.hpp"
 #include "span/example_span_back_if.hpp"
@@ -439,6 +489,7 @@
 #include "span/example_span_rend.hpp"
 #include "span/example_span_riter.hpp"
 #include "span/example_span_size_bytes.hpp"
+#include "span/example_span_static_extent.hpp"
 #include "span/example_span_size.hpp"
 #include "span/example_span_subspan.hpp"
 #include "example_spinlock_overview.hpp"
@@ -447,9 +498,19 @@
 #include "spinlock/example_spinlock_lock.hpp"
 #include "spinlock/example_spinlock_try_lock.hpp"
 #include "spinlock/example_spinlock_unlock.hpp"
+#include "example_stable_partition_overview.hpp"
+#include "example_strided_span_overview.hpp"
+#include "example_string_builder_overview.hpp"
 #include "example_swap_overview.hpp"
+#include "example_swap_ranges_overview.hpp"
+#if !BSL_PERFORCE && defined(__cpp_impl_coroutine)
+#include "example_task_overview.hpp"
+#endif
+#include "example_transform_exclusive_scan_overview.hpp"
 #include "example_true_type_overview.hpp"
+#include "example_tuple_overview.hpp"
 #include "example_underlying_type_overview.hpp"
+#include "example_unique_overview.hpp"
 #include "example_void_t_overview.hpp"
 
 namespace
@@ -502,6 +563,9 @@ main() noexcept
     example(&bsl::example_arguments_ostream, "example_arguments_ostream");
     example(&bsl::example_arguments_pos, "example_arguments_pos");
     example(&bsl::example_arguments_size, "example_arguments_size");
+    example(&bsl::example_all_of_overview, "example_all_of_overview");
+    example(&bsl::example_any_of_overview, "example_any_of_overview");
+    example(&bsl::example_apply_overview, "example_apply_overview");
     example(&bsl::example_array_overview, "example_array_overview");
     example(&bsl::example_array_at_if, "example_array_at_if");
     example(&bsl::example_array_back_if, "example_array_back_if");
@@ -524,6 +588,8 @@ main() noexcept
     example(&bsl::example_array_size_bytes, "example_array_size_bytes");
     example(&bsl::example_array_size, "example_array_size");
     example(&bsl::example_as_const_overview, "example_as_const_overview");
+    example(&bsl::example_base64_overview, "example_base64_overview");
+    example(&bsl::example_basic_addr_overview, "example_basic_addr_overview");
     example(&bsl::example_basic_errc_type_overview, "example_basic_errc_type_overview");
     example(&bsl::example_basic_errc_type_constructor_t, "example_basic_errc_type_constructor_t");
     example(&bsl::example_basic_errc_type_default_constructor, "example_basic_errc_type_default_constructor");
@@ -568,7 +634,9 @@ main() noexcept
     example(&bsl::example_basic_string_view_size, "example_basic_string_view_size");
     example(&bsl::example_basic_string_view_starts_with, "example_basic_string_view_starts_with");
     example(&bsl::example_basic_string_view_substr, "example_basic_string_view_substr");
+    example(&bsl::example_bloom_filter_overview, "example_bloom_filter_overview");
     example(&bsl::example_bool_constant_overview, "example_bool_constant_overview");
+    example(&bsl::example_bounded_integral_overview, "example_bounded_integral_overview");
     example(&bsl::example_byte_overview, "example_byte_overview");
     example(&bsl::example_byte_and_assign, "example_byte_and_assign");
     example(&bsl::example_byte_and, "example_byte_and");
@@ -634,6 +702,9 @@ main() noexcept
     example(&bsl::example_debug_debug, "example_debug_debug");
     example(&bsl::example_debug_error, "example_debug_error");
     example(&bsl::example_debug_print, "example_debug_print");
+    example(&bsl::example_convert_n_overview, "example_convert_n_overview");
+    example(&bsl::example_count_overview, "example_count_overview");
+    example(&bsl::example_count_if_overview, "example_count_if_overview");
     example(&bsl::example_decay_overview, "example_decay_overview");
     example(&bsl::example_declval_overview, "example_declval_overview");
     example(&bsl::example_destroy_at_overview, "example_destroy_at_overview");
@@ -641,8 +712,12 @@ main() noexcept
     example(&bsl::example_detected_overview, "example_detected_overview");
     example(&bsl::example_discard_overview, "example_discard_overview");
     example(&bsl::example_disjunction_overview, "example_disjunction_overview");
+    example(&bsl::example_divider_overview, "example_divider_overview");
     example(&bsl::example_enable_if_overview, "example_enable_if_overview");
+    example(&bsl::example_error_trace_overview, "example_error_trace_overview");
+    example(&bsl::example_event_loop_overview, "example_event_loop_overview");
     example(&bsl::example_exchange_overview, "example_exchange_overview");
+    example(&bsl::example_exclusive_scan_overview, "example_exclusive_scan_overview");
     example(&bsl::example_extent_overview, "example_extent_overview");
     example(&bsl::example_false_type_overview, "example_false_type_overview");
     example(&bsl::example_fill_overview, "example_fill_overview");
@@ -657,10 +732,18 @@ main() noexcept
     example(&bsl::example_fmt_sign_aware, "example_fmt_sign_aware");
     example(&bsl::example_fmt_sign, "example_fmt_sign");
     example(&bsl::example_fmt_width, "example_fmt_width");
+    example(&bsl::example_find_if_overview, "example_find_if_overview");
+    example(&bsl::example_fixed_string_overview, "example_fixed_string_overview");
+    example(&bsl::example_flight_recorder_overview, "example_flight_recorder_overview");
     example(&bsl::example_for_each_overview, "example_for_each_overview");
     example(&bsl::example_forward_overview, "example_forward_overview");
+    example(&bsl::example_frame_pool_overview, "example_frame_pool_overview");
     example(&bsl::example_from_chars_overview, "example_from_chars_overview");
     // example(&bsl::example_has_unique_object_representations_overview, "example_has_unique_object_representations_overview");
+    example(&bsl::example_function_ref_overview, "example_function_ref_overview");
+#if !BSL_PERFORCE && defined(__cpp_impl_coroutine)
+    example(&bsl::example_generator_overview, "example_generator_overview");
+#endif
     example(&bsl::example_has_virtual_destructor_overview, "example_has_virtual_destructor_overview");
     // example(&bsl::example_ifmap_overview, "example_ifmap_overview");
     // example(&bsl::example_ifmap_constructor, "example_ifmap_constructor");
@@ -671,14 +754,18 @@ main() noexcept
     // example(&bsl::example_ifmap_operator_bool, "example_ifmap_operator_bool");
     // example(&bsl::example_ifmap_size_bytes, "example_ifmap_size_bytes");
     // example(&bsl::example_ifmap_size, "example_ifmap_size");
+    example(&bsl::example_hex_overview, "example_hex_overview");
     example(&bsl::example_in_place_overview, "example_in_place_overview");
     // // example(&bsl::example_integer_sequence_overview, "example_integer_sequence_overview");
     // // example(&bsl::example_integer_sequence_max, "example_integer_sequence_max");
     // // example(&bsl::example_integer_sequence_min, "example_integer_sequence_min");
     // // example(&bsl::example_integer_sequence_size, "example_integer_sequence_size");
+    example(&bsl::example_inclusive_scan_overview, "example_inclusive_scan_overview");
     example(&bsl::example_integral_constant_overview, "example_integral_constant_overview");
+    example(&bsl::example_intern_table_overview, "example_intern_table_overview");
     example(&bsl::example_invoke_result_overview, "example_invoke_result_overview");
     example(&bsl::example_invoke_overview, "example_invoke_overview");
+    example(&bsl::example_iota_overview, "example_iota_overview");
     example(&bsl::example_is_abstract_overview, "example_is_abstract_overview");
     // example(&bsl::example_is_aggregate_overview, "example_is_aggregate_overview");
     example(&bsl::example_is_arithmetic_overview, "example_is_arithmetic_overview");
@@ -758,28 +845,43 @@ main() noexcept
     example(&bsl::example_is_unbounded_array_overview, "example_is_unbounded_array_overview");
     example(&bsl::example_is_unsigned_overview, "example_is_unsigned_overview");
     example(&bsl::example_is_void_overview, "example_is_void_overview");
+    example(&bsl::example_k_way_merge_overview, "example_k_way_merge_overview");
     example(&bsl::example_lock_guard_overview, "example_lock_guard_overview");
     example(&bsl::example_lock_guard_constructor_adopt, "example_lock_guard_constructor_adopt");
     example(&bsl::example_lock_guard_constructor_lck, "example_lock_guard_constructor_lck");
+    example(&bsl::example_lz4_overview, "example_lz4_overview");
     example(&bsl::example_make_signed_overview, "example_make_signed_overview");
     example(&bsl::example_make_unsigned_overview, "example_make_unsigned_overview");
     example(&bsl::example_max_align_t_overview, "example_max_align_t_overview");
+    example(&bsl::example_max_element_overview, "example_max_element_overview");
+    example(&bsl::example_mdspan_overview, "example_mdspan_overview");
+    example(&bsl::example_merge_overview, "example_merge_overview");
+    example(&bsl::example_min_element_overview, "example_min_element_overview");
+    example(&bsl::example_minmax_element_overview, "example_minmax_element_overview");
     example(&bsl::example_move_if_noexcept_overview, "example_move_if_noexcept_overview");
     example(&bsl::example_move_overview, "example_move_overview");
     example(&bsl::example_negation_overview, "example_negation_overview");
+    example(&bsl::example_none_of_overview, "example_none_of_overview");
+    example(&bsl::example_nth_element_overview, "example_nth_element_overview");
     example(&bsl::example_numeric_limits_overview, "example_numeric_limits_overview");
+    example(&bsl::example_page_span_overview, "example_page_span_overview");
+    example(&bsl::example_partial_sort_overview, "example_partial_sort_overview");
+    example(&bsl::example_partial_sort_copy_overview, "example_partial_sort_copy_overview");
+    example(&bsl::example_partition_overview, "example_partition_overview");
     example(&bsl::example_rank_overview, "example_rank_overview");
     example(&bsl::example_reference_wrapper_overview, "example_reference_wrapper_overview");
     example(&bsl::example_reference_wrapper_constructor, "example_reference_wrapper_constructor");
     example(&bsl::example_reference_wrapper_functor, "example_reference_wrapper_functor");
     example(&bsl::example_reference_wrapper_get, "example_reference_wrapper_get");
     example(&bsl::example_reference_wrapper_ostream, "example_reference_wrapper_ostream");
+    example(&bsl::example_register_value_overview, "example_register_value_overview");
     example(&bsl::example_remove_all_extents_overview, "example_remove_all_extents_overview");
     example(&bsl::example_remove_const_overview, "example_remove_const_overview");
     example(&bsl::example_remove_cv_overview, "example_remove_cv_overview");
     example(&bsl::example_remove_cvext_overview, "example_remove_cvext_overview");
     example(&bsl::example_remove_cvref_overview, "example_remove_cvref_overview");
     example(&bsl::example_remove_extent_overview, "example_remove_extent_overview");
+    example(&bsl::example_remove_if_overview, "example_remove_if_overview");
     example(&bsl::example_remove_pointer_overview, "example_remove_pointer_overview");
     example(&bsl::example_remove_reference_overview, "example_remove_reference_overview");
     example(&bsl::example_result_overview, "example_result_overview");
@@ -800,6 +902,7 @@ main() noexcept
     example(&bsl::example_result_t_copy_constructor, "example_result_t_copy_constructor");
     example(&bsl::example_result_t_in_place_constructor, "example_result_t_in_place_constructor");
     example(&bsl::example_result_t_move_constructor, "example_result_t_move_constructor");
+    example(&bsl::example_reverse_overview, "example_reverse_overview");
     example(&bsl::example_reverse_iterator_overview, "example_reverse_iterator_overview");
     example(&bsl::example_reverse_iterator_data, "example_reverse_iterator_data");
     example(&bsl::example_reverse_iterator_decrement, "example_reverse_iterator_decrement");
@@ -817,6 +920,10 @@ main() noexcept
     example(&bsl::example_reverse_iterator_operator_bool, "example_reverse_iterator_operator_bool");
     example(&bsl::example_reverse_iterator_ostream, "example_reverse_iterator_ostream");
     example(&bsl::example_reverse_iterator_size, "example_reverse_iterator_size");
+    example(&bsl::example_rotate_overview, "example_rotate_overview");
+#if !BSL_PERFORCE && defined(__cpp_impl_coroutine)
+    example(&bsl::example_run_queue_overview, "example_run_queue_overview");
+#endif
     example(&bsl::example_safe_integral_overview, "example_safe_integral_overview");
     example(&bsl::example_safe_integral_add, "example_safe_integral_add");
     example(&bsl::example_safe_integral_and, "example_safe_integral_and");
@@ -864,6 +971,9 @@ main() noexcept
     example(&bsl::example_safe_integral_sub, "example_safe_integral_sub");
     example(&bsl::example_safe_integral_unary, "example_safe_integral_unary");
     example(&bsl::example_safe_integral_xor, "example_safe_integral_xor");
+    example(&bsl::example_shift_left_overview, "example_shift_left_overview");
+    example(&bsl::example_shift_right_overview, "example_shift_right_overview");
+    example(&bsl::example_soa_array_overview, "example_soa_array_overview");
     example(&bsl::example_source_location_overview, "example_source_location_overview");
     example(&bsl::example_source_location_current, "example_source_location_current");
     example(&bsl::example_source_location_default_constructor, "example_source_location_default_constructor");
@@ -874,6 +984,7 @@ main() noexcept
     example(&bsl::example_source_location_ostream, "example_source_location_ostream");
     example(&bsl::example_span_overview, "example_span_overview");
     example(&bsl::example_span_as_bytes, "example_span_as_bytes");
+    example(&bsl::example_span_as_span, "example_span_as_span");
     example(&bsl::example_span_as_writable_bytes, "example_span_as_writable_bytes");
     example(&bsl::example_span_at_if, "example_span_at_if");
     example(&bsl::example_span_back_if, "example_span_back_if");
@@ -896,6 +1007,7 @@ main() noexcept
     example(&bsl::example_span_rend, "example_span_rend");
     example(&bsl::example_span_riter, "example_span_riter");
     example(&bsl::example_span_size_bytes, "example_span_size_bytes");
+    example(&bsl::example_span_static_extent, "example_span_static_extent");
     example(&bsl::example_span_size, "example_span_size");
     example(&bsl::example_span_subspan, "example_span_subspan");
     example(&bsl::example_spinlock_overview, "example_spinlock_overview");
@@ -904,9 +1016,19 @@ main() noexcept
     example(&bsl::example_spinlock_lock, "example_spinlock_lock");
     example(&bsl::example_spinlock_try_lock, "example_spinlock_try_lock");
     example(&bsl::example_spinlock_unlock, "example_spinlock_unlock");
+    example(&bsl::example_stable_partition_overview, "example_stable_partition_overview");
+    example(&bsl::example_strided_span_overview, "example_strided_span_overview");
+    example(&bsl::example_string_builder_overview, "example_string_builder_overview");
     example(&bsl::example_swap_overview, "example_swap_overview");
+    example(&bsl::example_swap_ranges_overview, "example_swap_ranges_overview");
+#if !BSL_PERFORCE && defined(__cpp_impl_coroutine)
+    example(&bsl::example_task_overview, "example_task_overview");
+#endif
+    example(&bsl::example_transform_exclusive_scan_overview, "example_transform_exclusive_scan_overview");
     example(&bsl::example_true_type_overview, "example_true_type_overview");
+    example(&bsl::example_tuple_overview, "example_tuple_overview");
     example(&bsl::example_underlying_type_overview, "example_underlying_type_overview");
+    example(&bsl::example_unique_overview, "example_unique_overview");
     example(&bsl::example_void_t_overview, "example_void_t_overview");
 
     return bsl::exit_success;
@@ -0,0 +1,66 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+///
+/// @file any_of.hpp
+///
+
+#ifndef BSL_ANY_OF_HPP
+#define BSL_ANY_OF_HPP
+
+#include "details/reduce_impl.hpp"
+#include "details/value_type_for.hpp"
+
+#include "is_nothrow_invocable.hpp"
+#include "remove_const.hpp"
+
+namespace bsl
+{
+    /// <!-- description -->
+    ///   @brief Returns true if "pred" returns true for at least one
+    ///     element in a view. The search stops at the end of the first
+    ///     block of elements that contains a match.
+    ///   @include example_any_of_overview.hpp
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @tparam VIEW the type of view to search
+    ///   @tparam PRED the type of predicate to use
+    ///   @param vw the view to search
+    ///   @param pred the predicate to use
+    ///   @return Returns true if "pred" returns true for at least one
+    ///     element in "vw". Returns false if "vw" is empty.
+    ///
+    template<typename VIEW, typename PRED>
+    [[nodiscard]] constexpr bool
+    any_of(VIEW const &vw, PRED &&pred) noexcept
+    {
+        using value_type = remove_const_t<details::value_type_for<VIEW>>;
+        static_assert(
+            is_nothrow_invocable<PRED, value_type const &>::value, "pred must be noexcept");
+
+        bsl::uintmax const num{vw.size().get()};
+        return details::reduce_find_if<value_type>(vw.data(), num, pred) != num;
+    }
+}
+
+#endif
@@ -0,0 +1,102 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+///
+/// @file apply.hpp
+///
+
+#ifndef BSL_APPLY_HPP
+#define BSL_APPLY_HPP
+
+#include "cstdint.hpp"
+#include "discard.hpp"
+#include "forward.hpp"
+#include "integer_sequence.hpp"
+#include "invoke.hpp"
+#include "remove_cvref.hpp"
+#include "tuple.hpp"
+#include "tuple_size.hpp"
+
+namespace bsl
+{
+    namespace details
+    {
+        /// <!-- description -->
+        ///   @brief Implements bsl::apply. The index sequence is used to
+        ///     expand the elements of the tuple into the argument list.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @tparam FUNC the type of function to invoke
+        ///   @tparam TUPLE the type of tuple that provides the arguments
+        ///   @tparam I the index of each element in the tuple
+        ///   @param f the function to invoke
+        ///   @param t the tuple that provides the arguments
+        ///   @param seq the indexes of the elements in the tuple
+        ///   @return Returns the result of invoking f
+        ///
+        template<typename FUNC, typename TUPLE, bsl::uintmax... I>
+        constexpr auto
+        apply_impl(FUNC &&f, TUPLE &&t, index_sequence<I...> const &seq) noexcept(    // --
+            noexcept(bsl::invoke(
+                bsl::forward<FUNC>(f), bsl::forward<TUPLE>(t).template get<I>()...)))
+            -> decltype(bsl::invoke(
+                bsl::forward<FUNC>(f), bsl::forward<TUPLE>(t).template get<I>()...))
+        {
+            bsl::discard(seq);
+            return bsl::invoke(bsl::forward<FUNC>(f), bsl::forward<TUPLE>(t).template get<I>()...);
+        }
+    }
+
+    /// <!-- description -->
+    ///   @brief Invokes "f" using the elements of "t" as its arguments,
+    ///     (i.e., bsl::apply(f, bsl::tuple{a, b}) is the same as
+    ///     bsl::invoke(f, a, b)).
+    ///   @include example_apply_overview.hpp
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @tparam FUNC the type of function to invoke
+    ///   @tparam TUPLE the type of bsl::tuple that provides the arguments
+    ///   @param f the function to invoke
+    ///   @param t the tuple that provides the arguments
+    ///   @return Returns the result of invoking f
+    ///
+    template<typename FUNC, typename TUPLE>
+    constexpr auto
+    apply(FUNC &&f, TUPLE &&t) noexcept(    // --
+        noexcept(details::apply_impl(
+            bsl::forward<FUNC>(f),
+            bsl::forward<TUPLE>(t),
+            make_index_sequence<tuple_size<remove_cvref_t<TUPLE>>::value>{})))
+        -> decltype(details::apply_impl(
+            bsl::forward<FUNC>(f),
+            bsl::forward<TUPLE>(t),
+            make_index_sequence<tuple_size<remove_cvref_t<TUPLE>>::value>{}))
+    {
+        return details::apply_impl(
+            bsl::forward<FUNC>(f),
+            bsl::forward<TUPLE>(t),
+            make_index_sequence<tuple_size<remove_cvref_t<TUPLE>>::value>{});
+    }
+}
+
+#endif
@@ -28,6 +28,7 @@
 #ifndef BSL_ARRAY_HPP
 #define BSL_ARRAY_HPP
 
+#include "bounded_integral.hpp"
 #include "contiguous_iterator.hpp"
 #include "convert.hpp"
 #include "cstdint.hpp"
@@ -142,6 +143,50 @@ namespace bsl
             return &m_data[index.get()];    // NOLINT
         }
 
+        /// <!-- description -->
+        ///   @brief Returns a pointer to the instance of T stored at index
+        ///     "index". The range of "index" is known to be inside of the
+        ///     array at compile-time, so no bounds check is performed and
+        ///     this function never returns a nullptr.
+        ///   @include example_bounded_integral_overview.hpp
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @tparam LO the lower bound of "index"
+        ///   @tparam HI the upper bound of "index"
+        ///   @param index the index of the instance to return
+        ///   @return Returns a pointer to the instance of T stored at index
+        ///     "index".
+        ///
+        template<bsl::uintmax LO, bsl::uintmax HI>
+        [[nodiscard]] constexpr pointer_type
+        at_if(bounded_integral<bsl::uintmax, LO, HI> const &index) noexcept
+        {
+            static_assert(HI < N, "index range exceeds the size of the array");
+            return &m_data[index.get()];    // PRQA S 4024 // NOLINT
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns a pointer to the instance of T stored at index
+        ///     "index". The range of "index" is known to be inside of the
+        ///     array at compile-time, so no bounds check is performed and
+        ///     this function never returns a nullptr.
+        ///   @include example_bounded_integral_overview.hpp
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @tparam LO the lower bound of "index"
+        ///   @tparam HI the upper bound of "index"
+        ///   @param index the index of the instance to return
+        ///   @return Returns a pointer to the instance of T stored at index
+        ///     "index".
+        ///
+        template<bsl::uintmax LO, bsl::uintmax HI>
+        [[nodiscard]] constexpr const_pointer_type
+        at_if(bounded_integral<bsl::uintmax, LO, HI> const &index) const noexcept
+        {
+            static_assert(HI < N, "index range exceeds the size of the array");
+            return &m_data[index.get()];    // NOLINT
+        }
+
         /// <!-- description -->
         ///   @brief Returns a reference to the first element in the array.
         ///   @include array/example_array_front.hpp
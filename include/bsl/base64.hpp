@@ -0,0 +1,232 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+///
+/// @file base64.hpp
+///
+
+#ifndef BSL_BASE64_HPP
+#define BSL_BASE64_HPP
+
+#include "details/base64_impl.hpp"
+
+#include "array.hpp"
+#include "byte.hpp"
+#include "char_type.hpp"
+#include "convert.hpp"
+#include "debug.hpp"
+#include "discard.hpp"
+#include "errc_type.hpp"
+#include "fixed_string.hpp"
+#include "result.hpp"
+#include "safe_integral.hpp"
+#include "span.hpp"
+#include "string_view.hpp"
+
+namespace bsl
+{
+    /// <!-- description -->
+    ///   @brief Returns the number of characters that bsl::base64_encode
+    ///     produces for "size" bytes of input (including padding).
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param size the number of bytes to be encoded
+    ///   @return Returns the number of characters that bsl::base64_encode
+    ///     produces for "size" bytes of input.
+    ///
+    [[nodiscard]] constexpr safe_uintmax
+    base64_encoded_size(safe_uintmax const &size) noexcept
+    {
+        constexpr safe_uintmax three{to_umax(3)};
+        constexpr safe_uintmax four{to_umax(4)};
+
+        return ((size + three - safe_uintmax::one()) / three) * four;
+    }
+
+    /// <!-- description -->
+    ///   @brief Returns the largest number of bytes that
+    ///     bsl::base64_decode produces for "size" characters of input.
+    ///     The actual number is smaller by one for each '=' of padding.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param size the number of characters to be decoded
+    ///   @return Returns the largest number of bytes that
+    ///     bsl::base64_decode produces for "size" characters of input.
+    ///
+    [[nodiscard]] constexpr safe_uintmax
+    base64_decoded_size(safe_uintmax const &size) noexcept
+    {
+        constexpr safe_uintmax three{to_umax(3)};
+        constexpr safe_uintmax four{to_umax(4)};
+
+        return (size / four) * three;
+    }
+
+    /// <!-- description -->
+    ///   @brief Appends src to dst as padded base64 (RFC 4648, standard
+    ///     alphabet, no line breaks). The remaining capacity of dst is
+    ///     checked up front, so either all of the characters are
+    ///     appended, or dst is left unchanged.
+    ///   @include example_base64_overview.hpp
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @tparam N the capacity of dst
+    ///   @param src the bytes to encode
+    ///   @param dst the string to append the characters to
+    ///   @return Returns the number of characters appended to dst, or
+    ///     bsl::errc_failure if dst does not have enough room.
+    ///
+    template<bsl::uintmax N>
+    [[nodiscard]] constexpr result<safe_uintmax>
+    base64_encode(span<byte const> const &src, fixed_string<N> &dst) noexcept
+    {
+        constexpr bsl::uintmax chunk{48U};
+        constexpr bsl::uintmax chunk_chars{64U};
+
+        safe_uintmax const size{base64_encoded_size(src.size())};
+        if ((fixed_string<N>::max_size() - dst.size()) < size) {
+            bsl::error() << "base64: dst is too small\n";
+            return {errc_failure};
+        }
+
+        /// NOTE:
+        /// - fixed_string does not expose its storage, so the characters
+        ///   are staged on the stack and appended one chunk at a time.
+        ///   The chunk is a multiple of 3 bytes, so only the last chunk
+        ///   can be padded.
+        ///
+
+        bsl::array<char_type, chunk_chars> buf{};
+        for (safe_uintmax i{}; i < src.size(); i += to_umax(chunk)) {
+            safe_uintmax const count{(src.size() - i).min(to_umax(chunk))};
+
+            details::base64_encode(
+                reinterpret_cast<bsl::uint8 const *>(src.at_if(i)),    // NOLINT
+                count.get(),
+                buf.data());
+
+            bsl::discard(dst.append(buf.data(), base64_encoded_size(count)));
+        }
+
+        return {size};
+    }
+
+    /// <!-- description -->
+    ///   @brief Decodes the padded base64 (RFC 4648, standard alphabet)
+    ///     in src into dst. Decoding is strict: the length must be a
+    ///     multiple of 4, '=' may only appear as padding at the end, the
+    ///     unused bits of the last quantum must be zero, and whitespace
+    ///     is rejected. If src is invalid, the contents of dst are
+    ///     unspecified.
+    ///   @include example_base64_overview.hpp
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param src the characters to decode
+    ///   @param dst the buffer to decode to
+    ///   @return Returns the number of bytes written to dst,
+    ///     bsl::errc_invalid_argument if src is not valid base64, or
+    ///     bsl::errc_failure if dst is too small.
+    ///
+    [[nodiscard]] inline result<safe_uintmax>
+    base64_decode(string_view const &src, span<byte> dst) noexcept
+    {
+        constexpr safe_uintmax four{to_umax(4)};
+        constexpr bsl::uint32 byte_mask{0xFFU};
+        constexpr bsl::uint32 two_byte_mask{0xFFFFU};
+
+        if ((src.size() % four).is_pos()) {
+            bsl::error() << "base64: length is not a multiple of 4\n";
+            return {errc_invalid_argument};
+        }
+
+        if (src.empty()) {
+            return {safe_uintmax::zero()};
+        }
+
+        safe_uintmax pad{};
+        if (details::base64_pad == *src.back_if()) {
+            ++pad;
+            if (details::base64_pad == *src.at_if(src.size() - to_umax(2))) {
+                ++pad;
+            }
+        }
+
+        safe_uintmax const size{base64_decoded_size(src.size()) - pad};
+        if (dst.size() < size) {
+            bsl::error() << "base64: dst is too small\n";
+            return {errc_failure};
+        }
+
+        safe_uintmax quantums{src.size() / four};
+        if (pad.is_pos()) {
+            --quantums;
+        }
+
+        bool valid{details::base64_decode(
+            src.data(),
+            quantums.get(),
+            reinterpret_cast<bsl::uint8 *>(dst.data()))};    // NOLINT
+
+        if (pad.is_pos()) {
+            bsl::array<char_type, 4> last{};
+            for (safe_uintmax i{}; i < last.size(); ++i) {
+                *last.at_if(i) = *src.at_if((quantums * four) + i);
+            }
+
+            /// NOTE:
+            /// - Only the padding is replaced with a valid character, so
+            ///   a '=' anywhere else is still rejected by the table.
+            ///
+
+            *last.back_if() = 'A';
+            if (to_umax(2) == pad) {
+                *last.at_if(to_umax(2)) = 'A';
+            }
+
+            bsl::uint8 bad{};
+            bsl::uint32 const val{details::base64_decode4(last.data(), bad)};
+            valid = valid && (0U == (bad & details::base64_bad_mask));
+
+            safe_uintmax const tail{quantums * to_umax(3)};
+            *dst.at_if(tail) = byte{static_cast<bsl::uint8>(val >> 16U)};
+
+            if (to_umax(2) == pad) {
+                valid = valid && (0U == (val & two_byte_mask));
+            }
+            else {
+                valid = valid && (0U == (val & byte_mask));
+                auto const second{static_cast<bsl::uint8>((val >> 8U) & byte_mask)};
+                *dst.at_if(tail + safe_uintmax::one()) = byte{second};
+            }
+        }
+
+        if (!valid) {
+            bsl::error() << "base64: invalid encoding\n";
+            return {errc_invalid_argument};
+        }
+
+        return {size};
+    }
+}
+
+#endif
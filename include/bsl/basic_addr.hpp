@@ -0,0 +1,415 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+///
+/// @file basic_addr.hpp
+///
+
+#ifndef BSL_BASIC_ADDR_HPP
+#define BSL_BASIC_ADDR_HPP
+
+#include "debug.hpp"
+#include "page_index.hpp"
+#include "page_size.hpp"
+#include "safe_integral.hpp"
+
+namespace bsl
+{
+    /// @class bsl::basic_addr
+    ///
+    /// <!-- description -->
+    ///   @brief Stores an address of a specific kind (e.g., physical or
+    ///     virtual), given by TAG. Addresses of different kinds are
+    ///     different types, so adding, subtracting or comparing a physical
+    ///     address with a virtual address will not compile. Use
+    ///     bsl::phys_addr and bsl::virt_addr instead of this type directly.
+    ///   @include example_basic_addr_overview.hpp
+    ///
+    /// <!-- template parameters -->
+    ///   @tparam TAG the kind of address (e.g., details::phys_addr_tag)
+    ///
+    template<typename TAG>
+    class basic_addr final
+    {
+        /// @brief stores the address
+        safe_uintmax m_addr;
+
+    public:
+        /// @brief alias for: TAG
+        using tag_type = TAG;
+
+        /// <!-- description -->
+        ///   @brief Creates a bsl::basic_addr set to 0
+        ///   @include example_basic_addr_overview.hpp
+        ///
+        constexpr basic_addr() noexcept = default;
+
+        /// <!-- description -->
+        ///   @brief Creates a bsl::basic_addr given an address
+        ///   @include example_basic_addr_overview.hpp
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param addr the address to store
+        ///
+        explicit constexpr basic_addr(safe_uintmax const &addr) noexcept : m_addr{addr}
+        {}
+
+        /// <!-- description -->
+        ///   @brief Returns the address as a bsl::safe_uintmax
+        ///   @include example_basic_addr_overview.hpp
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Returns the address as a bsl::safe_uintmax
+        ///
+        [[nodiscard]] constexpr safe_uintmax
+        get() const noexcept
+        {
+            return m_addr;
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns true if the bsl::basic_addr is invalid (i.e.,
+        ///     it was the result of an overflow, underflow, etc...)
+        ///   @include example_basic_addr_overview.hpp
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Returns true if the bsl::basic_addr is invalid
+        ///
+        [[nodiscard]] constexpr bool
+        failure() const noexcept
+        {
+            return m_addr.failure();
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns *this += bytes
+        ///   @include example_basic_addr_overview.hpp
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param bytes the number of bytes to advance the address by
+        ///   @return Returns *this
+        ///
+        [[maybe_unused]] constexpr basic_addr &
+        operator+=(safe_uintmax const &bytes) noexcept
+        {
+            m_addr += bytes;
+            return *this;
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns *this -= bytes
+        ///   @include example_basic_addr_overview.hpp
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param bytes the number of bytes to move the address back by
+        ///   @return Returns *this
+        ///
+        [[maybe_unused]] constexpr basic_addr &
+        operator-=(safe_uintmax const &bytes) noexcept
+        {
+            m_addr -= bytes;
+            return *this;
+        }
+    };
+
+    /// <!-- description -->
+    ///   @brief Returns the address "bytes" bytes after "addr"
+    ///   @include example_basic_addr_overview.hpp
+    ///   @related bsl::basic_addr
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @tparam TAG the kind of address
+    ///   @param addr the address to start from
+    ///   @param bytes the number of bytes to advance the address by
+    ///   @return Returns the address "bytes" bytes after "addr"
+    ///
+    template<typename TAG>
+    [[nodiscard]] constexpr basic_addr<TAG>
+    operator+(basic_addr<TAG> const &addr, safe_uintmax const &bytes) noexcept
+    {
+        return basic_addr<TAG>{addr.get() + bytes};
+    }
+
+    /// <!-- description -->
+    ///   @brief Returns the address "bytes" bytes before "addr"
+    ///   @include example_basic_addr_overview.hpp
+    ///   @related bsl::basic_addr
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @tparam TAG the kind of address
+    ///   @param addr the address to start from
+    ///   @param bytes the number of bytes to move the address back by
+    ///   @return Returns the address "bytes" bytes before "addr"
+    ///
+    template<typename TAG>
+    [[nodiscard]] constexpr basic_addr<TAG>
+    operator-(basic_addr<TAG> const &addr, safe_uintmax const &bytes) noexcept
+    {
+        return basic_addr<TAG>{addr.get() - bytes};
+    }
+
+    /// <!-- description -->
+    ///   @brief Returns the number of bytes between two addresses of the
+    ///     same kind (i.e., lhs - rhs).
+    ///   @include example_basic_addr_overview.hpp
+    ///   @related bsl::basic_addr
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @tparam TAG the kind of address
+    ///   @param lhs the left hand side of the operator
+    ///   @param rhs the right hand side of the operator
+    ///   @return Returns the number of bytes between lhs and rhs
+    ///
+    template<typename TAG>
+    [[nodiscard]] constexpr safe_uintmax
+    operator-(basic_addr<TAG> const &lhs, basic_addr<TAG> const &rhs) noexcept
+    {
+        return lhs.get() - rhs.get();
+    }
+
+    /// <!-- description -->
+    ///   @brief Returns lhs.get() == rhs.get()
+    ///   @include example_basic_addr_overview.hpp
+    ///   @related bsl::basic_addr
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @tparam TAG the kind of address
+    ///   @param lhs the left hand side of the operator
+    ///   @param rhs the right hand side of the operator
+    ///   @return Returns lhs.get() == rhs.get()
+    ///
+    template<typename TAG>
+    [[nodiscard]] constexpr bool
+    operator==(basic_addr<TAG> const &lhs, basic_addr<TAG> const &rhs) noexcept
+    {
+        return lhs.get() == rhs.get();
+    }
+
+    /// <!-- description -->
+    ///   @brief Returns !(lhs == rhs)
+    ///   @include example_basic_addr_overview.hpp
+    ///   @related bsl::basic_addr
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @tparam TAG the kind of address
+    ///   @param lhs the left hand side of the operator
+    ///   @param rhs the right hand side of the operator
+    ///   @return Returns !(lhs == rhs)
+    ///
+    template<typename TAG>
+    [[nodiscard]] constexpr bool
+    operator!=(basic_addr<TAG> const &lhs, basic_addr<TAG> const &rhs) noexcept
+    {
+        return !(lhs == rhs);
+    }
+
+    /// <!-- description -->
+    ///   @brief Returns lhs.get() < rhs.get()
+    ///   @include example_basic_addr_overview.hpp
+    ///   @related bsl::basic_addr
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @tparam TAG the kind of address
+    ///   @param lhs the left hand side of the operator
+    ///   @param rhs the right hand side of the operator
+    ///   @return Returns lhs.get() < rhs.get()
+    ///
+    template<typename TAG>
+    [[nodiscard]] constexpr bool
+    operator<(basic_addr<TAG> const &lhs, basic_addr<TAG> const &rhs) noexcept
+    {
+        return lhs.get() < rhs.get();
+    }
+
+    /// <!-- description -->
+    ///   @brief Returns lhs.get() > rhs.get()
+    ///   @include example_basic_addr_overview.hpp
+    ///   @related bsl::basic_addr
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @tparam TAG the kind of address
+    ///   @param lhs the left hand side of the operator
+    ///   @param rhs the right hand side of the operator
+    ///   @return Returns lhs.get() > rhs.get()
+    ///
+    template<typename TAG>
+    [[nodiscard]] constexpr bool
+    operator>(basic_addr<TAG> const &lhs, basic_addr<TAG> const &rhs) noexcept
+    {
+        return lhs.get() > rhs.get();
+    }
+
+    /// <!-- description -->
+    ///   @brief Returns the bsl::page_index of the page that contains
+    ///     the provided address (i.e., addr >> page_shift).
+    ///   @include example_basic_addr_overview.hpp
+    ///   @related bsl::basic_addr
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @tparam TAG the kind of address
+    ///   @param addr the address to get the page of
+    ///   @return Returns the bsl::page_index of the page that contains addr
+    ///
+    template<typename TAG>
+    [[nodiscard]] constexpr page_index<TAG>
+    page_of(basic_addr<TAG> const &addr) noexcept
+    {
+        return page_index<TAG>{addr.get() >> page_shift};
+    }
+
+    /// <!-- description -->
+    ///   @brief Returns the offset of the provided address into the page
+    ///     that contains it (i.e., addr & page_mask).
+    ///   @include example_basic_addr_overview.hpp
+    ///   @related bsl::basic_addr
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @tparam TAG the kind of address
+    ///   @param addr the address to get the offset of
+    ///   @return Returns the offset of addr into the page that contains it
+    ///
+    template<typename TAG>
+    [[nodiscard]] constexpr safe_uintmax
+    offset_in_page(basic_addr<TAG> const &addr) noexcept
+    {
+        return addr.get() & page_mask;
+    }
+
+    /// <!-- description -->
+    ///   @brief Returns true if the provided address is page aligned.
+    ///     If the address is invalid, false is returned.
+    ///   @include example_basic_addr_overview.hpp
+    ///   @related bsl::basic_addr
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @tparam TAG the kind of address
+    ///   @param addr the address to check
+    ///   @return Returns true if the provided address is page aligned
+    ///
+    template<typename TAG>
+    [[nodiscard]] constexpr bool
+    is_page_aligned(basic_addr<TAG> const &addr) noexcept
+    {
+        return (!addr.failure()) && ((addr.get().get() & page_mask) == 0U);
+    }
+
+    /// <!-- description -->
+    ///   @brief Returns the provided address rounded down to the start of
+    ///     the page that contains it (i.e., addr & ~page_mask).
+    ///   @include example_basic_addr_overview.hpp
+    ///   @related bsl::basic_addr
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @tparam TAG the kind of address
+    ///   @param addr the address to align
+    ///   @return Returns addr rounded down to a page boundary
+    ///
+    template<typename TAG>
+    [[nodiscard]] constexpr basic_addr<TAG>
+    align_down(basic_addr<TAG> const &addr) noexcept
+    {
+        return basic_addr<TAG>{addr.get() & (~page_mask)};
+    }
+
+    /// <!-- description -->
+    ///   @brief Returns the provided address rounded up to the start of
+    ///     the next page, or addr if addr is already page aligned. If
+    ///     rounding up would overflow, the resulting address is invalid.
+    ///   @include example_basic_addr_overview.hpp
+    ///   @related bsl::basic_addr
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @tparam TAG the kind of address
+    ///   @param addr the address to align
+    ///   @return Returns addr rounded up to a page boundary
+    ///
+    template<typename TAG>
+    [[nodiscard]] constexpr basic_addr<TAG>
+    align_up(basic_addr<TAG> const &addr) noexcept
+    {
+        /// NOTE:
+        /// - The overflow check is folded into the error flag instead of
+        ///   being a branch, so the common case is an add and a mask.
+        ///
+
+        constexpr bsl::uintmax max_addr{safe_uintmax::max() - page_mask};
+        bsl::uintmax const val{addr.get().get()};
+        bool const err{addr.failure() || (val > max_addr)};
+
+        return basic_addr<TAG>{safe_uintmax{(val + page_mask) & (~page_mask), err}};
+    }
+
+    /// <!-- description -->
+    ///   @brief Returns the address of the start of the provided page
+    ///     (i.e., idx << page_shift). The address is of the same kind as
+    ///     the address the page came from. If the page is too large to be
+    ///     converted into an address, the resulting address is invalid.
+    ///   @include example_basic_addr_overview.hpp
+    ///   @related bsl::basic_addr
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @tparam TAG the kind of address
+    ///   @param idx the page to get the address of
+    ///   @return Returns the address of the start of the provided page
+    ///
+    template<typename TAG>
+    [[nodiscard]] constexpr basic_addr<TAG>
+    addr_of(page_index<TAG> const &idx) noexcept
+    {
+        constexpr bsl::uintmax max_idx{safe_uintmax::max() >> page_shift};
+        bsl::uintmax const val{idx.get().get()};
+        bool const err{idx.failure() || (val > max_idx)};
+
+        return basic_addr<TAG>{safe_uintmax{val << page_shift, err}};
+    }
+
+    /// <!-- description -->
+    ///   @brief Outputs the provided bsl::basic_addr to the provided
+    ///     output type in hex.
+    ///   @related bsl::basic_addr
+    ///   @include example_basic_addr_overview.hpp
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @tparam T the type of outputter provided
+    ///   @tparam TAG the kind of address
+    ///   @param o the instance of the outputter used to output the value.
+    ///   @param addr the bsl::basic_addr to output
+    ///   @return return o
+    ///
+    template<typename T, typename TAG>
+    [[maybe_unused]] constexpr out<T>
+    operator<<(out<T> const o, basic_addr<TAG> const &addr) noexcept
+    {
+        if constexpr (!o) {
+            return o;
+        }
+
+        if (addr.failure()) {
+            return o << addr.get();
+        }
+
+        return o << fmt{"#018x", addr.get()};
+    }
+}
+
+#endif
@@ -31,7 +31,9 @@
 #include "cstdint.hpp"
 #include "debug.hpp"
 #include "discard.hpp"
+#include "error_trace.hpp"
 #include "move.hpp"
+#include "site_table.hpp"
 #include "string_view.hpp"
 
 namespace bsl
@@ -71,14 +73,23 @@ namespace bsl
         constexpr basic_errc_type() noexcept = default;
 
         /// <!-- description -->
-        ///   @brief Value initialization constructor
+        ///   @brief Value initialization constructor. If the error code
+        ///     is a failure, it is recorded in the calling thread's
+        ///     bsl::error_trace.
         ///   @include basic_errc_type/example_basic_errc_type_constructor_t.hpp
         ///
         /// <!-- inputs/outputs -->
         ///   @param errc the error code to store
+        ///   @param site defaults to the site that created the error code
         ///
-        explicit constexpr basic_errc_type(value_type const &errc) noexcept : m_errc{errc}
-        {}
+        explicit constexpr basic_errc_type(
+            value_type const &errc, site_entry const &site = {}) noexcept
+            : m_errc{errc}
+        {
+            if (this->failure()) {
+                record_error(site, static_cast<bsl::int32>(errc));
+            }
+        }
 
         /// <!-- description -->
         ///   @brief Returns the integer value that represents the error code.
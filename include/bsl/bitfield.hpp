@@ -0,0 +1,178 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+///
+/// @file bitfield.hpp
+///
+
+#ifndef BSL_BITFIELD_HPP
+#define BSL_BITFIELD_HPP
+
+#include "climits.hpp"
+#include "cstdint.hpp"
+#include "is_unsigned.hpp"
+#include "numeric_limits.hpp"
+#include "safe_integral.hpp"
+
+namespace bsl
+{
+    /// @class bsl::bitfield
+    ///
+    /// <!-- description -->
+    ///   @brief Describes a field of WIDTH bits, starting at bit OFFSET, in
+    ///     the register REG. REG is a tag type that provides the type used
+    ///     to store the register as REG::value_type, which keeps the fields
+    ///     of one register (e.g., CR0) from being used with another (e.g.,
+    ///     CR4). The field's mask and shift are computed at compile time,
+    ///     and a field that does not fit in the register will not compile.
+    ///     Use a bsl::register_value to read and write fields.
+    ///   @include example_register_value_overview.hpp
+    ///
+    /// <!-- template parameters -->
+    ///   @tparam REG the register the field belongs to
+    ///   @tparam OFFSET the index of the field's first (lowest) bit
+    ///   @tparam WIDTH the number of bits in the field
+    ///
+    template<typename REG, bsl::uintmax OFFSET, bsl::uintmax WIDTH>
+    class bitfield final
+    {
+    public:
+        /// @brief alias for: REG
+        using register_type = REG;
+        /// @brief alias for: typename REG::value_type
+        using value_type = typename REG::value_type;
+
+    private:
+        /// @brief stores the number of bits in the register
+        static constexpr bsl::uintmax m_bits{
+            sizeof(value_type) * static_cast<bsl::uintmax>(CHAR_BIT)};
+
+        static_assert(is_unsigned<value_type>::value, "registers must be unsigned");
+        static_assert(WIDTH > 0U, "a field must have at least one bit");
+        static_assert(WIDTH <= m_bits, "the field is wider than its register");
+        static_assert(OFFSET <= (m_bits - WIDTH), "the field does not fit in its register");
+
+    public:
+        /// <!-- description -->
+        ///   @brief Returns the index of the field's first (lowest) bit
+        ///   @include example_register_value_overview.hpp
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Returns the index of the field's first (lowest) bit
+        ///
+        [[nodiscard]] static constexpr bsl::uintmax
+        offset() noexcept
+        {
+            return OFFSET;
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns the number of bits in the field
+        ///   @include example_register_value_overview.hpp
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Returns the number of bits in the field
+        ///
+        [[nodiscard]] static constexpr bsl::uintmax
+        width() noexcept
+        {
+            return WIDTH;
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns the largest value the field can store
+        ///   @include example_register_value_overview.hpp
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Returns the largest value the field can store
+        ///
+        [[nodiscard]] static constexpr value_type
+        max() noexcept
+        {
+            constexpr value_type all{numeric_limits<value_type>::max()};
+            return static_cast<value_type>(all >> (m_bits - WIDTH));
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns the bits of the register that the field uses
+        ///   @include example_register_value_overview.hpp
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Returns the bits of the register that the field uses
+        ///
+        [[nodiscard]] static constexpr value_type
+        mask() noexcept
+        {
+            return static_cast<value_type>(max() << OFFSET);
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns the value of the field in the provided register
+        ///     value. If reg is invalid, the result is invalid.
+        ///   @include example_register_value_overview.hpp
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param reg the register value to extract the field from
+        ///   @return Returns the value of the field in reg
+        ///
+        [[nodiscard]] static constexpr safe_integral<value_type>
+        get(safe_integral<value_type> const &reg) noexcept
+        {
+            value_type const val{static_cast<value_type>((reg.get() & mask()) >> OFFSET)};
+            return safe_integral<value_type>{val, reg.failure()};
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns val shifted into the field's position in the
+        ///     register. Bits of val that do not fit in the field are
+        ///     dropped, so callers should check fits() first.
+        ///   @include example_register_value_overview.hpp
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param val the value to shift into place
+        ///   @return Returns val shifted into the field's position
+        ///
+        [[nodiscard]] static constexpr value_type
+        to_bits(safe_integral<value_type> const &val) noexcept
+        {
+            return static_cast<value_type>(static_cast<value_type>(val.get() << OFFSET) & mask());
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns true if val can be stored in the field (i.e.,
+        ///     val is valid and val <= max()).
+        ///   @include example_register_value_overview.hpp
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param val the value to check
+        ///   @return Returns true if val can be stored in the field
+        ///
+        [[nodiscard]] static constexpr bool
+        fits(safe_integral<value_type> const &val) noexcept
+        {
+            return (!val.failure()) && (val.get() <= max());
+        }
+    };
+}
+
+#endif
@@ -0,0 +1,431 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+///
+/// @file bloom_filter.hpp
+///
+
+#ifndef BSL_BLOOM_FILTER_HPP
+#define BSL_BLOOM_FILTER_HPP
+
+#include "array.hpp"
+#include "byte.hpp"
+#include "convert.hpp"
+#include "cstdint.hpp"
+#include "debug.hpp"
+#include "errc_type.hpp"
+#include "result.hpp"
+#include "safe_integral.hpp"
+#include "span.hpp"
+
+namespace bsl
+{
+    /// @class bsl::bloom_filter
+    ///
+    /// <!-- description -->
+    ///   @brief A cache line blocked Bloom filter. Every key is mapped to
+    ///     a single 64 byte block, and all K of the key's bits are set (or
+    ///     tested) inside of that block, so a query touches exactly one
+    ///     cache line no matter how large the filter is. The K bit
+    ///     positions are first gathered into a block sized mask, which is
+    ///     then compared against the block one 64bit word at a time with
+    ///     no branches (a loop the compiler can vectorize), and a negative
+    ///     query (the common case for a pre-filter) costs the same as a
+    ///     positive one.
+    ///
+    ///     Like all Bloom filters, contains() never returns a false
+    ///     negative, but it may return a false positive. The storage is
+    ///     inline, nothing is allocated, and the filter is not thread
+    ///     safe.
+    ///   @include example_bloom_filter_overview.hpp
+    ///
+    /// <!-- template parameters -->
+    ///   @tparam BITS the total number of bits in the filter, which must
+    ///     be a multiple of 512 (the number of bits in a cache line)
+    ///   @tparam K the number of bits that are set for each key
+    ///
+    template<bsl::uintmax BITS, bsl::uintmax K>
+    class bloom_filter final
+    {
+        /// @brief stores the number of bits in a 64bit word
+        static constexpr bsl::uintmax word_bits{64U};
+        /// @brief stores the number of bits in a block (a cache line)
+        static constexpr bsl::uintmax block_bits{512U};
+        /// @brief stores the number of 64bit words in a block
+        static constexpr bsl::uintmax block_words{block_bits / word_bits};
+        /// @brief stores the number of blocks in the filter
+        static constexpr bsl::uintmax num_blocks{BITS / block_bits};
+        /// @brief stores the number of 64bit words in the filter
+        static constexpr bsl::uintmax num_words{BITS / word_bits};
+
+        static_assert(BITS != 0, "bloom_filters of size 0 are not supported");
+        static_assert(BITS % block_bits == 0, "BITS must be a multiple of 512");
+        static_assert(num_blocks <= 0xFFFFFFFFU, "the number of blocks must fit in 32 bits");
+        static_assert(K != 0, "K must be at least 1");
+        static_assert(K <= 16U, "K must be at most 16");
+
+        /// @brief stores the filter's bits, aligned to a cache line
+        alignas(64) array<bsl::uint64, num_words> m_words{};
+
+        /// <!-- description -->
+        ///   @brief Returns a well mixed 64bit hash of key (the MurmurHash3
+        ///     finalizer), so that keys that are sequential (like frame
+        ///     numbers) are spread evenly across the filter.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param key the key to mix
+        ///   @return Returns a well mixed 64bit hash of key
+        ///
+        [[nodiscard]] static constexpr bsl::uint64
+        mix(bsl::uint64 const key) noexcept
+        {
+            constexpr bsl::uint64 mul1{0xFF51AFD7ED558CCDU};
+            constexpr bsl::uint64 mul2{0xC4CEB9FE1A85EC53U};
+            constexpr bsl::uint64 shift{33U};
+
+            bsl::uint64 h{key};
+            h ^= h >> shift;
+            h *= mul1;
+            h ^= h >> shift;
+            h *= mul2;
+            h ^= h >> shift;
+
+            return h;
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns the 64bit FNV-1a hash of the provided bytes.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param key the bytes to hash
+        ///   @return Returns the 64bit FNV-1a hash of the provided bytes.
+        ///
+        [[nodiscard]] static constexpr bsl::uint64
+        hash(span<byte const> const &key) noexcept
+        {
+            constexpr bsl::uint64 basis{0xCBF29CE484222325U};
+            constexpr bsl::uint64 prime{0x00000100000001B3U};
+
+            bsl::uint64 h{basis};
+            for (safe_uintmax i{}; i < key.size(); ++i) {
+                h ^= key.at_if(i)->template to_integer<bsl::uint64>();
+                h *= prime;
+            }
+
+            return h;
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns the index of the first word of the block that
+        ///     h maps to. The upper 32 bits of h are mapped onto the range
+        ///     [0, num_blocks) with a multiply and a shift, which (unlike
+        ///     a modulo) does not require the number of blocks to be a
+        ///     power of 2.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param h the (mixed) hash of the key
+        ///   @return Returns the index of the first word of h's block
+        ///
+        [[nodiscard]] static constexpr bsl::uintmax
+        block(bsl::uint64 const h) noexcept
+        {
+            constexpr bsl::uint64 shift{32U};
+            return static_cast<bsl::uintmax>(((h >> shift) * num_blocks) >> shift) * block_words;
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns the mask of the K bits that h sets inside of
+        ///     its block. Each probe multiplies the hash by an odd
+        ///     constant (a bijection) and uses the top 9 bits as the bit
+        ///     position, so all K positions come from a single hash. The
+        ///     sequence starts from h | 1, since mix(0) is 0 and a sequence
+        ///     that starts at 0 would set the same bit K times.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param h the (mixed) hash of the key
+        ///   @return Returns the mask of the K bits that h sets
+        ///
+        [[nodiscard]] static constexpr array<bsl::uint64, block_words>
+        probes(bsl::uint64 const h) noexcept
+        {
+            constexpr bsl::uint64 golden{0x9E3779B97F4A7C15U};
+            constexpr bsl::uint64 pos_shift{55U};
+            constexpr bsl::uint64 word_shift{6U};
+            constexpr bsl::uint64 bit_mask{0x3FU};
+
+            array<bsl::uint64, block_words> mask{};
+            bsl::uint64 x{h | static_cast<bsl::uint64>(1U)};
+
+            for (bsl::uintmax i{}; i < K; ++i) {
+                x *= golden;
+                bsl::uint64 const pos{x >> pos_shift};
+                bsl::uint64 const bit{static_cast<bsl::uint64>(1U) << (pos & bit_mask)};
+                *mask.at_if(to_umax(pos >> word_shift)) |= bit;
+            }
+
+            return mask;
+        }
+
+        /// <!-- description -->
+        ///   @brief Sets the bits of the provided hash
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param h the (mixed) hash of the key
+        ///
+        constexpr void
+        add_hash(bsl::uint64 const h) noexcept
+        {
+            bsl::uintmax const first{block(h)};
+            array<bsl::uint64, block_words> const mask{probes(h)};
+
+            for (bsl::uintmax i{}; i < block_words; ++i) {
+                *m_words.at_if(to_umax(first + i)) |= *mask.at_if(to_umax(i));
+            }
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns true if all of the bits of the provided hash
+        ///     are set. All of the words of the block are tested, without
+        ///     an early exit, so that the loop has no branches.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param h the (mixed) hash of the key
+        ///   @return Returns true if all of the bits of h are set
+        ///
+        [[nodiscard]] constexpr bool
+        contains_hash(bsl::uint64 const h) const noexcept
+        {
+            bsl::uintmax const first{block(h)};
+            array<bsl::uint64, block_words> const mask{probes(h)};
+
+            bsl::uint64 missing{};
+            for (bsl::uintmax i{}; i < block_words; ++i) {
+                bsl::uint64 const m{*mask.at_if(to_umax(i))};
+                missing |= m & ~*m_words.at_if(to_umax(first + i));
+            }
+
+            return 0U == missing;
+        }
+
+    public:
+        /// <!-- description -->
+        ///   @brief Adds a key to the filter.
+        ///   @include example_bloom_filter_overview.hpp
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param key the key to add
+        ///
+        constexpr void
+        add(safe_uint64 const &key) noexcept
+        {
+            if (!key) {
+                bsl::error() << "bloom_filter: invalid key\n";
+                return;
+            }
+
+            this->add_hash(mix(key.get()));
+        }
+
+        /// <!-- description -->
+        ///   @brief Adds a key, given as a sequence of bytes, to the
+        ///     filter.
+        ///   @include example_bloom_filter_overview.hpp
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param key the key to add
+        ///
+        constexpr void
+        add(span<byte const> const &key) noexcept
+        {
+            this->add_hash(mix(hash(key)));
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns false if the key was definitely never added to
+        ///     the filter, and true if the key was probably added to the
+        ///     filter. Returns false if key is invalid.
+        ///   @include example_bloom_filter_overview.hpp
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param key the key to look for
+        ///   @return Returns false if the key was definitely never added
+        ///     to the filter, and true if it probably was.
+        ///
+        [[nodiscard]] constexpr bool
+        contains(safe_uint64 const &key) const noexcept
+        {
+            if (!key) {
+                return false;
+            }
+
+            return this->contains_hash(mix(key.get()));
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns false if the key (given as a sequence of
+        ///     bytes) was definitely never added to the filter, and true
+        ///     if the key was probably added to the filter.
+        ///   @include example_bloom_filter_overview.hpp
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param key the key to look for
+        ///   @return Returns false if the key was definitely never added
+        ///     to the filter, and true if it probably was.
+        ///
+        [[nodiscard]] constexpr bool
+        contains(span<byte const> const &key) const noexcept
+        {
+            return this->contains_hash(mix(hash(key)));
+        }
+
+        /// <!-- description -->
+        ///   @brief Adds all of the keys in "o" to this filter (i.e.,
+        ///     this filter becomes the union of both filters).
+        ///   @include example_bloom_filter_overview.hpp
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param o the filter to merge into this filter
+        ///
+        constexpr void
+        merge(bloom_filter const &o) noexcept
+        {
+            for (safe_uintmax i{}; i < m_words.size(); ++i) {
+                *m_words.at_if(i) |= *o.m_words.at_if(i);
+            }
+        }
+
+        /// <!-- description -->
+        ///   @brief Removes all of the keys from the filter.
+        ///
+        constexpr void
+        clear() noexcept
+        {
+            for (safe_uintmax i{}; i < m_words.size(); ++i) {
+                *m_words.at_if(i) = {};
+            }
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns true if no keys have been added to the filter.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Returns true if no keys have been added to the filter.
+        ///
+        [[nodiscard]] constexpr bool
+        empty() const noexcept
+        {
+            bsl::uint64 bits{};
+            for (safe_uintmax i{}; i < m_words.size(); ++i) {
+                bits |= *m_words.at_if(i);
+            }
+
+            return 0U == bits;
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns the number of bits in the filter
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Returns the number of bits in the filter
+        ///
+        [[nodiscard]] static constexpr safe_uintmax
+        bits() noexcept
+        {
+            return to_umax(BITS);
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns the number of bits that are set for each key
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Returns the number of bits that are set for each key
+        ///
+        [[nodiscard]] static constexpr safe_uintmax
+        hashes() noexcept
+        {
+            return to_umax(K);
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns the number of bytes written by serialize() and
+        ///     read by deserialize().
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Returns the number of bytes written by serialize()
+        ///
+        [[nodiscard]] static constexpr safe_uintmax
+        size_bytes() noexcept
+        {
+            return to_umax(BITS / 8U);
+        }
+
+        /// <!-- description -->
+        ///   @brief Copies the filter's bits to dst. The bits are stored
+        ///     in the target's byte order, so they can be loaded by a
+        ///     filter with the same BITS and K on a target with the same
+        ///     byte order.
+        ///   @include example_bloom_filter_overview.hpp
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param dst the buffer to copy the filter to
+        ///   @return Returns the number of bytes written to dst, or
+        ///     bsl::errc_failure if dst is smaller than size_bytes().
+        ///
+        [[nodiscard]] result<safe_uintmax>
+        serialize(span<byte> dst) const noexcept
+        {
+            if (dst.size() < size_bytes()) {
+                bsl::error() << "bloom_filter: dst is too small\n";
+                return {errc_failure};
+            }
+
+            __builtin_memcpy(dst.data(), m_words.data(), BITS / 8U);
+            return {size_bytes()};
+        }
+
+        /// <!-- description -->
+        ///   @brief Replaces the filter's bits with the bits in src, which
+        ///     must have been written by serialize().
+        ///   @include example_bloom_filter_overview.hpp
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param src the buffer to copy the filter from
+        ///   @return Returns the number of bytes read from src, or
+        ///     bsl::errc_invalid_argument if the size of src is not
+        ///     size_bytes().
+        ///
+        [[nodiscard]] result<safe_uintmax>
+        deserialize(span<byte const> const &src) noexcept
+        {
+            if (src.size() != size_bytes()) {
+                bsl::error() << "bloom_filter: invalid serialized filter\n";
+                return {errc_invalid_argument};
+            }
+
+            __builtin_memcpy(m_words.data(), src.data(), BITS / 8U);
+            return {size_bytes()};
+        }
+    };
+}
+
+#endif
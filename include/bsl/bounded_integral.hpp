@@ -0,0 +1,471 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+///
+/// @file bounded_integral.hpp
+///
+
+#ifndef BSL_BOUNDED_INTEGRAL_HPP
+#define BSL_BOUNDED_INTEGRAL_HPP
+
+#include "details/bounded_range.hpp"
+
+#include "cstdint.hpp"
+#include "debug.hpp"
+#include "enable_if.hpp"
+#include "errc_type.hpp"
+#include "is_integral.hpp"
+#include "is_unsigned.hpp"
+#include "result.hpp"
+#include "safe_integral.hpp"
+
+namespace bsl
+{
+    /// @class bsl::bounded_integral
+    ///
+    /// <!-- description -->
+    ///   @brief Stores an integral whose value is known, at compile-time,
+    ///     to be in the range [LO, HI]. Arithmetic between two
+    ///     bsl::bounded_integrals computes the range of the result at
+    ///     compile-time. If that range fits in T, the result is another
+    ///     bsl::bounded_integral and no run-time check is performed.
+    ///     Otherwise, the result is a bsl::safe_integral, and the usual
+    ///     overflow/wrap checks are performed. Indexing a bsl::array
+    ///     with a bsl::bounded_integral whose upper bound is less than
+    ///     the size of the array does not need a bounds check at all.
+    ///     - a bsl::bounded_integral can only be created from a constant
+    ///       (bsl::bounded_constant), from the result of an operation on
+    ///       other bsl::bounded_integrals, or from a bsl::safe_integral
+    ///       using bsl::to_bounded, which checks the range once.
+    ///     - a default constructed bsl::bounded_integral stores LO.
+    ///   @include example_bounded_integral_overview.hpp
+    ///
+    /// <!-- template parameters -->
+    ///   @tparam T the integral type to encapsulate
+    ///   @tparam LO the smallest value the bsl::bounded_integral can store
+    ///   @tparam HI the largest value the bsl::bounded_integral can store
+    ///
+    template<typename T, T LO, T HI>
+    class bounded_integral final
+    {
+        static_assert(is_integral<T>::value, "only integral types are supported");
+        static_assert(!(HI < LO), "LO must not be greater than HI");
+
+        /// @brief stores the value of the integral
+        T m_val;
+
+        /// @brief allows the operators to create values they have proven
+        friend class details::bounded_access;
+
+        /// <!-- description -->
+        ///   @brief Creates a bsl::bounded_integral without checking
+        ///     "val". Only used by bsl::details::bounded_access.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param val the value to store
+        ///
+        explicit constexpr bounded_integral(T const val) noexcept : m_val{val}
+        {}
+
+    public:
+        /// @brief alias for: T
+        using value_type = T;
+
+        /// <!-- description -->
+        ///   @brief Creates a bsl::bounded_integral that stores LO
+        ///   @include example_bounded_integral_overview.hpp
+        ///
+        constexpr bounded_integral() noexcept : m_val{LO}
+        {}
+
+        /// <!-- description -->
+        ///   @brief Creates a bsl::bounded_integral from another
+        ///     bsl::bounded_integral whose range is contained in
+        ///     [LO, HI]. No check is needed.
+        ///   @include example_bounded_integral_overview.hpp
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @tparam L the lower bound of "other"
+        ///   @tparam H the upper bound of "other"
+        ///   @param other the bsl::bounded_integral to copy
+        ///
+        template<T L, T H, enable_if_t<(!(L < LO)) && (!(HI < H)), bool> = true>
+        explicit constexpr bounded_integral(bounded_integral<T, L, H> const &other) noexcept
+            : m_val{other.get()}
+        {}
+
+        /// <!-- description -->
+        ///   @brief Returns LO
+        ///   @include example_bounded_integral_overview.hpp
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Returns LO
+        ///
+        [[nodiscard]] static constexpr value_type
+        min() noexcept
+        {
+            return LO;
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns HI
+        ///   @include example_bounded_integral_overview.hpp
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Returns HI
+        ///
+        [[nodiscard]] static constexpr value_type
+        max() noexcept
+        {
+            return HI;
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns the value stored by the bsl::bounded_integral,
+        ///     which is always in the range [LO, HI].
+        ///   @include example_bounded_integral_overview.hpp
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Returns the value stored by the bsl::bounded_integral
+        ///
+        [[nodiscard]] constexpr value_type
+        get() const noexcept
+        {
+            return m_val;
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns the value stored by the bsl::bounded_integral
+        ///     as a bsl::safe_integral
+        ///   @include example_bounded_integral_overview.hpp
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Returns the value stored by the bsl::bounded_integral
+        ///     as a bsl::safe_integral
+        ///
+        [[nodiscard]] constexpr safe_integral<value_type>
+        to_safe() const noexcept
+        {
+            return safe_integral<value_type>{m_val};
+        }
+    };
+
+    /// @brief a bsl::bounded_integral that can only store V
+    template<typename T, T V>
+    constexpr bounded_integral<T, V, V> bounded_constant{
+        details::bounded_access::make<bounded_integral<T, V, V>>(V)};
+
+    /// @brief a bsl::bounded_integral that can index an array of size N
+    template<bsl::uintmax N>
+    using bounded_index = bounded_integral<bsl::uintmax, static_cast<bsl::uintmax>(0), N - 1U>;
+
+    /// <!-- description -->
+    ///   @brief Returns "val" as a bsl::bounded_integral of type B. This
+    ///     is where the range check that a bsl::bounded_integral saves
+    ///     everywhere else is performed.
+    ///   @include example_bounded_integral_overview.hpp
+    ///   @related bsl::bounded_integral
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @tparam B the type of bsl::bounded_integral to return
+    ///   @param val the value to convert
+    ///   @return Returns "val" as a B on success. Returns
+    ///     bsl::errc_index_out_of_bounds if "val" is invalid or is
+    ///     outside of the range of B.
+    ///
+    template<typename B>
+    [[nodiscard]] constexpr result<B>
+    to_bounded(safe_integral<typename B::value_type> const &val) noexcept
+    {
+        if ((!val) || (val.get() < B::min()) || (B::max() < val.get())) {
+            bsl::error() << "to_bounded: value out of range: " << val << bsl::endl;
+            return {errc_index_out_of_bounds};
+        }
+
+        return details::bounded_access::make<B>(val.get());
+    }
+
+    // -------------------------------------------------------------------------
+    // bounded_integral arithmetic operators
+    // -------------------------------------------------------------------------
+
+    /// <!-- description -->
+    ///   @brief Returns lhs + rhs. If lhs + rhs cannot overflow, the
+    ///     result is a bsl::bounded_integral of range [L1 + L2, H1 + H2]
+    ///     and no check is performed. Otherwise, the result is a checked
+    ///     bsl::safe_integral.
+    ///   @include example_bounded_integral_overview.hpp
+    ///   @related bsl::bounded_integral
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @tparam T the integral type to encapsulate
+    ///   @tparam L1 the lower bound of the left hand side
+    ///   @tparam H1 the upper bound of the left hand side
+    ///   @tparam L2 the lower bound of the right hand side
+    ///   @tparam H2 the upper bound of the right hand side
+    ///   @param lhs the left hand side of the operator
+    ///   @param rhs the right hand side of the operator
+    ///   @return Returns lhs + rhs
+    ///
+    template<typename T, T L1, T H1, T L2, T H2>
+    [[nodiscard]] constexpr auto
+    operator+(
+        bounded_integral<T, L1, H1> const &lhs, bounded_integral<T, L2, H2> const &rhs) noexcept
+    {
+        if constexpr (details::bounded_add_fits(L1, L2) && details::bounded_add_fits(H1, H2)) {
+            using ret_type =
+                bounded_integral<T, static_cast<T>(L1 + L2), static_cast<T>(H1 + H2)>;
+            return details::bounded_access::make<ret_type>(static_cast<T>(lhs.get() + rhs.get()));
+        }
+        else {
+            return lhs.to_safe() + rhs.to_safe();
+        }
+    }
+
+    /// <!-- description -->
+    ///   @brief Returns lhs - rhs. If lhs - rhs cannot overflow or wrap,
+    ///     the result is a bsl::bounded_integral of range
+    ///     [L1 - H2, H1 - L2] and no check is performed. Otherwise, the
+    ///     result is a checked bsl::safe_integral.
+    ///   @include example_bounded_integral_overview.hpp
+    ///   @related bsl::bounded_integral
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @tparam T the integral type to encapsulate
+    ///   @tparam L1 the lower bound of the left hand side
+    ///   @tparam H1 the upper bound of the left hand side
+    ///   @tparam L2 the lower bound of the right hand side
+    ///   @tparam H2 the upper bound of the right hand side
+    ///   @param lhs the left hand side of the operator
+    ///   @param rhs the right hand side of the operator
+    ///   @return Returns lhs - rhs
+    ///
+    template<typename T, T L1, T H1, T L2, T H2>
+    [[nodiscard]] constexpr auto
+    operator-(
+        bounded_integral<T, L1, H1> const &lhs, bounded_integral<T, L2, H2> const &rhs) noexcept
+    {
+        if constexpr (details::bounded_sub_fits(L1, H2) && details::bounded_sub_fits(H1, L2)) {
+            using ret_type =
+                bounded_integral<T, static_cast<T>(L1 - H2), static_cast<T>(H1 - L2)>;
+            return details::bounded_access::make<ret_type>(static_cast<T>(lhs.get() - rhs.get()));
+        }
+        else {
+            return lhs.to_safe() - rhs.to_safe();
+        }
+    }
+
+    /// <!-- description -->
+    ///   @brief Returns lhs * rhs. If lhs * rhs cannot overflow or wrap,
+    ///     the result is a bsl::bounded_integral whose range is given by
+    ///     the smallest and largest products of the bounds, and no check
+    ///     is performed. Otherwise, the result is a checked
+    ///     bsl::safe_integral.
+    ///   @include example_bounded_integral_overview.hpp
+    ///   @related bsl::bounded_integral
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @tparam T the integral type to encapsulate
+    ///   @tparam L1 the lower bound of the left hand side
+    ///   @tparam H1 the upper bound of the left hand side
+    ///   @tparam L2 the lower bound of the right hand side
+    ///   @tparam H2 the upper bound of the right hand side
+    ///   @param lhs the left hand side of the operator
+    ///   @param rhs the right hand side of the operator
+    ///   @return Returns lhs * rhs
+    ///
+    template<typename T, T L1, T H1, T L2, T H2>
+    [[nodiscard]] constexpr auto
+    operator*(
+        bounded_integral<T, L1, H1> const &lhs, bounded_integral<T, L2, H2> const &rhs) noexcept
+    {
+        if constexpr (details::bounded_mul_range_fits<T, L1, H1, L2, H2>()) {
+            using ret_type = bounded_integral<
+                T,
+                details::bounded_mul_bound<false, T, L1, H1, L2, H2>(),
+                details::bounded_mul_bound<true, T, L1, H1, L2, H2>()>;
+            return details::bounded_access::make<ret_type>(static_cast<T>(lhs.get() * rhs.get()));
+        }
+        else {
+            return lhs.to_safe() * rhs.to_safe();
+        }
+    }
+
+    /// <!-- description -->
+    ///   @brief Returns lhs % rhs for unsigned integrals, as a
+    ///     bsl::bounded_integral of range [0, min(H1, H2 - 1)]. Since L2
+    ///     must be greater than 0, no check is performed (e.g., this is
+    ///     how a free running counter is turned into the index of a ring).
+    ///   @include example_bounded_integral_overview.hpp
+    ///   @related bsl::bounded_integral
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @tparam T the integral type to encapsulate
+    ///   @tparam L1 the lower bound of the left hand side
+    ///   @tparam H1 the upper bound of the left hand side
+    ///   @tparam L2 the lower bound of the right hand side
+    ///   @tparam H2 the upper bound of the right hand side
+    ///   @param lhs the left hand side of the operator
+    ///   @param rhs the right hand side of the operator
+    ///   @return Returns lhs % rhs
+    ///
+    template<typename T, T L1, T H1, T L2, T H2, enable_if_t<is_unsigned<T>::value, bool> = true>
+    [[nodiscard]] constexpr auto
+    operator%(
+        bounded_integral<T, L1, H1> const &lhs, bounded_integral<T, L2, H2> const &rhs) noexcept
+    {
+        static_assert(L2 > static_cast<T>(0), "rhs of a bounded modulus must not include 0");
+
+        constexpr T hi{(H1 < (H2 - 1U)) ? H1 : static_cast<T>(H2 - 1U)};
+        using ret_type = bounded_integral<T, static_cast<T>(0), hi>;
+        return details::bounded_access::make<ret_type>(static_cast<T>(lhs.get() % rhs.get()));
+    }
+
+    /// <!-- description -->
+    ///   @brief Returns lhs & rhs for unsigned integrals, as a
+    ///     bsl::bounded_integral of range [0, min(H1, H2)]. No check is
+    ///     performed (e.g., masking with a power of 2 minus 1).
+    ///   @include example_bounded_integral_overview.hpp
+    ///   @related bsl::bounded_integral
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @tparam T the integral type to encapsulate
+    ///   @tparam L1 the lower bound of the left hand side
+    ///   @tparam H1 the upper bound of the left hand side
+    ///   @tparam L2 the lower bound of the right hand side
+    ///   @tparam H2 the upper bound of the right hand side
+    ///   @param lhs the left hand side of the operator
+    ///   @param rhs the right hand side of the operator
+    ///   @return Returns lhs & rhs
+    ///
+    template<typename T, T L1, T H1, T L2, T H2, enable_if_t<is_unsigned<T>::value, bool> = true>
+    [[nodiscard]] constexpr auto
+    operator&(
+        bounded_integral<T, L1, H1> const &lhs, bounded_integral<T, L2, H2> const &rhs) noexcept
+    {
+        constexpr T hi{(H1 < H2) ? H1 : H2};
+        using ret_type = bounded_integral<T, static_cast<T>(0), hi>;
+        return details::bounded_access::make<ret_type>(static_cast<T>(lhs.get() & rhs.get()));
+    }
+
+    // -------------------------------------------------------------------------
+    // bounded_integral rational operators
+    // -------------------------------------------------------------------------
+
+    /// <!-- description -->
+    ///   @brief Returns lhs.get() == rhs.get()
+    ///   @include example_bounded_integral_overview.hpp
+    ///   @related bsl::bounded_integral
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @tparam T the integral type to encapsulate
+    ///   @tparam L1 the lower bound of the left hand side
+    ///   @tparam H1 the upper bound of the left hand side
+    ///   @tparam L2 the lower bound of the right hand side
+    ///   @tparam H2 the upper bound of the right hand side
+    ///   @param lhs the left hand side of the operator
+    ///   @param rhs the right hand side of the operator
+    ///   @return Returns lhs.get() == rhs.get()
+    ///
+    template<typename T, T L1, T H1, T L2, T H2>
+    [[nodiscard]] constexpr bool
+    operator==(
+        bounded_integral<T, L1, H1> const &lhs, bounded_integral<T, L2, H2> const &rhs) noexcept
+    {
+        return lhs.get() == rhs.get();
+    }
+
+    /// <!-- description -->
+    ///   @brief Returns !(lhs == rhs)
+    ///   @include example_bounded_integral_overview.hpp
+    ///   @related bsl::bounded_integral
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @tparam T the integral type to encapsulate
+    ///   @tparam L1 the lower bound of the left hand side
+    ///   @tparam H1 the upper bound of the left hand side
+    ///   @tparam L2 the lower bound of the right hand side
+    ///   @tparam H2 the upper bound of the right hand side
+    ///   @param lhs the left hand side of the operator
+    ///   @param rhs the right hand side of the operator
+    ///   @return Returns !(lhs == rhs)
+    ///
+    template<typename T, T L1, T H1, T L2, T H2>
+    [[nodiscard]] constexpr bool
+    operator!=(
+        bounded_integral<T, L1, H1> const &lhs, bounded_integral<T, L2, H2> const &rhs) noexcept
+    {
+        return !(lhs == rhs);
+    }
+
+    /// <!-- description -->
+    ///   @brief Returns lhs.get() < rhs.get()
+    ///   @include example_bounded_integral_overview.hpp
+    ///   @related bsl::bounded_integral
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @tparam T the integral type to encapsulate
+    ///   @tparam L1 the lower bound of the left hand side
+    ///   @tparam H1 the upper bound of the left hand side
+    ///   @tparam L2 the lower bound of the right hand side
+    ///   @tparam H2 the upper bound of the right hand side
+    ///   @param lhs the left hand side of the operator
+    ///   @param rhs the right hand side of the operator
+    ///   @return Returns lhs.get() < rhs.get()
+    ///
+    template<typename T, T L1, T H1, T L2, T H2>
+    [[nodiscard]] constexpr bool
+    operator<(
+        bounded_integral<T, L1, H1> const &lhs, bounded_integral<T, L2, H2> const &rhs) noexcept
+    {
+        return lhs.get() < rhs.get();
+    }
+
+    /// <!-- description -->
+    ///   @brief Outputs the provided bsl::bounded_integral to the
+    ///     provided output type.
+    ///   @related bsl::bounded_integral
+    ///   @include example_bounded_integral_overview.hpp
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @tparam T1 the type of outputter provided
+    ///   @tparam T2 the integral type of the bsl::bounded_integral
+    ///   @tparam LO the lower bound of the bsl::bounded_integral
+    ///   @tparam HI the upper bound of the bsl::bounded_integral
+    ///   @param o the instance of the outputter used to output the value.
+    ///   @param val the bsl::bounded_integral to output
+    ///   @return return o
+    ///
+    template<typename T1, typename T2, T2 LO, T2 HI>
+    [[maybe_unused]] constexpr out<T1>
+    operator<<(out<T1> const o, bounded_integral<T2, LO, HI> const &val) noexcept
+    {
+        if constexpr (!o) {
+            return o;
+        }
+
+        return o << val.to_safe();
+    }
+}
+
+#endif
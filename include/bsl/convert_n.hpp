@@ -0,0 +1,89 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+///
+/// @file convert_n.hpp
+///
+
+#ifndef BSL_CONVERT_N_HPP
+#define BSL_CONVERT_N_HPP
+
+#include "details/convert_n_impl.hpp"
+
+#include "convert.hpp"
+#include "debug.hpp"
+#include "is_integral.hpp"
+#include "is_same.hpp"
+#include "remove_const.hpp"
+#include "safe_integral.hpp"
+#include "span.hpp"
+
+namespace bsl
+{
+    /// <!-- description -->
+    ///   @brief Converts every element of "src" to T and stores the
+    ///     result in "dst", narrowing or widening each element the same
+    ///     way bsl::convert() does (e.g., storing a column of 64 bit
+    ///     values as 32 bit values). Instead of checking each value on
+    ///     its own, the smallest and largest value of each block of "src"
+    ///     is checked against the range of T, so the checks vectorize and
+    ///     cost a pair of compares per block. If no value of F can lose
+    ///     data when converted to T, nothing is checked.
+    ///
+    ///     If a value in "src" does not fit in T, every value before it
+    ///     is converted, and the index of the value that did not fit is
+    ///     returned. If "dst" is smaller than "src", nothing is converted
+    ///     and an invalid bsl::safe_uintmax is returned.
+    ///   @include example_convert_n_overview.hpp
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @tparam F the type of elements to convert from (may be const)
+    ///   @tparam T the type of elements to convert to
+    ///   @param src the elements to convert
+    ///   @param dst where to store the converted elements
+    ///   @return Returns src.size() if every element was converted,
+    ///     the index of the first element of "src" that does not fit in
+    ///     T if one does not fit, or an invalid bsl::safe_uintmax if
+    ///     "dst" is too small.
+    ///
+    template<typename F, typename T>
+    [[nodiscard]] constexpr safe_uintmax
+    convert_n(span<F> const &src, span<T> dst) noexcept
+    {
+        using from_type = remove_const_t<F>;
+
+        static_assert(is_integral<from_type>::value, "only integral types are supported");
+        static_assert(is_integral<T>::value, "only integral types are supported");
+        static_assert(!is_same<from_type, bool>::value, "bool is not supported");
+        static_assert(!is_same<T, bool>::value, "bool is not supported");
+
+        if (dst.size() < src.size()) {
+            bsl::error() << "convert_n: dst is too small\n";
+            return safe_uintmax::zero(true);
+        }
+
+        return to_umax(details::convert_n_impl(src.data(), dst.data(), src.size().get()));
+    }
+}
+
+#endif
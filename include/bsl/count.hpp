@@ -0,0 +1,82 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+///
+/// @file count.hpp
+///
+
+#ifndef BSL_COUNT_HPP
+#define BSL_COUNT_HPP
+
+#include "details/reduce_impl.hpp"
+#include "details/value_type_for.hpp"
+
+#include "byte.hpp"
+#include "convert.hpp"
+#include "is_constant_evaluated.hpp"
+#include "is_integral.hpp"
+#include "is_same.hpp"
+#include "remove_const.hpp"
+#include "safe_integral.hpp"
+
+namespace bsl
+{
+    /// <!-- description -->
+    ///   @brief Returns the number of elements in a view that are equal
+    ///     to "val" (e.g., the number of lines in a buffer is the number
+    ///     of '\n' characters in it). At run-time, views of single byte
+    ///     elements (e.g., char, bsl::uint8, bsl::byte) are counted 8
+    ///     bytes at a time.
+    ///   @include example_count_overview.hpp
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @tparam VIEW the type of view to search
+    ///   @param vw the view to search
+    ///   @param val the value to count
+    ///   @return Returns the number of elements in "vw" equal to "val"
+    ///
+    template<typename VIEW>
+    [[nodiscard]] constexpr safe_uintmax
+    count(VIEW const &vw, remove_const_t<details::value_type_for<VIEW>> const &val) noexcept
+    {
+        using value_type = remove_const_t<details::value_type_for<VIEW>>;
+
+        value_type const *const ptr{vw.data()};
+        bsl::uintmax const num{vw.size().get()};
+
+        if constexpr (sizeof(value_type) == sizeof(bsl::uint8)) {
+            if constexpr (is_integral<value_type>::value || is_same<value_type, byte>::value) {
+                if (!is_constant_evaluated()) {
+                    return to_umax(details::reduce_count_bytes(
+                        reinterpret_cast<bsl::uint8 const *>(ptr),    // NOLINT
+                        num,
+                        details::reduce_to_u8(val)));
+                }
+            }
+        }
+
+        return to_umax(details::reduce_count(ptr, num, val));
+    }
+}
+
+#endif
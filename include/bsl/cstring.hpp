@@ -31,6 +31,7 @@
 #include "char_type.hpp"
 #include "convert.hpp"
 #include "cstr_type.hpp"
+#include "is_constant_evaluated.hpp"
 #include "safe_integral.hpp"
 
 // Notes: --
@@ -130,6 +131,44 @@ namespace bsl
             return __builtin_char_memchr(str, ch, count.min(len + to_umax(1)).get());
         }
     }
+
+    /// <!-- description -->
+    ///   @brief Same as std::memcpy (for characters) with parameter checks.
+    ///     If dst or src are a nullptr, or count is 0, this function does
+    ///     nothing and returns dst. The caller is responsible for ensuring
+    ///     that both dst and src are at least count characters in size.
+    ///     When evaluated at compile-time, the copy is performed one
+    ///     character at a time.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param dst the buffer to copy to
+    ///   @param src the buffer to copy from
+    ///   @param count the total number of characters to copy
+    ///   @return Returns dst
+    ///
+    [[maybe_unused]] inline constexpr char_type *
+    builtin_memcpy(char_type *const dst, cstr_type const src, safe_uintmax const &count) noexcept
+    {
+        if ((nullptr == dst) || (nullptr == src) || count.is_zero()) {
+            return dst;
+        }
+
+        if (is_constant_evaluated()) {
+            for (bsl::uintmax i{}; i < count.get(); ++i) {
+                dst[i] = src[i];    // NOLINT
+            }
+
+            return dst;
+        }
+
+        if constexpr (BSL_PERFORCE) {
+            return dst;
+        }
+        else {
+            __builtin_memcpy(dst, src, count.get());
+            return dst;
+        }
+    }
 }
 
 #endif
@@ -30,9 +30,9 @@
 
 #include "details/out_type_alert.hpp"
 #include "details/out_type_debug.hpp"
-#include "details/out_type_empty.hpp"
 #include "details/out_type_error.hpp"
 #include "details/out_type_print.hpp"
+#include "details/out_type_record.hpp"
 #include "details/out.hpp"
 
 #include "char_type.hpp"
@@ -52,9 +52,10 @@ namespace bsl
     /// @brief newline constant
     constexpr bsl::char_type endl{'\n'};
 
-    /// @brief used to disable debugging for debug() and alert()
+    /// @brief used to disable debugging for debug() and alert(). Disabled
+    ///   output is written to the calling thread's bsl::flight_recorder.
     template<bsl::uintmax DL, typename T>
-    using out_t = conditional_t<DL <= BSL_DEBUG_LEVEL, out<T>, out<details::out_type_empty>>;
+    using out_t = conditional_t<DL <= BSL_DEBUG_LEVEL, out<T>, out<details::out_type_record>>;
 
     namespace details
     {
@@ -110,7 +111,7 @@ namespace bsl
     {
         out_t<DL, details::out_type_debug> o{};
 
-        if constexpr (!o) {
+        if constexpr (o.is_record()) {
             return o;
         }
 
@@ -136,7 +137,7 @@ namespace bsl
     {
         out_t<DL, details::out_type_alert> o{};
 
-        if constexpr (!o) {
+        if constexpr (o.is_record()) {
             return o;
         }
 
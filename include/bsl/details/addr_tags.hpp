@@ -0,0 +1,53 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+///
+/// @file addr_tags.hpp
+///
+
+#ifndef BSL_DETAILS_ADDR_TAGS_HPP
+#define BSL_DETAILS_ADDR_TAGS_HPP
+
+namespace bsl
+{
+    namespace details
+    {
+        /// @class bsl::details::phys_addr_tag
+        ///
+        /// <!-- description -->
+        ///   @brief Tags a bsl::basic_addr as a physical address
+        ///
+        class phys_addr_tag final
+        {};
+
+        /// @class bsl::details::virt_addr_tag
+        ///
+        /// <!-- description -->
+        ///   @brief Tags a bsl::basic_addr as a virtual address
+        ///
+        class virt_addr_tag final
+        {};
+    }
+}
+
+#endif
@@ -0,0 +1,226 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+///
+/// @file base64_impl.hpp
+///
+
+#ifndef BSL_DETAILS_BASE64_IMPL_HPP
+#define BSL_DETAILS_BASE64_IMPL_HPP
+
+#include "../array.hpp"
+#include "../char_type.hpp"
+#include "../convert.hpp"
+#include "../cstdint.hpp"
+#include "../safe_integral.hpp"
+
+// Notes: --
+// - Both directions work on whole quantums (3 bytes <-> 4 characters).
+//   Each quantum is packed into a 32bit integer so that it can be split
+//   (or merged) with shifts, and is then written with a single unaligned
+//   store (or a 2 byte and a 1 byte store when decoding).
+// - The decoder uses a 256 entry table that maps each character to its
+//   6bit value, or to base64_bad for any character that is not part of
+//   the alphabet (including '='). The table results are OR'd into an
+//   accumulator that is checked once at the end, so the hot loop has no
+//   data dependent branches. Padding is only accepted in the last
+//   quantum, which is decoded separately.
+//
+
+namespace bsl
+{
+    namespace details
+    {
+        /// @brief the value stored in the decode table for invalid chars
+        constexpr bsl::uint8 base64_bad{0xFFU};
+        /// @brief the mask of the bits that are only set by base64_bad
+        constexpr bsl::uint8 base64_bad_mask{0xC0U};
+        /// @brief the mask of a 6bit value
+        constexpr bsl::uint32 base64_mask{0x3FU};
+        /// @brief the padding character
+        constexpr bsl::char_type base64_pad{'='};
+
+        /// @brief the base64 alphabet (RFC 4648)
+        constexpr bsl::array<bsl::char_type, 64> base64_alphabet{
+            'A', 'B', 'C', 'D', 'E', 'F', 'G', 'H', 'I', 'J', 'K', 'L', 'M', 'N', 'O', 'P',
+            'Q', 'R', 'S', 'T', 'U', 'V', 'W', 'X', 'Y', 'Z', 'a', 'b', 'c', 'd', 'e', 'f',
+            'g', 'h', 'i', 'j', 'k', 'l', 'm', 'n', 'o', 'p', 'q', 'r', 's', 't', 'u', 'v',
+            'w', 'x', 'y', 'z', '0', '1', '2', '3', '4', '5', '6', '7', '8', '9', '+', '/'};
+
+        /// <!-- description -->
+        ///   @brief Returns the table used to decode base64 characters
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Returns the table used to decode base64 characters
+        ///
+        [[nodiscard]] constexpr bsl::array<bsl::uint8, 256>
+        base64_make_decode_table() noexcept
+        {
+            bsl::array<bsl::uint8, 256> tbl{};
+
+            for (bsl::safe_uintmax i{}; i < tbl.size(); ++i) {
+                *tbl.at_if(i) = base64_bad;
+            }
+
+            for (bsl::safe_uintmax i{}; i < base64_alphabet.size(); ++i) {
+                auto const c{static_cast<bsl::uint8>(*base64_alphabet.at_if(i))};
+                *tbl.at_if(to_umax(c)) = static_cast<bsl::uint8>(i.get());
+            }
+
+            return tbl;
+        }
+
+        /// @brief maps a character to its 6bit value, or to base64_bad
+        constexpr bsl::array<bsl::uint8, 256> base64_decode_table{
+            base64_make_decode_table()};
+
+        /// <!-- description -->
+        ///   @brief Returns the 4 characters that encode the 24bit value
+        ///     val, packed in memory order.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param val the 24bit value to encode
+        ///   @return Returns the 4 characters that encode val
+        ///
+        [[nodiscard]] inline bsl::uint32
+        base64_encode3(bsl::uint32 const val) noexcept
+        {
+            bsl::char_type const *const abc{base64_alphabet.data()};
+
+            auto const c0{static_cast<bsl::uint8>(abc[(val >> 18U) & base64_mask])};    // NOLINT
+            auto const c1{static_cast<bsl::uint8>(abc[(val >> 12U) & base64_mask])};    // NOLINT
+            auto const c2{static_cast<bsl::uint8>(abc[(val >> 6U) & base64_mask])};     // NOLINT
+            auto const c3{static_cast<bsl::uint8>(abc[val & base64_mask])};             // NOLINT
+
+            return static_cast<bsl::uint32>(c0) | (static_cast<bsl::uint32>(c1) << 8U) |
+                   (static_cast<bsl::uint32>(c2) << 16U) | (static_cast<bsl::uint32>(c3) << 24U);
+        }
+
+        /// <!-- description -->
+        ///   @brief Encodes count bytes from src into dst, which must have
+        ///     room for ((count + 2) / 3) * 4 characters. A partial last
+        ///     quantum is padded with '='.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param src the bytes to encode
+        ///   @param count the number of bytes to encode
+        ///   @param dst where to store the characters
+        ///
+        inline void
+        base64_encode(bsl::uint8 const *src, bsl::uintmax count, bsl::char_type *dst) noexcept
+        {
+            constexpr bsl::uintmax in{3U};
+            constexpr bsl::uintmax out{4U};
+
+            while (count >= in) {
+                bsl::uint32 const val{
+                    (static_cast<bsl::uint32>(src[0]) << 16U) |        // NOLINT
+                    (static_cast<bsl::uint32>(src[1]) << 8U) |         // NOLINT
+                    static_cast<bsl::uint32>(src[2])};                 // NOLINT
+
+                bsl::uint32 const chars{base64_encode3(val)};
+                __builtin_memcpy(dst, &chars, sizeof(chars));
+
+                src += in;     // NOLINT
+                dst += out;    // NOLINT
+                count -= in;
+            }
+
+            if (0U == count) {
+                return;
+            }
+
+            bsl::uint32 val{static_cast<bsl::uint32>(src[0]) << 16U};    // NOLINT
+            if (count > 1U) {
+                val |= static_cast<bsl::uint32>(src[1]) << 8U;    // NOLINT
+            }
+
+            bsl::uint32 const chars{base64_encode3(val)};
+            __builtin_memcpy(dst, &chars, sizeof(chars));
+
+            dst[3] = base64_pad;    // NOLINT
+            if (1U == count) {
+                dst[2] = base64_pad;    // NOLINT
+            }
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns the 24bit value encoded by the 4 characters at
+        ///     src. Invalid characters are accumulated into bad.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param src the characters to decode
+        ///   @param bad accumulates the table entries that were used
+        ///   @return Returns the 24bit value encoded by src
+        ///
+        [[nodiscard]] inline bsl::uint32
+        base64_decode4(bsl::char_type const *const src, bsl::uint8 &bad) noexcept
+        {
+            bsl::uint8 const *const tbl{base64_decode_table.data()};
+
+            bsl::uint8 const a{tbl[static_cast<bsl::uint8>(src[0])]};    // NOLINT
+            bsl::uint8 const b{tbl[static_cast<bsl::uint8>(src[1])]};    // NOLINT
+            bsl::uint8 const c{tbl[static_cast<bsl::uint8>(src[2])]};    // NOLINT
+            bsl::uint8 const d{tbl[static_cast<bsl::uint8>(src[3])]};    // NOLINT
+
+            bad |= static_cast<bsl::uint8>(a | b | c | d);
+            return (static_cast<bsl::uint32>(a) << 18U) | (static_cast<bsl::uint32>(b) << 12U) |
+                   (static_cast<bsl::uint32>(c) << 6U) | static_cast<bsl::uint32>(d);
+        }
+
+        /// <!-- description -->
+        ///   @brief Decodes "quantums" full quantums (4 characters each,
+        ///     no padding) from src into 3 * quantums bytes in dst.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param src the characters to decode
+        ///   @param quantums the number of quantums to decode
+        ///   @param dst where to store the decoded bytes
+        ///   @return Returns true if all of the characters were valid
+        ///
+        [[nodiscard]] inline bool
+        base64_decode(
+            bsl::char_type const *src, bsl::uintmax quantums, bsl::uint8 *dst) noexcept
+        {
+            constexpr bsl::uintmax in{4U};
+            constexpr bsl::uintmax out{3U};
+            constexpr bsl::uint32 byte_mask{0xFFU};
+
+            bsl::uint8 bad{};
+            for (bsl::uintmax i{}; i < quantums; ++i) {
+                bsl::uint32 const val{base64_decode4(src, bad)};
+
+                dst[0] = static_cast<bsl::uint8>(val >> 16U);                 // NOLINT
+                dst[1] = static_cast<bsl::uint8>((val >> 8U) & byte_mask);    // NOLINT
+                dst[2] = static_cast<bsl::uint8>(val & byte_mask);            // NOLINT
+
+                src += in;     // NOLINT
+                dst += out;    // NOLINT
+            }
+
+            return 0U == (bad & base64_bad_mask);
+        }
+    }
+}
+
+#endif
@@ -0,0 +1,122 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+///
+/// @file bitfield_masks.hpp
+///
+
+#ifndef BSL_DETAILS_BITFIELD_MASKS_HPP
+#define BSL_DETAILS_BITFIELD_MASKS_HPP
+
+#include "../cstdint.hpp"
+#include "../integer_sequence.hpp"
+#include "../is_same.hpp"
+
+namespace bsl
+{
+    namespace details
+    {
+        /// <!-- description -->
+        ///   @brief Returns the number of bits that are set in val
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @tparam T the type of value to count the bits of
+        ///   @param val the value to count the bits of
+        ///   @return Returns the number of bits that are set in val
+        ///
+        template<typename T>
+        [[nodiscard]] constexpr bsl::uintmax
+        bitfield_popcount(T const val) noexcept
+        {
+            return static_cast<bsl::uintmax>(__builtin_popcountll(val));
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns the bitwise OR of all of the masks in the
+        ///     provided sequence.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @tparam T the type of mask
+        ///   @tparam MASKS the masks to combine
+        ///   @return Returns the bitwise OR of all of the masks
+        ///
+        template<typename T, T... MASKS>
+        [[nodiscard]] constexpr T
+        bitfield_combine(integer_sequence<T, MASKS...> const) noexcept
+        {
+            return static_cast<T>((static_cast<T>(0) | ... | MASKS));
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns true if none of the masks in the provided
+        ///     sequence share a bit. If no two masks overlap, the number of
+        ///     bits set in each mask adds up to the number of bits set in
+        ///     all of them combined.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @tparam T the type of mask
+        ///   @tparam MASKS the masks to check
+        ///   @param seq the masks to check
+        ///   @return Returns true if none of the masks share a bit
+        ///
+        template<typename T, T... MASKS>
+        [[nodiscard]] constexpr bool
+        bitfield_disjoint(integer_sequence<T, MASKS...> const seq) noexcept
+        {
+            bsl::uintmax const total{(bsl::uintmax{} + ... + bitfield_popcount(MASKS))};
+            return total == bitfield_popcount(bitfield_combine(seq));
+        }
+
+        /// @class bsl::details::bitfield_masks
+        ///
+        /// <!-- description -->
+        ///   @brief Computes, at compile time, the combined mask of a set
+        ///     of bsl::bitfield descriptors, and validates that they all
+        ///     describe the same register and that none of them overlap.
+        ///
+        /// <!-- template parameters -->
+        ///   @tparam REG the register the fields must belong to
+        ///   @tparam FIELDS the bsl::bitfield descriptors
+        ///
+        template<typename REG, typename... FIELDS>
+        class bitfield_masks final
+        {
+            /// @brief alias for: typename REG::value_type
+            using value_type = typename REG::value_type;
+            /// @brief the masks of each field, as an integer_sequence
+            using masks_type = integer_sequence<value_type, FIELDS::mask()...>;
+
+            static_assert(sizeof...(FIELDS) > 0U, "at least one field is required");
+            static_assert(
+                (is_same<REG, typename FIELDS::register_type>::value && ...),
+                "all fields must belong to the same register");
+            static_assert(bitfield_disjoint(masks_type{}), "fields must not overlap");
+
+        public:
+            /// @brief the bitwise OR of the masks of each field
+            static constexpr value_type mask{bitfield_combine(masks_type{})};
+        };
+    }
+}
+
+#endif
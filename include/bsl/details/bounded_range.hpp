@@ -0,0 +1,181 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+///
+/// @file bounded_range.hpp
+///
+
+#ifndef BSL_DETAILS_BOUNDED_RANGE_HPP
+#define BSL_DETAILS_BOUNDED_RANGE_HPP
+
+// Notes: --
+// - These helpers are only ever evaluated at compile-time, on the bounds
+//   of a bsl::bounded_integral, to work out the bounds of the result of
+//   an operation and whether that result could leave the range of T.
+// - The builtins are called directly (and not through the
+//   bsl::builtin_xxx_overflow wrappers) because an overflow here is not
+//   an error, it simply means the operation needs a run-time check.
+//
+
+namespace bsl
+{
+    namespace details
+    {
+        /// <!-- description -->
+        ///   @brief Returns true if lhs + rhs is representable by T
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @tparam T the type of integral to add
+        ///   @param lhs the left hand side of the operation
+        ///   @param rhs the right hand side of the operation
+        ///   @return Returns true if lhs + rhs is representable by T
+        ///
+        template<typename T>
+        [[nodiscard]] constexpr bool
+        bounded_add_fits(T const lhs, T const rhs) noexcept
+        {
+            T res{};
+            return !__builtin_add_overflow(lhs, rhs, &res);    // NOLINT
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns true if lhs - rhs is representable by T
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @tparam T the type of integral to subtract
+        ///   @param lhs the left hand side of the operation
+        ///   @param rhs the right hand side of the operation
+        ///   @return Returns true if lhs - rhs is representable by T
+        ///
+        template<typename T>
+        [[nodiscard]] constexpr bool
+        bounded_sub_fits(T const lhs, T const rhs) noexcept
+        {
+            T res{};
+            return !__builtin_sub_overflow(lhs, rhs, &res);    // NOLINT
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns true if lhs * rhs is representable by T
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @tparam T the type of integral to multiply
+        ///   @param lhs the left hand side of the operation
+        ///   @param rhs the right hand side of the operation
+        ///   @return Returns true if lhs * rhs is representable by T
+        ///
+        template<typename T>
+        [[nodiscard]] constexpr bool
+        bounded_mul_fits(T const lhs, T const rhs) noexcept
+        {
+            T res{};
+            return !__builtin_mul_overflow(lhs, rhs, &res);    // NOLINT
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns true if every product of a bound of [L1, H1]
+        ///     and a bound of [L2, H2] is representable by T, in which
+        ///     case every product of the two ranges is as well.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @tparam T the type of integral to multiply
+        ///   @tparam L1 the lower bound of the left hand side
+        ///   @tparam H1 the upper bound of the left hand side
+        ///   @tparam L2 the lower bound of the right hand side
+        ///   @tparam H2 the upper bound of the right hand side
+        ///   @return Returns true if the product of the two ranges is
+        ///     representable by T
+        ///
+        template<typename T, T L1, T H1, T L2, T H2>
+        [[nodiscard]] constexpr bool
+        bounded_mul_range_fits() noexcept
+        {
+            return bounded_mul_fits(L1, L2) && bounded_mul_fits(L1, H2) &&
+                   bounded_mul_fits(H1, L2) && bounded_mul_fits(H1, H2);
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns the smallest (or largest if MAX is true)
+        ///     product of a bound of [L1, H1] and a bound of [L2, H2].
+        ///     Must only be called if bounded_mul_range_fits() is true.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @tparam MAX true to return the largest product
+        ///   @tparam T the type of integral to multiply
+        ///   @tparam L1 the lower bound of the left hand side
+        ///   @tparam H1 the upper bound of the left hand side
+        ///   @tparam L2 the lower bound of the right hand side
+        ///   @tparam H2 the upper bound of the right hand side
+        ///   @return Returns the smallest (or largest) product
+        ///
+        template<bool MAX, typename T, T L1, T H1, T L2, T H2>
+        [[nodiscard]] constexpr T
+        bounded_mul_bound() noexcept
+        {
+            T const p1{static_cast<T>(L1 * L2)};
+            T const p2{static_cast<T>(L1 * H2)};
+            T const p3{static_cast<T>(H1 * L2)};
+            T const p4{static_cast<T>(H1 * H2)};
+
+            if constexpr (MAX) {
+                T const p12{(p1 < p2) ? p2 : p1};
+                T const p34{(p3 < p4) ? p4 : p3};
+                return (p12 < p34) ? p34 : p12;
+            }
+            else {
+                T const p12{(p2 < p1) ? p2 : p1};
+                T const p34{(p4 < p3) ? p4 : p3};
+                return (p34 < p12) ? p34 : p12;
+            }
+        }
+
+        /// @class bsl::details::bounded_access
+        ///
+        /// <!-- description -->
+        ///   @brief Creates a bsl::bounded_integral without checking its
+        ///     value. Only used by the bsl::bounded_integral operators,
+        ///     which have already proven that the value is in range.
+        ///
+        class bounded_access final
+        {
+        public:
+            /// <!-- description -->
+            ///   @brief Returns a B storing "val"
+            ///
+            /// <!-- inputs/outputs -->
+            ///   @tparam B the type of bsl::bounded_integral to create
+            ///   @tparam T the type of value to store
+            ///   @param val the value to store
+            ///   @return Returns a B storing "val"
+            ///
+            template<typename B, typename T>
+            [[nodiscard]] static constexpr B
+            make(T const val) noexcept
+            {
+                return B{val};
+            }
+        };
+    }
+}
+
+#endif
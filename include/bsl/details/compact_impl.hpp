@@ -0,0 +1,206 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+///
+/// @file compact_impl.hpp
+///
+
+#ifndef BSL_DETAILS_COMPACT_IMPL_HPP
+#define BSL_DETAILS_COMPACT_IMPL_HPP
+
+#include "../cstdint.hpp"
+
+// Notes: --
+// - These are the branchless kernels used by bsl::remove_if, bsl::unique,
+//   bsl::partition and bsl::stable_partition when the element type is
+//   trivially copyable. Instead of branching on the predicate, every
+//   element is written to the output position unconditionally, and the
+//   result of the predicate is added to the output index. A copy that is
+//   not kept is simply overwritten by the next one. This removes the
+//   branch mispredictions that dominate filtering unpredictable data,
+//   and is the scalar form of a vector compress (which the compiler is
+//   free to vectorize).
+// - Trivially copyable types can be copied without side effects, which
+//   is what makes the extra copies safe. Other types use the portable
+//   versions in each algorithm.
+// - All of the kernels assume the caller has already validated the
+//   pointers and counts.
+//
+
+namespace bsl
+{
+    namespace details
+    {
+        /// @class bsl::details::compact_equal
+        ///
+        /// <!-- description -->
+        ///   @brief The default equality comparison used by bsl::unique,
+        ///     which compares elements using operator==.
+        ///
+        class compact_equal final
+        {
+        public:
+            /// <!-- description -->
+            ///   @brief Returns lhs == rhs
+            ///
+            /// <!-- inputs/outputs -->
+            ///   @tparam T the type of elements to compare
+            ///   @param lhs the left hand side of the comparison
+            ///   @param rhs the right hand side of the comparison
+            ///   @return Returns lhs == rhs
+            ///
+            template<typename T>
+            [[nodiscard]] constexpr bool
+            operator()(T const &lhs, T const &rhs) const noexcept
+            {
+                return lhs == rhs;
+            }
+        };
+
+        /// <!-- description -->
+        ///   @brief Moves the elements for which "pred" returns false to
+        ///     the front of the array, keeping their order.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @tparam T the type of element to compact
+        ///   @tparam PRED the type of predicate to use
+        ///   @param ptr a pointer to the array to compact
+        ///   @param count the number of elements in the array
+        ///   @param pred the predicate to use
+        ///   @return Returns the number of elements that were kept
+        ///
+        template<typename T, typename PRED>
+        [[nodiscard]] constexpr bsl::uintmax
+        compact_remove_if(T *const ptr, bsl::uintmax const count, PRED &pred) noexcept
+        {
+            bsl::uintmax kept{};
+            for (bsl::uintmax i{}; i < count; ++i) {
+                T const val{ptr[i]};    // NOLINT
+                ptr[kept] = val;        // NOLINT
+                kept += static_cast<bsl::uintmax>(!pred(val));
+            }
+
+            return kept;
+        }
+
+        /// <!-- description -->
+        ///   @brief Moves the first element of each group of consecutive
+        ///     equal elements to the front of the array, keeping their
+        ///     order. The array must not be empty.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @tparam T the type of element to compact
+        ///   @tparam EQUAL the type of equality comparison to use
+        ///   @param ptr a pointer to the array to compact
+        ///   @param count the number of elements in the array
+        ///   @param equal the equality comparison to use
+        ///   @return Returns the number of elements that were kept
+        ///
+        template<typename T, typename EQUAL>
+        [[nodiscard]] constexpr bsl::uintmax
+        compact_unique(T *const ptr, bsl::uintmax const count, EQUAL &equal) noexcept
+        {
+            bsl::uintmax kept{1U};
+            for (bsl::uintmax i{1U}; i < count; ++i) {
+                T const val{ptr[i]};             // NOLINT
+                T const last{ptr[kept - 1U]};    // NOLINT
+                ptr[kept] = val;                 // NOLINT
+                kept += static_cast<bsl::uintmax>(!equal(last, val));
+            }
+
+            return kept;
+        }
+
+        /// <!-- description -->
+        ///   @brief Moves the elements for which "pred" returns true in
+        ///     front of the elements for which "pred" returns false. The
+        ///     order of the elements is not kept. Each element is swapped
+        ///     with the first element of the second group (Lomuto), and
+        ///     the result of "pred" decides if the first group grows.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @tparam T the type of element to partition
+        ///   @tparam PRED the type of predicate to use
+        ///   @param ptr a pointer to the array to partition
+        ///   @param count the number of elements in the array
+        ///   @param pred the predicate to use
+        ///   @return Returns the number of elements in the first group
+        ///
+        template<typename T, typename PRED>
+        [[nodiscard]] constexpr bsl::uintmax
+        compact_partition(T *const ptr, bsl::uintmax const count, PRED &pred) noexcept
+        {
+            bsl::uintmax first{};
+            for (bsl::uintmax i{}; i < count; ++i) {
+                T const val{ptr[i]};    // NOLINT
+                ptr[i] = ptr[first];    // NOLINT
+                ptr[first] = val;       // NOLINT
+                first += static_cast<bsl::uintmax>(pred(val));
+            }
+
+            return first;
+        }
+
+        /// <!-- description -->
+        ///   @brief Moves the elements for which "pred" returns true in
+        ///     front of the elements for which "pred" returns false,
+        ///     keeping the order of both groups. The elements of the
+        ///     second group are staged in "scratch", which must be able
+        ///     to hold "count" elements.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @tparam T the type of element to partition
+        ///   @tparam PRED the type of predicate to use
+        ///   @param ptr a pointer to the array to partition
+        ///   @param count the number of elements in the array
+        ///   @param scratch a pointer to the scratch array to use
+        ///   @param pred the predicate to use
+        ///   @return Returns the number of elements in the first group
+        ///
+        template<typename T, typename PRED>
+        [[nodiscard]] constexpr bsl::uintmax
+        compact_stable_partition(
+            T *const ptr, bsl::uintmax const count, T *const scratch, PRED &pred) noexcept
+        {
+            bsl::uintmax first{};
+            bsl::uintmax second{};
+            for (bsl::uintmax i{}; i < count; ++i) {
+                T const val{ptr[i]};    // NOLINT
+                bool const keep{pred(val)};
+
+                ptr[first] = val;         // NOLINT
+                scratch[second] = val;    // NOLINT
+                first += static_cast<bsl::uintmax>(keep);
+                second += static_cast<bsl::uintmax>(!keep);
+            }
+
+            for (bsl::uintmax i{}; i < second; ++i) {
+                ptr[first + i] = scratch[i];    // NOLINT
+            }
+
+            return first;
+        }
+    }
+}
+
+#endif
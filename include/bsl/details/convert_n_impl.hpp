@@ -0,0 +1,166 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+///
+/// @file convert_n_impl.hpp
+///
+
+#ifndef BSL_DETAILS_CONVERT_N_IMPL_HPP
+#define BSL_DETAILS_CONVERT_N_IMPL_HPP
+
+#include "../cstdint.hpp"
+#include "../is_signed.hpp"
+#include "../numeric_limits.hpp"
+
+// Notes: --
+// - bsl::convert() checks each value on its own, which is a pair of
+//   compares and a branch per element. convert_n_impl() instead finds the
+//   smallest and largest value of a block of elements, which is a
+//   branch-free min/max reduction that the compiler turns into vector
+//   min/max instructions, and checks those two values against the range
+//   of the destination type once per block.
+// - Only a block that contains a value out of range is walked one
+//   element at a time, which is needed to report the index of the
+//   first value that does not fit.
+// - If every value of F fits in T (i.e., the conversion widens), the
+//   checks are removed entirely and the conversion is a plain copy loop.
+//
+
+namespace bsl
+{
+    namespace details
+    {
+        /// @brief the number of elements checked at a time
+        constexpr bsl::uintmax convert_n_block{32U};
+
+        /// <!-- description -->
+        ///   @brief Returns the smallest value of F that can be converted
+        ///     to T without a loss of data.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @tparam T the type being converted to
+        ///   @tparam F the type being converted from
+        ///   @return Returns the smallest value of F that fits in T
+        ///
+        template<typename T, typename F>
+        [[nodiscard]] constexpr F
+        convert_n_lo() noexcept
+        {
+            if constexpr (is_signed<F>::value) {
+                if constexpr (is_signed<T>::value) {
+                    constexpr bsl::intmax f_min{numeric_limits<F>::min()};
+                    constexpr bsl::intmax t_min{numeric_limits<T>::min()};
+                    return static_cast<F>((f_min < t_min) ? t_min : f_min);
+                }
+                else {
+                    return static_cast<F>(0);
+                }
+            }
+            else {
+                return static_cast<F>(0);
+            }
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns the largest value of F that can be converted
+        ///     to T without a loss of data.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @tparam T the type being converted to
+        ///   @tparam F the type being converted from
+        ///   @return Returns the largest value of F that fits in T
+        ///
+        template<typename T, typename F>
+        [[nodiscard]] constexpr F
+        convert_n_hi() noexcept
+        {
+            constexpr auto f_max{static_cast<bsl::uintmax>(numeric_limits<F>::max())};
+            constexpr auto t_max{static_cast<bsl::uintmax>(numeric_limits<T>::max())};
+            return static_cast<F>((f_max < t_max) ? f_max : t_max);
+        }
+
+        /// <!-- description -->
+        ///   @brief Converts "count" elements from "src" to "dst". If a
+        ///     value does not fit in T, the values before it are converted
+        ///     and its index is returned.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @tparam T the type being converted to
+        ///   @tparam F the type being converted from
+        ///   @param src a pointer to the elements to convert
+        ///   @param dst a pointer to where to store the converted elements
+        ///   @param count the number of elements to convert
+        ///   @return Returns "count" if all of the elements were converted,
+        ///     otherwise returns the index of the first element that does
+        ///     not fit in T.
+        ///
+        template<typename T, typename F>
+        [[nodiscard]] constexpr bsl::uintmax
+        convert_n_impl(F const *const src, T *const dst, bsl::uintmax const count) noexcept
+        {
+            constexpr F lo{convert_n_lo<T, F>()};
+            constexpr F hi{convert_n_hi<T, F>()};
+
+            if constexpr ((lo == numeric_limits<F>::min()) && (hi == numeric_limits<F>::max())) {
+                for (bsl::uintmax i{}; i < count; ++i) {
+                    dst[i] = static_cast<T>(src[i]);    // NOLINT
+                }
+
+                return count;
+            }
+            else {
+                for (bsl::uintmax i{}; i < count; i += convert_n_block) {
+                    bsl::uintmax const end{
+                        ((count - i) < convert_n_block) ? count : (i + convert_n_block)};
+
+                    F min{src[i]};    // NOLINT
+                    F max{src[i]};    // NOLINT
+                    for (bsl::uintmax j{i}; j < end; ++j) {
+                        F const val{src[j]};    // NOLINT
+                        min = (val < min) ? val : min;
+                        max = (val > max) ? val : max;
+                    }
+
+                    if ((min < lo) || (max > hi)) {
+                        for (bsl::uintmax j{i}; j < end; ++j) {
+                            F const val{src[j]};    // NOLINT
+                            if ((val < lo) || (val > hi)) {
+                                return j;
+                            }
+
+                            dst[j] = static_cast<T>(val);    // NOLINT
+                        }
+                    }
+
+                    for (bsl::uintmax j{i}; j < end; ++j) {
+                        dst[j] = static_cast<T>(src[j]);    // NOLINT
+                    }
+                }
+
+                return count;
+            }
+        }
+    }
+}
+
+#endif
@@ -0,0 +1,64 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+///
+/// @file default_less.hpp
+///
+
+#ifndef BSL_DETAILS_DEFAULT_LESS_HPP
+#define BSL_DETAILS_DEFAULT_LESS_HPP
+
+namespace bsl
+{
+    namespace details
+    {
+        /// @class bsl::details::default_less
+        ///
+        /// <!-- description -->
+        ///   @brief The default comparison used by the ordering algorithms
+        ///     (e.g., bsl::merge, bsl::nth_element), which orders elements
+        ///     using operator<.
+        ///
+        class default_less final
+        {
+        public:
+            /// <!-- description -->
+            ///   @brief Returns lhs < rhs
+            ///
+            /// <!-- inputs/outputs -->
+            ///   @tparam T the type of elements to compare
+            ///   @param lhs the left hand side of the comparison
+            ///   @param rhs the right hand side of the comparison
+            ///   @return Returns lhs < rhs
+            ///
+            template<typename T>
+            [[nodiscard]] constexpr bool
+            operator()(T const &lhs, T const &rhs) const noexcept
+            {
+                return lhs < rhs;
+            }
+        };
+    }
+}
+
+#endif
@@ -0,0 +1,216 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+///
+/// @file divider_impl.hpp
+///
+
+#ifndef BSL_DETAILS_DIVIDER_IMPL_HPP
+#define BSL_DETAILS_DIVIDER_IMPL_HPP
+
+#include "../cstdint.hpp"
+#include "../is_unsigned.hpp"
+
+// Notes: --
+// - Division by a divisor "d" that is not a power of 2 is replaced with
+//   a multiply by a precomputed "magic" number, followed by a shift
+//   (Granlund and Montgomery, "Division by Invariant Integers using
+//   Multiplication", figure 4.1). Given N = the number of bits in T and
+//   l = ceil(log2(d)):
+//
+//     m = floor(2^N * (2^l - d) / d) + 1
+//     t = mulhi(m, n)
+//     q = (t + ((n - t) >> 1)) >> (l - 1)
+//
+//   which is exact for every n and needs no wider type, no fixups and no
+//   branches. Division by a power of 2 is a shift, and the remainder a
+//   mask.
+// - The magic number is computed one bit at a time so that constructing
+//   a divider for a 64 bit type does not need a 128 bit division, which
+//   is not available without a runtime library.
+//
+
+namespace bsl
+{
+    namespace details
+    {
+        /// <!-- description -->
+        ///   @brief Returns the high half of the full product of "lhs"
+        ///     and "rhs"
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @tparam U the unsigned type of the values to multiply
+        ///   @param lhs the left hand side of the product
+        ///   @param rhs the right hand side of the product
+        ///   @return Returns the high half of lhs * rhs
+        ///
+        template<typename U>
+        [[nodiscard]] constexpr U
+        divider_mulhi(U const lhs, U const rhs) noexcept
+        {
+            constexpr bsl::uint64 bits{static_cast<bsl::uint64>(sizeof(U)) * 8U};
+
+            if constexpr (sizeof(U) < sizeof(bsl::uint64)) {
+                bsl::uint64 const prod{
+                    static_cast<bsl::uint64>(lhs) * static_cast<bsl::uint64>(rhs)};
+                return static_cast<U>(prod >> bits);
+            }
+            else {
+                constexpr bsl::uint64 mask{0xFFFFFFFFU};
+                constexpr bsl::uint64 half{32U};
+
+                bsl::uint64 const l_lo{lhs & mask};
+                bsl::uint64 const l_hi{lhs >> half};
+                bsl::uint64 const r_lo{rhs & mask};
+                bsl::uint64 const r_hi{rhs >> half};
+
+                bsl::uint64 const lo_lo{l_lo * r_lo};
+                bsl::uint64 const hi_lo{l_hi * r_lo};
+                bsl::uint64 const lo_hi{l_lo * r_hi};
+                bsl::uint64 const hi_hi{l_hi * r_hi};
+
+                bsl::uint64 const mid{(lo_lo >> half) + (hi_lo & mask) + (lo_hi & mask)};
+                return static_cast<U>(hi_hi + (hi_lo >> half) + (lo_hi >> half) + (mid >> half));
+            }
+        }
+
+        /// @class bsl::details::divider_impl
+        ///
+        /// <!-- description -->
+        ///   @brief Divides unsigned integrals by a fixed, non-zero
+        ///     divisor without using a hardware division. Used to
+        ///     implement bsl::divider.
+        ///
+        /// <!-- template parameters -->
+        ///   @tparam U the unsigned integral type to divide
+        ///
+        template<typename U>
+        class divider_impl final
+        {
+            static_assert(is_unsigned<U>::value, "divider_impl only supports unsigned types");
+
+            /// @brief the number of bits in U
+            static constexpr bsl::uint32 bits{static_cast<bsl::uint32>(sizeof(U) * 8U)};
+
+            /// @brief stores the divisor
+            U m_divisor;
+            /// @brief stores the magic number (unused if m_pow2 is true)
+            U m_magic;
+            /// @brief stores l - 1, or log2(d) if m_pow2 is true
+            bsl::uint32 m_shift;
+            /// @brief stores true if the divisor is a power of 2
+            bool m_pow2;
+
+        public:
+            /// <!-- description -->
+            ///   @brief Creates a divider for "d", which must not be 0
+            ///
+            /// <!-- inputs/outputs -->
+            ///   @param d the divisor
+            ///
+            explicit constexpr divider_impl(U const d) noexcept
+                : m_divisor{d}, m_magic{}, m_shift{}, m_pow2{}
+            {
+                bsl::uint32 log2{};
+                while ((d >> log2) > static_cast<U>(1)) {
+                    ++log2;
+                }
+
+                m_pow2 = (static_cast<U>(d & static_cast<U>(d - static_cast<U>(1))) == 0U);
+                if (m_pow2) {
+                    m_shift = log2;
+                    return;
+                }
+
+                bsl::uint32 const l{log2 + 1U};
+                U rem{static_cast<U>(static_cast<U>(0) - d)};
+                if (l < bits) {
+                    rem = static_cast<U>(static_cast<U>(static_cast<U>(1) << l) - d);
+                }
+
+                U quo{};
+                for (bsl::uint32 i{}; i < bits; ++i) {
+                    bool const carry{static_cast<U>(rem >> (bits - 1U)) != 0U};
+                    rem = static_cast<U>(rem << 1U);
+                    quo = static_cast<U>(quo << 1U);
+                    if (carry || (rem >= d)) {
+                        rem = static_cast<U>(rem - d);
+                        quo = static_cast<U>(quo | static_cast<U>(1));
+                    }
+                }
+
+                m_magic = static_cast<U>(quo + static_cast<U>(1));
+                m_shift = l - 1U;
+            }
+
+            /// <!-- description -->
+            ///   @brief Returns the divisor
+            ///
+            /// <!-- inputs/outputs -->
+            ///   @return Returns the divisor
+            ///
+            [[nodiscard]] constexpr U
+            divisor() const noexcept
+            {
+                return m_divisor;
+            }
+
+            /// <!-- description -->
+            ///   @brief Returns n / divisor()
+            ///
+            /// <!-- inputs/outputs -->
+            ///   @param n the value to divide
+            ///   @return Returns n / divisor()
+            ///
+            [[nodiscard]] constexpr U
+            divide(U const n) const noexcept
+            {
+                if (m_pow2) {
+                    return static_cast<U>(n >> m_shift);
+                }
+
+                U const t{divider_mulhi(m_magic, n)};
+                return static_cast<U>(static_cast<U>(t + static_cast<U>((n - t) >> 1U)) >> m_shift);
+            }
+
+            /// <!-- description -->
+            ///   @brief Returns n % divisor()
+            ///
+            /// <!-- inputs/outputs -->
+            ///   @param n the value to divide
+            ///   @return Returns n % divisor()
+            ///
+            [[nodiscard]] constexpr U
+            remainder(U const n) const noexcept
+            {
+                if (m_pow2) {
+                    return static_cast<U>(n & static_cast<U>(m_divisor - static_cast<U>(1)));
+                }
+
+                return static_cast<U>(n - static_cast<U>(this->divide(n) * m_divisor));
+            }
+        };
+    }
+}
+
+#endif
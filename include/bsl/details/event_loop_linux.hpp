@@ -0,0 +1,625 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+///
+/// @file event_loop_linux.hpp
+///
+
+#ifndef BSL_DETAILS_EVENT_LOOP_LINUX_HPP
+#define BSL_DETAILS_EVENT_LOOP_LINUX_HPP
+
+#include "../array.hpp"
+#include "../convert.hpp"
+#include "../cstdint.hpp"
+#include "../debug.hpp"
+#include "../discard.hpp"
+#include "../function_ref.hpp"
+#include "../lock_guard.hpp"
+#include "../result.hpp"
+#include "../safe_integral.hpp"
+#include "../spinlock.hpp"
+
+#include <errno.h>    // NOLINT
+#include <sys/epoll.h>
+#include <sys/eventfd.h>
+#include <sys/timerfd.h>
+#include <unistd.h>
+
+namespace bsl
+{
+    static_assert(event_loop_read == EPOLLIN);
+    static_assert(event_loop_write == EPOLLOUT);
+    static_assert(event_loop_error == EPOLLERR);
+    static_assert(event_loop_hangup == EPOLLHUP);
+
+    /// @class bsl::event_loop
+    ///
+    /// <!-- description -->
+    ///   @brief Implements a single threaded event loop using epoll. File
+    ///     descriptors (sockets, device handles, etc.) are registered with
+    ///     a callback that is called each time the file descriptor becomes
+    ///     ready. Timers are implemented using a timerfd, and other threads
+    ///     can post() callbacks to the event loop, which wakes up the event
+    ///     loop using an eventfd. Everything is stored in fixed size tables,
+    ///     meaning the bsl::event_loop never allocates memory once it has
+    ///     been constructed.
+    ///
+    /// <!-- notes -->
+    ///   @note The callbacks given to add() and add_timer() are stored as
+    ///     bsl::function_ref, which means that the callable objects must
+    ///     outlive their registration. post() only takes a function
+    ///     pointer and a context, as it is usually called from another
+    ///     thread whose callable objects would be long gone by the time
+    ///     the post is executed.
+    ///   @note Only post() and stop() may be called from a thread other
+    ///     than the thread executing run() or run_once().
+    ///   @include example_event_loop_overview.hpp
+    ///
+    /// <!-- template parameters -->
+    ///   @tparam N the max number of file descriptors and timers that can
+    ///     be registered, the max number of pending posts, and the max
+    ///     number of events harvested by a single call to epoll_wait().
+    ///
+    template<bsl::uintmax N>
+    class event_loop final
+    {
+        static_assert(N != 0, "event loops of size 0 are not supported");
+
+    public:
+        /// @brief alias for: function_ref<void(bsl::int32, bsl::uint32)>
+        using callback_type = function_ref<void(bsl::int32, bsl::uint32)>;
+        /// @brief alias for: void (*)(void *) noexcept
+        using post_type = void (*)(void *) noexcept;
+
+    private:
+        /// @class bsl::event_loop::pending_post
+        ///
+        /// <!-- description -->
+        ///   @brief Stores a post that has not been executed yet
+        ///
+        class pending_post final
+        {
+        public:
+            /// @brief stores the function to call
+            post_type m_func;
+            /// @brief stores the context to pass to m_func
+            void *m_ctx;
+        };
+
+        /// @class bsl::event_loop::source_type
+        ///
+        /// <!-- description -->
+        ///   @brief Stores a registered file descriptor or timer
+        ///
+        class source_type final
+        {
+        public:
+            /// @brief stores the file descriptor
+            bsl::int32 m_fd;
+            /// @brief stores the generation of this slot
+            bsl::uint32 m_gen;
+            /// @brief stores the callback to call when the fd is ready
+            callback_type m_cb;
+            /// @brief stores whether or not this slot is in use
+            bool m_used;
+            /// @brief stores whether or not the fd is a timerfd we own
+            bool m_timer;
+        };
+
+        /// @brief the epoll_event data used to identify the eventfd
+        static constexpr bsl::uint64 wakeup_token{0xFFFFFFFFFFFFFFFFU};
+        /// @brief the number of nanoseconds in a second
+        static constexpr bsl::uintmax ns_per_sec{1000000000U};
+
+        /// @brief stores the epoll file descriptor
+        bsl::int32 m_epfd{-1};
+        /// @brief stores the eventfd used to wake up the event loop
+        bsl::int32 m_evfd{-1};
+        /// @brief stores the registered file descriptors and timers
+        array<source_type, N> m_sources{};
+        /// @brief stores the pending posts
+        array<pending_post, N> m_posts{};
+        /// @brief stores the index of the oldest pending post
+        safe_uintmax m_posts_head{};
+        /// @brief stores the number of pending posts
+        safe_uintmax m_posts_size{};
+        /// @brief protects the pending posts and m_stop
+        spinlock m_lock{};
+        /// @brief stores whether or not stop() was called
+        bool m_stop{};
+
+        /// <!-- description -->
+        ///   @brief Returns the source registered with the provided fd,
+        ///     or a nullptr if the fd is not registered.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param fd the file descriptor to look up
+        ///   @return Returns the source registered with the provided fd,
+        ///     or a nullptr if the fd is not registered.
+        ///
+        [[nodiscard]] source_type *
+        find(bsl::int32 const fd) noexcept
+        {
+            for (safe_uintmax i{}; i < N; ++i) {
+                source_type *const src{m_sources.at_if(i)};
+                if (src->m_used && (fd == src->m_fd)) {
+                    return src;
+                }
+            }
+
+            return nullptr;
+        }
+
+        /// <!-- description -->
+        ///   @brief Registers a file descriptor with epoll
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param fd the file descriptor to register
+        ///   @param events the events to wait for
+        ///   @param cb the callback to call when the fd is ready
+        ///   @param timer true if fd is a timerfd owned by the event loop
+        ///   @return Returns true on success, false otherwise
+        ///
+        [[nodiscard]] bool
+        add_source(
+            bsl::int32 const fd,
+            bsl::uint32 const events,
+            callback_type const &cb,
+            bool const timer) noexcept
+        {
+            if ((fd < 0) || (!cb)) {
+                bsl::error() << "event_loop: invalid fd or callback\n";
+                return false;
+            }
+
+            if (nullptr != this->find(fd)) {
+                bsl::error() << "event_loop: fd " << fd << " is already registered\n";
+                return false;
+            }
+
+            for (safe_uintmax i{}; i < N; ++i) {
+                source_type *const src{m_sources.at_if(i)};
+                if (src->m_used) {
+                    continue;
+                }
+
+                epoll_event ev{};
+                ev.events = events;
+                ev.data.u64 = (static_cast<bsl::uint64>(src->m_gen) << 32U) | i.get();    // NOLINT
+
+                if (epoll_ctl(m_epfd, EPOLL_CTL_ADD, fd, &ev) < 0) {
+                    bsl::error() << "event_loop: epoll_ctl add failed for fd " << fd << bsl::endl;
+                    return false;
+                }
+
+                src->m_fd = fd;
+                src->m_cb = cb;
+                src->m_used = true;
+                src->m_timer = timer;
+
+                return true;
+            }
+
+            bsl::error() << "event_loop: out of sources\n";
+            return false;
+        }
+
+        /// <!-- description -->
+        ///   @brief Drains the eventfd and executes all pending posts
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Returns the number of posts that were executed
+        ///
+        [[nodiscard]] safe_uintmax
+        drain_posts() noexcept
+        {
+            bsl::uint64 val{};
+            bsl::discard(::read(m_evfd, &val, sizeof(val)));
+
+            safe_uintmax count{};
+            while (true) {
+                pending_post pst{};
+
+                {
+                    lock_guard lck{m_lock};
+                    if (m_posts_size.is_zero()) {
+                        break;
+                    }
+
+                    pst = *m_posts.at_if(m_posts_head);
+                    m_posts_head = (m_posts_head + safe_uintmax::one()) % N;
+                    --m_posts_size;
+                }
+
+                pst.m_func(pst.m_ctx);
+                ++count;
+            }
+
+            return count;
+        }
+
+    public:
+        /// <!-- description -->
+        ///   @brief Creates a bsl::event_loop. This creates the epoll
+        ///     instance and the eventfd used by post() and stop(). If
+        ///     either cannot be created, operator bool returns false.
+        ///
+        event_loop() noexcept
+        {
+            m_epfd = epoll_create1(EPOLL_CLOEXEC);
+            if (m_epfd < 0) {
+                bsl::error() << "event_loop: epoll_create1 failed\n";
+                return;
+            }
+
+            m_evfd = eventfd(0U, EFD_NONBLOCK | EFD_CLOEXEC);    // NOLINT
+            if (m_evfd < 0) {
+                bsl::error() << "event_loop: eventfd failed\n";
+                return;
+            }
+
+            epoll_event ev{};
+            ev.events = EPOLLIN;
+            ev.data.u64 = wakeup_token;
+
+            if (epoll_ctl(m_epfd, EPOLL_CTL_ADD, m_evfd, &ev) < 0) {
+                bsl::error() << "event_loop: epoll_ctl add failed for eventfd\n";
+                close(m_evfd);
+                m_evfd = -1;
+            }
+        }
+
+        /// <!-- description -->
+        ///   @brief Destroyes a previously created bsl::event_loop,
+        ///     closing any timers that are still registered.
+        ///
+        ~event_loop() noexcept
+        {
+            for (safe_uintmax i{}; i < N; ++i) {
+                source_type *const src{m_sources.at_if(i)};
+                if (src->m_used && src->m_timer) {
+                    close(src->m_fd);
+                }
+            }
+
+            if (m_evfd >= 0) {
+                close(m_evfd);
+            }
+
+            if (m_epfd >= 0) {
+                close(m_epfd);
+            }
+        }
+
+        /// <!-- description -->
+        ///   @brief copy constructor
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param o the object being copied
+        ///
+        event_loop(event_loop const &o) noexcept = delete;
+
+        /// <!-- description -->
+        ///   @brief move constructor
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param o the object being moved
+        ///
+        event_loop(event_loop &&o) noexcept = delete;
+
+        /// <!-- description -->
+        ///   @brief copy assignment
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param o the object being copied
+        ///   @return a reference to *this
+        ///
+        [[maybe_unused]] event_loop &operator=(event_loop const &o) &noexcept = delete;
+
+        /// <!-- description -->
+        ///   @brief move assignment
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param o the object being moved
+        ///   @return a reference to *this
+        ///
+        [[maybe_unused]] event_loop &operator=(event_loop &&o) &noexcept = delete;
+
+        /// <!-- description -->
+        ///   @brief Registers a file descriptor with the event loop. The
+        ///     callback is called with the fd and the events that are
+        ///     ready each time the fd becomes ready.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param fd the file descriptor to register
+        ///   @param events the events to wait for (e.g. event_loop_read)
+        ///   @param cb the callback to call when the fd is ready
+        ///   @return Returns true on success, false otherwise
+        ///
+        [[nodiscard]] bool
+        add(bsl::int32 const fd, bsl::uint32 const events, callback_type const &cb) noexcept
+        {
+            return this->add_source(fd, events, cb, false);
+        }
+
+        /// <!-- description -->
+        ///   @brief Changes the events a registered fd is waiting for
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param fd the file descriptor to modify
+        ///   @param events the events to wait for (e.g. event_loop_read)
+        ///   @return Returns true on success, false otherwise
+        ///
+        [[nodiscard]] bool
+        modify(bsl::int32 const fd, bsl::uint32 const events) noexcept
+        {
+            source_type *const src{this->find(fd)};
+            if (nullptr == src) {
+                bsl::error() << "event_loop: fd " << fd << " is not registered\n";
+                return false;
+            }
+
+            epoll_event ev{};
+            ev.events = events;
+            ev.data.u64 = (static_cast<bsl::uint64>(src->m_gen) << 32U) |    // NOLINT
+                          to_umax(src - m_sources.data()).get();                // NOLINT
+
+            if (epoll_ctl(m_epfd, EPOLL_CTL_MOD, fd, &ev) < 0) {
+                bsl::error() << "event_loop: epoll_ctl mod failed for fd " << fd << bsl::endl;
+                return false;
+            }
+
+            return true;
+        }
+
+        /// <!-- description -->
+        ///   @brief Removes a registered fd (or timer) from the event
+        ///     loop. It is safe to call this from a callback, including
+        ///     the callback of the fd that is being removed. If the fd is
+        ///     a timer, the timer is closed.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param fd the file descriptor to remove
+        ///   @return Returns true on success, false otherwise
+        ///
+        [[maybe_unused]] bool
+        remove(bsl::int32 const fd) noexcept
+        {
+            source_type *const src{this->find(fd)};
+            if (nullptr == src) {
+                bsl::error() << "event_loop: fd " << fd << " is not registered\n";
+                return false;
+            }
+
+            bsl::discard(epoll_ctl(m_epfd, EPOLL_CTL_DEL, fd, nullptr));
+            if (src->m_timer) {
+                close(fd);
+            }
+
+            ++src->m_gen;
+            src->m_fd = -1;
+            src->m_cb = {};
+            src->m_used = false;
+            src->m_timer = false;
+
+            return true;
+        }
+
+        /// <!-- description -->
+        ///   @brief Creates a timer that calls the provided callback once
+        ///     the provided number of nanoseconds has elapsed (and every
+        ///     period thereafter if periodic is true). The timer is removed
+        ///     by passing the returned fd to remove().
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param ns the timer's period in nanoseconds
+        ///   @param periodic true if the timer should repeat
+        ///   @param cb the callback to call when the timer expires
+        ///   @return Returns the timer's fd on success, or an error code
+        ///     on failure.
+        ///
+        [[nodiscard]] result<bsl::int32>
+        add_timer(safe_uintmax const &ns, bool const periodic, callback_type const &cb) noexcept
+        {
+            if (ns.failure() || ns.is_zero()) {
+                bsl::error() << "event_loop: invalid timer period\n";
+                return {errc_invalid_argument};
+            }
+
+            constexpr bsl::int32 flags{TFD_NONBLOCK | TFD_CLOEXEC};    // NOLINT
+            bsl::int32 const fd{timerfd_create(CLOCK_MONOTONIC, flags)};
+            if (fd < 0) {
+                bsl::error() << "event_loop: timerfd_create failed\n";
+                return {errc_failure};
+            }
+
+            itimerspec spec{};
+            spec.it_value.tv_sec = static_cast<time_t>((ns / ns_per_sec).get());
+            spec.it_value.tv_nsec = static_cast<bsl::int64>((ns % ns_per_sec).get());
+            if (periodic) {
+                spec.it_interval = spec.it_value;
+            }
+
+            if (timerfd_settime(fd, 0, &spec, nullptr) < 0) {
+                bsl::error() << "event_loop: timerfd_settime failed\n";
+                close(fd);
+                return {errc_failure};
+            }
+
+            if (!this->add_source(fd, EPOLLIN, cb, true)) {
+                close(fd);
+                return {errc_failure};
+            }
+
+            return {fd};
+        }
+
+        /// <!-- description -->
+        ///   @brief Queues a call to func(ctx), which is executed by the
+        ///     thread running the event loop, and wakes up the event loop.
+        ///     This function is thread safe. Only the function pointer and
+        ///     the context are copied, so whatever ctx points to must stay
+        ///     alive until func has been called.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param func the function to call
+        ///   @param ctx the context to pass to func
+        ///   @return Returns true on success, false if the queue is full
+        ///     or func is a nullptr.
+        ///
+        [[nodiscard]] bool
+        post(post_type const func, void *const ctx) noexcept
+        {
+            if (nullptr == func) {
+                bsl::error() << "event_loop: invalid post\n";
+                return false;
+            }
+
+            {
+                lock_guard lck{m_lock};
+                if (m_posts_size == N) {
+                    bsl::error() << "event_loop: post queue is full\n";
+                    return false;
+                }
+
+                *m_posts.at_if((m_posts_head + m_posts_size) % N) = {func, ctx};
+                ++m_posts_size;
+            }
+
+            this->wakeup();
+            return true;
+        }
+
+        /// <!-- description -->
+        ///   @brief Wakes up the event loop if it is blocked in
+        ///     epoll_wait(). This function is thread safe.
+        ///
+        void
+        wakeup() const noexcept
+        {
+            bsl::uint64 const val{1U};
+            bsl::discard(::write(m_evfd, &val, sizeof(val)));
+        }
+
+        /// <!-- description -->
+        ///   @brief Tells run() to return once the current batch of
+        ///     events has been processed. This function is thread safe.
+        ///
+        void
+        stop() noexcept
+        {
+            {
+                lock_guard lck{m_lock};
+                m_stop = true;
+            }
+
+            this->wakeup();
+        }
+
+        /// <!-- description -->
+        ///   @brief Waits for at most timeout milliseconds for events
+        ///     (-1 waits forever), harvests up to N events using a single
+        ///     call to epoll_wait(), and dispatches them.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param timeout the max number of milliseconds to wait for
+        ///   @return Returns the number of callbacks that were called
+        ///
+        [[maybe_unused]] safe_uintmax
+        run_once(bsl::int32 const timeout) noexcept
+        {
+            array<epoll_event, N> events{};
+            safe_uintmax count{};
+
+            bsl::int32 const num{
+                epoll_wait(m_epfd, events.data(), static_cast<bsl::int32>(N), timeout)};
+            if (num < 0) {
+                if (EINTR != errno) {
+                    bsl::error() << "event_loop: epoll_wait failed\n";
+                }
+
+                return count;
+            }
+
+            for (safe_uintmax i{}; i < to_umax(num); ++i) {
+                epoll_event const *const ev{events.at_if(i)};
+                bsl::uint64 const data{ev->data.u64};
+
+                if (wakeup_token == data) {
+                    count += this->drain_posts();
+                    continue;
+                }
+
+                source_type *const src{m_sources.at_if(safe_uintmax{data & 0xFFFFFFFFU})};
+                if ((nullptr == src) || (!src->m_used) ||
+                    (static_cast<bsl::uint32>(data >> 32U) != src->m_gen)) {    // NOLINT
+                    continue;
+                }
+
+                if (src->m_timer) {
+                    bsl::uint64 expirations{};
+                    bsl::discard(::read(src->m_fd, &expirations, sizeof(expirations)));
+                }
+
+                src->m_cb(src->m_fd, ev->events);
+                ++count;
+            }
+
+            return count;
+        }
+
+        /// <!-- description -->
+        ///   @brief Dispatches events until stop() is called
+        ///
+        void
+        run() noexcept
+        {
+            while (true) {
+                {
+                    lock_guard lck{m_lock};
+                    if (m_stop) {
+                        m_stop = false;
+                        return;
+                    }
+                }
+
+                bsl::discard(this->run_once(-1));
+            }
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns true if the event loop was successfully
+        ///     created, false otherwise.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Returns true if the event loop was successfully
+        ///     created, false otherwise.
+        ///
+        [[nodiscard]] constexpr explicit operator bool() const noexcept
+        {
+            return (m_epfd >= 0) && (m_evfd >= 0);
+        }
+    };
+}
+
+#endif
@@ -0,0 +1,134 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+///
+/// @file frame_pool_promise.hpp
+///
+
+#ifndef BSL_DETAILS_FRAME_POOL_PROMISE_HPP
+#define BSL_DETAILS_FRAME_POOL_PROMISE_HPP
+
+#include "../cstdint.hpp"
+#include "../discard.hpp"
+#include "../disjunction.hpp"
+#include "../frame_pool.hpp"
+#include "../is_same.hpp"
+#include "../remove_cvref.hpp"
+#include "../safe_integral.hpp"
+
+namespace bsl
+{
+    namespace details
+    {
+        /// <!-- description -->
+        ///   @brief Returns a pointer to the provided bsl::frame_pool.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param pool the bsl::frame_pool to return a pointer to
+        ///   @return Returns a pointer to the provided bsl::frame_pool.
+        ///
+        [[nodiscard]] constexpr frame_pool *
+        frame_pool_of(frame_pool &pool) noexcept
+        {
+            return &pool;
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns a nullptr as the provided argument is not a
+        ///     bsl::frame_pool.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @tparam U the type of argument that is ignored
+        ///   @param arg the argument that is ignored
+        ///   @return Returns a nullptr
+        ///
+        template<typename U>
+        [[nodiscard]] constexpr frame_pool *
+        frame_pool_of(U &arg) noexcept
+        {
+            bsl::discard(arg);
+            return nullptr;
+        }
+
+        /// @class bsl::details::frame_pool_promise
+        ///
+        /// <!-- description -->
+        ///   @brief Provides the base class for all BSL coroutine promise
+        ///     types. The compiler uses the operator new and operator
+        ///     delete functions that are provided here to allocate a
+        ///     coroutine's frame, which we take from the first
+        ///     bsl::frame_pool that is passed to the coroutine as an
+        ///     argument. Since no plain operator new is provided, a
+        ///     coroutine that is not given a bsl::frame_pool will not
+        ///     compile, which ensures that coroutine frames never come
+        ///     from the heap.
+        ///
+        class frame_pool_promise
+        {
+        public:
+            /// <!-- description -->
+            ///   @brief Allocates a coroutine frame from the first
+            ///     bsl::frame_pool in the coroutine's argument list.
+            ///     Returns a nullptr on failure, in which case the
+            ///     compiler calls get_return_object_on_allocation_failure().
+            ///
+            /// <!-- inputs/outputs -->
+            ///   @tparam ARGS the types of the coroutine's arguments
+            ///   @param size the total number of bytes to allocate
+            ///   @param args the coroutine's arguments
+            ///   @return Returns a pointer to the newly allocated frame, or
+            ///     a nullptr on failure.
+            ///
+            template<typename... ARGS>
+            [[nodiscard]] static void *
+            operator new(bsl::uintmax const size, ARGS &... args) noexcept    // PRQA S 1-10000
+            {
+                static_assert(
+                    disjunction<is_same<remove_cvref_t<ARGS>, frame_pool>...>::value,
+                    "coroutines must be given a bsl::frame_pool to allocate from");
+
+                frame_pool *pool{};
+                ((pool = (nullptr == pool) ? frame_pool_of(args) : pool), ...);
+
+                return pool->allocate(safe_uintmax{size});
+            }
+
+            /// <!-- description -->
+            ///   @brief Returns a coroutine frame back to the bsl::frame_pool
+            ///     that it was allocated from.
+            ///
+            /// <!-- inputs/outputs -->
+            ///   @param ptr a pointer to the frame to deallocate
+            ///   @param size the total number of bytes that were allocated
+            ///
+            static void
+            operator delete(void *const ptr, bsl::uintmax const size) noexcept    // PRQA S 1-10000
+            {
+                bsl::discard(size);
+                frame_pool::deallocate(ptr);
+            }
+        };
+    }
+}
+
+#endif
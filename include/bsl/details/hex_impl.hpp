@@ -0,0 +1,196 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+///
+/// @file hex_impl.hpp
+///
+
+#ifndef BSL_DETAILS_HEX_IMPL_HPP
+#define BSL_DETAILS_HEX_IMPL_HPP
+
+#include "../array.hpp"
+#include "../char_type.hpp"
+#include "../convert.hpp"
+#include "../cstdint.hpp"
+#include "../safe_integral.hpp"
+
+// Notes: --
+// - The encoder converts 4 bytes into 8 characters at a time using SWAR
+//   (SIMD within a register). The nibbles are spread into the bytes of
+//   a 64bit integer, and the ASCII digits are computed for all 8 lanes
+//   at once, so the hot loop has no table lookups and no branches.
+// - The decoder uses a 256 entry table that maps each character to its
+//   value, or to hex_bad for any character that is not a hex digit. The
+//   table results are OR'd into an accumulator that is checked once at
+//   the end, so the hot loop has no data dependent branches.
+//
+
+namespace bsl
+{
+    namespace details
+    {
+        /// @brief the value stored in the decode table for invalid chars
+        constexpr bsl::uint8 hex_bad{0xFFU};
+        /// @brief the mask of the bits that are only set by hex_bad
+        constexpr bsl::uint8 hex_bad_mask{0xF0U};
+
+        /// <!-- description -->
+        ///   @brief Returns the table used to decode hex digits. Both
+        ///     upper and lower case digits are accepted.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Returns the table used to decode hex digits
+        ///
+        [[nodiscard]] constexpr bsl::array<bsl::uint8, 256>
+        hex_make_decode_table() noexcept
+        {
+            constexpr bsl::uint8 ten{10U};
+            bsl::array<bsl::uint8, 256> tbl{};
+
+            for (bsl::safe_uintmax i{}; i < tbl.size(); ++i) {
+                *tbl.at_if(i) = hex_bad;
+            }
+
+            for (bsl::uint8 i{}; i < ten; ++i) {
+                *tbl.at_if(to_umax(static_cast<bsl::uint8>('0' + i))) = i;
+            }
+
+            for (bsl::uint8 i{}; i < static_cast<bsl::uint8>(6U); ++i) {
+                auto const val{static_cast<bsl::uint8>(ten + i)};
+                *tbl.at_if(to_umax(static_cast<bsl::uint8>('a' + i))) = val;
+                *tbl.at_if(to_umax(static_cast<bsl::uint8>('A' + i))) = val;
+            }
+
+            return tbl;
+        }
+
+        /// @brief maps a character to its value, or to hex_bad
+        constexpr bsl::array<bsl::uint8, 256> hex_decode_table{hex_make_decode_table()};
+
+        /// <!-- description -->
+        ///   @brief Returns the 8 lower case hex digits of the 4 bytes in
+        ///     val, in memory order (i.e., the digits of the first byte in
+        ///     memory are stored first).
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param val the 4 bytes to encode, as loaded from memory
+        ///   @return Returns the 8 hex digits of val
+        ///
+        [[nodiscard]] constexpr bsl::uint64
+        hex_encode4(bsl::uint32 const val) noexcept
+        {
+            constexpr bsl::uint64 mask16{0x0000FFFF0000FFFFU};
+            constexpr bsl::uint64 mask8{0x00FF00FF00FF00FFU};
+            constexpr bsl::uint64 nibble{0x000F000F000F000FU};
+            constexpr bsl::uint64 lanes{0x0F0F0F0F0F0F0F0FU};
+            constexpr bsl::uint64 ones{0x0101010101010101U};
+            constexpr bsl::uint64 six{0x0606060606060606U};
+            constexpr bsl::uint64 zero{0x3030303030303030U};
+            constexpr bsl::uint64 alpha{static_cast<bsl::uint64>('a' - '0' - 10)};
+
+            /// NOTE:
+            /// - Give each byte its own 16bit lane, then split each lane
+            ///   into its high nibble (first) and its low nibble (second).
+            ///
+
+            bsl::uint64 x{static_cast<bsl::uint64>(val)};
+            x = (x | (x << 16U)) & mask16;
+            x = (x | (x << 8U)) & mask8;
+            x = ((x >> 4U) & nibble) | ((x & nibble) << 8U);
+
+            /// NOTE:
+            /// - Every lane that holds a value larger than 9 carries into
+            ///   bit 4 once 6 is added, which selects the 'a'-'f' digits.
+            ///
+
+            bsl::uint64 const letters{((x + six) >> 4U) & ones};
+            return (x & lanes) + zero + (letters * alpha);
+        }
+
+        /// <!-- description -->
+        ///   @brief Encodes count bytes from src as 2 * count lower case
+        ///     hex digits into dst.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param src the bytes to encode
+        ///   @param count the number of bytes to encode
+        ///   @param dst where to store the hex digits
+        ///
+        inline void
+        hex_encode(bsl::uint8 const *src, bsl::uintmax count, bsl::char_type *dst) noexcept
+        {
+            constexpr bsl::uintmax chunk{4U};
+            constexpr bsl::uint8 nibble{0x0FU};
+            constexpr bsl::array<bsl::char_type, 16> digits{
+                '0', '1', '2', '3', '4', '5', '6', '7', '8', '9', 'a', 'b', 'c', 'd', 'e', 'f'};
+
+            while (count >= chunk) {
+                bsl::uint32 val{};
+                __builtin_memcpy(&val, src, sizeof(val));
+                bsl::uint64 const chars{hex_encode4(val)};
+                __builtin_memcpy(dst, &chars, sizeof(chars));
+
+                src += chunk;             // NOLINT
+                dst += chunk + chunk;     // NOLINT
+                count -= chunk;
+            }
+
+            for (bsl::uintmax i{}; i < count; ++i) {
+                bsl::uint8 const val{src[i]};    // NOLINT
+                dst[i + i] = *digits.at_if(to_umax(val >> 4U));             // NOLINT
+                dst[i + i + 1U] = *digits.at_if(to_umax(val & nibble));    // NOLINT
+            }
+        }
+
+        /// <!-- description -->
+        ///   @brief Decodes count pairs of hex digits from src into count
+        ///     bytes in dst. If src contains a character that is not a hex
+        ///     digit, false is returned and the contents of dst are
+        ///     unspecified.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param src the hex digits to decode
+        ///   @param count the number of bytes to decode
+        ///   @param dst where to store the decoded bytes
+        ///   @return Returns true if all of the characters were valid
+        ///
+        [[nodiscard]] inline bool
+        hex_decode(bsl::char_type const *src, bsl::uintmax count, bsl::uint8 *dst) noexcept
+        {
+            bsl::uint8 const *const tbl{hex_decode_table.data()};
+            bsl::uint8 bad{};
+
+            for (bsl::uintmax i{}; i < count; ++i) {
+                bsl::uint8 const hi{tbl[static_cast<bsl::uint8>(src[i + i])]};         // NOLINT
+                bsl::uint8 const lo{tbl[static_cast<bsl::uint8>(src[i + i + 1U])]};    // NOLINT
+
+                bad |= static_cast<bsl::uint8>(hi | lo);
+                dst[i] = static_cast<bsl::uint8>((hi << 4U) | lo);    // NOLINT
+            }
+
+            return 0U == (bad & hex_bad_mask);
+        }
+    }
+}
+
+#endif
@@ -0,0 +1,621 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+///
+/// @file lz4_impl.hpp
+///
+
+#ifndef BSL_DETAILS_LZ4_IMPL_HPP
+#define BSL_DETAILS_LZ4_IMPL_HPP
+
+#include "../convert.hpp"
+#include "../cstdint.hpp"
+#include "../safe_integral.hpp"
+
+// Notes: --
+// - The LZ4 block format is a sequence of (literals, match) pairs, and
+//   decoding it is dominated by small copies. To keep these fast, the
+//   codec works on raw byte pointers with explicit bounds checks, and
+//   all unaligned loads and stores are performed with __builtin_memcpy,
+//   which the compiler lowers to a single load or store.
+// - Multi-byte values (offsets and the frame fields) are little endian,
+//   as required by the LZ4 format. The loads and stores below assume a
+//   little endian target, which is true of every target the BSL supports.
+//
+
+namespace bsl
+{
+    namespace details
+    {
+        /// @brief the minimum length of a match
+        constexpr bsl::uintmax lz4_min_match{4U};
+        /// @brief the last match must start at least this far from the end
+        constexpr bsl::uintmax lz4_mf_limit{12U};
+        /// @brief the last bytes of a block are always literals
+        constexpr bsl::uintmax lz4_last_literals{5U};
+        /// @brief the max distance a match can reach back
+        constexpr bsl::uintmax lz4_max_distance{65535U};
+        /// @brief the log2 of the number of entries in the hash table
+        constexpr bsl::uintmax lz4_hash_log{12U};
+        /// @brief the number of entries in the hash table
+        constexpr bsl::uintmax lz4_hash_entries{1U << lz4_hash_log};
+        /// @brief the largest input the block compressor accepts
+        constexpr bsl::uintmax lz4_max_input{0x7E000000U};
+        /// @brief the size of a wild copy
+        constexpr bsl::uintmax lz4_wild{8U};
+        /// @brief the value of a length nibble that is extended
+        constexpr bsl::uintmax lz4_run_mask{15U};
+
+        /// <!-- description -->
+        ///   @brief Returns the (unaligned) 16bit value stored at ptr
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param ptr the address to read from
+        ///   @return Returns the (unaligned) 16bit value stored at ptr
+        ///
+        [[nodiscard]] inline bsl::uint16
+        lz4_read16(bsl::uint8 const *const ptr) noexcept
+        {
+            bsl::uint16 val{};
+            __builtin_memcpy(&val, ptr, sizeof(val));
+            return val;
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns the (unaligned) 32bit value stored at ptr
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param ptr the address to read from
+        ///   @return Returns the (unaligned) 32bit value stored at ptr
+        ///
+        [[nodiscard]] inline bsl::uint32
+        lz4_read32(bsl::uint8 const *const ptr) noexcept
+        {
+            bsl::uint32 val{};
+            __builtin_memcpy(&val, ptr, sizeof(val));
+            return val;
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns the (unaligned) 64bit value stored at ptr
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param ptr the address to read from
+        ///   @return Returns the (unaligned) 64bit value stored at ptr
+        ///
+        [[nodiscard]] inline bsl::uint64
+        lz4_read64(bsl::uint8 const *const ptr) noexcept
+        {
+            bsl::uint64 val{};
+            __builtin_memcpy(&val, ptr, sizeof(val));
+            return val;
+        }
+
+        /// <!-- description -->
+        ///   @brief Stores a 16bit value at the (unaligned) address ptr
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param ptr the address to write to
+        ///   @param val the value to write
+        ///
+        inline void
+        lz4_write16(bsl::uint8 *const ptr, bsl::uint16 const val) noexcept
+        {
+            __builtin_memcpy(ptr, &val, sizeof(val));
+        }
+
+        /// <!-- description -->
+        ///   @brief Stores a 32bit value at the (unaligned) address ptr
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param ptr the address to write to
+        ///   @param val the value to write
+        ///
+        inline void
+        lz4_write32(bsl::uint8 *const ptr, bsl::uint32 const val) noexcept
+        {
+            __builtin_memcpy(ptr, &val, sizeof(val));
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns val rotated left by r bits
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param val the value to rotate
+        ///   @param r the number of bits to rotate by (1 to 31)
+        ///   @return Returns val rotated left by r bits
+        ///
+        [[nodiscard]] constexpr bsl::uint32
+        lz4_rotl32(bsl::uint32 const val, bsl::uint32 const r) noexcept
+        {
+            constexpr bsl::uint32 bits{32U};
+            return (val << r) | (val >> (bits - r));
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns the 32bit xxHash of the provided buffer. This
+        ///     is the checksum used by the LZ4 frame format.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param buf the buffer to hash
+        ///   @param len the number of bytes in buf
+        ///   @param seed the seed of the hash
+        ///   @return Returns the 32bit xxHash of the provided buffer.
+        ///
+        [[nodiscard]] inline bsl::uint32
+        lz4_xxh32(
+            bsl::uint8 const *const buf, bsl::uintmax const len, bsl::uint32 const seed) noexcept
+        {
+            constexpr bsl::uint32 p1{2654435761U};
+            constexpr bsl::uint32 p2{2246822519U};
+            constexpr bsl::uint32 p3{3266489917U};
+            constexpr bsl::uint32 p4{668265263U};
+            constexpr bsl::uint32 p5{374761393U};
+
+            auto const round{[](bsl::uint32 const acc, bsl::uint32 const val) noexcept {
+                return lz4_rotl32(acc + (val * p2), 13U) * p1;
+            }};
+
+            bsl::uintmax i{};
+            bsl::uint32 h{};
+
+            if (len >= 16U) {
+                bsl::uint32 v1{seed + p1 + p2};
+                bsl::uint32 v2{seed + p2};
+                bsl::uint32 v3{seed};
+                bsl::uint32 v4{seed - p1};
+
+                for (; (i + 16U) <= len; i += 16U) {
+                    v1 = round(v1, lz4_read32(&buf[i]));           // NOLINT
+                    v2 = round(v2, lz4_read32(&buf[i + 4U]));      // NOLINT
+                    v3 = round(v3, lz4_read32(&buf[i + 8U]));      // NOLINT
+                    v4 = round(v4, lz4_read32(&buf[i + 12U]));     // NOLINT
+                }
+
+                h = lz4_rotl32(v1, 1U) + lz4_rotl32(v2, 7U) +
+                    lz4_rotl32(v3, 12U) + lz4_rotl32(v4, 18U);
+            }
+            else {
+                h = seed + p5;
+            }
+
+            h += static_cast<bsl::uint32>(len);
+
+            for (; (i + 4U) <= len; i += 4U) {
+                h += lz4_read32(&buf[i]) * p3;                     // NOLINT
+                h = lz4_rotl32(h, 17U) * p4;
+            }
+
+            for (; i < len; ++i) {
+                h += static_cast<bsl::uint32>(buf[i]) * p5;        // NOLINT
+                h = lz4_rotl32(h, 11U) * p1;
+            }
+
+            h ^= h >> 15U;
+            h *= p2;
+            h ^= h >> 13U;
+            h *= p3;
+            h ^= h >> 16U;
+
+            return h;
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns the hash table index for the provided sequence
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param seq the 4 bytes to hash
+        ///   @return Returns the hash table index for the provided sequence
+        ///
+        [[nodiscard]] constexpr bsl::uint32
+        lz4_hash(bsl::uint32 const seq) noexcept
+        {
+            constexpr bsl::uint32 prime{2654435761U};
+            constexpr bsl::uint32 shift{32U - static_cast<bsl::uint32>(lz4_hash_log)};
+            return (seq * prime) >> shift;
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns the number of bytes that are the same at ip
+        ///     and ref, stopping at limit.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param src the buffer being compressed
+        ///   @param ip the position being matched
+        ///   @param ref the position of the match (ref < ip)
+        ///   @param limit the position the match cannot extend past
+        ///   @return Returns the number of bytes that are the same at ip
+        ///     and ref, stopping at limit.
+        ///
+        [[nodiscard]] inline bsl::uintmax
+        lz4_count(
+            bsl::uint8 const *const src,
+            bsl::uintmax ip,
+            bsl::uintmax ref,
+            bsl::uintmax const limit) noexcept
+        {
+            bsl::uintmax const start{ip};
+
+            while ((ip + lz4_wild) <= limit) {
+                bsl::uint64 const diff{lz4_read64(&src[ip]) ^ lz4_read64(&src[ref])};    // NOLINT
+                if (0U != diff) {
+                    return (ip - start) + (static_cast<bsl::uintmax>(__builtin_ctzll(diff)) >> 3U);
+                }
+
+                ip += lz4_wild;
+                ref += lz4_wild;
+            }
+
+            while ((ip < limit) && (src[ip] == src[ref])) {    // NOLINT
+                ++ip;
+                ++ref;
+            }
+
+            return ip - start;
+        }
+
+        /// <!-- description -->
+        ///   @brief Writes the extra bytes of a length that did not fit
+        ///     into its token nibble.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param dst the buffer to write to
+        ///   @param op the position in dst to write to (updated)
+        ///   @param len the length minus lz4_run_mask
+        ///
+        inline void
+        lz4_write_len(bsl::uint8 *const dst, bsl::uintmax &op, bsl::uintmax len) noexcept
+        {
+            constexpr bsl::uintmax max_byte{255U};
+
+            while (len >= max_byte) {
+                dst[op] = static_cast<bsl::uint8>(max_byte);    // NOLINT
+                ++op;
+                len -= max_byte;
+            }
+
+            dst[op] = static_cast<bsl::uint8>(len);    // NOLINT
+            ++op;
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns the worst case number of bytes needed to encode
+        ///     a sequence with the provided literal and match lengths.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param lit the number of literals in the sequence
+        ///   @param mlen the match length minus lz4_min_match (0 if the
+        ///     sequence is the last sequence)
+        ///   @param last true if this is the last sequence (no match)
+        ///   @return Returns the worst case number of bytes needed
+        ///
+        [[nodiscard]] constexpr bsl::uintmax
+        lz4_seq_size(bsl::uintmax const lit, bsl::uintmax const mlen, bool const last) noexcept
+        {
+            constexpr bsl::uintmax max_byte{255U};
+            bsl::uintmax size{1U + lit + (lit / max_byte) + 1U};
+            if (!last) {
+                size += 2U + (mlen / max_byte) + 1U;
+            }
+
+            return size;
+        }
+
+        /// <!-- description -->
+        ///   @brief Encodes a single sequence.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param src the buffer being compressed
+        ///   @param anchor the position of the first literal
+        ///   @param lit the number of literals
+        ///   @param dst the buffer to write to
+        ///   @param op the position in dst to write to (updated)
+        ///   @param offset the distance of the match
+        ///   @param mlen the match length minus lz4_min_match
+        ///   @param last true if this is the last sequence (no match)
+        ///
+        inline void
+        lz4_write_seq(
+            bsl::uint8 const *const src,
+            bsl::uintmax const anchor,
+            bsl::uintmax const lit,
+            bsl::uint8 *const dst,
+            bsl::uintmax &op,
+            bsl::uintmax const offset,
+            bsl::uintmax const mlen,
+            bool const last) noexcept
+        {
+            bsl::uintmax const token{op};
+            ++op;
+
+            bsl::uintmax nibbles{};
+            if (lit >= lz4_run_mask) {
+                nibbles = lz4_run_mask << 4U;
+                lz4_write_len(dst, op, lit - lz4_run_mask);
+            }
+            else {
+                nibbles = lit << 4U;
+            }
+
+            __builtin_memcpy(&dst[op], &src[anchor], lit);    // NOLINT
+            op += lit;
+
+            if (!last) {
+                lz4_write16(&dst[op], static_cast<bsl::uint16>(offset));    // NOLINT
+                op += 2U;
+
+                if (mlen >= lz4_run_mask) {
+                    nibbles |= lz4_run_mask;
+                    lz4_write_len(dst, op, mlen - lz4_run_mask);
+                }
+                else {
+                    nibbles |= mlen;
+                }
+            }
+
+            dst[token] = static_cast<bsl::uint8>(nibbles);    // NOLINT
+        }
+
+        /// <!-- description -->
+        ///   @brief Compresses src into dst using the LZ4 block format and
+        ///     a greedy parse. Each position is hashed into table, and the
+        ///     previous position with the same hash is checked for a match.
+        ///     When no match is found, the search step grows slowly so that
+        ///     incompressible data is skipped quickly.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param src the buffer to compress
+        ///   @param n the number of bytes in src
+        ///   @param dst the buffer to compress to
+        ///   @param cap the number of bytes in dst
+        ///   @param table the hash table (lz4_hash_entries entries)
+        ///   @return Returns the number of bytes written to dst, or
+        ///     safe_uintmax::zero(true) if dst is too small.
+        ///
+        [[nodiscard]] inline safe_uintmax
+        lz4_compress(
+            bsl::uint8 const *const src,
+            bsl::uintmax const n,
+            bsl::uint8 *const dst,
+            bsl::uintmax const cap,
+            bsl::uint32 *const table) noexcept
+        {
+            constexpr bsl::uintmax skip_trigger{6U};
+
+            __builtin_memset(table, 0, lz4_hash_entries * sizeof(bsl::uint32));
+
+            bsl::uintmax ip{};
+            bsl::uintmax anchor{};
+            bsl::uintmax op{};
+
+            if (n > lz4_mf_limit) {
+                bsl::uintmax const mf_limit{n - lz4_mf_limit};
+                bsl::uintmax const match_limit{n - lz4_last_literals};
+
+                table[lz4_hash(lz4_read32(src))] = 0U;    // NOLINT
+                ip = 1U;
+
+                while (true) {
+                    bsl::uintmax ref{};
+                    bsl::uintmax search{1U << skip_trigger};
+                    bool found{};
+
+                    while (ip <= mf_limit) {
+                        bsl::uint32 const seq{lz4_read32(&src[ip])};    // NOLINT
+                        bsl::uint32 const h{lz4_hash(seq)};
+
+                        ref = static_cast<bsl::uintmax>(table[h]);    // NOLINT
+                        table[h] = static_cast<bsl::uint32>(ip);      // NOLINT
+
+                        if ((ref < ip) && ((ip - ref) <= lz4_max_distance) &&
+                            (lz4_read32(&src[ref]) == seq)) {    // NOLINT
+                            found = true;
+                            break;
+                        }
+
+                        ip += search >> skip_trigger;
+                        ++search;
+                    }
+
+                    if (!found) {
+                        break;
+                    }
+
+                    while ((ip > anchor) && (ref > 0U)) {
+                        if (src[ip - 1U] != src[ref - 1U]) {    // NOLINT
+                            break;
+                        }
+
+                        --ip;
+                        --ref;
+                    }
+
+                    bsl::uintmax const lit{ip - anchor};
+                    bsl::uintmax const mlen{lz4_count(
+                        src, ip + lz4_min_match, ref + lz4_min_match, match_limit)};
+
+                    if ((cap - op) < lz4_seq_size(lit, mlen, false)) {
+                        return safe_uintmax::zero(true);
+                    }
+
+                    lz4_write_seq(src, anchor, lit, dst, op, ip - ref, mlen, false);
+
+                    ip += mlen + lz4_min_match;
+                    anchor = ip;
+
+                    if (ip > mf_limit) {
+                        break;
+                    }
+
+                    bsl::uintmax const prev{ip - 2U};
+                    bsl::uint32 const key{lz4_hash(lz4_read32(&src[prev]))};    // NOLINT
+                    table[key] = static_cast<bsl::uint32>(prev);                // NOLINT
+                }
+            }
+
+            bsl::uintmax const lit{n - anchor};
+            if ((cap - op) < lz4_seq_size(lit, 0U, true)) {
+                return safe_uintmax::zero(true);
+            }
+
+            lz4_write_seq(src, anchor, lit, dst, op, 0U, 0U, true);
+            return to_umax(op);
+        }
+
+        /// <!-- description -->
+        ///   @brief Reads the extra bytes of a length that did not fit into
+        ///     its token nibble.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param src the buffer being decompressed
+        ///   @param n the number of bytes in src
+        ///   @param ip the position in src to read from (updated)
+        ///   @param len the length to add to (updated)
+        ///   @return Returns true on success, false if src is truncated.
+        ///
+        [[nodiscard]] inline bool
+        lz4_read_len(
+            bsl::uint8 const *const src,
+            bsl::uintmax const n,
+            bsl::uintmax &ip,
+            bsl::uintmax &len) noexcept
+        {
+            constexpr bsl::uint8 max_byte{255U};
+
+            bsl::uint8 b{};
+            do {
+                if (ip >= n) {
+                    return false;
+                }
+
+                b = src[ip];    // NOLINT
+                ++ip;
+                len += static_cast<bsl::uintmax>(b);
+            } while (max_byte == b);
+
+            return true;
+        }
+
+        /// <!-- description -->
+        ///   @brief Decompresses an LZ4 block from src into dst. Every read
+        ///     and write is bounds checked, so corrupt input cannot read or
+        ///     write outside of the provided buffers. When there is enough
+        ///     room left in both buffers, literals and matches are copied 8
+        ///     bytes at a time (a "wild copy"), which may write past the end
+        ///     of the copy, but never past the end of dst.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param src the block to decompress
+        ///   @param n the number of bytes in src
+        ///   @param dst the buffer to decompress to
+        ///   @param prefix the number of bytes at the start of dst that
+        ///     have already been decompressed (matches may refer to them)
+        ///   @param cap the number of bytes in dst (including the prefix)
+        ///   @return Returns the number of bytes written to dst after
+        ///     the prefix, or safe_uintmax::zero(true) if the block is
+        ///     corrupt or dst is too small.
+        ///
+        [[nodiscard]] inline safe_uintmax
+        lz4_decompress(
+            bsl::uint8 const *const src,
+            bsl::uintmax const n,
+            bsl::uint8 *const dst,
+            bsl::uintmax const prefix,
+            bsl::uintmax const cap) noexcept
+        {
+            bsl::uintmax ip{};
+            bsl::uintmax op{prefix};
+
+            while (true) {
+                if (ip >= n) {
+                    return safe_uintmax::zero(true);
+                }
+
+                bsl::uintmax const token{static_cast<bsl::uintmax>(src[ip])};    // NOLINT
+                ++ip;
+
+                bsl::uintmax lit{token >> 4U};
+                if ((lz4_run_mask == lit) && (!lz4_read_len(src, n, ip, lit))) {
+                    return safe_uintmax::zero(true);
+                }
+
+                if ((lit > (n - ip)) || (lit > (cap - op))) {
+                    return safe_uintmax::zero(true);
+                }
+
+                if (((ip + lit + lz4_wild) <= n) && ((op + lit + lz4_wild) <= cap)) {
+                    for (bsl::uintmax i{}; i < lit; i += lz4_wild) {
+                        __builtin_memcpy(&dst[op + i], &src[ip + i], lz4_wild);    // NOLINT
+                    }
+                }
+                else {
+                    __builtin_memcpy(&dst[op], &src[ip], lit);    // NOLINT
+                }
+
+                ip += lit;
+                op += lit;
+
+                if (ip == n) {
+                    return to_umax(op - prefix);
+                }
+
+                if ((n - ip) < 2U) {
+                    return safe_uintmax::zero(true);
+                }
+
+                auto const offset{static_cast<bsl::uintmax>(lz4_read16(&src[ip]))};    // NOLINT
+                ip += 2U;
+
+                if ((0U == offset) || (offset > op)) {
+                    return safe_uintmax::zero(true);
+                }
+
+                bsl::uintmax mlen{token & lz4_run_mask};
+                if ((lz4_run_mask == mlen) && (!lz4_read_len(src, n, ip, mlen))) {
+                    return safe_uintmax::zero(true);
+                }
+
+                mlen += lz4_min_match;
+                if (mlen > (cap - op)) {
+                    return safe_uintmax::zero(true);
+                }
+
+                bsl::uintmax const ref{op - offset};
+                if ((offset >= lz4_wild) && ((op + mlen + lz4_wild) <= cap)) {
+                    for (bsl::uintmax i{}; i < mlen; i += lz4_wild) {
+                        __builtin_memcpy(&dst[op + i], &dst[ref + i], lz4_wild);    // NOLINT
+                    }
+                }
+                else {
+                    for (bsl::uintmax i{}; i < mlen; ++i) {
+                        dst[op + i] = dst[ref + i];    // NOLINT
+                    }
+                }
+
+                op += mlen;
+            }
+        }
+    }
+}
+
+#endif
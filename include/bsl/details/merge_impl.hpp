@@ -0,0 +1,279 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+///
+/// @file merge_impl.hpp
+///
+
+#ifndef BSL_DETAILS_MERGE_IMPL_HPP
+#define BSL_DETAILS_MERGE_IMPL_HPP
+
+#include "../array.hpp"
+#include "../convert.hpp"
+#include "../cstdint.hpp"
+#include "../safe_integral.hpp"
+#include "../span.hpp"
+#include "../swap.hpp"
+
+namespace bsl
+{
+    namespace details
+    {
+        /// @brief the max number of runs a loser_tree can merge
+        constexpr bsl::uintmax loser_tree_max_runs{64U};
+
+        /// @class bsl::details::merge_span_sink
+        ///
+        /// <!-- description -->
+        ///   @brief The callback used to stream the output of a merge into
+        ///     a span. The caller must ensure the span is large enough.
+        ///
+        /// <!-- template parameters -->
+        ///   @tparam T the type of elements being merged
+        ///
+        template<typename T>
+        class merge_span_sink final
+        {
+            /// @brief stores the span being written to
+            span<T> m_dst;
+            /// @brief stores the index of the next element to write
+            safe_uintmax m_idx;
+
+        public:
+            /// <!-- description -->
+            ///   @brief Creates a bsl::details::merge_span_sink
+            ///
+            /// <!-- inputs/outputs -->
+            ///   @param dst the span to write to
+            ///
+            explicit constexpr merge_span_sink(span<T> const dst) noexcept
+                : m_dst{dst}, m_idx{}
+            {}
+
+            /// <!-- description -->
+            ///   @brief Writes "val" to the next element in the span
+            ///
+            /// <!-- inputs/outputs -->
+            ///   @param val the value to write
+            ///
+            constexpr void
+            operator()(T const &val) noexcept
+            {
+                *m_dst.at_if(m_idx) = val;
+                ++m_idx;
+            }
+        };
+
+        /// @class bsl::details::loser_tree
+        ///
+        /// <!-- description -->
+        ///   @brief Implements a tournament tree of losers over up to
+        ///     loser_tree_max_runs sorted runs. Each internal node stores
+        ///     the run that lost the match played at that node, and the
+        ///     overall winner is stored separately. Taking the winner only
+        ///     requires replaying the matches on the path from its leaf to
+        ///     the root, which is log2(runs) comparisons, one per level,
+        ///     with no sibling lookups (unlike a binary heap). Ties are
+        ///     won by the run with the lower index, which makes the merge
+        ///     stable. All of the state is stored in the tree itself, so
+        ///     nothing is allocated.
+        ///
+        /// <!-- template parameters -->
+        ///   @tparam T the type of elements being merged
+        ///
+        template<typename T>
+        class loser_tree final
+        {
+            /// @brief stores the runs being merged
+            array<span<T const>, loser_tree_max_runs> m_runs;
+            /// @brief stores the index of the head of each run
+            array<bsl::uintmax, loser_tree_max_runs> m_pos;
+            /// @brief stores the loser of each internal node (1 is the root)
+            array<bsl::uintmax, loser_tree_max_runs> m_loser;
+            /// @brief stores the number of runs being merged
+            safe_uintmax m_num_runs;
+            /// @brief stores the number of leaves (a power of 2)
+            safe_uintmax m_num_leaves;
+            /// @brief stores the run that won the tournament
+            bsl::uintmax m_winner;
+
+            /// <!-- description -->
+            ///   @brief Returns true if "run" has no elements left. Leaves
+            ///     that do not have a run are always empty.
+            ///
+            /// <!-- inputs/outputs -->
+            ///   @param run the index of the run to query
+            ///   @return Returns true if "run" has no elements left
+            ///
+            [[nodiscard]] constexpr bool
+            exhausted(bsl::uintmax const run) const noexcept
+            {
+                if (to_umax(run) >= m_num_runs) {
+                    return true;
+                }
+
+                return *m_pos.at_if(to_umax(run)) >= m_runs.at_if(to_umax(run))->size();
+            }
+
+            /// <!-- description -->
+            ///   @brief Returns a pointer to the head of "run". The run
+            ///     must not be exhausted.
+            ///
+            /// <!-- inputs/outputs -->
+            ///   @param run the index of the run to query
+            ///   @return Returns a pointer to the head of "run"
+            ///
+            [[nodiscard]] constexpr T const *
+            head(bsl::uintmax const run) const noexcept
+            {
+                return m_runs.at_if(to_umax(run))->at_if(to_umax(*m_pos.at_if(to_umax(run))));
+            }
+
+            /// <!-- description -->
+            ///   @brief Returns true if the head of run "lhs" should be
+            ///     merged before the head of run "rhs".
+            ///
+            /// <!-- inputs/outputs -->
+            ///   @tparam COMP the type of comparison to use
+            ///   @param lhs the index of the first run
+            ///   @param rhs the index of the second run
+            ///   @param comp the comparison to use
+            ///   @return Returns true if "lhs" beats "rhs"
+            ///
+            template<typename COMP>
+            [[nodiscard]] constexpr bool
+            beats(bsl::uintmax const lhs, bsl::uintmax const rhs, COMP &comp) const noexcept
+            {
+                if (this->exhausted(lhs)) {
+                    return false;
+                }
+
+                if (this->exhausted(rhs)) {
+                    return true;
+                }
+
+                if (comp(*this->head(rhs), *this->head(lhs))) {
+                    return false;
+                }
+
+                if (comp(*this->head(lhs), *this->head(rhs))) {
+                    return true;
+                }
+
+                return lhs < rhs;
+            }
+
+        public:
+            /// <!-- description -->
+            ///   @brief Creates a bsl::details::loser_tree and plays the
+            ///     initial tournament. The caller must ensure that there
+            ///     are no more than loser_tree_max_runs runs.
+            ///
+            /// <!-- inputs/outputs -->
+            ///   @tparam RUNS the type of view storing the runs
+            ///   @tparam COMP the type of comparison to use
+            ///   @param runs the sorted runs to merge
+            ///   @param comp the comparison to use
+            ///
+            template<typename RUNS, typename COMP>
+            constexpr loser_tree(RUNS const &runs, COMP &comp) noexcept
+                : m_runs{}
+                , m_pos{}
+                , m_loser{}
+                , m_num_runs{runs.size()}
+                , m_num_leaves{to_umax(1)}
+                , m_winner{}
+            {
+                for (safe_uintmax i{}; i < m_num_runs; ++i) {
+                    *m_runs.at_if(i) = *runs.at_if(i);
+                }
+
+                while (m_num_leaves < m_num_runs) {
+                    m_num_leaves *= to_umax(2);
+                }
+
+                /// NOTE:
+                /// - The initial tournament is played bottom up, using a
+                ///   temporary tree of winners. Node n has children 2n
+                ///   and 2n + 1, and the leaves start at m_num_leaves.
+                ///
+
+                array<bsl::uintmax, loser_tree_max_runs + loser_tree_max_runs> winners{};
+                for (safe_uintmax i{}; i < m_num_leaves; ++i) {
+                    *winners.at_if(m_num_leaves + i) = i.get();
+                }
+
+                for (safe_uintmax n{m_num_leaves - to_umax(1)}; n.is_pos(); --n) {
+                    bsl::uintmax const lhs{*winners.at_if(n * to_umax(2))};
+                    bsl::uintmax const rhs{*winners.at_if((n * to_umax(2)) + to_umax(1))};
+
+                    if (this->beats(lhs, rhs, comp)) {
+                        *winners.at_if(n) = lhs;
+                        *m_loser.at_if(n) = rhs;
+                    }
+                    else {
+                        *winners.at_if(n) = rhs;
+                        *m_loser.at_if(n) = lhs;
+                    }
+                }
+
+                m_winner = *winners.at_if(to_umax(1));
+            }
+
+            /// <!-- description -->
+            ///   @brief Removes the smallest head from the runs being
+            ///     merged, and returns a pointer to it. Returns a nullptr
+            ///     once all of the runs are exhausted.
+            ///
+            /// <!-- inputs/outputs -->
+            ///   @tparam COMP the type of comparison to use
+            ///   @param comp the comparison to use
+            ///   @return Returns a pointer to the next element in the
+            ///     merge, or a nullptr once all of the runs are exhausted.
+            ///
+            template<typename COMP>
+            [[nodiscard]] constexpr T const *
+            next(COMP &comp) noexcept
+            {
+                if (this->exhausted(m_winner)) {
+                    return nullptr;
+                }
+
+                T const *const ptr{this->head(m_winner)};
+                ++*m_pos.at_if(to_umax(m_winner));
+
+                safe_uintmax n{(m_num_leaves + to_umax(m_winner)) / to_umax(2)};
+                for (; n.is_pos(); n /= to_umax(2)) {
+                    bsl::uintmax *const loser{m_loser.at_if(n)};
+                    if (this->beats(*loser, m_winner, comp)) {
+                        bsl::swap(*loser, m_winner);
+                    }
+                }
+
+                return ptr;
+            }
+        };
+    }
+}
+
+#endif
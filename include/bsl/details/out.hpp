@@ -30,9 +30,9 @@
 
 #include "out_type_alert.hpp"
 #include "out_type_debug.hpp"
-#include "out_type_empty.hpp"
 #include "out_type_error.hpp"
 #include "out_type_print.hpp"
+#include "out_type_record.hpp"
 #include "putc_stdout.hpp"
 #include "putc_stderr.hpp"
 #include "puts_stdout.hpp"
@@ -41,6 +41,7 @@
 #include "../color.hpp"
 #include "../char_type.hpp"
 #include "../cstr_type.hpp"
+#include "../flight_recorder.hpp"
 #include "../is_constant_evaluated.hpp"
 #include "../is_same.hpp"
 
@@ -52,14 +53,17 @@ namespace bsl
     ///   @brief Used to output characters and strings to stdout and stderr.
     ///     This class accepts "labels" which determines whether the output
     ///     goes to stdout or stderr and whether or not a prefix is printed
-    ///     such as "DEBUG". Note that this class is written such that it
-    ///     is completely compiled out during compilation as it has not
-    ///     member variables, or non-static member functions (i.e., everything
-    ///     is a constexpr). Note that you should not use this class
-    ///     directly but instead should use one of the functions from debug.hpp
-    //.     which ensures debug levels are handled properly. The only time
-    //      your code might use this class is when defining your own fmt_impl
-    //      function for overloading fmt.
+    ///     such as "DEBUG". Output that is filtered by the debug level is
+    ///     not discarded. It is formatted as usual and written to the
+    ///     calling thread's bsl::flight_recorder, which is dumped before
+    ///     the next "ERROR" label is printed. Filtered output therefore
+    ///     still costs the formatting and a copy into the recorder at
+    ///     runtime. The class itself has no member variables, and nothing
+    ///     is output during constant evaluation. Note that you should not
+    ///     use this class directly but instead should use one of the
+    ///     functions from debug.hpp which ensures debug levels are handled
+    ///     properly. The only time your code might use this class is when
+    ///     defining your own fmt_impl function for overloading fmt.
     ///
     /// <!-- notes -->
     ///   @note This class exists in the details folder because it is
@@ -81,6 +85,12 @@ namespace bsl
         ///
         constexpr out() noexcept
         {
+            if constexpr (is_record() && !BSL_PERFORCE) {
+                if (!is_constant_evaluated()) {
+                    this_thread_flight_recorder().begin();
+                }
+            }
+
             if constexpr (is_debug()) {
                 write(bsl::bold_green);
                 write("DEBUG ");
@@ -94,6 +104,7 @@ namespace bsl
             }
 
             if constexpr (is_error()) {
+                dump_flight_recorder();
                 write(bsl::bold_red);
                 write("ERROR ");
                 write(bsl::reset_color);
@@ -101,21 +112,19 @@ namespace bsl
         }
 
         /// <!-- description -->
-        ///   @brief Returns true if this bsl::out represents an empty out
-        ///     operation which will ignore all commands given to it. This
-        ///     occurs when the debug statement's debug level is greater
-        ///     than the current global debug level.
+        ///   @brief Always returns false. Output that is filtered by the
+        ///     debug level goes to the calling thread's
+        ///     bsl::flight_recorder, so no bsl::out ignores what it is
+        ///     given. This remains so that fmt_impl functions that test
+        ///     for an empty bsl::out continue to compile.
         ///
         /// <!-- inputs/outputs -->
-        ///   @return Returns true if this bsl::out represents an empty out
-        ///     operation which will ignore all commands given to it. This
-        ///     occurs when the debug statement's debug level is greater
-        ///     than the current global debug level.
+        ///   @return Always returns false
         ///
         [[nodiscard]] static constexpr bool
         empty() noexcept
         {
-            return is_same<T, details::out_type_empty>::value;
+            return false;
         }
 
         /// <!-- description -->
@@ -126,7 +135,7 @@ namespace bsl
         ///
         [[nodiscard]] constexpr explicit operator bool() const noexcept
         {
-            return !is_same<T, details::out_type_empty>::value;
+            return !empty();
         }
 
         /// <!-- description -->
@@ -185,6 +194,48 @@ namespace bsl
             return is_same<T, details::out_type_error>::value;
         }
 
+        /// <!-- description -->
+        ///   @brief Returns true if this bsl::out functions as a filtered
+        ///     debug() or alert() which outputs to the calling thread's
+        ///     bsl::flight_recorder instead of stdout or stderr.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Returns true if this bsl::out functions as a filtered
+        ///     debug() or alert() which outputs to the calling thread's
+        ///     bsl::flight_recorder instead of stdout or stderr.
+        ///
+        [[nodiscard]] static constexpr bool
+        is_record() noexcept
+        {
+            return is_same<T, details::out_type_record>::value;
+        }
+
+        /// <!-- description -->
+        ///   @brief Outputs the calling thread's bsl::flight_recorder to
+        ///     stderr (if it is not empty) and then clears it, so that
+        ///     each bsl::error() only dumps the records that were added
+        ///     since the last one.
+        ///
+        static constexpr void
+        dump_flight_recorder() noexcept
+        {
+            if (is_constant_evaluated()) {
+                return;
+            }
+
+            if constexpr (BSL_PERFORCE) {
+                return;
+            }
+
+            flight_recorder &recorder{this_thread_flight_recorder()};
+            if (0U == recorder.size()) {
+                return;
+            }
+
+            details::write_flight_recorder<out<T>>(recorder);
+            recorder.clear();
+        }
+
         /// <!-- description -->
         ///   @brief Outputs a character to either stdout or stderr,
         ///     depending on the bsl::out's label.
@@ -218,6 +269,10 @@ namespace bsl
             if constexpr (is_error()) {
                 details::putc_stderr(c);
             }
+
+            if constexpr (is_record()) {
+                this_thread_flight_recorder().put(c);
+            }
         }
 
         /// <!-- description -->
@@ -254,6 +309,10 @@ namespace bsl
             if constexpr (is_error()) {
                 details::puts_stderr(str);
             }
+
+            if constexpr (is_record()) {
+                this_thread_flight_recorder().put(str);
+            }
         }
     };
 }
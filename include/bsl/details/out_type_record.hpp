@@ -22,64 +22,64 @@
 /// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
 /// SOFTWARE.
 
-#ifndef BSL_DETAILS_OUT_TYPE_EMPTY_HPP
-#define BSL_DETAILS_OUT_TYPE_EMPTY_HPP
+#ifndef BSL_DETAILS_OUT_TYPE_RECORD_HPP
+#define BSL_DETAILS_OUT_TYPE_RECORD_HPP
 
 namespace bsl
 {
     namespace details
     {
-        /// @class bsl::out_type_empty
+        /// @class bsl::out_type_record
         ///
         /// <!-- description -->
         ///   @brief Used by out to define different versions of out
         ///
-        class out_type_empty final
+        class out_type_record final
         {
         public:
             /// <!-- description -->
-            ///   @brief Used to define bsl::out_type_empty as useless
+            ///   @brief Used to define bsl::out_type_record as useless
             ///
-            constexpr out_type_empty() noexcept = delete;
+            constexpr out_type_record() noexcept = delete;
 
             /// <!-- description -->
-            ///   @brief Used to define bsl::out_type_empty as useless
+            ///   @brief Used to define bsl::out_type_record as useless
             ///
-            ~out_type_empty() noexcept = delete;
+            ~out_type_record() noexcept = delete;
 
             /// <!-- description -->
-            ///   @brief Used to define bsl::out_type_empty as useless
+            ///   @brief Used to define bsl::out_type_record as useless
             ///
             /// <!-- inputs/outputs -->
             ///   @param o the object being copied
             ///
-            constexpr out_type_empty(out_type_empty const &o) noexcept = delete;
+            constexpr out_type_record(out_type_record const &o) noexcept = delete;
 
             /// <!-- description -->
-            ///   @brief Used to define bsl::out_type_empty as useless
+            ///   @brief Used to define bsl::out_type_record as useless
             ///
             /// <!-- inputs/outputs -->
             ///   @param o the object being moved
             ///
-            constexpr out_type_empty(out_type_empty &&o) noexcept = delete;
+            constexpr out_type_record(out_type_record &&o) noexcept = delete;
 
             /// <!-- description -->
-            ///   @brief Used to define bsl::out_type_empty as useless
+            ///   @brief Used to define bsl::out_type_record as useless
             ///
             /// <!-- inputs/outputs -->
             ///   @param o the object being copied
             ///   @return a reference to *this
             ///
-            constexpr out_type_empty &operator=(out_type_empty const &o) &noexcept = delete;
+            constexpr out_type_record &operator=(out_type_record const &o) &noexcept = delete;
 
             /// <!-- description -->
-            ///   @brief Used to define bsl::out_type_empty as useless
+            ///   @brief Used to define bsl::out_type_record as useless
             ///
             /// <!-- inputs/outputs -->
             ///   @param o the object being moved
             ///   @return a reference to *this
             ///
-            constexpr out_type_empty &operator=(out_type_empty &&o) &noexcept = delete;
+            constexpr out_type_record &operator=(out_type_record &&o) &noexcept = delete;
         };
     }
 }
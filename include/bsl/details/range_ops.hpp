@@ -0,0 +1,209 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+///
+/// @file range_ops.hpp
+///
+
+#ifndef BSL_DETAILS_RANGE_OPS_HPP
+#define BSL_DETAILS_RANGE_OPS_HPP
+
+#include "../cstdint.hpp"
+
+// Notes: --
+// - These are the run-time kernels used by the range mutating algorithms
+//   (bsl::reverse, bsl::rotate, bsl::swap_ranges, bsl::shift_left and
+//   bsl::shift_right) when the element type is trivially copyable. Such
+//   types can be moved around as raw bytes, which lets the kernels work
+//   on whole blocks with __builtin_memcpy/__builtin_memmove (which the
+//   compiler lowers to vector loads and stores) instead of one element
+//   at a time through at_if().
+// - None of these are constexpr. The algorithms only call them when
+//   bsl::is_constant_evaluated() is false, and fall back to a portable
+//   element by element loop otherwise.
+// - All of the kernels assume the caller has already validated the
+//   pointers and counts.
+//
+
+namespace bsl
+{
+    namespace details
+    {
+        /// @brief the number of bytes swapped at a time by range_swap
+        constexpr bsl::uintmax range_block{64U};
+        /// @brief the number of bytes reversed at a time by range_reverse
+        constexpr bsl::uintmax range_word{8U};
+
+        /// <!-- description -->
+        ///   @brief Reverses "count" bytes in place. The bytes are
+        ///     reversed 8 at a time from both ends using a byte swap (a
+        ///     single instruction on every target the BSL supports), and
+        ///     the remaining middle bytes are swapped one at a time.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param ptr a pointer to the bytes to reverse
+        ///   @param count the number of bytes to reverse
+        ///
+        inline void
+        range_reverse_bytes(bsl::uint8 *const ptr, bsl::uintmax const count) noexcept
+        {
+            bsl::uintmax lo{};
+            bsl::uintmax hi{count};
+
+            while ((hi - lo) >= (range_word + range_word)) {
+                bsl::uint64 front{};
+                bsl::uint64 back{};
+                __builtin_memcpy(&front, &ptr[lo], range_word);                // NOLINT
+                __builtin_memcpy(&back, &ptr[hi - range_word], range_word);    // NOLINT
+
+                front = __builtin_bswap64(front);
+                back = __builtin_bswap64(back);
+
+                __builtin_memcpy(&ptr[lo], &back, range_word);                  // NOLINT
+                __builtin_memcpy(&ptr[hi - range_word], &front, range_word);    // NOLINT
+
+                lo += range_word;
+                hi -= range_word;
+            }
+
+            while ((hi - lo) > 1U) {
+                --hi;
+                bsl::uint8 const tmp{ptr[lo]};    // NOLINT
+                ptr[lo] = ptr[hi];                // NOLINT
+                ptr[hi] = tmp;                    // NOLINT
+                ++lo;
+            }
+        }
+
+        /// <!-- description -->
+        ///   @brief Reverses "count" elements of a trivially copyable type
+        ///     in place. Single byte types use range_reverse_bytes. Larger
+        ///     types are swapped using a simple pointer loop, which the
+        ///     compiler vectorizes using shuffles.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @tparam T the type of element to reverse
+        ///   @param ptr a pointer to the elements to reverse
+        ///   @param count the number of elements to reverse
+        ///
+        template<typename T>
+        inline void
+        range_reverse(T *const ptr, bsl::uintmax const count) noexcept
+        {
+            if constexpr (sizeof(T) == 1U) {
+                range_reverse_bytes(reinterpret_cast<bsl::uint8 *>(ptr), count);    // NOLINT
+            }
+            else {
+                bsl::uintmax lo{};
+                bsl::uintmax hi{count};
+                while ((hi - lo) > 1U) {
+                    --hi;
+                    T const tmp{ptr[lo]};    // NOLINT
+                    ptr[lo] = ptr[hi];       // NOLINT
+                    ptr[hi] = tmp;           // NOLINT
+                    ++lo;
+                }
+            }
+        }
+
+        /// <!-- description -->
+        ///   @brief Swaps "count" elements of a trivially copyable type
+        ///     between two ranges that do not overlap. The ranges are
+        ///     swapped as raw bytes, 64 bytes (one cache line) at a time,
+        ///     and the remaining bytes are swapped one at a time.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @tparam T the type of element to swap
+        ///   @param lhs a pointer to the first range
+        ///   @param rhs a pointer to the second range
+        ///   @param count the number of elements to swap
+        ///
+        template<typename T>
+        inline void
+        range_swap(T *const lhs, T *const rhs, bsl::uintmax const count) noexcept
+        {
+            auto *const a{reinterpret_cast<bsl::uint8 *>(lhs)};    // NOLINT
+            auto *const b{reinterpret_cast<bsl::uint8 *>(rhs)};    // NOLINT
+            bsl::uintmax const bytes{count * sizeof(T)};
+
+            bsl::uintmax i{};
+            for (; (bytes - i) >= range_block; i += range_block) {
+                bsl::uint8 tmp[range_block];                    // NOLINT
+                __builtin_memcpy(tmp, &a[i], range_block);      // NOLINT
+                __builtin_memcpy(&a[i], &b[i], range_block);    // NOLINT
+                __builtin_memcpy(&b[i], tmp, range_block);      // NOLINT
+            }
+
+            for (; i < bytes; ++i) {
+                bsl::uint8 const tmp{a[i]};    // NOLINT
+                a[i] = b[i];                   // NOLINT
+                b[i] = tmp;                    // NOLINT
+            }
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns true if the ranges [lhs, lhs + count) and
+        ///     [rhs, rhs + count) overlap.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @tparam T the type of element in each range
+        ///   @param lhs a pointer to the first range
+        ///   @param rhs a pointer to the second range
+        ///   @param count the number of elements in each range
+        ///   @return Returns true if the ranges overlap
+        ///
+        template<typename T>
+        [[nodiscard]] inline bool
+        range_overlaps(T const *const lhs, T const *const rhs, bsl::uintmax const count) noexcept
+        {
+            auto const a{reinterpret_cast<bsl::uintptr>(lhs)};    // NOLINT
+            auto const b{reinterpret_cast<bsl::uintptr>(rhs)};    // NOLINT
+            bsl::uintptr const bytes{count * sizeof(T)};
+
+            if (a < b) {
+                return (b - a) < bytes;
+            }
+
+            return (a - b) < bytes;
+        }
+
+        /// <!-- description -->
+        ///   @brief Moves "count" elements of a trivially copyable type
+        ///     from "src" to "dst". The ranges may overlap.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @tparam T the type of element to move
+        ///   @param dst a pointer to where the elements are moved to
+        ///   @param src a pointer to the elements to move
+        ///   @param count the number of elements to move
+        ///
+        template<typename T>
+        inline void
+        range_move(T *const dst, T const *const src, bsl::uintmax const count) noexcept
+        {
+            __builtin_memmove(dst, src, count * sizeof(T));
+        }
+    }
+}
+
+#endif
@@ -0,0 +1,359 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+///
+/// @file reduce_impl.hpp
+///
+
+#ifndef BSL_DETAILS_REDUCE_IMPL_HPP
+#define BSL_DETAILS_REDUCE_IMPL_HPP
+
+#include "../byte.hpp"
+#include "../cstdint.hpp"
+#include "../invoke.hpp"
+#include "../is_integral.hpp"
+#include "../is_same.hpp"
+
+// Notes: --
+// - These are the kernels used by the query algorithms (bsl::count,
+//   bsl::find_if, bsl::min_element, etc.). They work on a raw pointer and
+//   count, which the algorithms get from the view once, so the inner
+//   loops do not pay for a bounds check on every element and are free of
+//   anything that would stop the compiler from vectorizing them.
+// - Predicates are evaluated a block at a time without branching on the
+//   result, and the result of the block is only checked at the end of
+//   the block. For simple predicates this lets the compiler vectorize
+//   the block, while still stopping early.
+// - Counting single byte elements at run-time is done 8 bytes at a time
+//   using SWAR (SIMD within a register), which runs at close to memory
+//   bandwidth without depending on a particular instruction set.
+// - All of the kernels assume the caller has already validated the
+//   pointers and counts.
+//
+
+namespace bsl
+{
+    namespace details
+    {
+        /// @brief the number of elements a predicate is evaluated on at a time
+        constexpr bsl::uintmax reduce_block{16U};
+        /// @brief the number of bytes counted at a time by reduce_count_bytes
+        constexpr bsl::uintmax reduce_word{8U};
+
+        /// @class bsl::details::reduce_not
+        ///
+        /// <!-- description -->
+        ///   @brief Wraps a predicate and returns the opposite of it.
+        ///     Used to implement bsl::all_of using bsl::details::reduce_find_if.
+        ///
+        /// <!-- template parameters -->
+        ///   @tparam PRED the type of predicate to wrap
+        ///
+        template<typename PRED>
+        class reduce_not final
+        {
+            /// @brief stores the predicate being wrapped
+            PRED &m_pred;
+
+        public:
+            /// <!-- description -->
+            ///   @brief Creates a bsl::details::reduce_not
+            ///
+            /// <!-- inputs/outputs -->
+            ///   @param pred the predicate to wrap
+            ///
+            explicit constexpr reduce_not(PRED &pred) noexcept : m_pred{pred}
+            {}
+
+            /// <!-- description -->
+            ///   @brief Returns !pred(elem)
+            ///
+            /// <!-- inputs/outputs -->
+            ///   @tparam T the type of element to test
+            ///   @param elem the element to test
+            ///   @return Returns !pred(elem)
+            ///
+            template<typename T>
+            [[nodiscard]] constexpr bool
+            operator()(T const &elem) const noexcept
+            {
+                return !bsl::invoke(m_pred, elem);
+            }
+        };
+
+        /// <!-- description -->
+        ///   @brief Returns the value of a single byte element as a
+        ///     bsl::uint8.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @tparam T the type of element to convert
+        ///   @param val the element to convert
+        ///   @return Returns the value of "val" as a bsl::uint8
+        ///
+        template<typename T>
+        [[nodiscard]] constexpr bsl::uint8
+        reduce_to_u8(T const &val) noexcept
+        {
+            if constexpr (is_same<T, bsl::byte>::value) {
+                return val.to_integer();
+            }
+            else {
+                return static_cast<bsl::uint8>(val);
+            }
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns the number of bytes equal to "val". Each 8
+        ///     byte word is XOR'd with "val" repeated 8 times, which turns
+        ///     each matching byte into 0, and the zero bytes are then
+        ///     counted exactly using a population count.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param ptr a pointer to the bytes to count
+        ///   @param count the number of bytes to count
+        ///   @param val the byte to count
+        ///   @return Returns the number of bytes equal to "val"
+        ///
+        inline bsl::uintmax
+        reduce_count_bytes(
+            bsl::uint8 const *const ptr, bsl::uintmax const count, bsl::uint8 const val) noexcept
+        {
+            constexpr bsl::uint64 ones{0x0101010101010101U};
+            constexpr bsl::uint64 low7{0x7F7F7F7F7F7F7F7FU};
+            constexpr bsl::uint64 high{0x8080808080808080U};
+
+            bsl::uint64 const pattern{ones * static_cast<bsl::uint64>(val)};
+
+            bsl::uintmax total{};
+            bsl::uintmax i{};
+            for (; (i + reduce_word) <= count; i += reduce_word) {
+                bsl::uint64 word{};
+                __builtin_memcpy(&word, &ptr[i], reduce_word);    // NOLINT
+                word ^= pattern;
+
+                /// NOTE:
+                /// - The high bit of each byte of "set" is 1 if any bit of
+                ///   that byte in "word" is 1. Adding 0x7F to the low 7
+                ///   bits cannot carry into the next byte.
+                ///
+
+                bsl::uint64 const set{((word & low7) + low7) | word};
+                total += static_cast<bsl::uintmax>(__builtin_popcountll(~set & high));
+            }
+
+            for (; i < count; ++i) {
+                total += static_cast<bsl::uintmax>(ptr[i] == val);    // NOLINT
+            }
+
+            return total;
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns the number of elements equal to "val"
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @tparam T the type of element to count
+        ///   @param ptr a pointer to the elements to count
+        ///   @param count the number of elements to count
+        ///   @param val the value to count
+        ///   @return Returns the number of elements equal to "val"
+        ///
+        template<typename T>
+        [[nodiscard]] constexpr bsl::uintmax
+        reduce_count(T const *const ptr, bsl::uintmax const count, T const &val) noexcept
+        {
+            bsl::uintmax total{};
+            for (bsl::uintmax i{}; i < count; ++i) {
+                total += static_cast<bsl::uintmax>(ptr[i] == val);    // NOLINT
+            }
+
+            return total;
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns the number of elements for which "pred"
+        ///     returns true
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @tparam T the type of element to count
+        ///   @tparam PRED the type of predicate to use
+        ///   @param ptr a pointer to the elements to count
+        ///   @param count the number of elements to count
+        ///   @param pred the predicate to use
+        ///   @return Returns the number of elements for which "pred"
+        ///     returns true
+        ///
+        template<typename T, typename PRED>
+        [[nodiscard]] constexpr bsl::uintmax
+        reduce_count_if(T const *const ptr, bsl::uintmax const count, PRED &pred) noexcept
+        {
+            bsl::uintmax total{};
+            for (bsl::uintmax i{}; i < count; ++i) {
+                bool const hit{bsl::invoke(pred, ptr[i])};    // NOLINT
+                total += static_cast<bsl::uintmax>(hit);
+            }
+
+            return total;
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns the index of the first element for which
+        ///     "pred" returns true, or "count" if there is no such
+        ///     element. The elements are tested a block at a time, and
+        ///     the search stops at the end of the first block with a hit.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @tparam T the type of element to search
+        ///   @tparam PRED the type of predicate to use
+        ///   @param ptr a pointer to the elements to search
+        ///   @param count the number of elements to search
+        ///   @param pred the predicate to use
+        ///   @return Returns the index of the first element for which
+        ///     "pred" returns true, or "count" if there is no such element
+        ///
+        template<typename T, typename PRED>
+        [[nodiscard]] constexpr bsl::uintmax
+        reduce_find_if(T const *const ptr, bsl::uintmax const count, PRED &pred) noexcept
+        {
+            for (bsl::uintmax i{}; i < count; i += reduce_block) {
+                bsl::uintmax const end{((count - i) < reduce_block) ? count : (i + reduce_block)};
+
+                bsl::uintmax first{end};
+                for (bsl::uintmax j{i}; j < end; ++j) {
+                    bool const hit{bsl::invoke(pred, ptr[j])};    // NOLINT
+                    first = (hit && (first == end)) ? j : first;
+                }
+
+                if (first != end) {
+                    return first;
+                }
+            }
+
+            return count;
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns the index of the first smallest element, as
+        ///     ordered by "comp". "count" must not be 0. If T is an
+        ///     integral and "comp" is operator<, the smallest value is
+        ///     found first (which vectorizes), followed by its index.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @tparam FAST true if T is an integral ordered by operator<
+        ///   @tparam T the type of element to search
+        ///   @tparam COMP the type of comparison to use
+        ///   @param ptr a pointer to the elements to search
+        ///   @param count the number of elements to search
+        ///   @param comp the comparison to use
+        ///   @return Returns the index of the first smallest element
+        ///
+        template<bool FAST, typename T, typename COMP>
+        [[nodiscard]] constexpr bsl::uintmax
+        reduce_min_index(T const *const ptr, bsl::uintmax const count, COMP &comp) noexcept
+        {
+            if constexpr (FAST) {
+                T best{ptr[0]};    // NOLINT
+                for (bsl::uintmax i{1U}; i < count; ++i) {
+                    best = (ptr[i] < best) ? ptr[i] : best;    // NOLINT
+                }
+
+                bsl::uintmax idx{};
+                while (ptr[idx] != best) {    // NOLINT
+                    ++idx;
+                }
+
+                return idx;
+            }
+            else {
+                bsl::uintmax idx{};
+                for (bsl::uintmax i{1U}; i < count; ++i) {
+                    idx = bsl::invoke(comp, ptr[i], ptr[idx]) ? i : idx;    // NOLINT
+                }
+
+                return idx;
+            }
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns the index of the first (or last if LAST is
+        ///     true) largest element, as ordered by "comp". "count" must
+        ///     not be 0. If T is an integral and "comp" is operator<, the
+        ///     largest value is found first (which vectorizes), followed
+        ///     by its index.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @tparam FAST true if T is an integral ordered by operator<
+        ///   @tparam LAST true to return the last largest element
+        ///   @tparam T the type of element to search
+        ///   @tparam COMP the type of comparison to use
+        ///   @param ptr a pointer to the elements to search
+        ///   @param count the number of elements to search
+        ///   @param comp the comparison to use
+        ///   @return Returns the index of the first (or last) largest
+        ///     element
+        ///
+        template<bool FAST, bool LAST, typename T, typename COMP>
+        [[nodiscard]] constexpr bsl::uintmax
+        reduce_max_index(T const *const ptr, bsl::uintmax const count, COMP &comp) noexcept
+        {
+            if constexpr (FAST) {
+                T best{ptr[0]};    // NOLINT
+                for (bsl::uintmax i{1U}; i < count; ++i) {
+                    best = (best < ptr[i]) ? ptr[i] : best;    // NOLINT
+                }
+
+                if constexpr (LAST) {
+                    bsl::uintmax idx{count - 1U};
+                    while (ptr[idx] != best) {    // NOLINT
+                        --idx;
+                    }
+
+                    return idx;
+                }
+                else {
+                    bsl::uintmax idx{};
+                    while (ptr[idx] != best) {    // NOLINT
+                        ++idx;
+                    }
+
+                    return idx;
+                }
+            }
+            else {
+                bsl::uintmax idx{};
+                for (bsl::uintmax i{1U}; i < count; ++i) {
+                    if constexpr (LAST) {
+                        idx = bsl::invoke(comp, ptr[i], ptr[idx]) ? idx : i;    // NOLINT
+                    }
+                    else {
+                        idx = bsl::invoke(comp, ptr[idx], ptr[i]) ? i : idx;    // NOLINT
+                    }
+                }
+
+                return idx;
+            }
+        }
+    }
+}
+
+#endif
@@ -0,0 +1,272 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+///
+/// @file scan_impl.hpp
+///
+
+#ifndef BSL_DETAILS_SCAN_IMPL_HPP
+#define BSL_DETAILS_SCAN_IMPL_HPP
+
+#include "../convert.hpp"
+#include "../cstdint.hpp"
+#include "../cstr_type.hpp"
+#include "../debug.hpp"
+#include "../discard.hpp"
+#include "../errc_type.hpp"
+#include "../invoke.hpp"
+#include "../is_nothrow_invocable.hpp"
+#include "../is_signed.hpp"
+#include "../result.hpp"
+#include "../safe_integral.hpp"
+#include "../span.hpp"
+
+// Notes: --
+// - The scans run in blocks of scan_block elements. Inside of a block,
+//   the running total is kept in a raw integral (so that it can live in
+//   a register) and each add reports its overflow into a sticky flag
+//   instead of branching. The flag is only checked at the end of each
+//   block, which keeps the inner loop free of branches and lets the
+//   compiler unroll and vectorize it.
+// - Elements that are a bsl::safe_integral are scanned using their raw
+//   value, and an element that has already experienced an error is
+//   treated the same as an overflow.
+//
+
+namespace bsl
+{
+    namespace details
+    {
+        /// @brief the number of elements scanned between overflow checks
+        constexpr bsl::uintmax scan_block{16U};
+
+        /// @class bsl::details::scan_traits
+        ///
+        /// <!-- description -->
+        ///   @brief Provides access to the raw value of an element being
+        ///     scanned. This version is used for raw integral types.
+        ///
+        /// <!-- template parameters -->
+        ///   @tparam T the type of element being scanned
+        ///
+        template<typename T>
+        class scan_traits final
+        {
+        public:
+            /// @brief the raw integral type used to compute the scan
+            using value_type = T;
+
+            /// <!-- description -->
+            ///   @brief Returns the raw value of "val"
+            ///
+            /// <!-- inputs/outputs -->
+            ///   @param val the element to get the raw value from
+            ///   @return Returns the raw value of "val"
+            ///
+            [[nodiscard]] static constexpr value_type
+            get(T const &val) noexcept
+            {
+                return val;
+            }
+
+            /// <!-- description -->
+            ///   @brief Returns true if "val" has experienced an error.
+            ///     Raw integrals cannot, so this always returns false.
+            ///
+            /// <!-- inputs/outputs -->
+            ///   @param val the element to check
+            ///   @return Always returns false
+            ///
+            [[nodiscard]] static constexpr bool
+            failure(T const &val) noexcept
+            {
+                bsl::discard(val);
+                return false;
+            }
+        };
+
+        /// @class bsl::details::scan_traits
+        ///
+        /// <!-- description -->
+        ///   @brief Provides access to the raw value of an element being
+        ///     scanned. This version is used for bsl::safe_integral.
+        ///
+        /// <!-- template parameters -->
+        ///   @tparam T the integral type stored by the bsl::safe_integral
+        ///
+        template<typename T>
+        class scan_traits<safe_integral<T>> final
+        {
+        public:
+            /// @brief the raw integral type used to compute the scan
+            using value_type = T;
+
+            /// <!-- description -->
+            ///   @brief Returns the raw value of "val"
+            ///
+            /// <!-- inputs/outputs -->
+            ///   @param val the element to get the raw value from
+            ///   @return Returns the raw value of "val"
+            ///
+            [[nodiscard]] static constexpr value_type
+            get(safe_integral<T> const &val) noexcept
+            {
+                return val.get();
+            }
+
+            /// <!-- description -->
+            ///   @brief Returns true if "val" has experienced an error.
+            ///
+            /// <!-- inputs/outputs -->
+            ///   @param val the element to check
+            ///   @return Returns val.failure()
+            ///
+            [[nodiscard]] static constexpr bool
+            failure(safe_integral<T> const &val) noexcept
+            {
+                return val.failure();
+            }
+        };
+
+        /// @class bsl::details::scan_identity
+        ///
+        /// <!-- description -->
+        ///   @brief The transform used by inclusive_scan and exclusive_scan,
+        ///     which returns each element unchanged.
+        ///
+        class scan_identity final
+        {
+        public:
+            /// <!-- description -->
+            ///   @brief Returns "val"
+            ///
+            /// <!-- inputs/outputs -->
+            ///   @tparam T the type of element being scanned
+            ///   @param val the element being scanned
+            ///   @return Returns "val"
+            ///
+            template<typename T>
+            [[nodiscard]] constexpr T const &
+            operator()(T const &val) const noexcept
+            {
+                return val;
+            }
+        };
+
+        /// <!-- description -->
+        ///   @brief Implements inclusive_scan, exclusive_scan and
+        ///     transform_exclusive_scan. Each element of src is first
+        ///     passed to "f", and the result is added to the running
+        ///     total. An inclusive scan stores the running total after
+        ///     the add, and an exclusive scan stores it before the add.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @tparam INCLUSIVE true for an inclusive scan, false for an
+        ///     exclusive scan
+        ///   @tparam T the type of element being scanned
+        ///   @tparam FUNC the type of transform to apply to each element
+        ///   @param name the name of the algorithm (used for errors)
+        ///   @param src the elements to scan
+        ///   @param dst where to store the scan
+        ///   @param init the initial value of the running total
+        ///   @param f the transform to apply to each element
+        ///   @return Returns src.size(), bsl::errc_failure if dst is too
+        ///     small, or bsl::errc_unsigned_wrap/bsl::errc_signed_overflow
+        ///     if the running total overflows.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @throw throws if "f" throws
+        ///
+        template<bool INCLUSIVE, typename T, typename FUNC>
+        [[nodiscard]] constexpr result<safe_uintmax>
+        scan_impl(
+            cstr_type const name,
+            span<T const> const &src,
+            span<T> dst,
+            T const &init,
+            FUNC &&f) noexcept(is_nothrow_invocable<FUNC, T const &>::value)
+        {
+            using traits = scan_traits<T>;
+            using value_type = typename traits::value_type;
+
+            if (dst.size() < src.size()) {
+                bsl::error() << name << ": dst is too small\n";
+                return {errc_failure};
+            }
+
+            value_type sum{traits::get(init)};
+            bool wrapped{traits::failure(init)};
+
+            for (safe_uintmax i{}; i < src.size(); i += to_umax(scan_block)) {
+                bsl::uintmax const count{(src.size() - i).min(to_umax(scan_block)).get()};
+                T const *const in{src.at_if(i)};
+                T *const out{dst.at_if(i)};
+
+                bool failed{};
+                for (bsl::uintmax j{}; j < count; ++j) {
+                    T const val{bsl::invoke(f, in[j])};    // NOLINT
+
+                    if constexpr (INCLUSIVE) {
+                        if (builtin_add_overflow(sum, traits::get(val), &sum)) {
+                            wrapped = true;
+                        }
+
+                        if (traits::failure(val)) {
+                            wrapped = true;
+                        }
+
+                        out[j] = T{sum};    // NOLINT
+                        failed = failed || wrapped;
+                    }
+                    else {
+                        out[j] = T{sum};    // NOLINT
+                        failed = failed || wrapped;
+
+                        if (builtin_add_overflow(sum, traits::get(val), &sum)) {
+                            wrapped = true;
+                        }
+
+                        if (traits::failure(val)) {
+                            wrapped = true;
+                        }
+                    }
+                }
+
+                if (failed) {
+                    bsl::error() << name << ": overflow at or before index " << i << '\n';
+
+                    if constexpr (is_signed<value_type>::value) {
+                        return {errc_signed_overflow};
+                    }
+                    else {
+                        return {errc_unsigned_wrap};
+                    }
+                }
+            }
+
+            return {src.size()};
+        }
+    }
+}
+
+#endif
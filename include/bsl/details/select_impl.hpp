@@ -0,0 +1,378 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+///
+/// @file select_impl.hpp
+///
+
+#ifndef BSL_DETAILS_SELECT_IMPL_HPP
+#define BSL_DETAILS_SELECT_IMPL_HPP
+
+#include "../cstdint.hpp"
+#include "../swap.hpp"
+
+// Notes: --
+// - These are the kernels used by bsl::nth_element, bsl::partial_sort and
+//   bsl::partial_sort_copy. They work on a raw pointer and count, which
+//   the algorithms get from the view once, so the inner loops do not pay
+//   for a bounds check on every element.
+// - Selection is an introselect. A quickselect with a median of three
+//   pivot is used for as long as every partition shrinks the range that
+//   is left to at most 3/4 of its size. As soon as a partition does not,
+//   the next pivot is chosen using the median of medians, which always
+//   shrinks the range to roughly 7/10 of its size. The range is
+//   therefore shrunk by a constant fraction at least every other
+//   partition, which bounds the worst case to O(count).
+// - Partitions are three-way, so inputs with many equal elements (like
+//   latency samples) do not degrade. They never reverse the elements
+//   being moved, so runs that are already sorted stay sorted and the
+//   median of three keeps finding good pivots in them. Small ranges are
+//   finished with an insertion sort.
+// - Sorting is a heap sort, which is O(count * log2(count)) in the worst
+//   case and does not need recursion or extra memory.
+// - All of the kernels assume the caller has already validated the
+//   pointers, counts and indexes.
+//
+
+namespace bsl
+{
+    namespace details
+    {
+        /// @brief ranges this small are finished with an insertion sort
+        constexpr bsl::uintmax select_threshold{16U};
+        /// @brief the size of each group used by the median of medians
+        constexpr bsl::uintmax select_group{5U};
+
+        /// <!-- description -->
+        ///   @brief Returns true if a partition that shrank a range of
+        ///     "before" elements down to "after" elements made enough
+        ///     progress, meaning the range is now at most 3/4 of its
+        ///     previous size. If it did not, introselect chooses the next
+        ///     pivot using the median of medians.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param before the number of elements before the partition
+        ///   @param after the number of elements after the partition
+        ///   @return Returns true if "after" is at most 3/4 of "before"
+        ///
+        [[nodiscard]] constexpr bool
+        select_progress(bsl::uintmax const before, bsl::uintmax const after) noexcept
+        {
+            return after <= (before - (before >> 2U));
+        }
+
+        /// <!-- description -->
+        ///   @brief Sorts "count" elements using an insertion sort
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @tparam T the type of element to sort
+        ///   @tparam COMP the type of comparison to use
+        ///   @param ptr a pointer to the elements to sort
+        ///   @param count the number of elements to sort
+        ///   @param comp the comparison to use
+        ///
+        template<typename T, typename COMP>
+        constexpr void
+        select_insertion_sort(T *const ptr, bsl::uintmax const count, COMP &comp) noexcept
+        {
+            for (bsl::uintmax i{1U}; i < count; ++i) {
+                for (bsl::uintmax j{i}; j > 0U; --j) {
+                    if (!comp(ptr[j], ptr[j - 1U])) {    // NOLINT
+                        break;
+                    }
+
+                    bsl::swap(ptr[j], ptr[j - 1U]);    // NOLINT
+                }
+            }
+        }
+
+        /// <!-- description -->
+        ///   @brief Reorders the elements in [lo, hi) so that the elements
+        ///     less than "pivot" come first, followed by the elements equal
+        ///     to "pivot", followed by the elements greater than "pivot".
+        ///     "pivot" must be equal to at least one element in [lo, hi).
+        ///     Each group is gathered with a forward scan, so the relative
+        ///     order of a run that is already sorted is left alone.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @tparam T the type of element to partition
+        ///   @tparam COMP the type of comparison to use
+        ///   @param ptr a pointer to the elements to partition
+        ///   @param lo the index of the first element to partition
+        ///   @param hi the index of the element after the last element
+        ///   @param pivot the value to partition around
+        ///   @param eq_lo returns the index of the first equal element
+        ///   @param eq_hi returns the index after the last equal element
+        ///   @param comp the comparison to use
+        ///
+        template<typename T, typename COMP>
+        constexpr void
+        select_partition(
+            T *const ptr,
+            bsl::uintmax const lo,
+            bsl::uintmax const hi,
+            T const &pivot,
+            bsl::uintmax &eq_lo,
+            bsl::uintmax &eq_hi,
+            COMP &comp) noexcept
+        {
+            bsl::uintmax lt{lo};
+            for (bsl::uintmax i{lo}; i < hi; ++i) {
+                if (comp(ptr[i], pivot)) {    // NOLINT
+                    if (i != lt) {
+                        bsl::swap(ptr[lt], ptr[i]);    // NOLINT
+                    }
+
+                    ++lt;
+                }
+            }
+
+            bsl::uintmax eq{lt};
+            for (bsl::uintmax i{lt}; i < hi; ++i) {
+                if (!comp(pivot, ptr[i])) {    // NOLINT
+                    if (i != eq) {
+                        bsl::swap(ptr[eq], ptr[i]);    // NOLINT
+                    }
+
+                    ++eq;
+                }
+            }
+
+            eq_lo = lt;
+            eq_hi = eq;
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns the median of the first, middle and last
+        ///     elements in [lo, hi)
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @tparam T the type of element to select from
+        ///   @tparam COMP the type of comparison to use
+        ///   @param ptr a pointer to the elements to select from
+        ///   @param lo the index of the first element
+        ///   @param hi the index of the element after the last element
+        ///   @param comp the comparison to use
+        ///   @return Returns the median of the first, middle and last
+        ///     elements in [lo, hi)
+        ///
+        template<typename T, typename COMP>
+        [[nodiscard]] constexpr T const &
+        select_median_of_three(
+            T const *const ptr, bsl::uintmax const lo, bsl::uintmax const hi, COMP &comp) noexcept
+        {
+            T const &a{ptr[lo]};                        // NOLINT
+            T const &b{ptr[lo + ((hi - lo) >> 1U)]};    // NOLINT
+            T const &c{ptr[hi - 1U]};                   // NOLINT
+
+            if (comp(a, b)) {
+                if (comp(b, c)) {
+                    return b;
+                }
+
+                return comp(a, c) ? c : a;
+            }
+
+            if (comp(a, c)) {
+                return a;
+            }
+
+            return comp(b, c) ? c : b;
+        }
+
+        /// <!-- description -->
+        ///   @brief Forward declaration of bsl::details::select_nth,
+        ///     which is used by the median of medians (see below).
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @tparam T the type of element to select from
+        ///   @tparam COMP the type of comparison to use
+        ///   @param ptr a pointer to the elements to select from
+        ///   @param count the number of elements to select from
+        ///   @param nth the index of the element to select
+        ///   @param comp the comparison to use
+        ///
+        template<typename T, typename COMP>
+        constexpr void select_nth(
+            T *const ptr, bsl::uintmax const count, bsl::uintmax const nth, COMP &comp) noexcept;
+
+        /// <!-- description -->
+        ///   @brief Returns the median of medians of [lo, hi), which is
+        ///     guaranteed to have at least 30% of the elements on either
+        ///     side of it. The median of each group of 5 elements is moved
+        ///     to the front of the range, and the median of those is then
+        ///     selected using bsl::details::select_nth.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @tparam T the type of element to select from
+        ///   @tparam COMP the type of comparison to use
+        ///   @param ptr a pointer to the elements to select from
+        ///   @param lo the index of the first element
+        ///   @param hi the index of the element after the last element
+        ///   @param comp the comparison to use
+        ///   @return Returns the median of medians of [lo, hi)
+        ///
+        template<typename T, typename COMP>
+        [[nodiscard]] constexpr T const &
+        select_median_of_medians(
+            T *const ptr, bsl::uintmax const lo, bsl::uintmax const hi, COMP &comp) noexcept
+        {
+            bsl::uintmax const groups{(hi - lo) / select_group};
+            for (bsl::uintmax i{}; i < groups; ++i) {
+                T *const group{&ptr[lo + (i * select_group)]};    // NOLINT
+                select_insertion_sort(group, select_group, comp);
+                bsl::swap(ptr[lo + i], group[select_group >> 1U]);    // NOLINT
+            }
+
+            select_nth(&ptr[lo], groups, groups >> 1U, comp);    // NOLINT
+            return ptr[lo + (groups >> 1U)];                     // NOLINT
+        }
+
+        /// <!-- description -->
+        ///   @brief Reorders "count" elements so that the element at
+        ///     "nth" is the element that would be there if the elements
+        ///     were sorted, every element before it is not greater than
+        ///     it, and every element after it is not less than it.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @tparam T the type of element to select from
+        ///   @tparam COMP the type of comparison to use
+        ///   @param ptr a pointer to the elements to select from
+        ///   @param count the number of elements to select from
+        ///   @param nth the index of the element to select
+        ///   @param comp the comparison to use
+        ///
+        template<typename T, typename COMP>
+        constexpr void
+        select_nth(
+            T *const ptr, bsl::uintmax const count, bsl::uintmax const nth, COMP &comp) noexcept
+        {
+            bsl::uintmax lo{};
+            bsl::uintmax hi{count};
+            bool fallback{};
+
+            while ((hi - lo) > select_threshold) {
+                bsl::uintmax const before{hi - lo};
+                T const pivot{
+                    fallback ? select_median_of_medians(ptr, lo, hi, comp)
+                             : select_median_of_three(ptr, lo, hi, comp)};
+
+                bsl::uintmax eq_lo{};
+                bsl::uintmax eq_hi{};
+                select_partition(ptr, lo, hi, pivot, eq_lo, eq_hi, comp);
+
+                if (nth < eq_lo) {
+                    hi = eq_lo;
+                }
+                else if (nth >= eq_hi) {
+                    lo = eq_hi;
+                }
+                else {
+                    return;
+                }
+
+                fallback = !select_progress(before, hi - lo);
+            }
+
+            select_insertion_sort(&ptr[lo], hi - lo, comp);    // NOLINT
+        }
+
+        /// <!-- description -->
+        ///   @brief Restores the max heap property of the heap of "count"
+        ///     elements rooted at "root", assuming both of its children are
+        ///     already max heaps.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @tparam T the type of element in the heap
+        ///   @tparam COMP the type of comparison to use
+        ///   @param ptr a pointer to the heap
+        ///   @param count the number of elements in the heap
+        ///   @param root the index of the root to sift down
+        ///   @param comp the comparison to use
+        ///
+        template<typename T, typename COMP>
+        constexpr void
+        select_sift_down(
+            T *const ptr, bsl::uintmax const count, bsl::uintmax root, COMP &comp) noexcept
+        {
+            while (true) {
+                bsl::uintmax child{(root << 1U) + 1U};
+                if (child >= count) {
+                    return;
+                }
+
+                if (((child + 1U) < count) && comp(ptr[child], ptr[child + 1U])) {    // NOLINT
+                    ++child;
+                }
+
+                if (!comp(ptr[root], ptr[child])) {    // NOLINT
+                    return;
+                }
+
+                bsl::swap(ptr[root], ptr[child]);    // NOLINT
+                root = child;
+            }
+        }
+
+        /// <!-- description -->
+        ///   @brief Turns "count" elements into a max heap
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @tparam T the type of element in the heap
+        ///   @tparam COMP the type of comparison to use
+        ///   @param ptr a pointer to the elements
+        ///   @param count the number of elements
+        ///   @param comp the comparison to use
+        ///
+        template<typename T, typename COMP>
+        constexpr void
+        select_make_heap(T *const ptr, bsl::uintmax const count, COMP &comp) noexcept
+        {
+            for (bsl::uintmax i{count >> 1U}; i > 0U; --i) {
+                select_sift_down(ptr, count, i - 1U, comp);
+            }
+        }
+
+        /// <!-- description -->
+        ///   @brief Sorts a max heap of "count" elements in place
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @tparam T the type of element in the heap
+        ///   @tparam COMP the type of comparison to use
+        ///   @param ptr a pointer to the heap
+        ///   @param count the number of elements in the heap
+        ///   @param comp the comparison to use
+        ///
+        template<typename T, typename COMP>
+        constexpr void
+        select_sort_heap(T *const ptr, bsl::uintmax const count, COMP &comp) noexcept
+        {
+            for (bsl::uintmax i{count}; i > 1U; --i) {
+                bsl::swap(ptr[0], ptr[i - 1U]);    // NOLINT
+                select_sift_down(ptr, i - 1U, 0U, comp);
+            }
+        }
+    }
+}
+
+#endif
@@ -0,0 +1,187 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+///
+/// @file soa_array_columns.hpp
+///
+
+#ifndef BSL_DETAILS_SOA_ARRAY_COLUMNS_HPP
+#define BSL_DETAILS_SOA_ARRAY_COLUMNS_HPP
+
+#include "../array.hpp"
+#include "../cstdint.hpp"
+
+namespace bsl
+{
+    namespace details
+    {
+        /// @class bsl::details::soa_element_type
+        ///
+        /// <!-- description -->
+        ///   @brief Provides the member type "type", which is the Ith type
+        ///     in TS.
+        ///
+        /// <!-- template parameters -->
+        ///   @tparam I the index of the type to get
+        ///   @tparam T the first type in the list
+        ///   @tparam TS the remaining types in the list
+        ///
+        template<bsl::uintmax I, typename T, typename... TS>
+        class soa_element_type final
+        {
+            static_assert(I <= sizeof...(TS), "soa_array column index out of range");
+
+        public:
+            /// @brief provides the member type for this class
+            using type = typename soa_element_type<I - 1U, TS...>::type;
+        };
+
+        /// @class bsl::details::soa_element_type
+        ///
+        /// <!-- description -->
+        ///   @brief Provides the member type "type", which is the Ith type
+        ///     in TS. This specialization ends the recursion.
+        ///
+        /// <!-- template parameters -->
+        ///   @tparam T the first type in the list
+        ///   @tparam TS the remaining types in the list
+        ///
+        template<typename T, typename... TS>
+        class soa_element_type<0U, T, TS...> final
+        {
+        public:
+            /// @brief provides the member type for this class
+            using type = T;
+        };
+
+        /// @class bsl::details::soa_columns
+        ///
+        /// <!-- description -->
+        ///   @brief Stores the columns of a bsl::soa_array. Each column is
+        ///     its own bsl::array, aligned to a cache line, so that a loop
+        ///     that touches one column only ever loads that column.
+        ///
+        /// <!-- template parameters -->
+        ///   @tparam N the number of elements in each column
+        ///   @tparam T the type of the first column
+        ///   @tparam TS the types of the remaining columns
+        ///
+        template<bsl::uintmax N, typename T, typename... TS>
+        class soa_columns final
+        {
+        public:
+            /// @brief stores the first column
+            alignas(64) array<T, N> m_head;
+            /// @brief stores the remaining columns
+            soa_columns<N, TS...> m_tail;
+
+            /// <!-- description -->
+            ///   @brief Returns a reference to column I
+            ///
+            /// <!-- inputs/outputs -->
+            ///   @tparam I the index of the column to return
+            ///   @return Returns a reference to column I
+            ///
+            template<bsl::uintmax I>
+            [[nodiscard]] constexpr auto
+            get() noexcept -> array<typename soa_element_type<I, T, TS...>::type, N> &
+            {
+                if constexpr (I == 0U) {
+                    return m_head;
+                }
+                else {
+                    return m_tail.template get<I - 1U>();
+                }
+            }
+
+            /// <!-- description -->
+            ///   @brief Returns a reference to column I
+            ///
+            /// <!-- inputs/outputs -->
+            ///   @tparam I the index of the column to return
+            ///   @return Returns a reference to column I
+            ///
+            template<bsl::uintmax I>
+            [[nodiscard]] constexpr auto
+            get() const noexcept -> array<typename soa_element_type<I, T, TS...>::type, N> const &
+            {
+                if constexpr (I == 0U) {
+                    return m_head;
+                }
+                else {
+                    return m_tail.template get<I - 1U>();
+                }
+            }
+        };
+
+        /// @class bsl::details::soa_columns
+        ///
+        /// <!-- description -->
+        ///   @brief Stores the last column of a bsl::soa_array. This
+        ///     specialization ends the recursion.
+        ///
+        /// <!-- template parameters -->
+        ///   @tparam N the number of elements in each column
+        ///   @tparam T the type of the column
+        ///
+        template<bsl::uintmax N, typename T>
+        class soa_columns<N, T> final
+        {
+        public:
+            /// @brief stores the column
+            alignas(64) array<T, N> m_head;
+
+            /// <!-- description -->
+            ///   @brief Returns a reference to column I
+            ///
+            /// <!-- inputs/outputs -->
+            ///   @tparam I the index of the column to return
+            ///   @return Returns a reference to column I
+            ///
+            template<bsl::uintmax I>
+            [[nodiscard]] constexpr auto
+            get() noexcept -> array<T, N> &
+            {
+                static_assert(I == 0U, "soa_array column index out of range");
+                return m_head;
+            }
+
+            /// <!-- description -->
+            ///   @brief Returns a reference to column I
+            ///
+            /// <!-- inputs/outputs -->
+            ///   @tparam I the index of the column to return
+            ///   @return Returns a reference to column I
+            ///
+            template<bsl::uintmax I>
+            [[nodiscard]] constexpr auto
+            get() const noexcept -> array<T, N> const &
+            {
+                static_assert(I == 0U, "soa_array column index out of range");
+                return m_head;
+            }
+        };
+    }
+}
+
+#endif
@@ -0,0 +1,98 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+///
+/// @file string_builder_out.hpp
+///
+
+#ifndef BSL_DETAILS_STRING_BUILDER_OUT_HPP
+#define BSL_DETAILS_STRING_BUILDER_OUT_HPP
+
+#include "../char_type.hpp"
+#include "../cstr_type.hpp"
+#include "../discard.hpp"
+#include "../fixed_string.hpp"
+
+namespace bsl
+{
+    namespace details
+    {
+        /// @class bsl::details::string_builder_out
+        ///
+        /// <!-- description -->
+        ///   @brief Provides the same write() interface as bsl::out, but
+        ///     appends to a bsl::fixed_string instead of writing to the
+        ///     console. Like bsl::out, this type is passed by value and its
+        ///     write() functions are const, which is what allows every
+        ///     fmt_impl() overload to be used with a bsl::string_builder
+        ///     without modification.
+        ///
+        /// <!-- template parameters -->
+        ///   @tparam N the max size of the bsl::fixed_string to append to
+        ///
+        template<bsl::uintmax N>
+        class string_builder_out final
+        {
+            /// @brief stores a pointer to the string being appended to
+            fixed_string<N> *m_str;
+
+        public:
+            /// <!-- description -->
+            ///   @brief Creates a bsl::details::string_builder_out that
+            ///     appends to the provided bsl::fixed_string.
+            ///
+            /// <!-- inputs/outputs -->
+            ///   @param str the bsl::fixed_string to append to
+            ///
+            explicit constexpr string_builder_out(fixed_string<N> &str) noexcept    // --
+                : m_str{&str}
+            {}
+
+            /// <!-- description -->
+            ///   @brief Appends a character to the string.
+            ///
+            /// <!-- inputs/outputs -->
+            ///   @param c the character to append
+            ///
+            constexpr void
+            write(char_type const c) const noexcept
+            {
+                bsl::discard(m_str->push_back(c));
+            }
+
+            /// <!-- description -->
+            ///   @brief Appends a '\0' terminated string to the string.
+            ///
+            /// <!-- inputs/outputs -->
+            ///   @param str the string to append
+            ///
+            constexpr void
+            write(cstr_type const str) const noexcept
+            {
+                bsl::discard(m_str->append(str));
+            }
+        };
+    }
+}
+
+#endif
@@ -0,0 +1,265 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+///
+/// @file divider.hpp
+///
+
+#ifndef BSL_DIVIDER_HPP
+#define BSL_DIVIDER_HPP
+
+#include "details/divider_impl.hpp"
+
+#include "conditional.hpp"
+#include "is_signed.hpp"
+#include "make_unsigned.hpp"
+#include "safe_integral.hpp"
+#include "type_identity.hpp"
+
+namespace bsl
+{
+    /// @class bsl::divider
+    ///
+    /// <!-- description -->
+    ///   @brief Divides bsl::safe_integrals by a divisor that does not
+    ///     change (e.g., a page size, a cache line size, or a stride that
+    ///     is only known at run-time) without a hardware division. The
+    ///     divisor is turned into a multiply and a shift once, when the
+    ///     bsl::divider is created, and a power of 2 divisor becomes a
+    ///     shift and a mask. When the bsl::divider is constexpr, the
+    ///     compiler sees which of these applies and only emits that path.
+    ///     The result and error state of n / d and n % d are identical
+    ///     to the bsl::safe_integral operators (i.e., an invalid operand,
+    ///     a divisor of 0, or min() / -1 results in an error).
+    ///   @include example_divider_overview.hpp
+    ///
+    /// <!-- template parameters -->
+    ///   @tparam T the integral type to divide
+    ///
+    template<typename T>
+    class divider final
+    {
+        /// @brief the unsigned version of T, which does the division
+        using unsigned_type = typename conditional_t<
+            is_signed<T>::value,
+            make_unsigned<T>,
+            type_identity<T>>::type;
+
+        /// @brief stores the divisor, including its error state
+        safe_integral<T> m_divisor;
+        /// @brief stores the precomputed division by |divisor|
+        details::divider_impl<unsigned_type> m_impl;
+
+        /// <!-- description -->
+        ///   @brief Returns |val| as an unsigned_type. The magnitude of
+        ///     min() is representable by unsigned_type.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param val the value to get the magnitude of
+        ///   @return Returns |val| as an unsigned_type
+        ///
+        [[nodiscard]] static constexpr unsigned_type
+        magnitude(T const val) noexcept
+        {
+            if constexpr (is_signed<T>::value) {
+                if (val < static_cast<T>(0)) {
+                    return static_cast<unsigned_type>(
+                        static_cast<unsigned_type>(0) - static_cast<unsigned_type>(val));
+                }
+            }
+
+            return static_cast<unsigned_type>(val);
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns |d| as a divisor, replacing 0 (or an invalid
+        ///     divisor) with 1 so that the precomputation is well defined.
+        ///     Such a bsl::divider never uses it.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param d the divisor
+        ///   @return Returns |d| as a non-zero divisor
+        ///
+        [[nodiscard]] static constexpr unsigned_type
+        divisor_for(safe_integral<T> const &d) noexcept
+        {
+            unsigned_type const mag{magnitude(d.get())};
+            if (static_cast<unsigned_type>(0) == mag) {
+                return static_cast<unsigned_type>(1);
+            }
+
+            return mag;
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns true if n / divisor() cannot be performed,
+        ///     using the same rules as bsl::safe_integral::operator/=.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param n the value to divide
+        ///   @return Returns true if n / divisor() cannot be performed
+        ///
+        [[nodiscard]] constexpr bool
+        check(safe_integral<T> const &n) const noexcept
+        {
+            if (n.failure() || m_divisor.failure()) {
+                return true;
+            }
+
+            if (m_divisor.is_zero()) {
+                return integral_overflow_underflow_wrap_error();
+            }
+
+            if constexpr (is_signed<T>::value) {
+                if (n.is_min() && (m_divisor == -safe_integral<T>::one())) {
+                    return integral_overflow_underflow_wrap_error();
+                }
+            }
+
+            return false;
+        }
+
+    public:
+        /// @brief alias for: T
+        using value_type = T;
+
+        /// <!-- description -->
+        ///   @brief Creates a bsl::divider for "d". If "d" is 0 or
+        ///     invalid, every division by this bsl::divider results in
+        ///     an error.
+        ///   @include example_divider_overview.hpp
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param d the divisor
+        ///
+        explicit constexpr divider(safe_integral<T> const &d) noexcept
+            : m_divisor{d}, m_impl{divisor_for(d)}
+        {}
+
+        /// <!-- description -->
+        ///   @brief Returns the divisor
+        ///   @include example_divider_overview.hpp
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Returns the divisor
+        ///
+        [[nodiscard]] constexpr safe_integral<value_type>
+        divisor() const noexcept
+        {
+            return m_divisor;
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns n / divisor(), rounding towards 0, with the
+        ///     same result and error state as n / divisor() would have.
+        ///   @include example_divider_overview.hpp
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param n the value to divide
+        ///   @return Returns n / divisor()
+        ///
+        [[nodiscard]] constexpr safe_integral<value_type>
+        divide(safe_integral<value_type> const &n) const noexcept
+        {
+            if (this->check(n)) {
+                return safe_integral<value_type>::zero(true);
+            }
+
+            unsigned_type const quo{m_impl.divide(magnitude(n.get()))};
+            if constexpr (is_signed<T>::value) {
+                if (n.is_neg() != m_divisor.is_neg()) {
+                    return safe_integral<value_type>{static_cast<value_type>(
+                        static_cast<unsigned_type>(static_cast<unsigned_type>(0) - quo))};
+                }
+            }
+
+            return safe_integral<value_type>{static_cast<value_type>(quo)};
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns n % divisor(), which has the sign of n, with
+        ///     the same result and error state as n % divisor() would
+        ///     have.
+        ///   @include example_divider_overview.hpp
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param n the value to divide
+        ///   @return Returns n % divisor()
+        ///
+        [[nodiscard]] constexpr safe_integral<value_type>
+        remainder(safe_integral<value_type> const &n) const noexcept
+        {
+            if (this->check(n)) {
+                return safe_integral<value_type>::zero(true);
+            }
+
+            unsigned_type const rem{m_impl.remainder(magnitude(n.get()))};
+            if constexpr (is_signed<T>::value) {
+                if (n.is_neg()) {
+                    return safe_integral<value_type>{static_cast<value_type>(
+                        static_cast<unsigned_type>(static_cast<unsigned_type>(0) - rem))};
+                }
+            }
+
+            return safe_integral<value_type>{static_cast<value_type>(rem)};
+        }
+    };
+
+    /// <!-- description -->
+    ///   @brief Returns rhs.divide(lhs)
+    ///   @include example_divider_overview.hpp
+    ///   @related bsl::divider
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @tparam T the integral type to divide
+    ///   @param lhs the value to divide
+    ///   @param rhs the divider to divide by
+    ///   @return Returns rhs.divide(lhs)
+    ///
+    template<typename T>
+    [[nodiscard]] constexpr safe_integral<T>
+    operator/(safe_integral<T> const &lhs, divider<T> const &rhs) noexcept
+    {
+        return rhs.divide(lhs);
+    }
+
+    /// <!-- description -->
+    ///   @brief Returns rhs.remainder(lhs)
+    ///   @include example_divider_overview.hpp
+    ///   @related bsl::divider
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @tparam T the integral type to divide
+    ///   @param lhs the value to divide
+    ///   @param rhs the divider to divide by
+    ///   @return Returns rhs.remainder(lhs)
+    ///
+    template<typename T>
+    [[nodiscard]] constexpr safe_integral<T>
+    operator%(safe_integral<T> const &lhs, divider<T> const &rhs) noexcept
+    {
+        return rhs.remainder(lhs);
+    }
+}
+
+#endif
@@ -0,0 +1,333 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+///
+/// @file error_trace.hpp
+///
+
+#ifndef BSL_ERROR_TRACE_HPP
+#define BSL_ERROR_TRACE_HPP
+
+#include "cstdint.hpp"
+#include "debug.hpp"
+#include "is_constant_evaluated.hpp"
+#include "site_id.hpp"
+#include "site_table.hpp"
+
+namespace bsl
+{
+    /// @brief the number of errors each thread's bsl::error_trace keeps
+    constexpr bsl::uintmax error_trace_size{32U};
+
+    /// @class bsl::untraced_t
+    ///
+    /// <!-- description -->
+    ///   @brief bsl::untraced is a disambiguation tag that can be passed to
+    ///     the constructors of classes like bsl::result to indicate that
+    ///     the error they are created with is expected (e.g., a lookup
+    ///     miss or a placeholder that is overwritten later), and should
+    ///     not be recorded in the calling thread's bsl::error_trace.
+    ///   @include example_error_trace_overview.hpp
+    ///
+    class untraced_t final
+    {
+    public:
+        /// <!-- description -->
+        ///   @brief Default constructor that ensures construction of
+        ///     this type must be explicit
+        ///
+        explicit constexpr untraced_t() noexcept = default;
+    };
+
+    /// @brief reduces the verbosity of bsl::untraced_t
+    constexpr untraced_t untraced{};
+
+    /// @class bsl::error_trace_entry
+    ///
+    /// <!-- description -->
+    ///   @brief Stores a single error recorded in a bsl::error_trace: the
+    ///     site of the error, the error code, and the value of the CPU's
+    ///     time stamp counter when the error was recorded. The site is
+    ///     stored as the bsl::site_entry that the compiler created for it,
+    ///     so the file, function and line are available without a lookup.
+    ///   @include example_error_trace_overview.hpp
+    ///
+    class error_trace_entry final
+    {
+        /// @brief stores the site of the error
+        site_entry m_site{};
+        /// @brief stores the error code
+        bsl::int32 m_errc{};
+        /// @brief stores the time stamp counter when the error was recorded
+        bsl::uint64 m_tsc{};
+
+    public:
+        /// <!-- description -->
+        ///   @brief Creates an empty bsl::error_trace_entry
+        ///   @include example_error_trace_overview.hpp
+        ///
+        constexpr error_trace_entry() noexcept = default;
+
+        /// <!-- description -->
+        ///   @brief Creates a bsl::error_trace_entry
+        ///   @include example_error_trace_overview.hpp
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param site the site of the error
+        ///   @param errc the error code
+        ///   @param tsc the time stamp counter when the error was recorded
+        ///
+        constexpr error_trace_entry(
+            site_entry const &site, bsl::int32 const errc, bsl::uint64 const tsc) noexcept
+            : m_site{site}, m_errc{errc}, m_tsc{tsc}
+        {}
+
+        /// <!-- description -->
+        ///   @brief Returns the id of the site of the error
+        ///   @include example_error_trace_overview.hpp
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Returns the id of the site of the error
+        ///
+        [[nodiscard]] constexpr site_id
+        site() const noexcept
+        {
+            return m_site.id();
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns the file, function and line of the site of
+        ///     the error
+        ///   @include example_error_trace_overview.hpp
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Returns the file, function and line of the site of
+        ///     the error
+        ///
+        [[nodiscard]] constexpr site_entry const &
+        location() const noexcept
+        {
+            return m_site;
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns the error code
+        ///   @include example_error_trace_overview.hpp
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Returns the error code
+        ///
+        [[nodiscard]] constexpr bsl::int32
+        errc() const noexcept
+        {
+            return m_errc;
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns the time stamp counter when the error was
+        ///     recorded
+        ///   @include example_error_trace_overview.hpp
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Returns the time stamp counter when the error was
+        ///     recorded
+        ///
+        [[nodiscard]] constexpr bsl::uint64
+        tsc() const noexcept
+        {
+            return m_tsc;
+        }
+    };
+
+    /// @class bsl::error_trace
+    ///
+    /// <!-- description -->
+    ///   @brief A ring of the last error_trace_size errors recorded by a
+    ///     thread. Each bsl::result that is created with an error, and
+    ///     each bsl::errc_type that is created with a failure code, adds
+    ///     an entry (see record_error()), so when something fails, the
+    ///     ring holds the path the error took as it was returned up the
+    ///     stack. Recording an error only copies a constant site, the error
+    ///     code and the time stamp counter into the ring (there are no
+    ///     atomics, lookups or hashing), so unlike bsl::debug(), it is
+    ///     always on, and nothing is formatted until the ring is printed.
+    ///   @include example_error_trace_overview.hpp
+    ///
+    class error_trace final
+    {
+        /// @brief used to turn the number of errors into an index
+        static constexpr bsl::uintmax index_mask{error_trace_size - 1U};
+
+        static_assert(0U == (error_trace_size & index_mask));
+
+        /// @brief stores the ring (bsl::array depends on bsl::result,
+        ///   which records errors here, so a plain array is used instead)
+        error_trace_entry m_ring[error_trace_size]{};    // NOLINT
+        /// @brief stores the total number of errors recorded
+        bsl::uintmax m_total{};
+
+    public:
+        /// <!-- description -->
+        ///   @brief Adds an error to the ring, replacing the oldest error
+        ///     if the ring is full.
+        ///   @include example_error_trace_overview.hpp
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param site the site of the error
+        ///   @param errc the error code
+        ///
+        void
+        record(site_entry const &site, bsl::int32 const errc) noexcept
+        {
+            bsl::uint64 const tsc{__builtin_readcyclecounter()};
+            m_ring[m_total & index_mask] = error_trace_entry{site, errc, tsc};    // NOLINT
+            ++m_total;
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns the number of errors in the ring
+        ///   @include example_error_trace_overview.hpp
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Returns the number of errors in the ring
+        ///
+        [[nodiscard]] constexpr bsl::uintmax
+        size() const noexcept
+        {
+            return (m_total < error_trace_size) ? m_total : error_trace_size;
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns the total number of errors recorded since the
+        ///     ring was created or last cleared, including errors that have
+        ///     since been replaced.
+        ///   @include example_error_trace_overview.hpp
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Returns the total number of errors recorded
+        ///
+        [[nodiscard]] constexpr bsl::uintmax
+        total() const noexcept
+        {
+            return m_total;
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns the ith most recent error (i.e., 0 is the most
+        ///     recent error), or a nullptr if i >= size().
+        ///   @include example_error_trace_overview.hpp
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param i the index of the error to return
+        ///   @return Returns the ith most recent error, or a nullptr
+        ///
+        [[nodiscard]] constexpr error_trace_entry const *
+        at_if(bsl::uintmax const i) const noexcept
+        {
+            if (i >= this->size()) {
+                return nullptr;
+            }
+
+            return &m_ring[(m_total - 1U - i) & index_mask];    // NOLINT
+        }
+
+        /// <!-- description -->
+        ///   @brief Removes all of the errors from the ring
+        ///   @include example_error_trace_overview.hpp
+        ///
+        constexpr void
+        clear() noexcept
+        {
+            m_total = {};
+        }
+    };
+
+    /// <!-- description -->
+    ///   @brief Returns the calling thread's bsl::error_trace
+    ///   @include example_error_trace_overview.hpp
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @return Returns the calling thread's bsl::error_trace
+    ///
+    [[nodiscard]] inline error_trace &
+    this_thread_error_trace() noexcept
+    {
+        static thread_local error_trace s_trace{};
+        return s_trace;
+    }
+
+    /// <!-- description -->
+    ///   @brief Records an error in the calling thread's bsl::error_trace.
+    ///     Nothing is recorded during constant evaluation.
+    ///   @include example_error_trace_overview.hpp
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param site the site of the error
+    ///   @param errc the error code
+    ///
+    constexpr void
+    record_error(site_entry const &site, bsl::int32 const errc) noexcept
+    {
+        if (is_constant_evaluated()) {
+            return;
+        }
+
+        if constexpr (BSL_PERFORCE) {
+            return;
+        }
+
+        this_thread_error_trace().record(site, errc);
+    }
+
+    /// <!-- description -->
+    ///   @brief Outputs the provided bsl::error_trace to the provided
+    ///     output type, most recent error first. Each error is printed
+    ///     with the location of its site.
+    ///   @related bsl::error_trace
+    ///   @include example_error_trace_overview.hpp
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @tparam T the type of outputter provided
+    ///   @param o the instance of the outputter used to output the value.
+    ///   @param trace the bsl::error_trace to output
+    ///   @return return o
+    ///
+    template<typename T>
+    [[maybe_unused]] constexpr out<T>
+    operator<<(out<T> const o, error_trace const &trace) noexcept
+    {
+        if constexpr (!o) {
+            return o;
+        }
+
+        for (bsl::uintmax i{}; i < trace.size(); ++i) {
+            error_trace_entry const *const entry{trace.at_if(i)};
+            o << "  [" << i << "] " << entry->site() << ' ' << entry->errc() << " @ "
+              << entry->tsc() << ' ' << entry->location() << bsl::endl;
+        }
+
+        return o;
+    }
+}
+
+#endif
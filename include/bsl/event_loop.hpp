@@ -0,0 +1,233 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+///
+/// @file event_loop.hpp
+///
+
+#ifndef BSL_EVENT_LOOP_HPP
+#define BSL_EVENT_LOOP_HPP
+
+#include "cstdint.hpp"
+#include "debug.hpp"
+#include "discard.hpp"
+#include "errc_type.hpp"
+#include "function_ref.hpp"
+#include "result.hpp"
+#include "safe_integral.hpp"
+
+namespace bsl
+{
+    /// @brief the fd is ready to be read from
+    constexpr bsl::uint32 event_loop_read{0x001U};
+    /// @brief the fd is ready to be written to
+    constexpr bsl::uint32 event_loop_write{0x004U};
+    /// @brief an error occurred on the fd
+    constexpr bsl::uint32 event_loop_error{0x008U};
+    /// @brief the other end of the fd hung up
+    constexpr bsl::uint32 event_loop_hangup{0x010U};
+}
+
+#if defined(__linux__) && !BSL_PERFORCE && !defined(BAREFLANK)
+#include "details/event_loop_linux.hpp"
+#else
+
+namespace bsl
+{
+    /// @class bsl::event_loop
+    ///
+    /// <!-- description -->
+    ///   @brief Implements a single threaded event loop.
+    ///
+    /// <!-- template parameters -->
+    ///   @tparam N the max number of file descriptors and timers that can
+    ///     be registered.
+    ///
+    template<bsl::uintmax N>
+    class event_loop final
+    {
+    public:
+        /// @brief alias for: function_ref<void(bsl::int32, bsl::uint32)>
+        using callback_type = function_ref<void(bsl::int32, bsl::uint32)>;
+        /// @brief alias for: void (*)(void *) noexcept
+        using post_type = void (*)(void *) noexcept;
+
+        /// <!-- description -->
+        ///   @brief Creates a bsl::event_loop.
+        ///
+        event_loop() noexcept
+        {
+            bsl::error() << "bsl::event_loop is unsupported on this platform\n";
+        }
+
+        /// <!-- description -->
+        ///   @brief Registers a file descriptor with the event loop.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param fd the file descriptor to register
+        ///   @param events the events to wait for (e.g. event_loop_read)
+        ///   @param cb the callback to call when the fd is ready
+        ///   @return Returns true on success, false otherwise
+        ///
+        [[nodiscard]] static bool
+        add(bsl::int32 const fd, bsl::uint32 const events, callback_type const &cb) noexcept
+        {
+            bsl::discard(fd);
+            bsl::discard(events);
+            bsl::discard(cb);
+
+            bsl::error() << "bsl::event_loop is unsupported on this platform\n";
+            return false;
+        }
+
+        /// <!-- description -->
+        ///   @brief Changes the events a registered fd is waiting for
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param fd the file descriptor to modify
+        ///   @param events the events to wait for (e.g. event_loop_read)
+        ///   @return Returns true on success, false otherwise
+        ///
+        [[nodiscard]] static bool
+        modify(bsl::int32 const fd, bsl::uint32 const events) noexcept
+        {
+            bsl::discard(fd);
+            bsl::discard(events);
+
+            bsl::error() << "bsl::event_loop is unsupported on this platform\n";
+            return false;
+        }
+
+        /// <!-- description -->
+        ///   @brief Removes a registered fd (or timer) from the event loop.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param fd the file descriptor to remove
+        ///   @return Returns true on success, false otherwise
+        ///
+        [[maybe_unused]] static bool
+        remove(bsl::int32 const fd) noexcept
+        {
+            bsl::discard(fd);
+
+            bsl::error() << "bsl::event_loop is unsupported on this platform\n";
+            return false;
+        }
+
+        /// <!-- description -->
+        ///   @brief Creates a timer.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param ns the timer's period in nanoseconds
+        ///   @param periodic true if the timer should repeat
+        ///   @param cb the callback to call when the timer expires
+        ///   @return Returns the timer's fd on success, or an error code
+        ///     on failure.
+        ///
+        [[nodiscard]] static result<bsl::int32>
+        add_timer(safe_uintmax const &ns, bool const periodic, callback_type const &cb) noexcept
+        {
+            bsl::discard(ns);
+            bsl::discard(periodic);
+            bsl::discard(cb);
+
+            bsl::error() << "bsl::event_loop is unsupported on this platform\n";
+            return {errc_failure};
+        }
+
+        /// <!-- description -->
+        ///   @brief Queues a call to func(ctx), which is executed by the
+        ///     event loop. Whatever ctx points to must stay alive until
+        ///     func has been called.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param func the function to call
+        ///   @param ctx the context to pass to func
+        ///   @return Returns true on success, false otherwise.
+        ///
+        [[nodiscard]] static bool
+        post(post_type const func, void *const ctx) noexcept
+        {
+            bsl::discard(func);
+            bsl::discard(ctx);
+
+            bsl::error() << "bsl::event_loop is unsupported on this platform\n";
+            return false;
+        }
+
+        /// <!-- description -->
+        ///   @brief Wakes up the event loop.
+        ///
+        static constexpr void
+        wakeup() noexcept
+        {}
+
+        /// <!-- description -->
+        ///   @brief Tells run() to return.
+        ///
+        static constexpr void
+        stop() noexcept
+        {}
+
+        /// <!-- description -->
+        ///   @brief Dispatches a single batch of events.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param timeout the max number of milliseconds to wait for
+        ///   @return Returns the number of callbacks that were called
+        ///
+        [[maybe_unused]] static safe_uintmax
+        run_once(bsl::int32 const timeout) noexcept
+        {
+            bsl::discard(timeout);
+
+            bsl::error() << "bsl::event_loop is unsupported on this platform\n";
+            return {};
+        }
+
+        /// <!-- description -->
+        ///   @brief Dispatches events until stop() is called
+        ///
+        static void
+        run() noexcept
+        {
+            bsl::error() << "bsl::event_loop is unsupported on this platform\n";
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns true if the event loop was successfully
+        ///     created, false otherwise.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Always returns false
+        ///
+        [[nodiscard]] constexpr explicit operator bool() const noexcept
+        {
+            return false;
+        }
+    };
+}
+
+#endif
+
+#endif
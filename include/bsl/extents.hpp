@@ -0,0 +1,114 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+///
+/// @file extents.hpp
+///
+
+#ifndef BSL_EXTENTS_HPP
+#define BSL_EXTENTS_HPP
+
+#include "array.hpp"
+#include "convert.hpp"
+#include "cstdint.hpp"
+#include "safe_integral.hpp"
+
+namespace bsl
+{
+    /// @class bsl::extents
+    ///
+    /// <!-- description -->
+    ///   @brief Describes the shape of a multidimensional array whose
+    ///     extents (the number of elements in each dimension) are all
+    ///     known at compile time. This is used by bsl::mdspan.
+    ///   @include example_mdspan_overview.hpp
+    ///
+    /// <!-- template parameters -->
+    ///   @tparam EXTENTS the number of elements in each dimension
+    ///
+    template<bsl::uintmax... EXTENTS>
+    class extents final
+    {
+        static_assert(sizeof...(EXTENTS) != 0U, "extents of rank 0 are not supported");
+        static_assert(((EXTENTS != 0U) && ...), "extents of size 0 are not supported");
+
+        /// @brief stores the extent of each dimension
+        static constexpr array<bsl::uintmax, sizeof...(EXTENTS)> values{EXTENTS...};
+        /// @brief stores the total number of elements
+        static constexpr safe_uintmax total{(to_umax(EXTENTS) * ...)};
+
+        // The PERFORCE build reports every safe_integral operation as an
+        // overflow, so this can only be checked by a real build.
+        static_assert(
+            BSL_PERFORCE || !!total, "the total number of elements must fit into a bsl::uintmax");
+
+    public:
+        /// <!-- description -->
+        ///   @brief Returns the number of dimensions
+        ///   @include example_mdspan_overview.hpp
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Returns the number of dimensions
+        ///
+        [[nodiscard]] static constexpr safe_uintmax
+        rank() noexcept
+        {
+            return to_umax(sizeof...(EXTENTS));
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns the number of elements in dimension "r", or
+        ///     safe_uintmax::zero(true) if "r" is not a valid dimension.
+        ///   @include example_mdspan_overview.hpp
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param r the dimension to query
+        ///   @return Returns the number of elements in dimension "r"
+        ///
+        [[nodiscard]] static constexpr safe_uintmax
+        extent(safe_uintmax const &r) noexcept
+        {
+            if ((!r) || (r >= rank())) {
+                return safe_uintmax::zero(true);
+            }
+
+            return to_umax(*values.at_if(r));
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns the total number of elements (i.e., the
+        ///     product of all of the extents).
+        ///   @include example_mdspan_overview.hpp
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Returns the total number of elements
+        ///
+        [[nodiscard]] static constexpr safe_uintmax
+        size() noexcept
+        {
+            return total;
+        }
+    };
+}
+
+#endif
@@ -0,0 +1,75 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+///
+/// @file find_if.hpp
+///
+
+#ifndef BSL_FIND_IF_HPP
+#define BSL_FIND_IF_HPP
+
+#include "details/reduce_impl.hpp"
+#include "details/value_type_for.hpp"
+
+#include "convert.hpp"
+#include "is_nothrow_invocable.hpp"
+#include "remove_const.hpp"
+
+namespace bsl
+{
+    /// <!-- description -->
+    ///   @brief Returns a pointer to the first element in a view for
+    ///     which "pred" returns true. The elements are tested a block at
+    ///     a time without branching on the result, so "pred" might be
+    ///     called on a few elements past the one that is returned, and
+    ///     must not have side effects that depend on where the search
+    ///     stops.
+    ///   @include example_find_if_overview.hpp
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @tparam VIEW the type of view to search
+    ///   @tparam PRED the type of predicate to use
+    ///   @param vw the view to search
+    ///   @param pred the predicate to use
+    ///   @return Returns a pointer to the first element in "vw" for which
+    ///     "pred" returns true, or a nullptr if there is no such element.
+    ///
+    template<typename VIEW, typename PRED>
+    [[nodiscard]] constexpr remove_const_t<details::value_type_for<VIEW>> const *
+    find_if(VIEW const &vw, PRED &&pred) noexcept
+    {
+        using value_type = remove_const_t<details::value_type_for<VIEW>>;
+        static_assert(
+            is_nothrow_invocable<PRED, value_type const &>::value, "pred must be noexcept");
+
+        bsl::uintmax const num{vw.size().get()};
+        bsl::uintmax const idx{details::reduce_find_if<value_type>(vw.data(), num, pred)};
+        if (idx == num) {
+            return nullptr;
+        }
+
+        return vw.at_if(to_umax(idx));
+    }
+}
+
+#endif
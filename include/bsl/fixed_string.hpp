@@ -0,0 +1,603 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+///
+/// @file fixed_string.hpp
+///
+
+#ifndef BSL_FIXED_STRING_HPP
+#define BSL_FIXED_STRING_HPP
+
+#include "array.hpp"
+#include "char_type.hpp"
+#include "contiguous_iterator.hpp"
+#include "cstr_type.hpp"
+#include "cstring.hpp"
+#include "debug.hpp"
+#include "fmt_options.hpp"
+#include "safe_integral.hpp"
+#include "string_view.hpp"
+
+namespace bsl
+{
+    /// @class bsl::fixed_string
+    ///
+    /// <!-- description -->
+    ///   @brief Provides a string with inline storage for up to N characters
+    ///     (plus a '\0' terminator that is always maintained). The length
+    ///     of the string is stored, so size() is O(1), and appends are
+    ///     performed as a single bounds check followed by a bulk copy. No
+    ///     memory is ever allocated. If an append does not fit, as much of
+    ///     the append as possible is copied, the append returns false and
+    ///     the string is marked as truncated() until it is cleared. To build
+    ///     a string using the same "<<" syntax as bsl::print(), see
+    ///     bsl::string_builder.
+    ///   @include example_fixed_string_overview.hpp
+    ///
+    /// <!-- template parameters -->
+    ///   @tparam N the max number of characters the string can store.
+    ///
+    template<bsl::uintmax N>
+    class fixed_string final
+    {
+        static_assert(N != 0, "fixed_strings of size 0 are not supported");
+
+        /// @brief stores the string and its '\0' terminator
+        array<char_type, N + 1U> m_data;
+        /// @brief stores the number of characters in the string
+        safe_uintmax m_size;
+        /// @brief stores whether or not an append was truncated
+        bool m_truncated;
+
+    public:
+        /// @brief alias for: char_type
+        using value_type = char_type;
+        /// @brief alias for: safe_uintmax
+        using size_type = safe_uintmax;
+        /// @brief alias for: safe_uintmax
+        using difference_type = safe_uintmax;
+        /// @brief alias for: char_type &
+        using reference_type = char_type &;
+        /// @brief alias for: char_type const &
+        using const_reference_type = char_type const &;
+        /// @brief alias for: char_type *
+        using pointer_type = char_type *;
+        /// @brief alias for: char_type const *
+        using const_pointer_type = char_type const *;
+        /// @brief alias for: contiguous_iterator<char_type>
+        using iterator_type = contiguous_iterator<char_type>;
+        /// @brief alias for: contiguous_iterator<char_type const>
+        using const_iterator_type = contiguous_iterator<char_type const>;
+
+        /// <!-- description -->
+        ///   @brief Creates an empty bsl::fixed_string
+        ///   @include example_fixed_string_overview.hpp
+        ///
+        constexpr fixed_string() noexcept    // --
+            : m_data{}, m_size{}, m_truncated{}
+        {}
+
+        /// <!-- description -->
+        ///   @brief Creates a bsl::fixed_string from a '\0' terminated
+        ///     string. If the string does not fit, it is truncated.
+        ///   @include example_fixed_string_overview.hpp
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param str the string to copy
+        ///
+        constexpr fixed_string(cstr_type const str) noexcept    // PRQA S 2180 // NOLINT
+            : fixed_string{}
+        {
+            bsl::discard(this->append(str));
+        }
+
+        /// <!-- description -->
+        ///   @brief Creates a bsl::fixed_string from a bsl::string_view.
+        ///     If the string does not fit, it is truncated.
+        ///   @include example_fixed_string_overview.hpp
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param str the string to copy
+        ///
+        explicit constexpr fixed_string(string_view const &str) noexcept    // --
+            : fixed_string{}
+        {
+            bsl::discard(this->append(str));
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns a pointer to the character stored at index
+        ///     "index". If the index is out of bounds, this function returns
+        ///     a nullptr.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param index the index of the character to return
+        ///   @return Returns a pointer to the requested character, or a
+        ///     nullptr if the index is out of bounds.
+        ///
+        [[nodiscard]] constexpr pointer_type
+        at_if(size_type const &index) noexcept
+        {
+            if ((!index) || (index >= m_size)) {
+                return nullptr;
+            }
+
+            return m_data.at_if(index);
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns a pointer to the character stored at index
+        ///     "index". If the index is out of bounds, this function returns
+        ///     a nullptr.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param index the index of the character to return
+        ///   @return Returns a pointer to the requested character, or a
+        ///     nullptr if the index is out of bounds.
+        ///
+        [[nodiscard]] constexpr const_pointer_type
+        at_if(size_type const &index) const noexcept
+        {
+            if ((!index) || (index >= m_size)) {
+                return nullptr;
+            }
+
+            return m_data.at_if(index);
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns a pointer to the first character in the
+        ///     string, or a nullptr if the string is empty.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Returns a pointer to the first character in the
+        ///     string, or a nullptr if the string is empty.
+        ///
+        [[nodiscard]] constexpr const_pointer_type
+        front_if() const noexcept
+        {
+            return this->at_if(to_umax(0));
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns a pointer to the last character in the
+        ///     string, or a nullptr if the string is empty.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Returns a pointer to the last character in the
+        ///     string, or a nullptr if the string is empty.
+        ///
+        [[nodiscard]] constexpr const_pointer_type
+        back_if() const noexcept
+        {
+            if (m_size.is_zero()) {
+                return nullptr;
+            }
+
+            return this->at_if(m_size - to_umax(1));
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns a pointer to the '\0' terminated string. This
+        ///     is always valid, even when the string is empty.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Returns a pointer to the '\0' terminated string
+        ///
+        [[nodiscard]] constexpr cstr_type
+        c_str() const noexcept
+        {
+            return m_data.data();
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns a pointer to the '\0' terminated string. This
+        ///     is always valid, even when the string is empty.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Returns a pointer to the '\0' terminated string
+        ///
+        [[nodiscard]] constexpr const_pointer_type
+        data() const noexcept
+        {
+            return m_data.data();
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns a bsl::string_view of the string. If the string
+        ///     is empty, an empty bsl::string_view is returned.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Returns a bsl::string_view of the string
+        ///
+        [[nodiscard]] constexpr string_view
+        view() const noexcept
+        {
+            if (m_size.is_zero()) {
+                return {};
+            }
+
+            return string_view{m_data.data(), m_size};
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns an iterator to the first character of the string.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Returns an iterator to the first character of the string.
+        ///
+        [[nodiscard]] constexpr iterator_type
+        begin() noexcept
+        {
+            return iterator_type{m_data.data(), m_size, to_umax(0)};
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns an iterator to the first character of the string.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Returns an iterator to the first character of the string.
+        ///
+        [[nodiscard]] constexpr const_iterator_type
+        begin() const noexcept
+        {
+            return const_iterator_type{m_data.data(), m_size, to_umax(0)};
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns an iterator to the first character of the string.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Returns an iterator to the first character of the string.
+        ///
+        [[nodiscard]] constexpr const_iterator_type
+        cbegin() const noexcept
+        {
+            return const_iterator_type{m_data.data(), m_size, to_umax(0)};
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns an iterator to one past the last character of
+        ///     the string.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Returns an iterator to one past the last character of
+        ///     the string.
+        ///
+        [[nodiscard]] constexpr iterator_type
+        end() noexcept
+        {
+            return iterator_type{m_data.data(), m_size, m_size};
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns an iterator to one past the last character of
+        ///     the string.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Returns an iterator to one past the last character of
+        ///     the string.
+        ///
+        [[nodiscard]] constexpr const_iterator_type
+        end() const noexcept
+        {
+            return const_iterator_type{m_data.data(), m_size, m_size};
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns an iterator to one past the last character of
+        ///     the string.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Returns an iterator to one past the last character of
+        ///     the string.
+        ///
+        [[nodiscard]] constexpr const_iterator_type
+        cend() const noexcept
+        {
+            return const_iterator_type{m_data.data(), m_size, m_size};
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns size().is_zero()
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Returns size().is_zero()
+        ///
+        [[nodiscard]] constexpr bool
+        empty() const noexcept
+        {
+            return m_size.is_zero();
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns !empty()
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Returns !empty()
+        ///
+        [[nodiscard]] constexpr explicit operator bool() const noexcept
+        {
+            return !this->empty();
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns the number of characters in the string, not
+        ///     including the '\0' terminator.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Returns the number of characters in the string, not
+        ///     including the '\0' terminator.
+        ///
+        [[nodiscard]] constexpr size_type const &
+        size() const noexcept
+        {
+            return m_size;
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns the number of characters in the string, not
+        ///     including the '\0' terminator.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Returns the number of characters in the string, not
+        ///     including the '\0' terminator.
+        ///
+        [[nodiscard]] constexpr size_type const &
+        length() const noexcept
+        {
+            return m_size;
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns the max number of characters the string can
+        ///     store (i.e., N).
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Returns the max number of characters the string can
+        ///     store (i.e., N).
+        ///
+        [[nodiscard]] static constexpr size_type
+        max_size() noexcept
+        {
+            return to_umax(N);
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns true if an append since the last call to
+        ///     clear() did not fit and was truncated.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Returns true if an append since the last call to
+        ///     clear() did not fit and was truncated.
+        ///
+        [[nodiscard]] constexpr bool
+        truncated() const noexcept
+        {
+            return m_truncated;
+        }
+
+        /// <!-- description -->
+        ///   @brief Empties the string and clears the truncated() flag.
+        ///
+        constexpr void
+        clear() noexcept
+        {
+            m_size = to_umax(0);
+            m_truncated = false;
+            *m_data.front_if() = '\0';
+        }
+
+        /// <!-- description -->
+        ///   @brief Appends "count" characters from "str" to the end of the
+        ///     string. The remaining capacity is checked once, after which
+        ///     as many characters as will fit are copied in bulk.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param str the characters to append
+        ///   @param count the number of characters to append
+        ///   @return Returns true if all of the characters were appended,
+        ///     false if the append was truncated or count is invalid.
+        ///
+        [[maybe_unused]] constexpr bool
+        append(cstr_type const str, size_type const &count) noexcept
+        {
+            if ((nullptr == str) || (!count)) {
+                return false;
+            }
+
+            size_type const len{count.min(to_umax(N) - m_size)};
+            bsl::discard(builtin_memcpy(m_data.at_if(m_size), str, len));
+
+            m_size += len;
+            *m_data.at_if(m_size) = '\0';
+
+            if (len != count) {
+                m_truncated = true;
+                return false;
+            }
+
+            return true;
+        }
+
+        /// <!-- description -->
+        ///   @brief Appends a '\0' terminated string to the end of the
+        ///     string.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param str the string to append
+        ///   @return Returns true if all of the characters were appended,
+        ///     false if the append was truncated or str is a nullptr.
+        ///
+        [[maybe_unused]] constexpr bool
+        append(cstr_type const str) noexcept
+        {
+            if (nullptr == str) {
+                return false;
+            }
+
+            return this->append(str, builtin_strlen(str));
+        }
+
+        /// <!-- description -->
+        ///   @brief Appends a bsl::string_view to the end of the string.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param str the string to append
+        ///   @return Returns true if all of the characters were appended,
+        ///     false if the append was truncated.
+        ///
+        [[maybe_unused]] constexpr bool
+        append(string_view const &str) noexcept
+        {
+            if (str.empty()) {
+                return true;
+            }
+
+            return this->append(str.data(), str.size());
+        }
+
+        /// <!-- description -->
+        ///   @brief Appends a single character to the end of the string.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param c the character to append
+        ///   @return Returns true if the character was appended, false if
+        ///     the string is full.
+        ///
+        [[maybe_unused]] constexpr bool
+        push_back(char_type const c) noexcept
+        {
+            if (m_size >= to_umax(N)) {
+                m_truncated = true;
+                return false;
+            }
+
+            *m_data.at_if(m_size) = c;
+            ++m_size;
+            *m_data.at_if(m_size) = '\0';
+
+            return true;
+        }
+    };
+
+    /// <!-- description -->
+    ///   @brief Returns true if the two strings contain the same characters.
+    ///   @related bsl::fixed_string
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @tparam N1 the max size of the left hand side
+    ///   @tparam N2 the max size of the right hand side
+    ///   @param lhs the left hand side of the operation
+    ///   @param rhs the right hand side of the operation
+    ///   @return Returns true if the two strings contain the same characters.
+    ///
+    template<bsl::uintmax N1, bsl::uintmax N2>
+    [[nodiscard]] constexpr bool
+    operator==(fixed_string<N1> const &lhs, fixed_string<N2> const &rhs) noexcept
+    {
+        return lhs.view() == rhs.view();
+    }
+
+    /// <!-- description -->
+    ///   @brief Returns true if the two strings contain the same characters.
+    ///   @related bsl::fixed_string
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @tparam N the max size of the left hand side
+    ///   @param lhs the left hand side of the operation
+    ///   @param rhs the right hand side of the operation
+    ///   @return Returns true if the two strings contain the same characters.
+    ///
+    template<bsl::uintmax N>
+    [[nodiscard]] constexpr bool
+    operator==(fixed_string<N> const &lhs, cstr_type const rhs) noexcept
+    {
+        return builtin_strlen(rhs) == lhs.size() &&
+               builtin_strncmp(lhs.c_str(), rhs, lhs.size()) == 0;
+    }
+
+    /// <!-- description -->
+    ///   @brief Returns true if the two strings do not contain the same
+    ///     characters.
+    ///   @related bsl::fixed_string
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @tparam N1 the max size of the left hand side
+    ///   @tparam N2 the max size of the right hand side
+    ///   @param lhs the left hand side of the operation
+    ///   @param rhs the right hand side of the operation
+    ///   @return Returns true if the two strings do not contain the same
+    ///     characters.
+    ///
+    template<bsl::uintmax N1, bsl::uintmax N2>
+    [[nodiscard]] constexpr bool
+    operator!=(fixed_string<N1> const &lhs, fixed_string<N2> const &rhs) noexcept
+    {
+        return !(lhs == rhs);
+    }
+
+    /// <!-- description -->
+    ///   @brief Returns true if the two strings do not contain the same
+    ///     characters.
+    ///   @related bsl::fixed_string
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @tparam N the max size of the left hand side
+    ///   @param lhs the left hand side of the operation
+    ///   @param rhs the right hand side of the operation
+    ///   @return Returns true if the two strings do not contain the same
+    ///     characters.
+    ///
+    template<bsl::uintmax N>
+    [[nodiscard]] constexpr bool
+    operator!=(fixed_string<N> const &lhs, cstr_type const rhs) noexcept
+    {
+        return !(lhs == rhs);
+    }
+
+    /// <!-- description -->
+    ///   @brief This function is responsible for implementing bsl::fmt
+    ///     for fixed_string types. For strings, the only fmt options
+    ///     that are available are alignment, fill and width, all of which
+    ///     are handled by the fmt_impl_align_xxx functions.
+    ///   @related bsl::fixed_string
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @tparam OUT the type of out (i.e., debug, alert, etc)
+    ///   @tparam N the max size of the string being outputted
+    ///   @param o the instance of out<T> to output to
+    ///   @param ops ops the fmt options used to format the output
+    ///   @param str the fixed_string being outputted
+    ///
+    template<typename OUT, bsl::uintmax N>
+    constexpr void
+    fmt_impl(OUT &&o, fmt_options const &ops, fixed_string<N> const &str) noexcept
+    {
+        details::fmt_impl_align_pre(o, ops, str.length(), true);
+        o.write(str.c_str());
+        details::fmt_impl_align_suf(o, ops, str.length(), true);
+    }
+}
+
+#endif
@@ -0,0 +1,269 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+///
+/// @file flight_recorder.hpp
+///
+
+#ifndef BSL_FLIGHT_RECORDER_HPP
+#define BSL_FLIGHT_RECORDER_HPP
+
+#include "char_type.hpp"
+#include "color.hpp"
+#include "cstdint.hpp"
+#include "cstr_type.hpp"
+
+namespace bsl
+{
+    template<typename T>
+    class out;
+
+    /// @brief the number of records each thread's bsl::flight_recorder keeps
+    constexpr bsl::uintmax flight_recorder_size{64U};
+    /// @brief the number of bytes a single record can hold (including the '\0')
+    constexpr bsl::uintmax flight_record_size{128U};
+
+    /// @class bsl::flight_recorder
+    ///
+    /// <!-- description -->
+    ///   @brief A ring of the last flight_recorder_size debug records
+    ///     written by a thread. When the level of a bsl::debug() or
+    ///     bsl::alert() is greater than BSL_DEBUG_LEVEL, instead of being
+    ///     discarded, the record is formatted into the ring, so the
+    ///     console stays quiet while the context is still available when
+    ///     something fails. Records are stored preformatted in fixed
+    ///     sized slots and anything that does not fit in a slot is
+    ///     truncated. The calling thread's ring is dumped (and cleared)
+    ///     each time bsl::error() is called, and can be dumped at any
+    ///     time by outputting this_thread_flight_recorder().
+    ///   @include example_flight_recorder_overview.hpp
+    ///
+    class flight_recorder final
+    {
+        /// @brief used to turn the number of records into an index
+        static constexpr bsl::uintmax index_mask{flight_recorder_size - 1U};
+
+        static_assert(0U == (flight_recorder_size & index_mask));
+
+        /// @brief stores the ring (the ring is written to by bsl::out,
+        ///   which everything depends on, so a plain array is used)
+        char_type m_ring[flight_recorder_size][flight_record_size]{};    // NOLINT
+        /// @brief stores the total number of records started
+        bsl::uintmax m_total{};
+        /// @brief stores the number of characters in the current record
+        bsl::uintmax m_len{};
+
+    public:
+        /// <!-- description -->
+        ///   @brief Starts a new record, replacing the oldest record if
+        ///     the ring is full.
+        ///   @include example_flight_recorder_overview.hpp
+        ///
+        constexpr void
+        begin() noexcept
+        {
+            m_ring[m_total & index_mask][0] = '\0';    // NOLINT
+            m_len = {};
+            ++m_total;
+        }
+
+        /// <!-- description -->
+        ///   @brief Adds a character to the current record. If no record
+        ///     has been started, or the current record is full, the
+        ///     character is dropped.
+        ///   @include example_flight_recorder_overview.hpp
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param c the character to add
+        ///
+        constexpr void
+        put(char_type const c) noexcept
+        {
+            if ((0U == m_total) || ((m_len + 1U) >= flight_record_size)) {
+                return;
+            }
+
+            char_type *const rec{m_ring[(m_total - 1U) & index_mask]};    // NOLINT
+            rec[m_len] = c;                                               // NOLINT
+            ++m_len;
+            rec[m_len] = '\0';    // NOLINT
+        }
+
+        /// <!-- description -->
+        ///   @brief Adds a '\0' terminated string to the current record.
+        ///     Characters that do not fit are dropped.
+        ///   @include example_flight_recorder_overview.hpp
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param str the string to add
+        ///
+        constexpr void
+        put(cstr_type const str) noexcept
+        {
+            if (nullptr == str) {
+                return;
+            }
+
+            for (bsl::uintmax i{}; '\0' != str[i]; ++i) {    // NOLINT
+                if ((m_len + 1U) >= flight_record_size) {
+                    return;
+                }
+
+                this->put(str[i]);    // NOLINT
+            }
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns the number of records in the ring
+        ///   @include example_flight_recorder_overview.hpp
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Returns the number of records in the ring
+        ///
+        [[nodiscard]] constexpr bsl::uintmax
+        size() const noexcept
+        {
+            return (m_total < flight_recorder_size) ? m_total : flight_recorder_size;
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns the total number of records started since the
+        ///     ring was created or last cleared, including records that
+        ///     have since been replaced.
+        ///   @include example_flight_recorder_overview.hpp
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Returns the total number of records started
+        ///
+        [[nodiscard]] constexpr bsl::uintmax
+        total() const noexcept
+        {
+            return m_total;
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns the ith oldest record in the ring (i.e., 0 is
+        ///     the oldest record), or a nullptr if i >= size().
+        ///   @include example_flight_recorder_overview.hpp
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param i the index of the record to return
+        ///   @return Returns the ith oldest record, or a nullptr
+        ///
+        [[nodiscard]] constexpr cstr_type
+        at_if(bsl::uintmax const i) const noexcept
+        {
+            if (i >= this->size()) {
+                return nullptr;
+            }
+
+            return m_ring[(m_total - this->size() + i) & index_mask];    // NOLINT
+        }
+
+        /// <!-- description -->
+        ///   @brief Removes all of the records from the ring
+        ///   @include example_flight_recorder_overview.hpp
+        ///
+        constexpr void
+        clear() noexcept
+        {
+            m_total = {};
+            m_len = {};
+        }
+    };
+
+    /// <!-- description -->
+    ///   @brief Returns the calling thread's bsl::flight_recorder
+    ///   @include example_flight_recorder_overview.hpp
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @return Returns the calling thread's bsl::flight_recorder
+    ///
+    [[nodiscard]] inline flight_recorder &
+    this_thread_flight_recorder() noexcept
+    {
+        static thread_local flight_recorder s_recorder{};
+        return s_recorder;
+    }
+
+    namespace details
+    {
+        /// <!-- description -->
+        ///   @brief Outputs the provided bsl::flight_recorder using the
+        ///     static write() functions of the provided output type,
+        ///     oldest record first. Each record is labeled "TRACE" and a
+        ///     newline is added to records that do not end in one.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @tparam O the type of bsl::out used to output the records
+        ///   @param recorder the bsl::flight_recorder to output
+        ///
+        template<typename O>
+        constexpr void
+        write_flight_recorder(flight_recorder const &recorder) noexcept
+        {
+            for (bsl::uintmax i{}; i < recorder.size(); ++i) {
+                cstr_type const rec{recorder.at_if(i)};
+
+                O::write(bsl::bold_blue);
+                O::write("TRACE ");
+                O::write(bsl::reset_color);
+
+                bsl::uintmax len{};
+                for (; '\0' != rec[len]; ++len) {    // NOLINT
+                    O::write(rec[len]);               // NOLINT
+                }
+
+                if ((0U == len) || ('\n' != rec[len - 1U])) {    // NOLINT
+                    O::write('\n');
+                }
+            }
+        }
+    }
+
+    /// <!-- description -->
+    ///   @brief Outputs the provided bsl::flight_recorder to the provided
+    ///     output type, oldest record first.
+    ///   @related bsl::flight_recorder
+    ///   @include example_flight_recorder_overview.hpp
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @tparam T the type of outputter provided
+    ///   @param o the instance of the outputter used to output the value.
+    ///   @param recorder the bsl::flight_recorder to output
+    ///   @return return o
+    ///
+    template<typename T>
+    [[maybe_unused]] constexpr out<T>
+    operator<<(out<T> const o, flight_recorder const &recorder) noexcept
+    {
+        if constexpr (!o) {
+            return o;
+        }
+
+        details::write_flight_recorder<out<T>>(recorder);
+        return o;
+    }
+}
+
+#endif
@@ -49,6 +49,10 @@
 
 namespace bsl
 {
+    /// @brief prototype for bsl::string_builder (see string_builder.hpp)
+    template<bsl::uintmax N>
+    class string_builder;
+
     /// @class bsl::fmt
     ///
     /// <!-- description -->
@@ -426,6 +430,26 @@ namespace bsl
         template<typename T, typename U>
         friend constexpr out<T>
         operator<<(out<T> const o, fmt<U> &&arg) noexcept;    // PRQA S 2107 // NOLINT
+
+        /// <!-- description -->
+        ///   @brief Outputs the provided formatted argument to the provided
+        ///     bsl::string_builder.
+        ///   @related bsl::fmt
+        ///
+        /// <!-- notes -->
+        ///   @note See the note for the bsl::out version above.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @tparam N the max size of the bsl::string_builder
+        ///   @tparam U the type of value being ouputter using bsl::fmt
+        ///   @param b the instance of the bsl::string_builder to append to.
+        ///   @param arg a bsl::fmt that contains the value being outputted as
+        ///     well as any format instructions.
+        ///   @return return b
+        ///
+        template<bsl::uintmax N, typename U>
+        friend constexpr string_builder<N> &
+        operator<<(string_builder<N> &b, fmt<U> &&arg) noexcept;    // PRQA S 2107 // NOLINT
     };
 
     /// <!-- description -->
@@ -0,0 +1,321 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+///
+/// @file frame_pool.hpp
+///
+
+#ifndef BSL_FRAME_POOL_HPP
+#define BSL_FRAME_POOL_HPP
+
+#include "byte.hpp"
+#include "construct_at.hpp"
+#include "convert.hpp"
+#include "debug.hpp"
+#include "safe_integral.hpp"
+#include "span.hpp"
+
+namespace bsl
+{
+    /// @class bsl::frame_pool
+    ///
+    /// <!-- description -->
+    ///   @brief Implements a fixed size block allocator that is used to
+    ///     store the frames of bsl::task and bsl::generator coroutines.
+    ///     The BSL does not have access to a heap, and operator new would
+    ///     throw if it could not allocate, neither of which are allowed.
+    ///     Instead, the caller provides a buffer, which the bsl::frame_pool
+    ///     divides into equally sized blocks and tracks using an intrusive
+    ///     free list. Allocation and deallocation are both O(1).
+    ///
+    /// <!-- notes -->
+    ///   @note Each block starts with a small header that stores a pointer
+    ///     back to the pool that owns it. This allows a frame to be returned
+    ///     to its pool without the coroutine having to remember where it
+    ///     came from. For this reason, a bsl::frame_pool can neither be
+    ///     copied nor moved.
+    ///   @note The bsl::frame_pool is not thread safe. It is meant to be
+    ///     used by a single bsl::run_queue (or by code that provides its
+    ///     own locking).
+    ///   @note The provided buffer must be aligned to
+    ///     bsl::frame_pool::alignment() as frames are given the same
+    ///     alignment guarantees as operator new.
+    ///   @include example_frame_pool_overview.hpp
+    ///
+    class frame_pool final
+    {
+        /// @brief stores the buffer the blocks are allocated from
+        span<byte> m_buf{};
+        /// @brief stores the size of each block (including the header)
+        safe_uintmax m_block_size{};
+        /// @brief stores the head of the free list
+        void *m_head{};
+        /// @brief stores the total number of blocks in the pool
+        safe_uintmax m_capacity{};
+        /// @brief stores the number of blocks that are still available
+        safe_uintmax m_available{};
+
+        /// <!-- description -->
+        ///   @brief Returns the header of the block at the provided index
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param i the index of the block to return the header for
+        ///   @return Returns the header of the block at the provided index
+        ///
+        [[nodiscard]] void **
+        header_at(safe_uintmax const &i) noexcept
+        {
+            return static_cast<void **>(static_cast<void *>(m_buf.at_if(i * m_block_size)));
+        }
+
+        /// <!-- description -->
+        ///   @brief Resets an invalid pool back to an empty pool. Every
+        ///     call to allocate() on an empty pool returns a nullptr.
+        ///
+        constexpr void
+        reset() noexcept
+        {
+            m_buf = {};
+            m_block_size = {};
+            m_head = {};
+            m_capacity = {};
+            m_available = {};
+        }
+
+    public:
+        /// <!-- description -->
+        ///   @brief Returns the alignment of every frame allocated from a
+        ///     bsl::frame_pool. This is also the size of each block's header.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Returns the alignment of every frame allocated from a
+        ///     bsl::frame_pool.
+        ///
+        [[nodiscard]] static constexpr safe_uintmax
+        alignment() noexcept
+        {
+            return safe_uintmax{static_cast<bsl::uintmax>(__STDCPP_DEFAULT_NEW_ALIGNMENT__)};
+        }
+
+        /// <!-- description -->
+        ///   @brief Default constructor. Creates an empty pool. All calls to
+        ///     allocate() will return a nullptr.
+        ///
+        constexpr frame_pool() noexcept = default;
+
+        /// <!-- description -->
+        ///   @brief Creates a bsl::frame_pool from a caller provided buffer.
+        ///     The buffer is divided into as many blocks of block_size bytes
+        ///     (plus the size of the header, rounded up to alignment()) as
+        ///     will fit. If the buffer is invalid, is not aligned, or is too
+        ///     small to hold a single block, the resulting pool is empty.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param buf the buffer to allocate frames from
+        ///   @param block_size the largest frame that can be allocated
+        ///
+        frame_pool(span<byte> const &buf, safe_uintmax const &block_size) noexcept    // --
+            : m_buf{buf}
+        {
+            safe_uintmax const align{alignment()};
+            safe_uintmax const mask{align - safe_uintmax::one()};
+
+            m_block_size = ((block_size + mask) & ~mask) + align;
+            if (m_block_size.failure() || (!m_buf) || block_size.is_zero()) {
+                bsl::error() << "frame_pool: invalid constructor args\n";
+                reset();
+                return;
+            }
+
+            if ((to_uptr(m_buf.data()) & convert<bsl::uintptr>(mask)).is_pos()) {
+                bsl::error() << "frame_pool: buffer is not properly aligned\n";
+                reset();
+                return;
+            }
+
+            m_capacity = m_buf.size() / m_block_size;
+            if (m_capacity.is_zero()) {
+                bsl::error() << "frame_pool: buffer is too small\n";
+                reset();
+                return;
+            }
+
+            for (safe_uintmax i{m_capacity}; i.is_pos(); --i) {
+                construct_at<void *>(header_at(i - safe_uintmax::one()), m_head);
+                m_head = header_at(i - safe_uintmax::one());
+            }
+
+            m_available = m_capacity;
+        }
+
+        /// <!-- description -->
+        ///   @brief Destroyes a previously created bsl::frame_pool. Note that
+        ///     all frames must be returned before the pool is destroyed.
+        ///
+        ~frame_pool() noexcept = default;
+
+        /// <!-- description -->
+        ///   @brief copy constructor
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param o the object being copied
+        ///
+        frame_pool(frame_pool const &o) noexcept = delete;
+
+        /// <!-- description -->
+        ///   @brief move constructor
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param o the object being moved
+        ///
+        frame_pool(frame_pool &&o) noexcept = delete;
+
+        /// <!-- description -->
+        ///   @brief copy assignment
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param o the object being copied
+        ///   @return a reference to *this
+        ///
+        [[maybe_unused]] frame_pool &operator=(frame_pool const &o) &noexcept = delete;
+
+        /// <!-- description -->
+        ///   @brief move assignment
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param o the object being moved
+        ///   @return a reference to *this
+        ///
+        [[maybe_unused]] frame_pool &operator=(frame_pool &&o) &noexcept = delete;
+
+        /// <!-- description -->
+        ///   @brief Allocates a frame of the requested size from the pool.
+        ///     If the requested size is larger than the pool's block size,
+        ///     or the pool has run out of blocks, a nullptr is returned.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param size the number of bytes to allocate
+        ///   @return Returns a pointer to the newly allocated frame, or a
+        ///     nullptr on failure.
+        ///
+        [[nodiscard]] void *
+        allocate(safe_uintmax const &size) noexcept
+        {
+            if ((size + alignment()) > m_block_size) {
+                bsl::error() << "frame_pool: frame of size " << size << " is too large\n";
+                return nullptr;
+            }
+
+            if (nullptr == m_head) {
+                bsl::error() << "frame_pool: out of frames\n";
+                return nullptr;
+            }
+
+            void **const hdr{static_cast<void **>(m_head)};
+            m_head = *hdr;
+            *hdr = this;
+            --m_available;
+
+            return static_cast<byte *>(static_cast<void *>(hdr)) + alignment().get();    // NOLINT
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns a frame previously allocated using allocate()
+        ///     back to the pool that it was allocated from. If ptr is a
+        ///     nullptr, this function does nothing.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param ptr a pointer to the frame to deallocate
+        ///
+        static void
+        deallocate(void *const ptr) noexcept
+        {
+            if (nullptr == ptr) {
+                return;
+            }
+
+            void *const blk{static_cast<byte *>(ptr) - alignment().get()};    // NOLINT
+            void **const hdr{static_cast<void **>(blk)};
+            auto *const pool{static_cast<frame_pool *>(*hdr)};
+
+            *hdr = pool->m_head;
+            pool->m_head = hdr;
+            ++pool->m_available;
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns the total number of blocks in the pool
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Returns the total number of blocks in the pool
+        ///
+        [[nodiscard]] constexpr safe_uintmax const &
+        capacity() const noexcept
+        {
+            return m_capacity;
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns the number of blocks that are still available
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Returns the number of blocks that are still available
+        ///
+        [[nodiscard]] constexpr safe_uintmax const &
+        available() const noexcept
+        {
+            return m_available;
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns the largest frame that can be allocated from
+        ///     this pool.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Returns the largest frame that can be allocated from
+        ///     this pool.
+        ///
+        [[nodiscard]] constexpr safe_uintmax
+        block_size() const noexcept
+        {
+            if (m_block_size.is_zero()) {
+                return m_block_size;
+            }
+
+            return m_block_size - alignment();
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns !empty()
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Returns !empty()
+        ///
+        [[nodiscard]] constexpr explicit operator bool() const noexcept
+        {
+            return m_capacity.is_pos();
+        }
+    };
+}
+
+#endif
@@ -0,0 +1,229 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+///
+/// @file function_ref.hpp
+///
+
+#ifndef BSL_FUNCTION_REF_HPP
+#define BSL_FUNCTION_REF_HPP
+
+#include "addressof.hpp"
+#include "debug.hpp"
+#include "enable_if.hpp"
+#include "forward.hpp"
+#include "invoke.hpp"
+#include "is_lvalue_reference.hpp"
+#include "is_pointer.hpp"
+#include "is_same.hpp"
+#include "is_void.hpp"
+#include "remove_cvref.hpp"
+
+namespace bsl
+{
+    /// @class bsl::function_ref
+    ///
+    /// <!-- description -->
+    ///   @brief Defines the primary template for a bsl::function_ref.
+    ///     Only the R(ARGS...) specialization is defined.
+    ///
+    /// <!-- template parameters -->
+    ///   @tparam FUNC the function signature of the bsl::function_ref
+    ///
+    template<typename FUNC>
+    class function_ref;
+
+    /// @class bsl::function_ref
+    ///
+    /// <!-- description -->
+    ///   @brief A bsl::function_ref is a non-owning reference to a
+    ///     callable object (a lambda, a functor or a function). It is the
+    ///     size of two pointers, it never allocates and it can be copied
+    ///     freely, making it a good fit for callbacks that must be stored
+    ///     in a fixed size table. Since a bsl::function_ref does not own
+    ///     what it references, it can only be created from an lvalue (or
+    ///     a function pointer), which prevents a bsl::function_ref from
+    ///     referencing a temporary that is destroyed before the
+    ///     bsl::function_ref is called.
+    ///   @include example_function_ref_overview.hpp
+    ///
+    /// <!-- template parameters -->
+    ///   @tparam R the return type of the function
+    ///   @tparam ARGS the argument types of the function
+    ///
+    template<typename R, typename... ARGS>
+    class function_ref<R(ARGS...)> final
+    {
+        /// @brief defines the type of the function used to call m_obj
+        using thunk_type = R (*)(function_ref const &, ARGS...);
+
+        /// @brief stores a pointer to the callable object (if any)
+        void *m_obj{};
+        /// @brief stores a pointer to a function (if any)
+        R (*m_fp)(ARGS...){};
+        /// @brief stores the function used to call the callable
+        thunk_type m_thunk{};
+
+        /// <!-- description -->
+        ///   @brief Calls the callable object stored in m_obj
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @tparam F the type of callable object stored in m_obj
+        ///   @param self the bsl::function_ref storing the callable
+        ///   @param args the arguments to pass to the callable
+        ///   @return Returns the result of the callable
+        ///
+        template<typename F>
+        static constexpr R
+        call_obj(function_ref const &self, ARGS... args) noexcept
+        {
+            return bsl::invoke(*static_cast<F *>(self.m_obj), bsl::forward<ARGS>(args)...);
+        }
+
+        /// <!-- description -->
+        ///   @brief Calls the function stored in m_fp
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param self the bsl::function_ref storing the function
+        ///   @param args the arguments to pass to the function
+        ///   @return Returns the result of the function
+        ///
+        static constexpr R
+        call_fp(function_ref const &self, ARGS... args) noexcept
+        {
+            return self.m_fp(bsl::forward<ARGS>(args)...);
+        }
+
+    public:
+        /// <!-- description -->
+        ///   @brief Default constructor. Creates an invalid
+        ///     bsl::function_ref. Calling an invalid bsl::function_ref
+        ///     outputs an error and returns R{}.
+        ///
+        constexpr function_ref() noexcept = default;
+
+        /// <!-- description -->
+        ///   @brief Creates a bsl::function_ref that references the
+        ///     provided callable object.
+        ///
+        ///   SUPPRESSION: PRQA 2180 - exception required
+        ///   - We suppress this because A12-1-4 states that all constructors
+        ///     that are callable from a fundamental type should be marked as
+        ///     explicit. A bsl::function_ref is meant to be used as a
+        ///     function parameter, and is never created from a fundamental
+        ///     type.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @tparam F the type of callable object to reference
+        ///   @param f the callable object to reference
+        ///
+        template<
+            typename F,
+            enable_if_t<!is_same<remove_cvref_t<F>, function_ref>::value, bool> = true>
+        constexpr function_ref(F &f) noexcept    // PRQA S 2180 // NOLINT
+            : m_obj{const_cast<void *>(static_cast<void const *>(addressof(f)))}    // NOLINT
+            , m_fp{}
+            , m_thunk{&call_obj<F>}
+        {}
+
+        /// <!-- description -->
+        ///   @brief Creates a bsl::function_ref that references the
+        ///     provided function.
+        ///
+        ///   SUPPRESSION: PRQA 2180 - exception required
+        ///   - We suppress this because A12-1-4 states that all constructors
+        ///     that are callable from a fundamental type should be marked as
+        ///     explicit. A bsl::function_ref is meant to be used as a
+        ///     function parameter, and implicit conversions from a function
+        ///     are what make that possible.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param fp the function to reference
+        ///
+        constexpr function_ref(R (*const fp)(ARGS...)) noexcept    // PRQA S 2180 // NOLINT
+            : m_obj{}, m_fp{fp}, m_thunk{}
+        {
+            if (nullptr != m_fp) {
+                m_thunk = &call_fp;
+            }
+        }
+
+        /// <!-- description -->
+        ///   @brief Prevents a bsl::function_ref from being created from
+        ///     a temporary, as the temporary would be destroyed before the
+        ///     bsl::function_ref could be called. Function pointers are
+        ///     handled by the function pointer constructor.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @tparam F the type of callable object to reference
+        ///   @param f the callable object to reference
+        ///
+        template<
+            typename F,
+            enable_if_t<!is_lvalue_reference<F>::value, bool> = true,
+            enable_if_t<!is_pointer<F>::value, bool> = true,
+            enable_if_t<!is_same<remove_cvref_t<F>, function_ref>::value, bool> = true>
+        constexpr function_ref(F &&f) noexcept = delete;    // PRQA S 2180 // NOLINT
+
+        /// <!-- description -->
+        ///   @brief Calls the referenced callable object with the
+        ///     provided arguments.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param args the arguments to pass to the callable object
+        ///   @return Returns the result of the callable object, or R{} if
+        ///     the bsl::function_ref is invalid.
+        ///
+        [[maybe_unused]] constexpr R
+        operator()(ARGS... args) const noexcept
+        {
+            if (nullptr == m_thunk) {
+                bsl::error() << "function_ref: invalid function\n";
+
+                if constexpr (is_void<R>::value) {
+                    return;
+                }
+                else {
+                    return R{};
+                }
+            }
+
+            return m_thunk(*this, bsl::forward<ARGS>(args)...);
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns true if the bsl::function_ref references a
+        ///     callable object, false otherwise.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Returns true if the bsl::function_ref references a
+        ///     callable object, false otherwise.
+        ///
+        [[nodiscard]] constexpr explicit operator bool() const noexcept
+        {
+            return nullptr != m_thunk;
+        }
+    };
+}
+
+#endif
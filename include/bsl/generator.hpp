@@ -0,0 +1,319 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+///
+/// @file generator.hpp
+///
+
+#ifndef BSL_GENERATOR_HPP
+#define BSL_GENERATOR_HPP
+
+#include "details/frame_pool_promise.hpp"
+#include "exchange.hpp"
+
+// Notes: --
+// - Coroutines need C++20, and the PERFORCE build is C++17, so this
+//   header is empty unless the compiler supports them.
+//
+#if !BSL_PERFORCE && defined(__cpp_impl_coroutine)
+
+#include <coroutine>    // NOLINT
+
+namespace bsl
+{
+    template<typename T>
+    class generator;
+
+    namespace details
+    {
+        /// @class bsl::details::generator_promise
+        ///
+        /// <!-- description -->
+        ///   @brief Defines the promise type of a bsl::generator. The
+        ///     promise stores a pointer to the most recently yielded value,
+        ///     which remains valid until the generator is resumed.
+        ///
+        /// <!-- template parameters -->
+        ///   @tparam T the type of value yielded by the generator
+        ///
+        template<typename T>
+        class generator_promise final : public frame_pool_promise
+        {
+            /// @brief stores a pointer to the most recently yielded value
+            T const *m_current{};
+
+        public:
+            /// <!-- description -->
+            ///   @brief Returns the bsl::generator that owns this promise
+            ///
+            /// <!-- inputs/outputs -->
+            ///   @return Returns the bsl::generator that owns this promise
+            ///
+            [[nodiscard]] generator<T>
+            get_return_object() noexcept
+            {
+                return generator<T>{std::coroutine_handle<generator_promise>::from_promise(*this)};
+            }
+
+            /// <!-- description -->
+            ///   @brief Called by the compiler when the frame of the
+            ///     generator could not be allocated. The resulting
+            ///     bsl::generator is invalid and yields nothing.
+            ///
+            /// <!-- inputs/outputs -->
+            ///   @return Returns an invalid bsl::generator
+            ///
+            [[nodiscard]] static generator<T>
+            get_return_object_on_allocation_failure() noexcept
+            {
+                return generator<T>{};
+            }
+
+            /// <!-- description -->
+            ///   @brief A bsl::generator is lazy and does not start
+            ///     executing until next() is called.
+            ///
+            /// <!-- inputs/outputs -->
+            ///   @return Returns std::suspend_always
+            ///
+            [[nodiscard]] static constexpr std::suspend_always
+            initial_suspend() noexcept
+            {
+                return {};
+            }
+
+            /// <!-- description -->
+            ///   @brief A completed generator is suspended so that the
+            ///     bsl::generator can tell that it is done.
+            ///
+            /// <!-- inputs/outputs -->
+            ///   @return Returns std::suspend_always
+            ///
+            [[nodiscard]] static constexpr std::suspend_always
+            final_suspend() noexcept
+            {
+                return {};
+            }
+
+            /// <!-- description -->
+            ///   @brief Stores a pointer to the yielded value and then
+            ///     suspends the generator.
+            ///
+            /// <!-- inputs/outputs -->
+            ///   @param val the value being yielded
+            ///   @return Returns std::suspend_always
+            ///
+            [[nodiscard]] constexpr std::suspend_always
+            yield_value(T const &val) noexcept
+            {
+                m_current = &val;
+                return {};
+            }
+
+            /// <!-- description -->
+            ///   @brief Called by the compiler when the generator completes
+            ///
+            constexpr void
+            return_void() noexcept
+            {
+                m_current = nullptr;
+            }
+
+            /// <!-- description -->
+            ///   @brief Exceptions are not supported by the BSL. This
+            ///     function is only provided as it is required by the
+            ///     compiler.
+            ///
+            static constexpr void
+            unhandled_exception() noexcept
+            {}
+
+            /// <!-- description -->
+            ///   @brief Returns a pointer to the most recently yielded value
+            ///
+            /// <!-- inputs/outputs -->
+            ///   @return Returns a pointer to the most recently yielded value
+            ///
+            [[nodiscard]] constexpr T const *
+            current() const noexcept
+            {
+                return m_current;
+            }
+        };
+    }
+
+    /// @class bsl::generator
+    ///
+    /// <!-- description -->
+    ///   @brief Implements a lazy coroutine that yields a sequence of
+    ///     values, without the need for a heap or exceptions. Like a
+    ///     bsl::task, a generator's frame is allocated from the first
+    ///     bsl::frame_pool that is passed to the coroutine as an argument.
+    ///     Values are retrieved by calling next() followed by get_if(),
+    ///     which returns a nullptr once the generator has completed (or
+    ///     if the generator's frame could not be allocated).
+    ///   @include example_generator_overview.hpp
+    ///
+    /// <!-- template parameters -->
+    ///   @tparam T the type of value yielded by the generator
+    ///
+    template<typename T>
+    class generator final
+    {
+        /// @brief stores a handle to the generator's coroutine
+        std::coroutine_handle<details::generator_promise<T>> m_hndl;
+
+    public:
+        /// @brief alias for: T
+        using value_type = T;
+        /// @brief alias for: details::generator_promise<T>
+        using promise_type = details::generator_promise<T>;
+
+        /// <!-- description -->
+        ///   @brief Default constructor. Creates an invalid generator.
+        ///
+        constexpr generator() noexcept = default;
+
+        /// <!-- description -->
+        ///   @brief Creates a bsl::generator given a handle to the
+        ///     generator's coroutine. Used by the generator's promise.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param hndl a handle to the generator's coroutine
+        ///
+        explicit constexpr generator(std::coroutine_handle<promise_type> const hndl) noexcept
+            : m_hndl{hndl}
+        {}
+
+        /// <!-- description -->
+        ///   @brief Destroyes a previously created bsl::generator, returning
+        ///     its frame back to the bsl::frame_pool it came from.
+        ///
+        ~generator() noexcept
+        {
+            if (m_hndl) {
+                m_hndl.destroy();
+            }
+        }
+
+        /// <!-- description -->
+        ///   @brief copy constructor
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param o the object being copied
+        ///
+        generator(generator const &o) noexcept = delete;
+
+        /// <!-- description -->
+        ///   @brief move constructor
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param o the object being moved
+        ///
+        constexpr generator(generator &&o) noexcept    // --
+            : m_hndl{bsl::exchange(o.m_hndl, {})}
+        {}
+
+        /// <!-- description -->
+        ///   @brief copy assignment
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param o the object being copied
+        ///   @return a reference to *this
+        ///
+        [[maybe_unused]] generator &operator=(generator const &o) &noexcept = delete;
+
+        /// <!-- description -->
+        ///   @brief move assignment
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param o the object being moved
+        ///   @return a reference to *this
+        ///
+        [[maybe_unused]] generator &
+        operator=(generator &&o) &noexcept
+        {
+            if (this != &o) {
+                if (m_hndl) {
+                    m_hndl.destroy();
+                }
+
+                m_hndl = bsl::exchange(o.m_hndl, {});
+            }
+
+            return *this;
+        }
+
+        /// <!-- description -->
+        ///   @brief Resumes the generator until it either yields its next
+        ///     value or completes.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Returns true if the generator yielded a value, false
+        ///     if the generator is invalid or has completed.
+        ///
+        [[maybe_unused]] bool
+        next() noexcept
+        {
+            if ((!m_hndl) || m_hndl.done()) {
+                return false;
+            }
+
+            m_hndl.resume();
+            return !m_hndl.done();
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns a pointer to the most recently yielded value,
+        ///     or a nullptr if next() has not been called, the generator is
+        ///     invalid or the generator has completed.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Returns a pointer to the most recently yielded value
+        ///
+        [[nodiscard]] T const *
+        get_if() const noexcept
+        {
+            if ((!m_hndl) || m_hndl.done()) {
+                return nullptr;
+            }
+
+            return m_hndl.promise().current();
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns true if the generator's frame was allocated
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Returns true if the generator's frame was allocated
+        ///
+        [[nodiscard]] constexpr explicit operator bool() const noexcept
+        {
+            return static_cast<bool>(m_hndl);
+        }
+    };
+}
+
+#endif
+
+#endif
@@ -0,0 +1,172 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+///
+/// @file hex.hpp
+///
+
+#ifndef BSL_HEX_HPP
+#define BSL_HEX_HPP
+
+#include "details/hex_impl.hpp"
+
+#include "array.hpp"
+#include "byte.hpp"
+#include "char_type.hpp"
+#include "convert.hpp"
+#include "debug.hpp"
+#include "discard.hpp"
+#include "errc_type.hpp"
+#include "fixed_string.hpp"
+#include "result.hpp"
+#include "safe_integral.hpp"
+#include "span.hpp"
+#include "string_view.hpp"
+
+namespace bsl
+{
+    /// <!-- description -->
+    ///   @brief Returns the number of characters that bsl::hex_encode
+    ///     produces for "size" bytes of input.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param size the number of bytes to be encoded
+    ///   @return Returns the number of characters that bsl::hex_encode
+    ///     produces for "size" bytes of input.
+    ///
+    [[nodiscard]] constexpr safe_uintmax
+    hex_encoded_size(safe_uintmax const &size) noexcept
+    {
+        return size + size;
+    }
+
+    /// <!-- description -->
+    ///   @brief Returns the number of bytes that bsl::hex_decode produces
+    ///     for "size" characters of input.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param size the number of characters to be decoded
+    ///   @return Returns the number of bytes that bsl::hex_decode produces
+    ///     for "size" characters of input.
+    ///
+    [[nodiscard]] constexpr safe_uintmax
+    hex_decoded_size(safe_uintmax const &size) noexcept
+    {
+        return size / to_umax(2);
+    }
+
+    /// <!-- description -->
+    ///   @brief Appends src to dst as lower case hex digits (two per
+    ///     byte). The remaining capacity of dst is checked up front, so
+    ///     either all of the digits are appended, or dst is left
+    ///     unchanged.
+    ///   @include example_hex_overview.hpp
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @tparam N the capacity of dst
+    ///   @param src the bytes to encode
+    ///   @param dst the string to append the hex digits to
+    ///   @return Returns the number of characters appended to dst, or
+    ///     bsl::errc_failure if dst does not have enough room.
+    ///
+    template<bsl::uintmax N>
+    [[nodiscard]] constexpr result<safe_uintmax>
+    hex_encode(span<byte const> const &src, fixed_string<N> &dst) noexcept
+    {
+        constexpr bsl::uintmax chunk{64U};
+
+        safe_uintmax const size{hex_encoded_size(src.size())};
+        if ((fixed_string<N>::max_size() - dst.size()) < size) {
+            bsl::error() << "hex: dst is too small\n";
+            return {errc_failure};
+        }
+
+        /// NOTE:
+        /// - fixed_string does not expose its storage, so the digits are
+        ///   staged on the stack and appended one chunk at a time.
+        ///
+
+        bsl::array<char_type, chunk + chunk> buf{};
+        for (safe_uintmax i{}; i < src.size(); i += to_umax(chunk)) {
+            safe_uintmax const count{(src.size() - i).min(to_umax(chunk))};
+
+            details::hex_encode(
+                reinterpret_cast<bsl::uint8 const *>(src.at_if(i)),    // NOLINT
+                count.get(),
+                buf.data());
+
+            bsl::discard(dst.append(buf.data(), count + count));
+        }
+
+        return {size};
+    }
+
+    /// <!-- description -->
+    ///   @brief Decodes the hex digits in src into dst. Upper and lower
+    ///     case digits are accepted. Anything else (including an odd
+    ///     number of digits, whitespace or a "0x" prefix) is rejected. dst
+    ///     must be at least bsl::hex_decoded_size(src.size()) bytes. If
+    ///     src is invalid, the contents of dst are unspecified.
+    ///   @include example_hex_overview.hpp
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param src the hex digits to decode
+    ///   @param dst the buffer to decode to
+    ///   @return Returns the number of bytes written to dst,
+    ///     bsl::errc_invalid_argument if src is not valid hex, or
+    ///     bsl::errc_failure if dst is too small.
+    ///
+    [[nodiscard]] inline result<safe_uintmax>
+    hex_decode(string_view const &src, span<byte> dst) noexcept
+    {
+        constexpr safe_uintmax two{to_umax(2)};
+        if ((src.size() % two).is_pos()) {
+            bsl::error() << "hex: odd number of digits\n";
+            return {errc_invalid_argument};
+        }
+
+        safe_uintmax const size{hex_decoded_size(src.size())};
+        if (dst.size() < size) {
+            bsl::error() << "hex: dst is too small\n";
+            return {errc_failure};
+        }
+
+        if (src.empty()) {
+            return {safe_uintmax::zero()};
+        }
+
+        bool const valid{details::hex_decode(
+            src.data(),
+            size.get(),
+            reinterpret_cast<bsl::uint8 *>(dst.data()))};    // NOLINT
+
+        if (!valid) {
+            bsl::error() << "hex: invalid digit\n";
+            return {errc_invalid_argument};
+        }
+
+        return {size};
+    }
+}
+
+#endif
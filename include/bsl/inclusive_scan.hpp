@@ -0,0 +1,93 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+///
+/// @file inclusive_scan.hpp
+///
+
+#ifndef BSL_INCLUSIVE_SCAN_HPP
+#define BSL_INCLUSIVE_SCAN_HPP
+
+#include "details/scan_impl.hpp"
+
+#include "result.hpp"
+#include "safe_integral.hpp"
+#include "span.hpp"
+
+namespace bsl
+{
+    /// <!-- description -->
+    ///   @brief Stores the running total of src into dst, starting with
+    ///     "init" (i.e., dst[i] = init + src[0] + ... + src[i]). T must be
+    ///     an integral or a bsl::safe_integral. Overflow is checked once
+    ///     for every block of elements, and if the running total
+    ///     overflows, the contents of dst are unspecified. src and dst
+    ///     may be the same span. A large scan can be split into chunks
+    ///     by first summing each chunk, and then scanning each chunk with
+    ///     the sum of the chunks before it as "init".
+    ///   @include example_inclusive_scan_overview.hpp
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @tparam T the type of element to scan
+    ///   @param src the elements to scan
+    ///   @param dst where to store the running total
+    ///   @param init the value to start the running total with
+    ///   @return Returns the number of elements stored in dst,
+    ///     bsl::errc_failure if dst is smaller than src, or
+    ///     bsl::errc_unsigned_wrap/bsl::errc_signed_overflow if the
+    ///     running total overflows.
+    ///
+    template<typename T>
+    [[nodiscard]] constexpr result<safe_uintmax>
+    inclusive_scan(span<T const> const &src, span<T> dst, T const &init) noexcept
+    {
+        return details::scan_impl<true>(
+            "inclusive_scan", src, dst, init, details::scan_identity{});
+    }
+
+    /// <!-- description -->
+    ///   @brief Stores the running total of src into dst (i.e.,
+    ///     dst[i] = src[0] + ... + src[i]). T must be an integral or a
+    ///     bsl::safe_integral. Overflow is checked once for every block
+    ///     of elements, and if the running total overflows, the contents
+    ///     of dst are unspecified. src and dst may be the same span.
+    ///   @include example_inclusive_scan_overview.hpp
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @tparam T the type of element to scan
+    ///   @param src the elements to scan
+    ///   @param dst where to store the running total
+    ///   @return Returns the number of elements stored in dst,
+    ///     bsl::errc_failure if dst is smaller than src, or
+    ///     bsl::errc_unsigned_wrap/bsl::errc_signed_overflow if the
+    ///     running total overflows.
+    ///
+    template<typename T>
+    [[nodiscard]] constexpr result<safe_uintmax>
+    inclusive_scan(span<T const> const &src, span<T> dst) noexcept
+    {
+        return bsl::inclusive_scan(src, dst, T{});
+    }
+}
+
+#endif
@@ -0,0 +1,383 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+///
+/// @file intern_table.hpp
+///
+
+#ifndef BSL_INTERN_TABLE_HPP
+#define BSL_INTERN_TABLE_HPP
+
+#include "array.hpp"
+#include "char_type.hpp"
+#include "convert.hpp"
+#include "cstdint.hpp"
+#include "cstring.hpp"
+#include "debug.hpp"
+#include "errc_type.hpp"
+#include "error_trace.hpp"
+#include "is_constant_evaluated.hpp"
+#include "lock_guard.hpp"
+#include "result.hpp"
+#include "safe_integral.hpp"
+#include "spinlock.hpp"
+#include "string_view.hpp"
+
+namespace bsl
+{
+    /// @class bsl::intern_table
+    ///
+    /// <!-- description -->
+    ///   @brief Maps strings to dense, stable 32bit ids. The first string
+    ///     that is interned is given the id 0, the next is given the id 1,
+    ///     and so on, and an id never changes once it has been handed out,
+    ///     which means that ids can be stored and compared in place of the
+    ///     strings themselves. The bytes of each string are copied into a
+    ///     fixed size arena (with a '\0' terminator), an open addressing
+    ///     hash index is used to map a string to its id, and an id can be
+    ///     converted back into a string in O(1).
+    ///
+    ///     intern() is serialized using a spinlock, while find() and get()
+    ///     are lock-free and may be called by any number of threads at the
+    ///     same time as intern(). Once all of the strings that are needed
+    ///     have been interned (i.e., after warmup), lookups never block.
+    ///   @include example_intern_table_overview.hpp
+    ///
+    /// <!-- template parameters -->
+    ///   @tparam MAX_STRINGS the max number of strings the table can store
+    ///   @tparam MAX_BYTES the size of the arena used to store the strings
+    ///     (each string uses its length plus 1 bytes)
+    ///
+    template<bsl::uintmax MAX_STRINGS, bsl::uintmax MAX_BYTES>
+    class intern_table final
+    {
+        static_assert(MAX_STRINGS != 0, "intern_tables of size 0 are not supported");
+        static_assert(MAX_BYTES != 0, "intern_tables of size 0 are not supported");
+        static_assert(MAX_STRINGS < 0xFFFFFFFFU, "ids must fit into a 32bit integer");
+
+        /// <!-- description -->
+        ///   @brief Returns the number of buckets in the hash index, which
+        ///     is the smallest power of 2 that is at least twice the max
+        ///     number of strings (keeping the load factor at or below 0.5).
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Returns the number of buckets in the hash index
+        ///
+        [[nodiscard]] static constexpr bsl::uintmax
+        buckets() noexcept
+        {
+            bsl::uintmax num{1U};
+            while (num < (MAX_STRINGS * 2U)) {
+                num <<= 1U;
+            }
+
+            return num;
+        }
+
+        /// @brief stores the number of buckets in the hash index
+        static constexpr bsl::uintmax num_buckets{buckets()};
+        /// @brief stores the mask used to wrap a hash into the index
+        static constexpr bsl::uintmax bucket_mask{num_buckets - 1U};
+
+        /// @class bsl::intern_table::entry_type
+        ///
+        /// <!-- description -->
+        ///   @brief Stores where a string lives in the arena.
+        ///
+        class entry_type final
+        {
+        public:
+            /// @brief stores the string's hash
+            bsl::uint64 m_hash;
+            /// @brief stores the string's offset into the arena
+            bsl::uintmax m_offset;
+            /// @brief stores the string's length
+            bsl::uintmax m_size;
+        };
+
+        /// @class bsl::intern_table::bucket_type
+        ///
+        /// <!-- description -->
+        ///   @brief Stores a bucket in the hash index.
+        ///
+        class bucket_type final
+        {
+        public:
+            /// @brief stores the bucket's id + 1, or 0 if the bucket is empty
+            _Atomic bsl::uint32 m_slot;
+        };
+
+        /// @brief stores the bytes of each string
+        array<char_type, MAX_BYTES> m_arena{};
+        /// @brief stores the number of arena bytes in use
+        bsl::uintmax m_arena_size{};
+        /// @brief stores the location of each string, indexed by id
+        array<entry_type, MAX_STRINGS> m_entries{};
+        /// @brief stores the hash index
+        array<bucket_type, num_buckets> m_index{};
+        /// @brief stores the number of published ids
+        _Atomic bsl::uint32 m_size{};
+        /// @brief serializes calls to intern()
+        spinlock m_lock{};
+
+        /// <!-- description -->
+        ///   @brief Returns the 64bit FNV-1a hash of the provided string.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param str the string to hash
+        ///   @return Returns the 64bit FNV-1a hash of the provided string.
+        ///
+        [[nodiscard]] static constexpr bsl::uint64
+        hash(string_view const &str) noexcept
+        {
+            constexpr bsl::uint64 basis{0xCBF29CE484222325U};
+            constexpr bsl::uint64 prime{0x00000100000001B3U};
+
+            bsl::uint64 h{basis};
+            cstr_type const ptr{str.data()};
+            for (bsl::uintmax i{}; i < str.size().get(); ++i) {
+                h ^= static_cast<bsl::uint64>(static_cast<bsl::uint8>(ptr[i]));    // NOLINT
+                h *= prime;
+            }
+
+            return h;
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns the id of the provided string, or the index of
+        ///     the empty bucket where the string would be inserted if the
+        ///     string has not been interned.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param str the string to look for
+        ///   @param h the hash of str
+        ///   @param bucket returns the empty bucket if the string is not found
+        ///   @return Returns the id of the provided string, or MAX_STRINGS
+        ///     if the string has not been interned.
+        ///
+        [[nodiscard]] constexpr bsl::uintmax
+        lookup(string_view const &str, bsl::uint64 const h, bsl::uintmax &bucket) const noexcept
+        {
+            for (bsl::uintmax i{}; i < num_buckets; ++i) {
+                bucket = (static_cast<bsl::uintmax>(h) + i) & bucket_mask;
+
+                bucket_type const *const b{m_index.at_if(to_umax(bucket))};
+                bsl::uint32 const slot{__c11_atomic_load(&b->m_slot, __ATOMIC_ACQUIRE)};
+                if (0U == slot) {
+                    break;
+                }
+
+                entry_type const *const entry{m_entries.at_if(to_umax(slot - 1U))};
+                if ((entry->m_hash != h) || (entry->m_size != str.size().get())) {
+                    continue;
+                }
+
+                cstr_type const bytes{m_arena.at_if(to_umax(entry->m_offset))};
+                if (builtin_strncmp(bytes, str.data(), str.size()) == 0) {
+                    return static_cast<bsl::uintmax>(slot - 1U);
+                }
+            }
+
+            return MAX_STRINGS;
+        }
+
+    public:
+        /// <!-- description -->
+        ///   @brief Creates an empty bsl::intern_table
+        ///
+        intern_table() noexcept = default;
+
+        /// <!-- description -->
+        ///   @brief Destroyes a previously created bsl::intern_table
+        ///
+        ~intern_table() noexcept = default;
+
+        /// <!-- description -->
+        ///   @brief copy constructor
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param o the object being copied
+        ///
+        intern_table(intern_table const &o) noexcept = delete;
+
+        /// <!-- description -->
+        ///   @brief move constructor
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param o the object being moved
+        ///
+        intern_table(intern_table &&o) noexcept = delete;
+
+        /// <!-- description -->
+        ///   @brief copy assignment
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param o the object being copied
+        ///   @return a reference to *this
+        ///
+        [[maybe_unused]] intern_table &operator=(intern_table const &o) &noexcept = delete;
+
+        /// <!-- description -->
+        ///   @brief move assignment
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param o the object being moved
+        ///   @return a reference to *this
+        ///
+        [[maybe_unused]] intern_table &operator=(intern_table &&o) &noexcept = delete;
+
+        /// <!-- description -->
+        ///   @brief Returns the id of the provided string, adding the
+        ///     string to the table if it has not been interned yet. This
+        ///     function is thread safe.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param str the string to intern
+        ///   @return Returns the id of the provided string, or an error
+        ///     code if str is empty or the table is full.
+        ///
+        [[nodiscard]] result<safe_uint32>
+        intern(string_view const &str) noexcept
+        {
+            if (str.empty()) {
+                bsl::error() << "intern_table: invalid string\n";
+                return {errc_invalid_argument};
+            }
+
+            bsl::uint64 const h{hash(str)};
+            bsl::uintmax bucket{};
+
+            bsl::uintmax id{this->lookup(str, h, bucket)};
+            if (id != MAX_STRINGS) {
+                return {to_u32(static_cast<bsl::uint32>(id))};
+            }
+
+            lock_guard lck{m_lock};
+
+            id = this->lookup(str, h, bucket);
+            if (id != MAX_STRINGS) {
+                return {to_u32(static_cast<bsl::uint32>(id))};
+            }
+
+            id = static_cast<bsl::uintmax>(__c11_atomic_load(&m_size, __ATOMIC_RELAXED));
+            if (id >= MAX_STRINGS) {
+                bsl::error() << "intern_table: table is full\n";
+                return {errc_failure};
+            }
+
+            bsl::uintmax const len{str.size().get()};
+            if ((MAX_BYTES - m_arena_size) <= len) {
+                bsl::error() << "intern_table: arena is full\n";
+                return {errc_failure};
+            }
+
+            char_type *const bytes{m_arena.at_if(to_umax(m_arena_size))};
+            bsl::discard(builtin_memcpy(bytes, str.data(), str.size()));
+            *m_arena.at_if(to_umax(m_arena_size + len)) = '\0';
+
+            *m_entries.at_if(to_umax(id)) = {h, m_arena_size, len};
+            m_arena_size += len + 1U;
+
+            auto const slot{static_cast<bsl::uint32>(id + 1U)};
+            __c11_atomic_store(&m_index.at_if(to_umax(bucket))->m_slot, slot, __ATOMIC_RELEASE);
+            __c11_atomic_store(&m_size, slot, __ATOMIC_RELEASE);
+
+            return {to_u32(static_cast<bsl::uint32>(id))};
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns the id of the provided string if it has already
+        ///     been interned. This function is lock-free.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param str the string to look for
+        ///   @return Returns the id of the provided string, or
+        ///     bsl::errc_failure if the string has not been interned. A miss
+        ///     is expected, so it is not recorded in the bsl::error_trace.
+        ///
+        [[nodiscard]] result<safe_uint32>
+        find(string_view const &str) const noexcept
+        {
+            if (str.empty()) {
+                return {untraced, errc_failure};
+            }
+
+            bsl::uintmax bucket{};
+            bsl::uintmax const id{this->lookup(str, hash(str), bucket)};
+            if (id == MAX_STRINGS) {
+                return {untraced, errc_failure};
+            }
+
+            return {to_u32(static_cast<bsl::uint32>(id))};
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns the string associated with the provided id in
+        ///     O(1). The returned string is '\0' terminated and remains
+        ///     valid for the lifetime of the table. This function is
+        ///     lock-free.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param id the id of the string to return
+        ///   @return Returns the string associated with the provided id, or
+        ///     an empty bsl::string_view if the id is invalid.
+        ///
+        [[nodiscard]] string_view
+        get(safe_uint32 const &id) const noexcept
+        {
+            bsl::uint32 const size{__c11_atomic_load(&m_size, __ATOMIC_ACQUIRE)};
+            if ((!id) || (id.get() >= size)) {
+                return {};
+            }
+
+            entry_type const *const entry{m_entries.at_if(to_umax(id.get()))};
+            return {m_arena.at_if(to_umax(entry->m_offset)), to_umax(entry->m_size)};
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns the number of strings that have been interned.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Returns the number of strings that have been interned.
+        ///
+        [[nodiscard]] safe_uintmax
+        size() const noexcept
+        {
+            return to_umax(__c11_atomic_load(&m_size, __ATOMIC_ACQUIRE));
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns the max number of strings the table can store.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Returns the max number of strings the table can store.
+        ///
+        [[nodiscard]] static constexpr safe_uintmax
+        max_size() noexcept
+        {
+            return to_umax(MAX_STRINGS);
+        }
+    };
+}
+
+#endif
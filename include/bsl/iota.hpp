@@ -0,0 +1,60 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+///
+/// @file iota.hpp
+///
+
+#ifndef BSL_IOTA_HPP
+#define BSL_IOTA_HPP
+
+#include "safe_integral.hpp"
+
+namespace bsl
+{
+    /// <!-- description -->
+    ///   @brief Sets the elements of a view to sequentially increasing
+    ///     values, starting with "value" (i.e., the first element is set
+    ///     to value, the second to ++value, and so on). When T is a
+    ///     bsl::safe_integral, an overflow is carried through the rest of
+    ///     the sequence as an error, like any other safe_integral math.
+    ///   @include example_iota_overview.hpp
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @tparam VIEW the type of view to fill
+    ///   @tparam T the type of value to fill the view with
+    ///   @param vw the view to fill
+    ///   @param value the value of the first element
+    ///
+    template<typename VIEW, typename T>
+    constexpr void
+    iota(VIEW &vw, T value) noexcept
+    {
+        for (safe_uintmax i{}; i < vw.size(); ++i) {
+            *vw.at_if(i) = value;
+            ++value;
+        }
+    }
+}
+
+#endif
@@ -0,0 +1,141 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+///
+/// @file k_way_merge.hpp
+///
+
+#ifndef BSL_K_WAY_MERGE_HPP
+#define BSL_K_WAY_MERGE_HPP
+
+#include "details/default_less.hpp"
+#include "details/merge_impl.hpp"
+#include "details/value_type_for.hpp"
+
+#include "debug.hpp"
+#include "enable_if.hpp"
+#include "errc_type.hpp"
+#include "forward.hpp"
+#include "is_invocable.hpp"
+#include "is_nothrow_invocable.hpp"
+#include "remove_const.hpp"
+#include "result.hpp"
+#include "safe_integral.hpp"
+#include "span.hpp"
+
+namespace bsl
+{
+    /// @brief the max number of runs that bsl::k_way_merge can merge
+    constexpr safe_uintmax k_way_merge_max_runs{to_umax(details::loser_tree_max_runs)};
+
+    /// <!-- description -->
+    ///   @brief Merges up to bsl::k_way_merge_max_runs sorted runs,
+    ///     passing each element to "f" in sorted order. "runs" is a view
+    ///     (e.g., a bsl::array) of span<T const>, and the runs are read
+    ///     in place, so a sorted file mapped with bsl::ifmap (see
+    ///     bsl::as_span) is merged without copying it. The runs are
+    ///     merged using a tournament tree of losers, which costs
+    ///     log2(runs) comparisons per element, and nothing is allocated.
+    ///     The merge is stable (i.e., when two elements are equal, the
+    ///     element from the run with the lower index is passed to "f"
+    ///     first). Elements are ordered using "comp", which must return
+    ///     true if its first argument should come before its second
+    ///     argument. If a run is not sorted, the order is unspecified.
+    ///   @include example_k_way_merge_overview.hpp
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @tparam RUNS the type of view storing the runs
+    ///   @tparam FUNC the type of callback to pass each element to
+    ///   @tparam COMP the type of comparison to use
+    ///   @param runs the sorted runs to merge
+    ///   @param f the callback to pass each element to
+    ///   @param comp the comparison to use (defaults to operator<)
+    ///   @return Returns the number of elements passed to "f", or
+    ///     bsl::errc_invalid_argument if there are too many runs.
+    ///
+    template<
+        typename RUNS,
+        typename FUNC,
+        typename COMP = details::default_less,
+        typename T = remove_const_t<typename details::value_type_for<RUNS>::value_type>,
+        enable_if_t<is_invocable<FUNC, T const &>::value, bool> = true>
+    constexpr result<safe_uintmax>
+    k_way_merge(RUNS const &runs, FUNC &&f, COMP &&comp = COMP{}) noexcept
+    {
+        static_assert(is_nothrow_invocable<FUNC, T const &>::value, "f must be noexcept");
+        static_assert(
+            is_nothrow_invocable<COMP, T const &, T const &>::value, "comp must be noexcept");
+
+        if (runs.size() > k_way_merge_max_runs) {
+            bsl::error() << "k_way_merge: too many runs: " << runs.size() << '\n';
+            return {errc_invalid_argument};
+        }
+
+        details::loser_tree<T> tree{runs, comp};
+
+        safe_uintmax count{};
+        for (T const *ptr{tree.next(comp)}; nullptr != ptr; ptr = tree.next(comp)) {
+            f(*ptr);
+            ++count;
+        }
+
+        return {count};
+    }
+
+    /// <!-- description -->
+    ///   @brief Merges up to bsl::k_way_merge_max_runs sorted runs into
+    ///     dst. See the callback version of bsl::k_way_merge for more
+    ///     details. dst must not overlap any of the runs.
+    ///   @include example_k_way_merge_overview.hpp
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @tparam RUNS the type of view storing the runs
+    ///   @tparam T the type of elements to merge
+    ///   @tparam COMP the type of comparison to use
+    ///   @param runs the sorted runs to merge
+    ///   @param dst where to store the merged elements
+    ///   @param comp the comparison to use (defaults to operator<)
+    ///   @return Returns the number of elements stored in dst,
+    ///     bsl::errc_invalid_argument if there are too many runs, or
+    ///     bsl::errc_failure if dst is too small.
+    ///
+    template<typename RUNS, typename T, typename COMP = details::default_less>
+    [[nodiscard]] constexpr result<safe_uintmax>
+    k_way_merge(RUNS const &runs, span<T> const dst, COMP &&comp = COMP{}) noexcept
+    {
+        safe_uintmax total{};
+        for (safe_uintmax i{}; i < runs.size(); ++i) {
+            total += runs.at_if(i)->size();
+        }
+
+        if (dst.size() < total) {
+            bsl::error() << "k_way_merge: dst is too small\n";
+            return {errc_failure};
+        }
+
+        return bsl::k_way_merge(
+            runs, details::merge_span_sink<T>{dst}, bsl::forward<COMP>(comp));
+    }
+}
+
+#endif
@@ -0,0 +1,97 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+///
+/// @file layout_left.hpp
+///
+
+#ifndef BSL_LAYOUT_LEFT_HPP
+#define BSL_LAYOUT_LEFT_HPP
+
+#include "safe_integral.hpp"
+
+namespace bsl
+{
+    /// @class bsl::layout_left
+    ///
+    /// <!-- description -->
+    ///   @brief Describes a column-major layout, in which the first index
+    ///     varies fastest. The stride of dimension "r" is the product of
+    ///     the extents that precede it.
+    ///   @include example_mdspan_overview.hpp
+    ///
+    class layout_left final
+    {
+    public:
+        /// <!-- description -->
+        ///   @brief Returns the distance (in elements) between two
+        ///     elements whose indexes only differ by one in dimension "r",
+        ///     or safe_uintmax::zero(true) if "r" is not a valid dimension.
+        ///   @include example_mdspan_overview.hpp
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @tparam EXTENTS the bsl::extents of the array
+        ///   @param r the dimension to query
+        ///   @return Returns the stride of dimension "r"
+        ///
+        template<typename EXTENTS>
+        [[nodiscard]] static constexpr safe_uintmax
+        stride(safe_uintmax const &r) noexcept
+        {
+            if ((!r) || (r >= EXTENTS::rank())) {
+                return safe_uintmax::zero(true);
+            }
+
+            safe_uintmax ret{safe_uintmax::one()};
+            for (safe_uintmax i{}; i < r; ++i) {
+                ret *= EXTENTS::extent(i);
+            }
+
+            return ret;
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns the dimension that is "k"th in memory order,
+        ///     where k == 0 is the dimension that varies fastest, or
+        ///     safe_uintmax::zero(true) if "k" is not a valid dimension.
+        ///   @include example_mdspan_overview.hpp
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @tparam EXTENTS the bsl::extents of the array
+        ///   @param k the position in memory order
+        ///   @return Returns the dimension that is "k"th in memory order
+        ///
+        template<typename EXTENTS>
+        [[nodiscard]] static constexpr safe_uintmax
+        dimension(safe_uintmax const &k) noexcept
+        {
+            if ((!k) || (k >= EXTENTS::rank())) {
+                return safe_uintmax::zero(true);
+            }
+
+            return k;
+        }
+    };
+}
+
+#endif
@@ -0,0 +1,644 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+///
+/// @file lz4.hpp
+///
+
+#ifndef BSL_LZ4_HPP
+#define BSL_LZ4_HPP
+
+#include "details/lz4_impl.hpp"
+
+#include "byte.hpp"
+#include "convert.hpp"
+#include "cstdint.hpp"
+#include "debug.hpp"
+#include "safe_integral.hpp"
+#include "span.hpp"
+
+namespace bsl
+{
+    /// @brief the number of scratch bytes needed by the compressor
+    constexpr safe_uintmax lz4_scratch_size{
+        to_umax(details::lz4_hash_entries * sizeof(bsl::uint32))};
+    /// @brief the size of the blocks written by bsl::lz4_frame_compress
+    constexpr safe_uintmax lz4_frame_block_size{to_umax(65536)};
+
+    namespace details
+    {
+        /// @brief the LZ4 frame magic number
+        constexpr bsl::uint32 lz4_magic{0x184D2204U};
+        /// @brief the size of an LZ4 frame header without optional fields
+        constexpr bsl::uintmax lz4_header_size{7U};
+        /// @brief FLG: version 01
+        constexpr bsl::uint8 lz4_flg_version{0x40U};
+        /// @brief FLG: mask of the version bits
+        constexpr bsl::uint8 lz4_flg_version_mask{0xC0U};
+        /// @brief FLG: blocks are independent
+        constexpr bsl::uint8 lz4_flg_indep{0x20U};
+        /// @brief FLG: each block is followed by a checksum
+        constexpr bsl::uint8 lz4_flg_block_checksum{0x10U};
+        /// @brief FLG: the header contains the content size
+        constexpr bsl::uint8 lz4_flg_content_size{0x08U};
+        /// @brief FLG: the frame ends with a content checksum
+        constexpr bsl::uint8 lz4_flg_content_checksum{0x04U};
+        /// @brief FLG: the header contains a dictionary id
+        constexpr bsl::uint8 lz4_flg_dict_id{0x01U};
+        /// @brief BD: 64 KB max block size
+        constexpr bsl::uint8 lz4_bd_64k{0x40U};
+        /// @brief the bit in a block size that marks an uncompressed block
+        constexpr bsl::uint32 lz4_block_raw{0x80000000U};
+
+        /// <!-- description -->
+        ///   @brief Returns a pointer to the compressor's hash table given
+        ///     the caller provided scratch buffer, or a nullptr if the
+        ///     scratch buffer is too small or is not properly aligned.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param scratch the caller provided scratch buffer
+        ///   @return Returns a pointer to the compressor's hash table
+        ///
+        [[nodiscard]] inline bsl::uint32 *
+        lz4_table(span<byte> scratch) noexcept
+        {
+            if (scratch.size() < lz4_scratch_size) {
+                bsl::error() << "lz4: scratch buffer is too small\n";
+                return nullptr;
+            }
+
+            if ((to_uptr(scratch.data()) % to_uptr(alignof(bsl::uint32))).is_pos()) {
+                bsl::error() << "lz4: scratch buffer is not properly aligned\n";
+                return nullptr;
+            }
+
+            return reinterpret_cast<bsl::uint32 *>(scratch.data());    // NOLINT
+        }
+    }
+
+    /// <!-- description -->
+    ///   @brief Returns the largest number of bytes that
+    ///     bsl::lz4_compress_block can produce for "size" bytes of input.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param size the number of bytes to be compressed
+    ///   @return Returns the largest number of bytes that
+    ///     bsl::lz4_compress_block can produce for "size" bytes of input.
+    ///
+    [[nodiscard]] constexpr safe_uintmax
+    lz4_compress_bound(safe_uintmax const &size) noexcept
+    {
+        constexpr safe_uintmax max_byte{to_umax(255)};
+        constexpr safe_uintmax slack{to_umax(16)};
+
+        return size + (size / max_byte) + slack;
+    }
+
+    /// <!-- description -->
+    ///   @brief Returns the largest number of bytes that
+    ///     bsl::lz4_frame_compress can produce for "size" bytes of input.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param size the number of bytes to be compressed
+    ///   @return Returns the largest number of bytes that
+    ///     bsl::lz4_frame_compress can produce for "size" bytes of input.
+    ///
+    [[nodiscard]] constexpr safe_uintmax
+    lz4_frame_bound(safe_uintmax const &size) noexcept
+    {
+        constexpr safe_uintmax word{to_umax(4)};
+        safe_uintmax const mask{lz4_frame_block_size - safe_uintmax::one()};
+        safe_uintmax const blocks{(size + mask) / lz4_frame_block_size};
+
+        return to_umax(details::lz4_header_size) + size + (blocks * word) + word + word;
+    }
+
+    /// <!-- description -->
+    ///   @brief Compresses src into dst using the LZ4 block format. The
+    ///     result can be decompressed with bsl::lz4_decompress_block, or
+    ///     any other LZ4 block decoder. The compressor's hash table is
+    ///     stored in the caller provided scratch buffer, which must be at
+    ///     least bsl::lz4_scratch_size bytes and 4 byte aligned, so nothing
+    ///     is allocated. To ensure compression cannot fail, dst should be
+    ///     at least bsl::lz4_compress_bound(src.size()) bytes.
+    ///   @include example_lz4_overview.hpp
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param src the bytes to compress
+    ///   @param dst the buffer to compress to
+    ///   @param scratch the buffer used to store the hash table
+    ///   @return Returns the number of bytes written to dst, or
+    ///     safe_uintmax::zero(true) on failure.
+    ///
+    [[nodiscard]] inline safe_uintmax
+    lz4_compress_block(
+        span<byte const> const &src, span<byte> dst, span<byte> scratch) noexcept
+    {
+        bsl::uint32 *const table{details::lz4_table(scratch)};
+        if (nullptr == table) {
+            return safe_uintmax::zero(true);
+        }
+
+        if (src.size() > to_umax(details::lz4_max_input)) {
+            bsl::error() << "lz4: input is too large\n";
+            return safe_uintmax::zero(true);
+        }
+
+        if (!dst) {
+            bsl::error() << "lz4: dst is too small\n";
+            return safe_uintmax::zero(true);
+        }
+
+        if (!src) {
+            *dst.front_if() = byte{static_cast<bsl::uint8>(0)};
+            return safe_uintmax::one();
+        }
+
+        safe_uintmax const ret{details::lz4_compress(
+            reinterpret_cast<bsl::uint8 const *>(src.data()),    // NOLINT
+            src.size().get(),
+            reinterpret_cast<bsl::uint8 *>(dst.data()),    // NOLINT
+            dst.size().get(),
+            table)};
+
+        if (ret.failure()) {
+            bsl::error() << "lz4: dst is too small\n";
+        }
+
+        return ret;
+    }
+
+    /// <!-- description -->
+    ///   @brief Decompresses an LZ4 block from src into dst. The block is
+    ///     fully validated while it is decoded, and corrupt input will
+    ///     never cause a read or write outside of src or dst.
+    ///   @include example_lz4_overview.hpp
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param src the LZ4 block to decompress
+    ///   @param dst the buffer to decompress to
+    ///   @return Returns the number of bytes written to dst, or
+    ///     safe_uintmax::zero(true) if the block is corrupt or dst is
+    ///     too small.
+    ///
+    [[nodiscard]] inline safe_uintmax
+    lz4_decompress_block(span<byte const> const &src, span<byte> dst) noexcept
+    {
+        if (!src) {
+            bsl::error() << "lz4: invalid block\n";
+            return safe_uintmax::zero(true);
+        }
+
+        safe_uintmax const ret{details::lz4_decompress(
+            reinterpret_cast<bsl::uint8 const *>(src.data()),    // NOLINT
+            src.size().get(),
+            reinterpret_cast<bsl::uint8 *>(dst.data()),    // NOLINT
+            0U,
+            dst.size().get())};
+
+        if (ret.failure()) {
+            bsl::error() << "lz4: corrupt block or dst is too small\n";
+        }
+
+        return ret;
+    }
+
+    /// <!-- description -->
+    ///   @brief Compresses src into dst as a complete LZ4 frame (the
+    ///     format used by .lz4 files). src is split into independent 64 KB
+    ///     blocks, any block that does not compress is stored as is, and
+    ///     the frame ends with a checksum of the uncompressed content.
+    ///     The result can be read by bsl::lz4_frame_reader, or by any LZ4
+    ///     frame decoder (e.g., the lz4 command line tool). To ensure
+    ///     compression cannot fail, dst should be at least
+    ///     bsl::lz4_frame_bound(src.size()) bytes.
+    ///   @include example_lz4_overview.hpp
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param src the bytes to compress
+    ///   @param dst the buffer to compress to
+    ///   @param scratch the buffer used to store the hash table
+    ///   @return Returns the number of bytes written to dst, or
+    ///     safe_uintmax::zero(true) on failure.
+    ///
+    [[nodiscard]] inline safe_uintmax
+    lz4_frame_compress(
+        span<byte const> const &src, span<byte> dst, span<byte> scratch) noexcept
+    {
+        bsl::uint32 *const table{details::lz4_table(scratch)};
+        if (nullptr == table) {
+            return safe_uintmax::zero(true);
+        }
+
+        constexpr bsl::uintmax word{4U};
+        bsl::uintmax const n{src.size().get()};
+        bsl::uintmax const cap{dst.size().get()};
+        auto const *const in{reinterpret_cast<bsl::uint8 const *>(src.data())};    // NOLINT
+        auto *const out{reinterpret_cast<bsl::uint8 *>(dst.data())};               // NOLINT
+
+        if (cap < (details::lz4_header_size + word + word)) {
+            bsl::error() << "lz4: dst is too small\n";
+            return safe_uintmax::zero(true);
+        }
+
+        constexpr bsl::uint8 flg{static_cast<bsl::uint8>(
+            details::lz4_flg_version | details::lz4_flg_indep |
+            details::lz4_flg_content_checksum)};
+
+        details::lz4_write32(out, details::lz4_magic);
+        out[4] = flg;                                                             // NOLINT
+        out[5] = details::lz4_bd_64k;                                             // NOLINT
+        out[6] = static_cast<bsl::uint8>(details::lz4_xxh32(&out[4], 2U, 0U) >> 8U);    // NOLINT
+
+        bsl::uintmax op{details::lz4_header_size};
+        for (bsl::uintmax ip{}; ip < n;) {
+            bsl::uintmax const len{safe_uintmax{n - ip}.min(lz4_frame_block_size).get()};
+            if ((cap - op) < (word + word)) {
+                bsl::error() << "lz4: dst is too small\n";
+                return safe_uintmax::zero(true);
+            }
+
+            bsl::uintmax const room{safe_uintmax{cap - op - word}.min(to_umax(len - 1U)).get()};
+            safe_uintmax const size{details::lz4_compress(
+                &in[ip], len, &out[op + word], room, table)};    // NOLINT
+
+            if (size.failure()) {
+                if ((cap - op - word) < len) {
+                    bsl::error() << "lz4: dst is too small\n";
+                    return safe_uintmax::zero(true);
+                }
+
+                auto const raw{static_cast<bsl::uint32>(len) | details::lz4_block_raw};
+                details::lz4_write32(&out[op], raw);                  // NOLINT
+                __builtin_memcpy(&out[op + word], &in[ip], len);    // NOLINT
+                op += word + len;
+            }
+            else {
+                details::lz4_write32(&out[op], static_cast<bsl::uint32>(size.get()));    // NOLINT
+                op += word + size.get();
+            }
+
+            ip += len;
+        }
+
+        if ((cap - op) < (word + word)) {
+            bsl::error() << "lz4: dst is too small\n";
+            return safe_uintmax::zero(true);
+        }
+
+        details::lz4_write32(&out[op], 0U);                                    // NOLINT
+        details::lz4_write32(&out[op + word], details::lz4_xxh32(in, n, 0U));    // NOLINT
+
+        return to_umax(op + word + word);
+    }
+
+    /// @class bsl::lz4_frame_reader
+    ///
+    /// <!-- description -->
+    ///   @brief Reads an LZ4 frame (the format used by .lz4 files) one
+    ///     block at a time. The frame is read in place, so it can come
+    ///     from any buffer, including a file that has been mapped with
+    ///     bsl::ifmap, and only one block needs to be decompressed at a
+    ///     time, so a frame of any size can be streamed through a buffer
+    ///     of block_max_size() bytes. Frames written by
+    ///     bsl::lz4_frame_compress and by the lz4 command line tool are
+    ///     supported, including block checksums (which are verified) and
+    ///     frames whose blocks refer to previous blocks (see next()).
+    ///     Dictionaries are not supported.
+    ///   @include example_lz4_overview.hpp
+    ///
+    class lz4_frame_reader final
+    {
+        /// @brief stores the frame being read
+        span<byte const> m_frame{};
+        /// @brief stores the current position in the frame
+        bsl::uintmax m_pos{};
+        /// @brief stores the max size of a decompressed block
+        bsl::uintmax m_block_max{};
+        /// @brief stores the frame's FLG byte
+        bsl::uint8 m_flg{};
+        /// @brief stores the content checksum once the frame has been read
+        bsl::uint32 m_checksum{};
+        /// @brief stores whether or not the end of the frame was reached
+        bool m_done{};
+        /// @brief stores whether or not the frame is valid
+        bool m_valid{};
+
+        /// <!-- description -->
+        ///   @brief Marks the frame as invalid and returns an error.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param msg the error message to output
+        ///   @return Returns safe_uintmax::zero(true)
+        ///
+        [[nodiscard]] safe_uintmax
+        fail(cstr_type const msg) noexcept
+        {
+            bsl::error() << msg;
+            m_valid = false;
+            return safe_uintmax::zero(true);
+        }
+
+    public:
+        /// <!-- description -->
+        ///   @brief Creates an invalid bsl::lz4_frame_reader
+        ///
+        constexpr lz4_frame_reader() noexcept = default;
+
+        /// <!-- description -->
+        ///   @brief Creates a bsl::lz4_frame_reader and validates the
+        ///     frame's header. If the header is invalid, or uses features
+        ///     that are not supported, the resulting reader is invalid.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param frame the frame to read
+        ///
+        explicit lz4_frame_reader(span<byte const> const &frame) noexcept    // --
+            : m_frame{frame}
+        {
+            constexpr bsl::uintmax content_size{8U};
+            constexpr bsl::uint8 bd_mask{0x70U};
+            constexpr bsl::uint8 bd_shift{4U};
+            constexpr bsl::uint8 bd_min{4U};
+
+            auto const *const in{reinterpret_cast<bsl::uint8 const *>(m_frame.data())};    // NOLINT
+            bsl::uintmax const n{m_frame.size().get()};
+
+            if ((n < details::lz4_header_size) || (details::lz4_read32(in) != details::lz4_magic)) {
+                bsl::error() << "lz4: invalid frame\n";
+                return;
+            }
+
+            m_flg = in[4];    // NOLINT
+            if (((m_flg & details::lz4_flg_version_mask) != details::lz4_flg_version) ||
+                ((m_flg & details::lz4_flg_dict_id) != 0U)) {
+                bsl::error() << "lz4: unsupported frame\n";
+                return;
+            }
+
+            bsl::uintmax desc{2U};
+            if ((m_flg & details::lz4_flg_content_size) != 0U) {
+                desc += content_size;
+            }
+
+            if (n < (4U + desc + 1U)) {
+                bsl::error() << "lz4: invalid frame\n";
+                return;
+            }
+
+            bsl::uint32 const sum{details::lz4_xxh32(&in[4], desc, 0U)};    // NOLINT
+            auto const hc{static_cast<bsl::uint8>(sum >> 8U)};
+            if (hc != in[4U + desc]) {    // NOLINT
+                bsl::error() << "lz4: frame header checksum mismatch\n";
+                return;
+            }
+
+            auto const bd{static_cast<bsl::uint8>((in[5] & bd_mask) >> bd_shift)};    // NOLINT
+            if (bd < bd_min) {
+                bsl::error() << "lz4: unsupported frame\n";
+                return;
+            }
+
+            m_block_max = static_cast<bsl::uintmax>(1U) << (8U + (2U * bd));
+            m_pos = 4U + desc + 1U;
+            m_valid = true;
+        }
+
+        /// <!-- description -->
+        ///   @brief Decompresses the next block of the frame into dst,
+        ///     starting at dst[pos]. The bytes in dst before pos must be the
+        ///     bytes that were previously read from this frame (or pos must
+        ///     be 0), which allows frames whose blocks refer to previous
+        ///     blocks to be decompressed into a single buffer. Frames with
+        ///     independent blocks can always use a pos of 0.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param dst the buffer to decompress to
+        ///   @param pos the position in dst to decompress to
+        ///   @return Returns the number of bytes written to dst, 0 once
+        ///     the end of the frame is reached, or safe_uintmax::zero(true)
+        ///     on failure.
+        ///
+        [[nodiscard]] safe_uintmax
+        next(span<byte> dst, safe_uintmax const &pos) noexcept
+        {
+            constexpr bsl::uintmax word{4U};
+
+            if (!m_valid) {
+                bsl::error() << "lz4: invalid frame\n";
+                return safe_uintmax::zero(true);
+            }
+
+            if (m_done) {
+                return to_umax(0);
+            }
+
+            if ((!pos) || (pos > dst.size())) {
+                bsl::error() << "lz4: invalid pos\n";
+                return safe_uintmax::zero(true);
+            }
+
+            auto const *const in{reinterpret_cast<bsl::uint8 const *>(m_frame.data())};    // NOLINT
+            bsl::uintmax const n{m_frame.size().get()};
+
+            if ((n - m_pos) < word) {
+                return this->fail("lz4: truncated frame\n");
+            }
+
+            bsl::uint32 const header{details::lz4_read32(&in[m_pos])};    // NOLINT
+            m_pos += word;
+
+            if (0U == header) {
+                if ((m_flg & details::lz4_flg_content_checksum) != 0U) {
+                    if ((n - m_pos) < word) {
+                        return this->fail("lz4: truncated frame\n");
+                    }
+
+                    m_checksum = details::lz4_read32(&in[m_pos]);    // NOLINT
+                    m_pos += word;
+                }
+
+                m_done = true;
+                return to_umax(0);
+            }
+
+            auto const size{static_cast<bsl::uintmax>(header & ~details::lz4_block_raw)};
+            if ((size > m_block_max) || (size > (n - m_pos))) {
+                return this->fail("lz4: corrupt frame\n");
+            }
+
+            bsl::uint8 const *const block{&in[m_pos]};    // NOLINT
+            m_pos += size;
+
+            if ((m_flg & details::lz4_flg_block_checksum) != 0U) {
+                if ((n - m_pos) < word) {
+                    return this->fail("lz4: truncated frame\n");
+                }
+
+                bsl::uint32 const sum{details::lz4_xxh32(block, size, 0U)};
+                if (details::lz4_read32(&in[m_pos]) != sum) {    // NOLINT
+                    return this->fail("lz4: block checksum mismatch\n");
+                }
+
+                m_pos += word;
+            }
+
+            auto *const out{reinterpret_cast<bsl::uint8 *>(dst.data())};    // NOLINT
+            bsl::uintmax const cap{dst.size().get()};
+
+            if ((header & details::lz4_block_raw) != 0U) {
+                if (size > (cap - pos.get())) {
+                    return this->fail("lz4: dst is too small\n");
+                }
+
+                __builtin_memcpy(&out[pos.get()], block, size);    // NOLINT
+                return to_umax(size);
+            }
+
+            safe_uintmax const ret{details::lz4_decompress(block, size, out, pos.get(), cap)};
+            if (ret.failure()) {
+                return this->fail("lz4: corrupt block or dst is too small\n");
+            }
+
+            return ret;
+        }
+
+        /// <!-- description -->
+        ///   @brief Same as next(dst, 0)
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param dst the buffer to decompress to
+        ///   @return Returns the number of bytes written to dst, 0 once
+        ///     the end of the frame is reached, or safe_uintmax::zero(true)
+        ///     on failure.
+        ///
+        [[nodiscard]] safe_uintmax
+        next(span<byte> const dst) noexcept
+        {
+            return this->next(dst, to_umax(0));
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns true if the frame has no content checksum, or
+        ///     if the frame's content checksum matches the provided
+        ///     content. Must be called after the end of the frame has been
+        ///     reached (i.e., done() returns true).
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param content the complete decompressed content of the frame
+        ///   @return Returns true if the frame has no content checksum, or
+        ///     if the frame's content checksum matches the provided
+        ///     content.
+        ///
+        [[nodiscard]] bool
+        verify(span<byte const> const &content) const noexcept
+        {
+            if ((!m_valid) || (!m_done)) {
+                return false;
+            }
+
+            if ((m_flg & details::lz4_flg_content_checksum) == 0U) {
+                return true;
+            }
+
+            auto const *const in{reinterpret_cast<bsl::uint8 const *>(content.data())};    // NOLINT
+            return details::lz4_xxh32(in, content.size().get(), 0U) == m_checksum;
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns the max number of bytes a single block can
+        ///     decompress to (i.e., the smallest dst that next() can be
+        ///     given).
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Returns the max number of bytes a single block can
+        ///     decompress to.
+        ///
+        [[nodiscard]] constexpr safe_uintmax
+        block_max_size() const noexcept
+        {
+            return to_umax(m_block_max);
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns true once the end of the frame has been reached
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Returns true once the end of the frame has been reached
+        ///
+        [[nodiscard]] constexpr bool
+        done() const noexcept
+        {
+            return m_done;
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns true if the frame is valid (i.e., the header is
+        ///     valid and no errors have been found while reading it).
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Returns true if the frame is valid
+        ///
+        [[nodiscard]] constexpr explicit operator bool() const noexcept
+        {
+            return m_valid;
+        }
+    };
+
+    /// <!-- description -->
+    ///   @brief Decompresses a complete LZ4 frame from src into dst and
+    ///     verifies the frame's content checksum (if it has one).
+    ///   @include example_lz4_overview.hpp
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param src the LZ4 frame to decompress
+    ///   @param dst the buffer to decompress to
+    ///   @return Returns the number of bytes written to dst, or
+    ///     safe_uintmax::zero(true) if the frame is corrupt or dst is
+    ///     too small.
+    ///
+    [[nodiscard]] inline safe_uintmax
+    lz4_frame_decompress(span<byte const> const &src, span<byte> dst) noexcept
+    {
+        lz4_frame_reader reader{src};
+
+        safe_uintmax pos{};
+        while (!reader.done()) {
+            safe_uintmax const ret{reader.next(dst, pos)};
+            if (ret.failure()) {
+                return ret;
+            }
+
+            pos += ret;
+        }
+
+        if (!reader.verify(as_bytes(dst.first(pos)))) {
+            bsl::error() << "lz4: content checksum mismatch\n";
+            return safe_uintmax::zero(true);
+        }
+
+        return pos;
+    }
+}
+
+#endif
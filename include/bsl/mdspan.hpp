@@ -0,0 +1,523 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+///
+/// @file mdspan.hpp
+///
+
+#ifndef BSL_MDSPAN_HPP
+#define BSL_MDSPAN_HPP
+
+#include "array.hpp"
+#include "convert.hpp"
+#include "debug.hpp"
+#include "extents.hpp"
+#include "forward.hpp"
+#include "invoke.hpp"
+#include "invoke_result.hpp"
+#include "is_bool.hpp"
+#include "is_invocable.hpp"
+#include "is_nothrow_invocable.hpp"
+#include "is_same.hpp"
+#include "layout_left.hpp"
+#include "layout_right.hpp"
+#include "safe_integral.hpp"
+#include "span.hpp"
+
+namespace bsl
+{
+    namespace details
+    {
+        /// <!-- description -->
+        ///   @brief Returns an array containing the stride of each
+        ///     dimension of EXTENTS for the layout LAYOUT. This is only
+        ///     ever evaluated at compile time, which means that the
+        ///     multiplications in bsl::mdspan::at_if are all by constants.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @tparam EXTENTS the bsl::extents of the array
+        ///   @tparam LAYOUT the layout of the array
+        ///   @return Returns the stride of each dimension
+        ///
+        template<typename EXTENTS, typename LAYOUT>
+        [[nodiscard]] constexpr auto
+        mdspan_strides() noexcept -> array<safe_uintmax, EXTENTS::rank().get()>
+        {
+            array<safe_uintmax, EXTENTS::rank().get()> ret{};
+            for (safe_uintmax r{}; r < EXTENTS::rank(); ++r) {
+                *ret.at_if(r) = LAYOUT::template stride<EXTENTS>(r);
+            }
+
+            return ret;
+        }
+    }
+
+    /// @class bsl::mdspan
+    ///
+    /// <!-- description -->
+    ///   @brief A bsl::mdspan is a non-owning, multidimensional view of a
+    ///     contiguous array whose extents are known at compile time. The
+    ///     layout (row-major with bsl::layout_right, which is the default,
+    ///     or column-major with bsl::layout_left) determines how a
+    ///     multi-index is mapped to an element. Like the bsl::span, all
+    ///     accessors are _if() versions which return a nullptr on error.
+    ///     To visit every element, use bsl::for_each, which walks the
+    ///     elements in memory order regardless of the layout.
+    ///   @include example_mdspan_overview.hpp
+    ///
+    /// <!-- template parameters -->
+    ///   @tparam T the type of element being viewed.
+    ///   @tparam EXTENTS the bsl::extents of the array
+    ///   @tparam LAYOUT the layout of the array
+    ///
+    template<typename T, typename EXTENTS, typename LAYOUT = layout_right>
+    class mdspan final
+    {
+        static_assert(!is_same<T, char_type>::value, "use bsl::string_view instead");
+        static_assert(
+            is_same<LAYOUT, layout_right>::value || is_same<LAYOUT, layout_left>::value,
+            "the layout must be bsl::layout_right or bsl::layout_left");
+
+        /// @brief stores the stride of each dimension
+        static constexpr auto strides{details::mdspan_strides<EXTENTS, LAYOUT>()};
+
+    public:
+        /// @brief alias for: T
+        using value_type = T;
+        /// @brief alias for: EXTENTS
+        using extents_type = EXTENTS;
+        /// @brief alias for: LAYOUT
+        using layout_type = LAYOUT;
+        /// @brief alias for: safe_uintmax
+        using size_type = safe_uintmax;
+        /// @brief alias for: array<safe_uintmax, EXTENTS::rank()>
+        using index_type = array<safe_uintmax, EXTENTS::rank().get()>;
+        /// @brief alias for: T &
+        using reference_type = T &;
+        /// @brief alias for: T &
+        using const_reference_type = T const &;
+        /// @brief alias for: T *
+        using pointer_type = T *;
+        /// @brief alias for: T const *
+        using const_pointer_type = T const *;
+
+        /// <!-- description -->
+        ///   @brief Default constructor that creates an mdspan with
+        ///     data() == nullptr and size() == 0. All accessors
+        ///     will return a nullptr if used.
+        ///   @include example_mdspan_overview.hpp
+        ///
+        constexpr mdspan() noexcept = default;
+
+        /// <!-- description -->
+        ///   @brief Creates an mdspan given a pointer to an array of
+        ///     EXTENTS::size() elements. Note that the array must be
+        ///     contiguous in memory and [ptr, ptr + EXTENTS::size()) must
+        ///     be a valid range.
+        ///   @include example_mdspan_overview.hpp
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param ptr a pointer to the array being viewed.
+        ///
+        explicit constexpr mdspan(pointer_type const ptr) noexcept    // --
+            : m_ptr{ptr}
+        {
+            if (nullptr == m_ptr) {
+                bsl::alert() << "mdspan: invalid constructor args\n";
+                bsl::alert() << "  - ptr: " << static_cast<void const *>(ptr) << bsl::endl;
+            }
+        }
+
+        /// <!-- description -->
+        ///   @brief Creates an mdspan from a span, which must view exactly
+        ///     EXTENTS::size() elements. If it does not, an invalid mdspan
+        ///     is created.
+        ///   @include example_mdspan_overview.hpp
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param spn the span to create the mdspan from
+        ///
+        explicit constexpr mdspan(span<T> spn) noexcept    // --
+            : m_ptr{}
+        {
+            if (spn.size() != EXTENTS::size()) {
+                bsl::alert() << "mdspan: invalid constructor args\n";
+                bsl::alert() << "  - size: " << spn.size() << bsl::endl;
+                return;
+            }
+
+            m_ptr = spn.data();
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns a pointer to the element at the provided
+        ///     multi-index, which must contain one index per dimension.
+        ///     If any index is out of bounds, or the view is invalid, this
+        ///     function returns a nullptr.
+        ///   @include example_mdspan_overview.hpp
+        ///
+        ///   SUPPRESSION: PRQA 4024 - false positive
+        ///   - We suppress this because A9-3-1 states that we should
+        ///     not provide a non-const reference or pointer to private
+        ///     member function, unless the class mimics a smart pointer or
+        ///     a containter. This class mimics a container.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param idx the multi-index of the element to return
+        ///   @return Returns a pointer to the element at the provided
+        ///     multi-index. If any index is out of bounds, or the view is
+        ///     invalid, this function returns a nullptr.
+        ///
+        [[nodiscard]] constexpr pointer_type
+        at_if(index_type const &idx) noexcept
+        {
+            safe_uintmax const off{offset(idx)};
+            if ((!off) || (nullptr == m_ptr)) {
+                return nullptr;
+            }
+
+            return &m_ptr[off.get()];    // PRQA S 4024 // NOLINT
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns a pointer to the element at the provided
+        ///     multi-index, which must contain one index per dimension.
+        ///     If any index is out of bounds, or the view is invalid, this
+        ///     function returns a nullptr.
+        ///   @include example_mdspan_overview.hpp
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param idx the multi-index of the element to return
+        ///   @return Returns a pointer to the element at the provided
+        ///     multi-index. If any index is out of bounds, or the view is
+        ///     invalid, this function returns a nullptr.
+        ///
+        [[nodiscard]] constexpr const_pointer_type
+        at_if(index_type const &idx) const noexcept
+        {
+            safe_uintmax const off{offset(idx)};
+            if ((!off) || (nullptr == m_ptr)) {
+                return nullptr;
+            }
+
+            return &m_ptr[off.get()];    // NOLINT
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns a pointer to the element at the provided
+        ///     indexes, one per dimension (i.e., md.at_if(i, j) for a rank
+        ///     2 mdspan). If any index is out of bounds, or the view is
+        ///     invalid, this function returns a nullptr.
+        ///   @include example_mdspan_overview.hpp
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @tparam IDX the type of each index (must be safe_uintmax)
+        ///   @param idx the indexes of the element to return
+        ///   @return Returns a pointer to the element at the provided
+        ///     indexes. If any index is out of bounds, or the view is
+        ///     invalid, this function returns a nullptr.
+        ///
+        template<typename... IDX>
+        [[nodiscard]] constexpr pointer_type
+        at_if(IDX const &... idx) noexcept
+        {
+            static_assert(to_umax(sizeof...(IDX)) == EXTENTS::rank(), "wrong number of indexes");
+            static_assert((is_same<IDX, safe_uintmax>::value && ...), "indexes must be unsigned");
+
+            return this->at_if(index_type{idx...});
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns a pointer to the element at the provided
+        ///     indexes, one per dimension (i.e., md.at_if(i, j) for a rank
+        ///     2 mdspan). If any index is out of bounds, or the view is
+        ///     invalid, this function returns a nullptr.
+        ///   @include example_mdspan_overview.hpp
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @tparam IDX the type of each index (must be safe_uintmax)
+        ///   @param idx the indexes of the element to return
+        ///   @return Returns a pointer to the element at the provided
+        ///     indexes. If any index is out of bounds, or the view is
+        ///     invalid, this function returns a nullptr.
+        ///
+        template<typename... IDX>
+        [[nodiscard]] constexpr const_pointer_type
+        at_if(IDX const &... idx) const noexcept
+        {
+            static_assert(to_umax(sizeof...(IDX)) == EXTENTS::rank(), "wrong number of indexes");
+            static_assert((is_same<IDX, safe_uintmax>::value && ...), "indexes must be unsigned");
+
+            return this->at_if(index_type{idx...});
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns a pointer to the array being viewed. If this is
+        ///     a default constructed view, or the view was constructed in
+        ///     error, this will return a nullptr.
+        ///   @include example_mdspan_overview.hpp
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Returns a pointer to the array being viewed. If this is
+        ///     a default constructed view, or the view was constructed in
+        ///     error, this will return a nullptr.
+        ///
+        [[nodiscard]] constexpr pointer_type
+        data() noexcept
+        {
+            return m_ptr;
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns a pointer to the array being viewed. If this is
+        ///     a default constructed view, or the view was constructed in
+        ///     error, this will return a nullptr.
+        ///   @include example_mdspan_overview.hpp
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Returns a pointer to the array being viewed. If this is
+        ///     a default constructed view, or the view was constructed in
+        ///     error, this will return a nullptr.
+        ///
+        [[nodiscard]] constexpr const_pointer_type
+        data() const noexcept
+        {
+            return m_ptr;
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns a span of all of the elements in memory order.
+        ///     If this is an invalid view, an invalid span is returned.
+        ///   @include example_mdspan_overview.hpp
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Returns a span of all of the elements in memory order
+        ///
+        [[nodiscard]] constexpr span<T>
+        flat() const noexcept
+        {
+            if (nullptr == m_ptr) {
+                return {};
+            }
+
+            return span<T>{m_ptr, EXTENTS::size()};
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns size() == 0, which is only true if this is a
+        ///     default constructed view, or the view was constructed in
+        ///     error.
+        ///   @include example_mdspan_overview.hpp
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Returns size() == 0
+        ///
+        [[nodiscard]] constexpr bool
+        empty() const noexcept
+        {
+            return nullptr == m_ptr;
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns !empty()
+        ///   @include example_mdspan_overview.hpp
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Returns !empty()
+        ///
+        [[nodiscard]] constexpr explicit operator bool() const noexcept
+        {
+            return !this->empty();
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns the total number of elements being viewed, or
+        ///     0 if this is an invalid view.
+        ///   @include example_mdspan_overview.hpp
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Returns the total number of elements being viewed
+        ///
+        [[nodiscard]] constexpr size_type
+        size() const noexcept
+        {
+            if (nullptr == m_ptr) {
+                return to_umax(0);
+            }
+
+            return EXTENTS::size();
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns the number of dimensions
+        ///   @include example_mdspan_overview.hpp
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Returns the number of dimensions
+        ///
+        [[nodiscard]] static constexpr size_type
+        rank() noexcept
+        {
+            return EXTENTS::rank();
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns the number of elements in dimension "r", or
+        ///     safe_uintmax::zero(true) if "r" is not a valid dimension.
+        ///   @include example_mdspan_overview.hpp
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param r the dimension to query
+        ///   @return Returns the number of elements in dimension "r"
+        ///
+        [[nodiscard]] static constexpr size_type
+        extent(size_type const &r) noexcept
+        {
+            return EXTENTS::extent(r);
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns the stride (in elements) of dimension "r", or
+        ///     safe_uintmax::zero(true) if "r" is not a valid dimension.
+        ///   @include example_mdspan_overview.hpp
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param r the dimension to query
+        ///   @return Returns the stride of dimension "r"
+        ///
+        [[nodiscard]] static constexpr size_type
+        stride(size_type const &r) noexcept
+        {
+            return LAYOUT::template stride<EXTENTS>(r);
+        }
+
+    private:
+        /// <!-- description -->
+        ///   @brief Returns the offset (in elements) of the element at the
+        ///     provided multi-index, or safe_uintmax::zero(true) (with an
+        ///     error reported) if any index is out of bounds.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param idx the multi-index to convert
+        ///   @return Returns the offset of the element at "idx"
+        ///
+        [[nodiscard]] static constexpr safe_uintmax
+        offset(index_type const &idx) noexcept
+        {
+            safe_uintmax off{};
+            for (safe_uintmax r{}; r < EXTENTS::rank(); ++r) {
+                safe_uintmax const &i{*idx.at_if(r)};
+                if ((!i) || (i >= EXTENTS::extent(r))) {
+                    bsl::error() << "mdspan: index out of range: " << i << '\n';
+                    return safe_uintmax::zero(true);
+                }
+
+                off += i * (*strides.at_if(r));
+            }
+
+            return off;
+        }
+
+        /// @brief stores a pointer to the array being viewed
+        pointer_type m_ptr;
+    };
+
+    /// <!-- description -->
+    ///   @brief Executes "f" on every element of "md" in memory order
+    ///     (i.e., the order in which the elements are stored, which for
+    ///     bsl::layout_right is row by row and for bsl::layout_left is
+    ///     column by column), which is the cache friendly way to visit an
+    ///     mdspan. "f" may take the element (T &), or the element and its
+    ///     multi-index (T &, index_type const &). Like the rest of the
+    ///     bsl::for_each overloads, "f" may return bsl::for_each_break to
+    ///     break from the loop. The multi-index is only tracked when "f"
+    ///     asks for it, otherwise this is a single flat loop.
+    ///   @include example_mdspan_overview.hpp
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @tparam T the type of element being viewed.
+    ///   @tparam EXTENTS the bsl::extents of the array
+    ///   @tparam LAYOUT the layout of the array
+    ///   @tparam FUNC the type of function to execute
+    ///   @param md the mdspan to iterate over
+    ///   @param f the function to execute on each element
+    ///
+    template<typename T, typename EXTENTS, typename LAYOUT, typename FUNC>
+    constexpr void
+    for_each(mdspan<T, EXTENTS, LAYOUT> md, FUNC &&f) noexcept(    // --
+        is_nothrow_invocable<FUNC, T &>::value ||
+        is_nothrow_invocable<FUNC, T &, array<safe_uintmax, EXTENTS::rank().get()> const &>::value)
+    {
+        using index_type = typename mdspan<T, EXTENTS, LAYOUT>::index_type;
+        constexpr bool eo{is_invocable<FUNC, T &>::value};
+        constexpr bool ei{is_invocable<FUNC, T &, index_type const &>::value};
+        static_assert(eo || ei, "the function you provided to bsl::for_each is invalid");
+
+        T *const ptr{md.data()};
+        if (nullptr == ptr) {
+            return;
+        }
+
+        if constexpr (eo) {
+            using ret_type = invoke_result_t<FUNC, T &>;
+            for (safe_uintmax i{}; i < EXTENTS::size(); ++i) {
+                if constexpr (is_bool<ret_type>::value) {
+                    if (!invoke(bsl::forward<FUNC>(f), ptr[i.get()])) {    // NOLINT
+                        break;
+                    }
+                }
+                else {
+                    invoke(bsl::forward<FUNC>(f), ptr[i.get()]);    // NOLINT
+                }
+            }
+        }
+        else {
+            using ret_type = invoke_result_t<FUNC, T &, index_type const &>;
+            index_type idx{};
+            for (safe_uintmax i{}; i < EXTENTS::size(); ++i) {
+                if constexpr (is_bool<ret_type>::value) {
+                    if (!invoke(bsl::forward<FUNC>(f), ptr[i.get()], idx)) {    // NOLINT
+                        break;
+                    }
+                }
+                else {
+                    invoke(bsl::forward<FUNC>(f), ptr[i.get()], idx);    // NOLINT
+                }
+
+                for (safe_uintmax k{}; k < EXTENTS::rank(); ++k) {
+                    safe_uintmax const d{LAYOUT::template dimension<EXTENTS>(k)};
+                    safe_uintmax &elem{*idx.at_if(d)};
+
+                    ++elem;
+                    if (elem < EXTENTS::extent(d)) {
+                        break;
+                    }
+
+                    elem = safe_uintmax::zero();
+                }
+            }
+        }
+    }
+}
+
+#endif
@@ -0,0 +1,143 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+///
+/// @file merge.hpp
+///
+
+#ifndef BSL_MERGE_HPP
+#define BSL_MERGE_HPP
+
+#include "details/default_less.hpp"
+#include "details/merge_impl.hpp"
+
+#include "debug.hpp"
+#include "enable_if.hpp"
+#include "errc_type.hpp"
+#include "forward.hpp"
+#include "is_invocable.hpp"
+#include "is_nothrow_invocable.hpp"
+#include "result.hpp"
+#include "safe_integral.hpp"
+#include "span.hpp"
+
+namespace bsl
+{
+    /// <!-- description -->
+    ///   @brief Merges two sorted spans, passing each element to "f" in
+    ///     sorted order. The merge is stable (i.e., when two elements
+    ///     are equal, the element from lhs is passed to "f" first).
+    ///     Elements are ordered using "comp", which must return true if
+    ///     its first argument should come before its second argument.
+    ///     If lhs or rhs is not sorted, the order is unspecified.
+    ///   @include example_merge_overview.hpp
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @tparam T the type of elements to merge
+    ///   @tparam FUNC the type of callback to pass each element to
+    ///   @tparam COMP the type of comparison to use
+    ///   @param lhs the first sorted span to merge
+    ///   @param rhs the second sorted span to merge
+    ///   @param f the callback to pass each element to
+    ///   @param comp the comparison to use (defaults to operator<)
+    ///   @return Returns the number of elements passed to "f"
+    ///
+    template<
+        typename T,
+        typename FUNC,
+        typename COMP = details::default_less,
+        enable_if_t<is_invocable<FUNC, T const &>::value, bool> = true>
+    constexpr safe_uintmax
+    merge(
+        span<T const> const &lhs,
+        span<T const> const &rhs,
+        FUNC &&f,
+        COMP &&comp = COMP{}) noexcept
+    {
+        static_assert(is_nothrow_invocable<FUNC, T const &>::value, "f must be noexcept");
+        static_assert(
+            is_nothrow_invocable<COMP, T const &, T const &>::value, "comp must be noexcept");
+
+        safe_uintmax i{};
+        safe_uintmax j{};
+
+        while ((i < lhs.size()) && (j < rhs.size())) {
+            if (comp(*rhs.at_if(j), *lhs.at_if(i))) {
+                f(*rhs.at_if(j));
+                ++j;
+            }
+            else {
+                f(*lhs.at_if(i));
+                ++i;
+            }
+        }
+
+        for (; i < lhs.size(); ++i) {
+            f(*lhs.at_if(i));
+        }
+
+        for (; j < rhs.size(); ++j) {
+            f(*rhs.at_if(j));
+        }
+
+        return lhs.size() + rhs.size();
+    }
+
+    /// <!-- description -->
+    ///   @brief Merges two sorted spans into dst. The merge is stable
+    ///     (i.e., when two elements are equal, the element from lhs is
+    ///     stored first). Elements are ordered using "comp", which must
+    ///     return true if its first argument should come before its
+    ///     second argument. If lhs or rhs is not sorted, the order is
+    ///     unspecified. dst must not overlap lhs or rhs.
+    ///   @include example_merge_overview.hpp
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @tparam T the type of elements to merge
+    ///   @tparam COMP the type of comparison to use
+    ///   @param lhs the first sorted span to merge
+    ///   @param rhs the second sorted span to merge
+    ///   @param dst where to store the merged elements
+    ///   @param comp the comparison to use (defaults to operator<)
+    ///   @return Returns the number of elements stored in dst, or
+    ///     bsl::errc_failure if dst is too small.
+    ///
+    template<typename T, typename COMP = details::default_less>
+    [[nodiscard]] constexpr result<safe_uintmax>
+    merge(
+        span<T const> const &lhs,
+        span<T const> const &rhs,
+        span<T> const dst,
+        COMP &&comp = COMP{}) noexcept
+    {
+        if (dst.size() < (lhs.size() + rhs.size())) {
+            bsl::error() << "merge: dst is too small\n";
+            return {errc_failure};
+        }
+
+        return {bsl::merge(
+            lhs, rhs, details::merge_span_sink<T>{dst}, bsl::forward<COMP>(comp))};
+    }
+}
+
+#endif
@@ -0,0 +1,84 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+///
+/// @file min_element.hpp
+///
+
+#ifndef BSL_MIN_ELEMENT_HPP
+#define BSL_MIN_ELEMENT_HPP
+
+#include "details/default_less.hpp"
+#include "details/reduce_impl.hpp"
+#include "details/value_type_for.hpp"
+
+#include "convert.hpp"
+#include "is_integral.hpp"
+#include "is_nothrow_invocable.hpp"
+#include "is_same.hpp"
+#include "remove_const.hpp"
+#include "remove_cvref.hpp"
+
+namespace bsl
+{
+    /// <!-- description -->
+    ///   @brief Returns a pointer to the smallest element in a view. If
+    ///     more than one element is the smallest, the first is returned.
+    ///     Elements are ordered using "comp", which must return true if
+    ///     its first argument should come before its second argument.
+    ///     When the elements are integrals ordered by operator<, the
+    ///     smallest value is found first using a loop the compiler can
+    ///     vectorize, and is then located.
+    ///   @include example_min_element_overview.hpp
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @tparam VIEW the type of view to search
+    ///   @tparam COMP the type of comparison to use
+    ///   @param vw the view to search
+    ///   @param comp the comparison to use (defaults to operator<)
+    ///   @return Returns a pointer to the smallest element in "vw", or a
+    ///     nullptr if "vw" is empty.
+    ///
+    template<typename VIEW, typename COMP = details::default_less>
+    [[nodiscard]] constexpr remove_const_t<details::value_type_for<VIEW>> const *
+    min_element(VIEW const &vw, COMP &&comp = COMP{}) noexcept
+    {
+        using value_type = remove_const_t<details::value_type_for<VIEW>>;
+        static_assert(
+            is_nothrow_invocable<COMP, value_type const &, value_type const &>::value,
+            "comp must be noexcept");
+
+        constexpr bool fast{
+            is_integral<value_type>::value &&
+            is_same<remove_cvref_t<COMP>, details::default_less>::value};
+
+        if (vw.empty()) {
+            return nullptr;
+        }
+
+        return vw.at_if(
+            to_umax(details::reduce_min_index<fast>(vw.data(), vw.size().get(), comp)));
+    }
+}
+
+#endif
@@ -0,0 +1,95 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+///
+/// @file minmax_element.hpp
+///
+
+#ifndef BSL_MINMAX_ELEMENT_HPP
+#define BSL_MINMAX_ELEMENT_HPP
+
+#include "details/default_less.hpp"
+#include "details/reduce_impl.hpp"
+#include "details/value_type_for.hpp"
+
+#include "convert.hpp"
+#include "is_integral.hpp"
+#include "is_nothrow_invocable.hpp"
+#include "is_same.hpp"
+#include "remove_const.hpp"
+#include "remove_cvref.hpp"
+#include "tuple.hpp"
+
+namespace bsl
+{
+    /// <!-- description -->
+    ///   @brief Returns a pointer to the smallest and the largest
+    ///     elements in a view. If more than one element is the smallest,
+    ///     the first is returned, and if more than one element is the
+    ///     largest, the last is returned (i.e., the same elements that
+    ///     a stable sort would place at the front and the back of the
+    ///     view). Elements are ordered using "comp", which must return
+    ///     true if its first argument should come before its second
+    ///     argument.
+    ///   @include example_minmax_element_overview.hpp
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @tparam VIEW the type of view to search
+    ///   @tparam COMP the type of comparison to use
+    ///   @param vw the view to search
+    ///   @param comp the comparison to use (defaults to operator<)
+    ///   @return Returns a bsl::tuple containing a pointer to the
+    ///     smallest element, followed by a pointer to the largest
+    ///     element. If "vw" is empty, both pointers are a nullptr.
+    ///
+    template<typename VIEW, typename COMP = details::default_less>
+    [[nodiscard]] constexpr auto
+    minmax_element(VIEW const &vw, COMP &&comp = COMP{}) noexcept
+        -> tuple<
+            remove_const_t<details::value_type_for<VIEW>> const *,
+            remove_const_t<details::value_type_for<VIEW>> const *>
+    {
+        using value_type = remove_const_t<details::value_type_for<VIEW>>;
+        static_assert(
+            is_nothrow_invocable<COMP, value_type const &, value_type const &>::value,
+            "comp must be noexcept");
+
+        constexpr bool fast{
+            is_integral<value_type>::value &&
+            is_same<remove_cvref_t<COMP>, details::default_less>::value};
+
+        using ret_type = tuple<value_type const *, value_type const *>;
+        if (vw.empty()) {
+            return ret_type{nullptr, nullptr};
+        }
+
+        value_type const *const ptr{vw.data()};
+        bsl::uintmax const num{vw.size().get()};
+
+        return ret_type{
+            vw.at_if(to_umax(details::reduce_min_index<fast>(ptr, num, comp))),
+            vw.at_if(to_umax(details::reduce_max_index<fast, true>(ptr, num, comp)))};
+    }
+}
+
+#endif
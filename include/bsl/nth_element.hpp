@@ -0,0 +1,80 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+///
+/// @file nth_element.hpp
+///
+
+#ifndef BSL_NTH_ELEMENT_HPP
+#define BSL_NTH_ELEMENT_HPP
+
+#include "details/default_less.hpp"
+#include "details/select_impl.hpp"
+#include "details/value_type_for.hpp"
+
+#include "is_nothrow_invocable.hpp"
+#include "safe_integral.hpp"
+
+namespace bsl
+{
+    /// <!-- description -->
+    ///   @brief Reorders the elements of a view so that the element at
+    ///     index "nth" is the element that would be there if the view
+    ///     were sorted. Every element before it is not greater than it,
+    ///     and every element after it is not less than it (e.g., this is
+    ///     how a percentile is read from a list of samples without
+    ///     sorting them). Runs in O(N), including the worst case
+    ///     (introselect, falling back to the median of medians).
+    ///     Elements are ordered using "comp", which must return true if
+    ///     its first argument should come before its second argument.
+    ///   @include example_nth_element_overview.hpp
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @tparam VIEW the type of view to reorder
+    ///   @tparam COMP the type of comparison to use
+    ///   @param vw the view to reorder
+    ///   @param nth the index of the element to select
+    ///   @param comp the comparison to use (defaults to operator<)
+    ///   @return Returns a pointer to the element at index "nth", or a
+    ///     nullptr if "nth" is invalid or out of bounds, in which case
+    ///     the view is left unchanged.
+    ///
+    template<typename VIEW, typename COMP = details::default_less>
+    [[maybe_unused]] constexpr details::value_type_for<VIEW> *
+    nth_element(VIEW &vw, safe_uintmax const &nth, COMP &&comp = COMP{}) noexcept
+    {
+        using value_type = details::value_type_for<VIEW>;
+        static_assert(
+            is_nothrow_invocable<COMP, value_type const &, value_type const &>::value,
+            "comp must be noexcept");
+
+        if ((!nth) || (nth >= vw.size())) {
+            return nullptr;
+        }
+
+        details::select_nth(vw.data(), vw.size().get(), nth.get(), comp);
+        return vw.at_if(nth);
+    }
+}
+
+#endif
@@ -0,0 +1,183 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+///
+/// @file page_index.hpp
+///
+
+#ifndef BSL_PAGE_INDEX_HPP
+#define BSL_PAGE_INDEX_HPP
+
+#include "debug.hpp"
+#include "safe_integral.hpp"
+
+namespace bsl
+{
+    /// @class bsl::page_index
+    ///
+    /// <!-- description -->
+    ///   @brief Stores the number of a page (i.e., an address divided by
+    ///     bsl::page_size). A bsl::page_index is its own type so that
+    ///     it cannot be confused with an address or a byte count, and it
+    ///     keeps the kind of address it came from, so a virtual page
+    ///     cannot be turned into a physical address. Most code should use
+    ///     bsl::phys_page_index and bsl::virt_page_index instead of this
+    ///     type directly.
+    ///   @include example_basic_addr_overview.hpp
+    ///
+    /// <!-- template parameters -->
+    ///   @tparam TAG the kind of address (e.g., details::phys_addr_tag)
+    ///
+    template<typename TAG>
+    class page_index final
+    {
+        /// @brief stores the number of the page
+        safe_uintmax m_idx{};
+
+    public:
+        /// @brief alias for: TAG
+        using tag_type = TAG;
+
+        /// <!-- description -->
+        ///   @brief Creates a bsl::page_index for page 0
+        ///   @include example_basic_addr_overview.hpp
+        ///
+        constexpr page_index() noexcept = default;
+
+        /// <!-- description -->
+        ///   @brief Creates a bsl::page_index given the number of a page
+        ///   @include example_basic_addr_overview.hpp
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param idx the number of the page
+        ///
+        explicit constexpr page_index(safe_uintmax const &idx) noexcept : m_idx{idx}
+        {}
+
+        /// <!-- description -->
+        ///   @brief Returns the number of the page
+        ///   @include example_basic_addr_overview.hpp
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Returns the number of the page
+        ///
+        [[nodiscard]] constexpr safe_uintmax
+        get() const noexcept
+        {
+            return m_idx;
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns true if the bsl::page_index is invalid
+        ///   @include example_basic_addr_overview.hpp
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Returns true if the bsl::page_index is invalid
+        ///
+        [[nodiscard]] constexpr bool
+        failure() const noexcept
+        {
+            return m_idx.failure();
+        }
+    };
+
+    /// <!-- description -->
+    ///   @brief Returns lhs.get() == rhs.get()
+    ///   @include example_basic_addr_overview.hpp
+    ///   @related bsl::page_index
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @tparam TAG the kind of address
+    ///   @param lhs the left hand side of the operator
+    ///   @param rhs the right hand side of the operator
+    ///   @return Returns lhs.get() == rhs.get()
+    ///
+    template<typename TAG>
+    [[nodiscard]] constexpr bool
+    operator==(page_index<TAG> const &lhs, page_index<TAG> const &rhs) noexcept
+    {
+        return lhs.get() == rhs.get();
+    }
+
+    /// <!-- description -->
+    ///   @brief Returns !(lhs == rhs)
+    ///   @include example_basic_addr_overview.hpp
+    ///   @related bsl::page_index
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @tparam TAG the kind of address
+    ///   @param lhs the left hand side of the operator
+    ///   @param rhs the right hand side of the operator
+    ///   @return Returns !(lhs == rhs)
+    ///
+    template<typename TAG>
+    [[nodiscard]] constexpr bool
+    operator!=(page_index<TAG> const &lhs, page_index<TAG> const &rhs) noexcept
+    {
+        return !(lhs == rhs);
+    }
+
+    /// <!-- description -->
+    ///   @brief Returns the page "count" pages after "idx"
+    ///   @include example_basic_addr_overview.hpp
+    ///   @related bsl::page_index
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @tparam TAG the kind of address
+    ///   @param idx the page to start from
+    ///   @param count the number of pages to advance by
+    ///   @return Returns the page "count" pages after "idx"
+    ///
+    template<typename TAG>
+    [[nodiscard]] constexpr page_index<TAG>
+    operator+(page_index<TAG> const &idx, safe_uintmax const &count) noexcept
+    {
+        return page_index<TAG>{idx.get() + count};
+    }
+
+    /// <!-- description -->
+    ///   @brief Outputs the provided bsl::page_index to the provided
+    ///     output type.
+    ///   @related bsl::page_index
+    ///   @include example_basic_addr_overview.hpp
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @tparam T the type of outputter provided
+    ///   @tparam TAG the kind of address
+    ///   @param o the instance of the outputter used to output the value.
+    ///   @param val the bsl::page_index to output
+    ///   @return return o
+    ///
+    template<typename T, typename TAG>
+    [[maybe_unused]] constexpr out<T>
+    operator<<(out<T> const o, page_index<TAG> const &val) noexcept
+    {
+        if constexpr (!o) {
+            return o;
+        }
+
+        return o << val.get();
+    }
+}
+
+#endif
@@ -0,0 +1,69 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+///
+/// @file page_size.hpp
+///
+
+#ifndef BSL_PAGE_SIZE_HPP
+#define BSL_PAGE_SIZE_HPP
+
+#include "cstdint.hpp"
+#include "safe_integral.hpp"
+
+namespace bsl
+{
+    namespace details
+    {
+        /// <!-- description -->
+        ///   @brief Returns log2(val), where val must be a power of 2
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param val the value to take the log2 of
+        ///   @return Returns log2(val)
+        ///
+        [[nodiscard]] constexpr bsl::uintmax
+        page_log2(bsl::uintmax const val) noexcept
+        {
+            bsl::uintmax log2{};
+            while ((val >> log2) > 1U) {
+                ++log2;
+            }
+
+            return log2;
+        }
+    }
+
+    /// @brief the size of a page in bytes, as set by BSL_PAGE_SIZE
+    constexpr bsl::safe_uintmax page_size{static_cast<bsl::uintmax>(BSL_PAGE_SIZE)};
+    /// @brief the number of bits an address is shifted by to get its page
+    constexpr bsl::uintmax page_shift{details::page_log2(page_size.get())};
+    /// @brief the bits of an address that give its offset in a page
+    constexpr bsl::uintmax page_mask{page_size.get() - 1U};
+
+    static_assert(
+        (page_size.get() != 0U) && ((page_size.get() & page_mask) == 0U),
+        "BSL_PAGE_SIZE must be a power of 2");
+}
+
+#endif
@@ -0,0 +1,262 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+///
+/// @file page_span.hpp
+///
+
+#ifndef BSL_PAGE_SPAN_HPP
+#define BSL_PAGE_SPAN_HPP
+
+#include "basic_addr.hpp"
+#include "debug.hpp"
+#include "page_size.hpp"
+#include "safe_integral.hpp"
+
+namespace bsl
+{
+    /// @class bsl::page_span
+    ///
+    /// <!-- description -->
+    ///   @brief Describes a range of bytes, starting at a base address,
+    ///     as the set of pages that the range touches. The range is
+    ///     validated once, when the bsl::page_span is created, so walking
+    ///     the range only needs to check the page being asked for, and not
+    ///     each byte in that page.
+    ///   @include example_page_span_overview.hpp
+    ///
+    /// <!-- template parameters -->
+    ///   @tparam ADDR the type of address (e.g., bsl::phys_addr)
+    ///
+    template<typename ADDR>
+    class page_span final
+    {
+        /// @brief stores the base address of the range
+        ADDR m_base;
+        /// @brief stores the number of bytes in the range
+        safe_uintmax m_bytes;
+        /// @brief stores the number of pages the range touches
+        safe_uintmax m_pages;
+
+    public:
+        /// @brief alias for: ADDR
+        using addr_type = ADDR;
+
+        /// <!-- description -->
+        ///   @brief Creates an empty bsl::page_span
+        ///   @include example_page_span_overview.hpp
+        ///
+        constexpr page_span() noexcept = default;
+
+        /// <!-- description -->
+        ///   @brief Creates a bsl::page_span given a base address and the
+        ///     number of bytes in the range. If the base address is invalid,
+        ///     or the range wraps around the end of the address space, the
+        ///     resulting bsl::page_span is empty and invalid.
+        ///   @include example_page_span_overview.hpp
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param base the base address of the range
+        ///   @param bytes the number of bytes in the range
+        ///
+        constexpr page_span(ADDR const &base, safe_uintmax const &bytes) noexcept
+            : m_base{base}, m_bytes{bytes}, m_pages{}
+        {
+            if (bytes.is_zero()) {
+                return;
+            }
+
+            safe_uintmax const last{base.get() + (bytes - safe_uintmax::one())};
+            if (last.failure()) {
+                bsl::error() << "invalid page_span: " << base << ", " << bytes << bsl::endl;
+
+                m_pages = safe_uintmax::zero(true);
+                return;
+            }
+
+            m_pages = ((last >> page_shift) - (base.get() >> page_shift)) + safe_uintmax::one();
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns the number of pages the range touches. If the
+        ///     bsl::page_span is invalid, the result is invalid.
+        ///   @include example_page_span_overview.hpp
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Returns the number of pages the range touches
+        ///
+        [[nodiscard]] constexpr safe_uintmax
+        size() const noexcept
+        {
+            return m_pages;
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns true if the range does not touch any pages
+        ///   @include example_page_span_overview.hpp
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Returns true if the range does not touch any pages
+        ///
+        [[nodiscard]] constexpr bool
+        empty() const noexcept
+        {
+            return m_pages.is_zero();
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns true if the bsl::page_span is invalid
+        ///   @include example_page_span_overview.hpp
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Returns true if the bsl::page_span is invalid
+        ///
+        [[nodiscard]] constexpr bool
+        failure() const noexcept
+        {
+            return m_pages.failure();
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns the base address of the range
+        ///   @include example_page_span_overview.hpp
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Returns the base address of the range
+        ///
+        [[nodiscard]] constexpr ADDR
+        base() const noexcept
+        {
+            return m_base;
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns the page-aligned address of the ith page in
+        ///     the range. If i is out of bounds, an invalid address is
+        ///     returned.
+        ///   @include example_page_span_overview.hpp
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param i the index of the page in the range to return
+        ///   @return Returns the page-aligned address of the ith page
+        ///
+        [[nodiscard]] constexpr ADDR
+        page(safe_uintmax const &i) const noexcept
+        {
+            if (!(i < m_pages)) {
+                bsl::error() << "index out of bounds: " << i << bsl::endl;
+                return ADDR{safe_uintmax::zero(true)};
+            }
+
+            /// NOTE:
+            /// - The range was validated when it was created, so once i is
+            ///   known to be in bounds, this cannot overflow.
+            ///
+
+            bsl::uintmax const first{m_base.get().get() & (~page_mask)};
+            return ADDR{safe_uintmax{first + (i.get() << page_shift)}};
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns the address of the first byte of the range that
+        ///     is in the ith page. This is the base address for the first
+        ///     page, and the page-aligned address for every other page. If
+        ///     i is out of bounds, an invalid address is returned.
+        ///   @include example_page_span_overview.hpp
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param i the index of the page in the range
+        ///   @return Returns the address of the first byte in the ith page
+        ///
+        [[nodiscard]] constexpr ADDR
+        addr(safe_uintmax const &i) const noexcept
+        {
+            if (i.is_zero() && !m_pages.is_zero()) {
+                return m_base;
+            }
+
+            return this->page(i);
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns the number of bytes of the range that are in
+        ///     the ith page. If i is out of bounds, an invalid result is
+        ///     returned.
+        ///   @include example_page_span_overview.hpp
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param i the index of the page in the range
+        ///   @return Returns the number of bytes of the range in the ith page
+        ///
+        [[nodiscard]] constexpr safe_uintmax
+        bytes(safe_uintmax const &i) const noexcept
+        {
+            if (!(i < m_pages)) {
+                bsl::error() << "index out of bounds: " << i << bsl::endl;
+                return safe_uintmax::zero(true);
+            }
+
+            /// NOTE:
+            /// - The page holds everything from max(base, page start) up to
+            ///   min(base + bytes, page end). As above, i being in bounds
+            ///   means none of this can overflow.
+            ///
+
+            bsl::uintmax const base{m_base.get().get()};
+            bsl::uintmax const start{(base & (~page_mask)) + (i.get() << page_shift)};
+            bsl::uintmax const last{base + (m_bytes.get() - 1U)};
+
+            bsl::uintmax const from{(start < base) ? base : start};
+            bsl::uintmax const end{start + page_mask};
+            bsl::uintmax const to{(last < end) ? last : end};
+
+            return safe_uintmax{(to - from) + 1U};
+        }
+    };
+
+    /// <!-- description -->
+    ///   @brief Outputs the provided bsl::page_span to the provided
+    ///     output type.
+    ///   @related bsl::page_span
+    ///   @include example_page_span_overview.hpp
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @tparam T the type of outputter provided
+    ///   @tparam ADDR the type of address
+    ///   @param o the instance of the outputter used to output the value.
+    ///   @param span the bsl::page_span to output
+    ///   @return return o
+    ///
+    template<typename T, typename ADDR>
+    [[maybe_unused]] constexpr out<T>
+    operator<<(out<T> const o, page_span<ADDR> const &span) noexcept
+    {
+        if constexpr (!o) {
+            return o;
+        }
+
+        return o << '[' << span.base() << ", " << span.size() << " pages]";
+    }
+}
+
+#endif
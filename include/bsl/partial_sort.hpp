@@ -0,0 +1,88 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+///
+/// @file partial_sort.hpp
+///
+
+#ifndef BSL_PARTIAL_SORT_HPP
+#define BSL_PARTIAL_SORT_HPP
+
+#include "details/default_less.hpp"
+#include "details/select_impl.hpp"
+#include "details/value_type_for.hpp"
+
+#include "debug.hpp"
+#include "is_nothrow_invocable.hpp"
+#include "safe_integral.hpp"
+
+namespace bsl
+{
+    /// <!-- description -->
+    ///   @brief Reorders the elements of a view so that the first "count"
+    ///     elements are the "count" smallest elements of the view, in
+    ///     sorted order. The order of the remaining elements is
+    ///     unspecified. The smallest elements are first selected using
+    ///     bsl::nth_element, and then heap sorted, so this runs in
+    ///     O(N + count * log2(count)). If "count" is larger than the
+    ///     view, the entire view is sorted. Elements are ordered using
+    ///     "comp", which must return true if its first argument should
+    ///     come before its second argument.
+    ///   @include example_partial_sort_overview.hpp
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @tparam VIEW the type of view to reorder
+    ///   @tparam COMP the type of comparison to use
+    ///   @param vw the view to reorder
+    ///   @param count the number of elements to sort
+    ///   @param comp the comparison to use (defaults to operator<)
+    ///
+    template<typename VIEW, typename COMP = details::default_less>
+    constexpr void
+    partial_sort(VIEW &vw, safe_uintmax const &count, COMP &&comp = COMP{}) noexcept
+    {
+        using value_type = details::value_type_for<VIEW>;
+        static_assert(
+            is_nothrow_invocable<COMP, value_type const &, value_type const &>::value,
+            "comp must be noexcept");
+
+        if (!count) {
+            bsl::error() << "partial_sort: invalid count: " << count << '\n';
+            return;
+        }
+
+        safe_uintmax const num{count.min(vw.size())};
+        if (num.is_zero()) {
+            return;
+        }
+
+        if (num < vw.size()) {
+            details::select_nth(vw.data(), vw.size().get(), num.get(), comp);
+        }
+
+        details::select_make_heap(vw.data(), num.get(), comp);
+        details::select_sort_heap(vw.data(), num.get(), comp);
+    }
+}
+
+#endif
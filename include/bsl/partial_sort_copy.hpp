@@ -0,0 +1,88 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+///
+/// @file partial_sort_copy.hpp
+///
+
+#ifndef BSL_PARTIAL_SORT_COPY_HPP
+#define BSL_PARTIAL_SORT_COPY_HPP
+
+#include "details/default_less.hpp"
+#include "details/select_impl.hpp"
+
+#include "is_nothrow_invocable.hpp"
+#include "safe_integral.hpp"
+#include "span.hpp"
+
+namespace bsl
+{
+    /// <!-- description -->
+    ///   @brief Copies the smallest elements of src into dst in sorted
+    ///     order, filling dst (or copying all of src if dst is larger).
+    ///     src is not modified. A max heap of the smallest elements seen
+    ///     so far is kept in dst, so this runs in O(N * log2(M)) where M
+    ///     is the number of elements copied, and only reads src once.
+    ///     Elements are ordered using "comp", which must return true if
+    ///     its first argument should come before its second argument.
+    ///   @include example_partial_sort_copy_overview.hpp
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @tparam T the type of elements to copy
+    ///   @tparam COMP the type of comparison to use
+    ///   @param src the elements to copy from
+    ///   @param dst where to copy the smallest elements to
+    ///   @param comp the comparison to use (defaults to operator<)
+    ///   @return Returns the number of elements copied to dst
+    ///
+    template<typename T, typename COMP = details::default_less>
+    [[maybe_unused]] constexpr safe_uintmax
+    partial_sort_copy(span<T const> const &src, span<T> dst, COMP &&comp = COMP{}) noexcept
+    {
+        static_assert(
+            is_nothrow_invocable<COMP, T const &, T const &>::value, "comp must be noexcept");
+
+        safe_uintmax const num{src.size().min(dst.size())};
+        if (num.is_zero()) {
+            return num;
+        }
+
+        for (safe_uintmax i{}; i < num; ++i) {
+            *dst.at_if(i) = *src.at_if(i);
+        }
+
+        details::select_make_heap(dst.data(), num.get(), comp);
+        for (safe_uintmax i{num}; i < src.size(); ++i) {
+            T const &elem{*src.at_if(i)};
+            if (comp(elem, *dst.front_if())) {
+                *dst.front_if() = elem;
+                details::select_sift_down(dst.data(), num.get(), bsl::uintmax{}, comp);
+            }
+        }
+
+        details::select_sort_heap(dst.data(), num.get(), comp);
+        return num;
+    }
+}
+
+#endif
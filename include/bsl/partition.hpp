@@ -0,0 +1,94 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+///
+/// @file partition.hpp
+///
+
+#ifndef BSL_PARTITION_HPP
+#define BSL_PARTITION_HPP
+
+#include "details/compact_impl.hpp"
+#include "details/value_type_for.hpp"
+
+#include "convert.hpp"
+#include "is_nothrow_invocable.hpp"
+#include "is_nothrow_swappable.hpp"
+#include "is_trivially_copyable.hpp"
+#include "safe_integral.hpp"
+#include "swap.hpp"
+
+namespace bsl
+{
+    /// <!-- description -->
+    ///   @brief Reorders the elements of a view so that the elements for
+    ///     which "pred" returns true come before the elements for which
+    ///     "pred" returns false. The order of the elements within each
+    ///     group is not kept (use bsl::stable_partition if it must be).
+    ///     If the elements are trivially copyable, the view is
+    ///     partitioned without branching on the result of "pred".
+    ///   @include example_partition_overview.hpp
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @tparam VIEW the type of view to partition
+    ///   @tparam PRED the type of predicate to use
+    ///   @param vw the view to partition
+    ///   @param pred returns true if an element belongs to the first group
+    ///   @return Returns the number of elements in the first group (i.e.,
+    ///     the index of the first element of the second group).
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @throw throws if the swap of two elements throws
+    ///
+    template<typename VIEW, typename PRED>
+    [[maybe_unused]] constexpr safe_uintmax
+    partition(VIEW &vw, PRED &&pred) noexcept(    // --
+        is_nothrow_swappable<details::value_type_for<VIEW>>::value)
+    {
+        using value_type = details::value_type_for<VIEW>;
+        static_assert(
+            is_nothrow_invocable<PRED, value_type const &>::value, "pred must be noexcept");
+
+        if constexpr (is_trivially_copyable<value_type>::value) {
+            return to_umax(details::compact_partition(vw.data(), vw.size().get(), pred));
+        }
+        else {
+            safe_uintmax first{};
+            for (safe_uintmax i{}; i < vw.size(); ++i) {
+                if (!pred(*vw.at_if(i))) {
+                    continue;
+                }
+
+                if (first != i) {
+                    bsl::swap(*vw.at_if(first), *vw.at_if(i));
+                }
+
+                ++first;
+            }
+
+            return first;
+        }
+    }
+}
+
+#endif
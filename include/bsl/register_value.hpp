@@ -0,0 +1,261 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+///
+/// @file register_value.hpp
+///
+
+#ifndef BSL_REGISTER_VALUE_HPP
+#define BSL_REGISTER_VALUE_HPP
+
+#include "details/bitfield_masks.hpp"
+
+#include "bitfield.hpp"
+#include "debug.hpp"
+#include "is_same.hpp"
+#include "safe_integral.hpp"
+
+namespace bsl
+{
+    /// @class bsl::register_value
+    ///
+    /// <!-- description -->
+    ///   @brief Stores the value of the register REG, and reads and writes
+    ///     the bsl::bitfield descriptors that belong to REG. Updates to
+    ///     several fields are combined into a single masked
+    ///     read-modify-write, using masks that are computed (and checked
+    ///     for overlap) at compile time. Using a field from a different
+    ///     register will not compile.
+    ///   @include example_register_value_overview.hpp
+    ///
+    /// <!-- template parameters -->
+    ///   @tparam REG the register being stored (see bsl::bitfield)
+    ///
+    template<typename REG>
+    class register_value final
+    {
+    public:
+        /// @brief alias for: REG
+        using register_type = REG;
+        /// @brief alias for: typename REG::value_type
+        using value_type = typename REG::value_type;
+
+    private:
+        /// @brief stores the value of the register
+        safe_integral<value_type> m_val;
+
+    public:
+        /// <!-- description -->
+        ///   @brief Creates a bsl::register_value set to 0
+        ///   @include example_register_value_overview.hpp
+        ///
+        constexpr register_value() noexcept = default;
+
+        /// <!-- description -->
+        ///   @brief Creates a bsl::register_value given the value of the
+        ///     register (e.g., the value read from CR0).
+        ///   @include example_register_value_overview.hpp
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param val the value of the register
+        ///
+        explicit constexpr register_value(safe_integral<value_type> const &val) noexcept
+            : m_val{val}
+        {}
+
+        /// <!-- description -->
+        ///   @brief Returns the value of the register (e.g., the value to
+        ///     write back to CR0).
+        ///   @include example_register_value_overview.hpp
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Returns the value of the register
+        ///
+        [[nodiscard]] constexpr safe_integral<value_type>
+        get() const noexcept
+        {
+            return m_val;
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns the value of FIELD
+        ///   @include example_register_value_overview.hpp
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @tparam FIELD the bsl::bitfield to read
+        ///   @return Returns the value of FIELD
+        ///
+        template<typename FIELD>
+        [[nodiscard]] constexpr safe_integral<value_type>
+        read() const noexcept
+        {
+            static_assert(is_same<REG, typename FIELD::register_type>::value);
+            return FIELD::get(m_val);
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns true if every bit of every field in FIELDS is
+        ///     set. This is a single mask and compare.
+        ///   @include example_register_value_overview.hpp
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @tparam FIELDS the bsl::bitfield descriptors to check
+        ///   @return Returns true if every bit of every field is set
+        ///
+        template<typename... FIELDS>
+        [[nodiscard]] constexpr bool
+        is_set() const noexcept
+        {
+            constexpr value_type mask{details::bitfield_masks<REG, FIELDS...>::mask};
+            return (!m_val.failure()) && ((m_val.get() & mask) == mask);
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns true if every bit of every field in FIELDS is
+        ///     clear. This is a single mask and compare.
+        ///   @include example_register_value_overview.hpp
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @tparam FIELDS the bsl::bitfield descriptors to check
+        ///   @return Returns true if every bit of every field is clear
+        ///
+        template<typename... FIELDS>
+        [[nodiscard]] constexpr bool
+        is_clear() const noexcept
+        {
+            constexpr value_type mask{details::bitfield_masks<REG, FIELDS...>::mask};
+            constexpr value_type none{};
+            return (!m_val.failure()) && ((m_val.get() & mask) == none);
+        }
+
+        /// <!-- description -->
+        ///   @brief Sets every bit of every field in FIELDS using a single
+        ///     OR.
+        ///   @include example_register_value_overview.hpp
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @tparam FIELDS the bsl::bitfield descriptors to set
+        ///
+        template<typename... FIELDS>
+        constexpr void
+        set() noexcept
+        {
+            constexpr value_type mask{details::bitfield_masks<REG, FIELDS...>::mask};
+            m_val |= mask;
+        }
+
+        /// <!-- description -->
+        ///   @brief Clears every bit of every field in FIELDS using a
+        ///     single AND.
+        ///   @include example_register_value_overview.hpp
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @tparam FIELDS the bsl::bitfield descriptors to clear
+        ///
+        template<typename... FIELDS>
+        constexpr void
+        clear() noexcept
+        {
+            constexpr value_type mask{details::bitfield_masks<REG, FIELDS...>::mask};
+            m_val &= static_cast<value_type>(~mask);
+        }
+
+        /// <!-- description -->
+        ///   @brief Writes each value in vals to its matching field in
+        ///     FIELDS using a single masked read-modify-write. Every value
+        ///     is checked before the register is touched, so if any value
+        ///     is invalid or does not fit in its field, an error is logged,
+        ///     false is returned and the register is left unchanged.
+        ///   @include example_register_value_overview.hpp
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @tparam FIELDS the bsl::bitfield descriptors to write
+        ///   @param vals the values to write, one for each field in FIELDS
+        ///   @return Returns true if the fields were written, false
+        ///     otherwise.
+        ///
+        template<typename... FIELDS>
+        [[nodiscard]] constexpr bool
+        write(safe_integral<typename FIELDS::value_type> const &...vals) noexcept
+        {
+            constexpr value_type mask{details::bitfield_masks<REG, FIELDS...>::mask};
+            constexpr value_type none{};
+
+            if (!(FIELDS::fits(vals) && ...)) {
+                bsl::error() << "register_value: value does not fit in its field\n";
+                return false;
+            }
+
+            value_type const bits{static_cast<value_type>((none | ... | FIELDS::to_bits(vals)))};
+
+            m_val = safe_integral<value_type>{
+                static_cast<value_type>((m_val.get() & static_cast<value_type>(~mask)) | bits),
+                m_val.failure()};
+
+            return true;
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns true if the register's value is invalid
+        ///   @include example_register_value_overview.hpp
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Returns true if the register's value is invalid
+        ///
+        [[nodiscard]] constexpr bool
+        failure() const noexcept
+        {
+            return m_val.failure();
+        }
+    };
+
+    /// <!-- description -->
+    ///   @brief Outputs the provided bsl::register_value to the provided
+    ///     output type in hex.
+    ///   @related bsl::register_value
+    ///   @include example_register_value_overview.hpp
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @tparam T the type of outputter provided
+    ///   @tparam REG the register being stored
+    ///   @param o the instance of the outputter used to output the value.
+    ///   @param reg the bsl::register_value to output
+    ///   @return return o
+    ///
+    template<typename T, typename REG>
+    [[maybe_unused]] constexpr out<T>
+    operator<<(out<T> const o, register_value<REG> const &reg) noexcept
+    {
+        if constexpr (!o) {
+            return o;
+        }
+
+        if (reg.failure()) {
+            return o << reg.get();
+        }
+
+        return o << fmt{"#x", reg.get()};
+    }
+}
+
+#endif
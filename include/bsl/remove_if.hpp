@@ -0,0 +1,94 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+///
+/// @file remove_if.hpp
+///
+
+#ifndef BSL_REMOVE_IF_HPP
+#define BSL_REMOVE_IF_HPP
+
+#include "details/compact_impl.hpp"
+#include "details/value_type_for.hpp"
+
+#include "convert.hpp"
+#include "is_nothrow_invocable.hpp"
+#include "is_nothrow_move_assignable.hpp"
+#include "is_trivially_copyable.hpp"
+#include "move.hpp"
+#include "safe_integral.hpp"
+
+namespace bsl
+{
+    /// <!-- description -->
+    ///   @brief Removes the elements of a view for which "pred" returns
+    ///     true by moving the elements that are kept to the front of the
+    ///     view, keeping their order. The elements after the returned
+    ///     size are left in a valid but unspecified state. If the
+    ///     elements are trivially copyable, the view is compacted without
+    ///     branching on the result of "pred".
+    ///   @include example_remove_if_overview.hpp
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @tparam VIEW the type of view to compact
+    ///   @tparam PRED the type of predicate to use
+    ///   @param vw the view to compact
+    ///   @param pred returns true if an element should be removed
+    ///   @return Returns the number of elements that were kept (i.e.,
+    ///     the new size of the view).
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @throw throws if the move assignment of an element throws
+    ///
+    template<typename VIEW, typename PRED>
+    [[maybe_unused]] constexpr safe_uintmax
+    remove_if(VIEW &vw, PRED &&pred) noexcept(    // --
+        is_nothrow_move_assignable<details::value_type_for<VIEW>>::value)
+    {
+        using value_type = details::value_type_for<VIEW>;
+        static_assert(
+            is_nothrow_invocable<PRED, value_type const &>::value, "pred must be noexcept");
+
+        if constexpr (is_trivially_copyable<value_type>::value) {
+            return to_umax(details::compact_remove_if(vw.data(), vw.size().get(), pred));
+        }
+        else {
+            safe_uintmax kept{};
+            for (safe_uintmax i{}; i < vw.size(); ++i) {
+                if (pred(*vw.at_if(i))) {
+                    continue;
+                }
+
+                if (kept != i) {
+                    *vw.at_if(kept) = bsl::move(*vw.at_if(i));
+                }
+
+                ++kept;
+            }
+
+            return kept;
+        }
+    }
+}
+
+#endif
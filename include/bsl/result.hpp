@@ -32,7 +32,9 @@
 #include "cstdint.hpp"
 #include "destroy_at.hpp"
 #include "debug.hpp"
+#include "discard.hpp"
 #include "errc_type.hpp"
+#include "error_trace.hpp"
 #include "in_place.hpp"
 #include "is_nothrow_constructible.hpp"
 #include "is_nothrow_copy_constructible.hpp"
@@ -43,6 +45,7 @@
 #include "is_nothrow_swappable.hpp"
 #include "is_same.hpp"
 #include "move.hpp"
+#include "site_table.hpp"
 #include "swap.hpp"
 
 namespace bsl
@@ -121,6 +124,29 @@ namespace bsl
             bsl::swap(lhs.m_which, rhs.m_which);
         }
 
+        /// <!-- description -->
+        ///   @brief Records the error that a bsl::result was created with
+        ///     in the calling thread's bsl::error_trace. Error types other
+        ///     than bsl::errc_type are recorded as bsl::errc_failure.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param e the error that the bsl::result was created with
+        ///   @param site the site that created the bsl::result
+        ///
+        static constexpr void
+        private_record(E const &e, site_entry const &site) noexcept
+        {
+            if constexpr (is_same<E, errc_type>::value) {
+                if (e.failure()) {
+                    record_error(site, e.get());
+                }
+            }
+            else {
+                bsl::discard(e);
+                record_error(site, errc_failure.get());
+            }
+        }
+
     public:
         /// @brief alias for: T
         using type = T;
@@ -207,11 +233,32 @@ namespace bsl
         ///
         /// <!-- inputs/outputs -->
         ///   @param e the error code being copied
+        ///   @param site defaults to the site that created the bsl::result
         ///
         constexpr result(    // PRQA S 2180 // NOLINT
-            E const &e) noexcept
+            E const &e,
+            site_entry const &site = {}) noexcept
             : m_which{details::result_type::contains_e}, m_e{e}
-        {}
+        {
+            private_record(m_e, site);
+        }
+
+        /// <!-- description -->
+        ///   @brief Constructs a bsl::result that contains E,
+        ///     by copying "e", without recording "e" in the calling
+        ///     thread's bsl::error_trace. Use this for errors that are
+        ///     expected, like a lookup miss.
+        ///   @include example_error_trace_overview.hpp
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param ut provide bsl::untraced to skip the bsl::error_trace
+        ///   @param e the error code being copied
+        ///
+        constexpr result(untraced_t const &ut, E const &e) noexcept
+            : m_which{details::result_type::contains_e}, m_e{e}
+        {
+            bsl::discard(ut);
+        }
 
         /// <!-- description -->
         ///   @brief Constructs a bsl::result that contains E,
@@ -226,11 +273,15 @@ namespace bsl
         ///
         /// <!-- inputs/outputs -->
         ///   @param e the error code being moved
+        ///   @param site defaults to the site that created the bsl::result
         ///
         constexpr result(    // PRQA S 2180 // NOLINT
-            E &&e) noexcept
+            E &&e,
+            site_entry const &site = {}) noexcept
             : m_which{details::result_type::contains_e}, m_e{bsl::move(e)}
-        {}
+        {
+            private_record(m_e, site);
+        }
 
         /// <!-- description -->
         ///   @brief Destroyes a previously created bsl::result. Since
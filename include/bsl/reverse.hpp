@@ -0,0 +1,83 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+///
+/// @file reverse.hpp
+///
+
+#ifndef BSL_REVERSE_HPP
+#define BSL_REVERSE_HPP
+
+#include "details/range_ops.hpp"
+#include "details/value_type_for.hpp"
+
+#include "convert.hpp"
+#include "is_constant_evaluated.hpp"
+#include "is_nothrow_swappable.hpp"
+#include "is_trivially_copyable.hpp"
+#include "safe_integral.hpp"
+#include "swap.hpp"
+
+namespace bsl
+{
+    /// <!-- description -->
+    ///   @brief Reverses the order of the elements in a view. If the
+    ///     elements are trivially copyable, at run-time the view is
+    ///     reversed as raw memory (byte swapping 8 bytes at a time for
+    ///     single byte elements). Otherwise, and at compile-time, the
+    ///     elements are swapped one pair at a time using bsl::swap.
+    ///   @include example_reverse_overview.hpp
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @tparam VIEW the type of view to reverse
+    ///   @param vw the view to reverse
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @throw throws if the swap of two elements throws
+    ///
+    template<typename VIEW>
+    constexpr void
+    reverse(VIEW &vw) noexcept(is_nothrow_swappable<details::value_type_for<VIEW>>::value)
+    {
+        if (vw.size() <= safe_uintmax::one()) {
+            return;
+        }
+
+        if constexpr (is_trivially_copyable<details::value_type_for<VIEW>>::value) {
+            if (!is_constant_evaluated()) {
+                details::range_reverse(vw.data(), vw.size().get());
+                return;
+            }
+        }
+
+        safe_uintmax lo{};
+        safe_uintmax hi{vw.size()};
+        while ((hi - lo) > safe_uintmax::one()) {
+            --hi;
+            bsl::swap(*vw.at_if(lo), *vw.at_if(hi));
+            ++lo;
+        }
+    }
+}
+
+#endif
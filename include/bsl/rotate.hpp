@@ -0,0 +1,136 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+///
+/// @file rotate.hpp
+///
+
+#ifndef BSL_ROTATE_HPP
+#define BSL_ROTATE_HPP
+
+#include "details/range_ops.hpp"
+#include "details/value_type_for.hpp"
+
+#include "convert.hpp"
+#include "debug.hpp"
+#include "is_constant_evaluated.hpp"
+#include "is_nothrow_swappable.hpp"
+#include "is_trivially_copyable.hpp"
+#include "safe_integral.hpp"
+#include "swap.hpp"
+
+namespace bsl
+{
+    namespace details
+    {
+        /// <!-- description -->
+        ///   @brief Swaps the "count" elements starting at index "a" with
+        ///     the "count" elements starting at index "b" of the same view.
+        ///     The two blocks must not overlap. Trivially copyable elements
+        ///     are swapped as raw memory at run-time.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @tparam VIEW the type of view to swap the blocks of
+        ///   @param vw the view to swap the blocks of
+        ///   @param a the index of the first block
+        ///   @param b the index of the second block
+        ///   @param count the number of elements in each block
+        ///
+        template<typename VIEW>
+        constexpr void
+        rotate_swap_blocks(
+            VIEW &vw,
+            safe_uintmax const &a,
+            safe_uintmax const &b,
+            safe_uintmax const &count) noexcept(    // --
+            is_nothrow_swappable<value_type_for<VIEW>>::value)
+        {
+            if constexpr (is_trivially_copyable<value_type_for<VIEW>>::value) {
+                if (!is_constant_evaluated()) {
+                    details::range_swap(vw.at_if(a), vw.at_if(b), count.get());
+                    return;
+                }
+            }
+
+            for (safe_uintmax i{}; i < count; ++i) {
+                bsl::swap(*vw.at_if(a + i), *vw.at_if(b + i));
+            }
+        }
+    }
+
+    /// <!-- description -->
+    ///   @brief Rotates the elements of a view to the left, such that the
+    ///     element at index "mid" becomes the first element, and the
+    ///     element that was first ends up at index "size() - mid". This is
+    ///     implemented using the block swap algorithm (Gries and Mills),
+    ///     which only ever swaps blocks of elements that do not overlap.
+    ///     As a result, trivially copyable elements are rotated one 64 byte
+    ///     block at a time at run-time, without the need for a temporary
+    ///     buffer. If "mid" is larger than the size of the view, nothing
+    ///     is rotated and safe_uintmax::zero(true) is returned.
+    ///   @include example_rotate_overview.hpp
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @tparam VIEW the type of view to rotate
+    ///   @param vw the view to rotate
+    ///   @param mid the index of the element that should become the first
+    ///   @return Returns the new index of the element that was first, or
+    ///     safe_uintmax::zero(true) if "mid" is invalid.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @throw throws if the swap of two elements throws
+    ///
+    template<typename VIEW>
+    [[maybe_unused]] constexpr safe_uintmax
+    rotate(VIEW &vw, safe_uintmax const &mid) noexcept(    // --
+        is_nothrow_swappable<details::value_type_for<VIEW>>::value)
+    {
+        if ((!mid) || (mid > vw.size())) {
+            bsl::error() << "rotate: invalid mid: " << mid << '\n';
+            return safe_uintmax::zero(true);
+        }
+
+        safe_uintmax const ret{vw.size() - mid};
+        if (mid.is_zero() || ret.is_zero()) {
+            return ret;
+        }
+
+        safe_uintmax i{mid};
+        safe_uintmax j{ret};
+        while (i != j) {
+            if (i > j) {
+                details::rotate_swap_blocks(vw, mid - i, mid, j);
+                i -= j;
+            }
+            else {
+                details::rotate_swap_blocks(vw, mid - i, (mid + j) - i, i);
+                j -= i;
+            }
+        }
+
+        details::rotate_swap_blocks(vw, mid - i, mid, i);
+        return ret;
+    }
+}
+
+#endif
@@ -0,0 +1,262 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+///
+/// @file run_queue.hpp
+///
+
+#ifndef BSL_RUN_QUEUE_HPP
+#define BSL_RUN_QUEUE_HPP
+
+#include "array.hpp"
+#include "cstdint.hpp"
+#include "debug.hpp"
+#include "safe_integral.hpp"
+#include "task.hpp"
+
+// Notes: --
+// - Coroutines need C++20, and the PERFORCE build is C++17, so this
+//   header is empty unless the compiler supports them.
+//
+#if !BSL_PERFORCE && defined(__cpp_impl_coroutine)
+
+#include <coroutine>    // NOLINT
+
+namespace bsl
+{
+    /// @class bsl::run_queue
+    ///
+    /// <!-- description -->
+    ///   @brief Implements a simple, single threaded executor for BSL
+    ///     coroutines. The bsl::run_queue is a fixed size FIFO of
+    ///     suspended coroutines. Tasks are added using spawn(), and a
+    ///     running coroutine can give up the CPU (i.e., go to the back of
+    ///     the queue) using "co_await queue.schedule()". Calling run()
+    ///     resumes queued coroutines until the queue is empty. No memory
+    ///     is allocated by the bsl::run_queue.
+    ///
+    /// <!-- notes -->
+    ///   @note If the queue is full, spawn() fails, and schedule() does
+    ///     not suspend (meaning the coroutine simply continues to run).
+    ///     This ensures that a full queue never loses a coroutine.
+    ///   @include example_run_queue_overview.hpp
+    ///
+    /// <!-- template parameters -->
+    ///   @tparam N the max number of coroutines that can be queued
+    ///
+    template<bsl::uintmax N>
+    class run_queue final
+    {
+        /// @brief stores the queued coroutines
+        array<std::coroutine_handle<>, N> m_queue;
+        /// @brief stores the index of the oldest queued coroutine
+        safe_uintmax m_head;
+        /// @brief stores the number of queued coroutines
+        safe_uintmax m_size;
+
+    public:
+        /// @class bsl::run_queue::awaiter
+        ///
+        /// <!-- description -->
+        ///   @brief Returned by schedule(). Suspends the awaiting
+        ///     coroutine and places it at the back of the queue.
+        ///
+        class awaiter final
+        {
+            /// @brief stores the queue to place the coroutine in
+            run_queue *m_rq;
+
+        public:
+            /// <!-- description -->
+            ///   @brief Creates a bsl::run_queue::awaiter
+            ///
+            /// <!-- inputs/outputs -->
+            ///   @param rq the queue to place the coroutine in
+            ///
+            explicit constexpr awaiter(run_queue *const rq) noexcept    // --
+                : m_rq{rq}
+            {}
+
+            /// <!-- description -->
+            ///   @brief Always returns false as the coroutine must be
+            ///     suspended in order to be queued.
+            ///
+            /// <!-- inputs/outputs -->
+            ///   @return Always returns false
+            ///
+            [[nodiscard]] static constexpr bool
+            await_ready() noexcept
+            {
+                return false;
+            }
+
+            /// <!-- description -->
+            ///   @brief Queues the awaiting coroutine
+            ///
+            /// <!-- inputs/outputs -->
+            ///   @param hndl the awaiting coroutine
+            ///   @return Returns true if the coroutine was queued, false
+            ///     if the queue is full, in which case the coroutine is
+            ///     not suspended.
+            ///
+            [[nodiscard]] bool
+            await_suspend(std::coroutine_handle<> const hndl) const noexcept
+            {
+                return m_rq->post(hndl);
+            }
+
+            /// <!-- description -->
+            ///   @brief Does nothing
+            ///
+            static constexpr void
+            await_resume() noexcept
+            {}
+        };
+
+        /// <!-- description -->
+        ///   @brief Places a suspended coroutine at the back of the queue
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param hndl the coroutine to queue
+        ///   @return Returns true if the coroutine was queued, false if the
+        ///     queue is full or hndl is invalid or has already completed.
+        ///
+        [[nodiscard]] bool
+        post(std::coroutine_handle<> const hndl) noexcept
+        {
+            if ((!hndl) || hndl.done()) {
+                bsl::error() << "run_queue: invalid coroutine\n";
+                return false;
+            }
+
+            if (m_size == N) {
+                bsl::error() << "run_queue: queue is full\n";
+                return false;
+            }
+
+            *m_queue.at_if((m_head + m_size) % N) = hndl;
+            ++m_size;
+
+            return true;
+        }
+
+        /// <!-- description -->
+        ///   @brief Places a bsl::task at the back of the queue. Note that
+        ///     the task must outlive its execution by the queue, and its
+        ///     result can be read using get() once it completes.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @tparam T the type of value returned by the task
+        ///   @param tsk the task to queue
+        ///   @return Returns true if the task was queued, false otherwise
+        ///
+        template<typename T>
+        [[nodiscard]] bool
+        spawn(task<T> const &tsk) noexcept
+        {
+            return this->post(tsk.handle());
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns an awaiter that places the awaiting coroutine
+        ///     at the back of the queue (i.e., yields to the other
+        ///     coroutines in the queue).
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Returns a bsl::run_queue::awaiter
+        ///
+        [[nodiscard]] constexpr awaiter
+        schedule() noexcept
+        {
+            return awaiter{this};
+        }
+
+        /// <!-- description -->
+        ///   @brief Removes the coroutine at the front of the queue and
+        ///     resumes it.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Returns true if a coroutine was resumed, false if the
+        ///     queue is empty.
+        ///
+        [[maybe_unused]] bool
+        run_one() noexcept
+        {
+            if (m_size.is_zero()) {
+                return false;
+            }
+
+            std::coroutine_handle<> const hndl{*m_queue.at_if(m_head)};
+            m_head = (m_head + safe_uintmax::one()) % N;
+            --m_size;
+
+            hndl.resume();
+            return true;
+        }
+
+        /// <!-- description -->
+        ///   @brief Resumes queued coroutines until the queue is empty
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Returns the total number of coroutines that were resumed
+        ///
+        [[maybe_unused]] safe_uintmax
+        run() noexcept
+        {
+            safe_uintmax count{};
+            while (this->run_one()) {
+                ++count;
+            }
+
+            return count;
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns the number of queued coroutines
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Returns the number of queued coroutines
+        ///
+        [[nodiscard]] constexpr safe_uintmax const &
+        size() const noexcept
+        {
+            return m_size;
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns true if no coroutines are queued
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Returns true if no coroutines are queued
+        ///
+        [[nodiscard]] constexpr bool
+        empty() const noexcept
+        {
+            return m_size.is_zero();
+        }
+    };
+}
+
+#endif
+
+#endif
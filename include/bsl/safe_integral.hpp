@@ -568,7 +568,7 @@ namespace bsl
         {
             bool const err{builtin_add_overflow(m_val, rhs.m_val, &m_val)};
 
-            m_error = m_error || (err || rhs.failure());
+            m_error = static_cast<bool>(m_error | err | rhs.m_error);
             return *this;
         }
 
@@ -591,7 +591,7 @@ namespace bsl
         {
             bool const err{builtin_add_overflow(m_val, rhs, &m_val)};
 
-            m_error = m_error || err;
+            m_error = static_cast<bool>(m_error | err);
             return *this;
         }
 
@@ -612,7 +612,7 @@ namespace bsl
         {
             bool const err{builtin_sub_overflow(m_val, rhs.m_val, &m_val)};
 
-            m_error = m_error || (err || rhs.failure());
+            m_error = static_cast<bool>(m_error | err | rhs.m_error);
             return *this;
         }
 
@@ -635,7 +635,7 @@ namespace bsl
         {
             bool const err{builtin_sub_overflow(m_val, rhs, &m_val)};
 
-            m_error = m_error || err;
+            m_error = static_cast<bool>(m_error | err);
             return *this;
         }
 
@@ -656,7 +656,7 @@ namespace bsl
         {
             bool const err{builtin_mul_overflow(m_val, rhs.m_val, &m_val)};
 
-            m_error = m_error || (err || rhs.failure());
+            m_error = static_cast<bool>(m_error | err | rhs.m_error);
             return *this;
         }
 
@@ -679,7 +679,7 @@ namespace bsl
         {
             bool const err{builtin_mul_overflow(m_val, rhs, &m_val)};
 
-            m_error = m_error || err;
+            m_error = static_cast<bool>(m_error | err);
             return *this;
         }
 
@@ -811,7 +811,7 @@ namespace bsl
         {
             bool const err{builtin_add_overflow(m_val, one().get(), &m_val)};
 
-            m_error = m_error || err;
+            m_error = static_cast<bool>(m_error | err);
             return *this;
         }
 
@@ -831,7 +831,7 @@ namespace bsl
         {
             bool const err{builtin_sub_overflow(m_val, one().get(), &m_val)};
 
-            m_error = m_error || err;
+            m_error = static_cast<bool>(m_error | err);
             return *this;
         }
     };
@@ -0,0 +1,99 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+///
+/// @file shift_right.hpp
+///
+
+#ifndef BSL_SHIFT_RIGHT_HPP
+#define BSL_SHIFT_RIGHT_HPP
+
+#include "details/range_ops.hpp"
+#include "details/value_type_for.hpp"
+
+#include "convert.hpp"
+#include "debug.hpp"
+#include "is_constant_evaluated.hpp"
+#include "is_nothrow_move_assignable.hpp"
+#include "is_trivially_copyable.hpp"
+#include "move.hpp"
+#include "safe_integral.hpp"
+
+namespace bsl
+{
+    /// <!-- description -->
+    ///   @brief Shifts the elements of a view "n" positions towards the
+    ///     end of the view. The last "n" elements are overwritten, and the
+    ///     first "n" elements are left in a valid but unspecified (moved
+    ///     from) state. If the elements are trivially copyable, at
+    ///     run-time this is a single memmove. If "n" is invalid, nothing
+    ///     is shifted and safe_uintmax::zero(true) is returned.
+    ///   @include example_shift_right_overview.hpp
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @tparam VIEW the type of view to shift
+    ///   @param vw the view to shift
+    ///   @param n the number of positions to shift the elements by
+    ///   @return Returns the index of the first element that was shifted
+    ///     (i.e., "n"), or the size of the view if "n" is larger than or
+    ///     equal to the size of the view.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @throw throws if the move assignment of an element throws
+    ///
+    template<typename VIEW>
+    [[maybe_unused]] constexpr safe_uintmax
+    shift_right(VIEW &vw, safe_uintmax const &n) noexcept(    // --
+        is_nothrow_move_assignable<details::value_type_for<VIEW>>::value)
+    {
+        if (!n) {
+            bsl::error() << "shift_right: invalid n: " << n << '\n';
+            return safe_uintmax::zero(true);
+        }
+
+        if (n >= vw.size()) {
+            return vw.size();
+        }
+
+        if (n.is_zero()) {
+            return n;
+        }
+
+        safe_uintmax const count{vw.size() - n};
+        if constexpr (is_trivially_copyable<details::value_type_for<VIEW>>::value) {
+            if (!is_constant_evaluated()) {
+                details::range_move(vw.at_if(n), vw.data(), count.get());
+                return n;
+            }
+        }
+
+        for (safe_uintmax i{count}; i.is_pos(); --i) {
+            safe_uintmax const src{i - safe_uintmax::one()};
+            *vw.at_if(src + n) = bsl::move(*vw.at_if(src));
+        }
+
+        return n;
+    }
+}
+
+#endif
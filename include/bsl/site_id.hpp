@@ -0,0 +1,224 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+///
+/// @file site_id.hpp
+///
+
+#ifndef BSL_SITE_ID_HPP
+#define BSL_SITE_ID_HPP
+
+#include "cstdint.hpp"
+#include "cstr_type.hpp"
+#include "debug.hpp"
+
+namespace bsl
+{
+    namespace details
+    {
+        /// <!-- description -->
+        ///   @brief Returns the 32bit FNV-1a hash of the provided file name
+        ///     and line. 0 is reserved to mean "no site" and 0xFFFFFFFF is
+        ///     reserved by bsl::site_table, so these hashes are returned as
+        ///     1 and 0xFFFFFFFE.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param file the file name to hash
+        ///   @param line the line to hash
+        ///   @return Returns the 32bit FNV-1a hash of file and line
+        ///
+        [[nodiscard]] constexpr bsl::uint32
+        site_hash(cstr_type const file, bsl::int32 const line) noexcept
+        {
+            constexpr bsl::uint32 basis{0x811C9DC5U};
+            constexpr bsl::uint32 prime{0x01000193U};
+            constexpr bsl::uint32 byte_mask{0xFFU};
+            constexpr bsl::uint32 byte_bits{8U};
+            constexpr bsl::uint32 line_bytes{4U};
+
+            bsl::uint32 h{basis};
+            if (nullptr != file) {
+                for (bsl::uintmax i{}; '\0' != file[i]; ++i) {                            // NOLINT
+                    h ^= static_cast<bsl::uint32>(static_cast<bsl::uint8>(file[i]));    // NOLINT
+                    h *= prime;
+                }
+            }
+
+            auto l{static_cast<bsl::uint32>(line)};
+            for (bsl::uint32 i{}; i < line_bytes; ++i) {
+                h ^= (l & byte_mask);
+                h *= prime;
+                l >>= byte_bits;
+            }
+
+            constexpr bsl::uint32 reserved{0xFFFFFFFFU};
+            if (0U == h) {
+                return 1U;
+            }
+
+            if (reserved == h) {
+                return reserved - 1U;
+            }
+
+            return h;
+        }
+    }
+
+    /// @class bsl::site_id
+    ///
+    /// <!-- description -->
+    ///   @brief A 32bit id that names a location in the source code (a
+    ///     "site"), used in place of a bsl::source_location where storing
+    ///     two pointers and a line is too much (e.g., bsl::error_trace).
+    ///     The id is a hash of the site's file name and line, so the same
+    ///     site always has the same id. current() is consteval, so the
+    ///     hash is always computed by the compiler. The file, function
+    ///     and line of an id are stored in a bsl::site_entry, and can be
+    ///     looked up using a bsl::site_table.
+    ///   @include example_error_trace_overview.hpp
+    ///
+    class site_id final
+    {
+        /// @brief stores the id
+        bsl::uint32 m_id{};
+
+    public:
+        /// <!-- description -->
+        ///   @brief Creates a bsl::site_id that does not name a site
+        ///   @include example_error_trace_overview.hpp
+        ///
+        constexpr site_id() noexcept = default;
+
+        /// <!-- description -->
+        ///   @brief Creates a bsl::site_id given the value of an id
+        ///   @include example_error_trace_overview.hpp
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param id the value of the id
+        ///
+        explicit constexpr site_id(bsl::uint32 const id) noexcept : m_id{id}
+        {}
+
+        /// <!-- description -->
+        ///   @brief Returns the bsl::site_id of the site that called this
+        ///     function. This function is consteval, so the arguments
+        ///     must be constants.
+        ///   @include example_error_trace_overview.hpp
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param file defaults to the file name of the caller
+        ///   @param line defaults to the line of the caller
+        ///   @return Returns the bsl::site_id of the caller
+        ///
+        [[nodiscard]] static BSL_CONSTEVAL site_id
+        current(
+            cstr_type const file = __builtin_FILE(),
+            bsl::int32 const line = __builtin_LINE()) noexcept
+        {
+            return site_id{details::site_hash(file, line)};
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns the value of the id
+        ///   @include example_error_trace_overview.hpp
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Returns the value of the id
+        ///
+        [[nodiscard]] constexpr bsl::uint32
+        get() const noexcept
+        {
+            return m_id;
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns true if the bsl::site_id names a site
+        ///   @include example_error_trace_overview.hpp
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Returns true if the bsl::site_id names a site
+        ///
+        [[nodiscard]] constexpr bool
+        valid() const noexcept
+        {
+            return 0U != m_id;
+        }
+    };
+
+    /// <!-- description -->
+    ///   @brief Returns lhs.get() == rhs.get()
+    ///   @include example_error_trace_overview.hpp
+    ///   @related bsl::site_id
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param lhs the left hand side of the operator
+    ///   @param rhs the right hand side of the operator
+    ///   @return Returns lhs.get() == rhs.get()
+    ///
+    [[nodiscard]] constexpr bool
+    operator==(site_id const &lhs, site_id const &rhs) noexcept
+    {
+        return lhs.get() == rhs.get();
+    }
+
+    /// <!-- description -->
+    ///   @brief Returns !(lhs == rhs)
+    ///   @include example_error_trace_overview.hpp
+    ///   @related bsl::site_id
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param lhs the left hand side of the operator
+    ///   @param rhs the right hand side of the operator
+    ///   @return Returns !(lhs == rhs)
+    ///
+    [[nodiscard]] constexpr bool
+    operator!=(site_id const &lhs, site_id const &rhs) noexcept
+    {
+        return !(lhs == rhs);
+    }
+
+    /// <!-- description -->
+    ///   @brief Outputs the provided bsl::site_id to the provided
+    ///     output type in hex.
+    ///   @related bsl::site_id
+    ///   @include example_error_trace_overview.hpp
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @tparam T the type of outputter provided
+    ///   @param o the instance of the outputter used to output the value.
+    ///   @param id the bsl::site_id to output
+    ///   @return return o
+    ///
+    template<typename T>
+    [[maybe_unused]] constexpr out<T>
+    operator<<(out<T> const o, site_id const &id) noexcept
+    {
+        if constexpr (!o) {
+            return o;
+        }
+
+        return o << fmt{"#010x", id.get()};
+    }
+}
+
+#endif
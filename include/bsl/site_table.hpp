@@ -0,0 +1,341 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+///
+/// @file site_table.hpp
+///
+
+#ifndef BSL_SITE_TABLE_HPP
+#define BSL_SITE_TABLE_HPP
+
+#include "cstdint.hpp"
+#include "cstr_type.hpp"
+#include "debug.hpp"
+#include "site_id.hpp"
+
+namespace bsl
+{
+    /// @brief the max number of sites a bsl::site_table can store
+    constexpr bsl::uintmax site_table_size{512U};
+
+    /// @class bsl::site_entry
+    ///
+    /// <!-- description -->
+    ///   @brief Stores the bsl::site_id of a site, along with the file,
+    ///     function and line that it names. A bsl::site_entry can only be
+    ///     created by the compiler (its constructor is consteval), so the
+    ///     id is never computed at run time and the entry is a constant
+    ///     whose strings are the compiler's own file and function names.
+    ///     To capture the caller of a function, add a
+    ///     "site_entry const &site = {}" parameter.
+    ///   @include example_error_trace_overview.hpp
+    ///
+    class site_entry final
+    {
+        /// @brief stores the id of the site
+        site_id m_id{};
+        /// @brief stores the file name of the site
+        cstr_type m_file{};
+        /// @brief stores the function name of the site
+        cstr_type m_func{};
+        /// @brief stores the line of the site
+        bsl::int32 m_line{};
+
+    public:
+        /// <!-- description -->
+        ///   @brief Creates a bsl::site_entry given a file, function and
+        ///     line, which default to the site that created the
+        ///     bsl::site_entry. The site's id is computed from file and
+        ///     line by the compiler.
+        ///   @include example_error_trace_overview.hpp
+        ///
+        ///   SUPPRESSION: PRQA 2180 - exception required
+        ///   - We suppress this because A12-1-4 states that all constructors
+        ///     that are callable from a fundamental type should be marked as
+        ///     explicit. This constructor is also the default constructor,
+        ///     and it must not be explicit so that "= {}" can be used as a
+        ///     default argument, which is what captures the caller's site.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param file defaults to the file name of the caller
+        ///   @param func defaults to the function name of the caller
+        ///   @param line defaults to the line of the caller
+        ///
+        BSL_CONSTEVAL site_entry(    // PRQA S 2180 // NOLINT
+            cstr_type const file = __builtin_FILE(),
+            cstr_type const func = __builtin_FUNCTION(),
+            bsl::int32 const line = __builtin_LINE()) noexcept
+            : m_id{site_id::current(file, line)}, m_file{file}, m_func{func}, m_line{line}
+        {}
+
+        /// <!-- description -->
+        ///   @brief Returns the bsl::site_entry of the site that called this
+        ///     function.
+        ///   @include example_error_trace_overview.hpp
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param file defaults to the file name of the caller
+        ///   @param func defaults to the function name of the caller
+        ///   @param line defaults to the line of the caller
+        ///   @return Returns the bsl::site_entry of the caller
+        ///
+        [[nodiscard]] static BSL_CONSTEVAL site_entry
+        current(
+            cstr_type const file = __builtin_FILE(),
+            cstr_type const func = __builtin_FUNCTION(),
+            bsl::int32 const line = __builtin_LINE()) noexcept
+        {
+            return {file, func, line};
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns the id of the site
+        ///   @include example_error_trace_overview.hpp
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Returns the id of the site
+        ///
+        [[nodiscard]] constexpr site_id
+        id() const noexcept
+        {
+            return m_id;
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns the file name of the site
+        ///   @include example_error_trace_overview.hpp
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Returns the file name of the site
+        ///
+        [[nodiscard]] constexpr cstr_type
+        file_name() const noexcept
+        {
+            return m_file;
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns the function name of the site
+        ///   @include example_error_trace_overview.hpp
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Returns the function name of the site
+        ///
+        [[nodiscard]] constexpr cstr_type
+        function_name() const noexcept
+        {
+            return m_func;
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns the line of the site
+        ///   @include example_error_trace_overview.hpp
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Returns the line of the site
+        ///
+        [[nodiscard]] constexpr bsl::int32
+        line() const noexcept
+        {
+            return m_line;
+        }
+    };
+
+    /// @class bsl::site_table
+    ///
+    /// <!-- description -->
+    ///   @brief Maps each bsl::site_id to the file, function and line it
+    ///     names, for code that stores or sends bare ids (bsl::error_trace
+    ///     does not need it, as it keeps each error's bsl::site_entry).
+    ///     Adding a site costs a hash probe and is lock-free, so the table
+    ///     can be filled from any thread. The table is fixed in size, so once it is full, new
+    ///     sites are not added (their ids are still valid, but cannot be
+    ///     looked up). A site that is still being added by another thread
+    ///     is not found until its location has been written. The global
+    ///     table (see sites()) is placed in its own "bsl_sites" linker
+    ///     section, so it can be found in a memory image or core dump
+    ///     without symbols.
+    ///   @include example_error_trace_overview.hpp
+    ///
+    class site_table final
+    {
+        /// @brief the number of buckets in the table
+        static constexpr bsl::uint32 num_buckets{static_cast<bsl::uint32>(site_table_size)};
+        /// @brief used to turn a hash into a bucket
+        static constexpr bsl::uint32 bucket_mask{num_buckets - 1U};
+
+        /// @brief marks a bucket that is claimed but not yet written
+        static constexpr bsl::uint32 busy{0xFFFFFFFFU};
+
+        static_assert(0U == (site_table_size & (site_table_size - 1U)));
+
+        /// @class bsl::site_table::bucket_type
+        ///
+        /// <!-- description -->
+        ///   @brief Stores a bucket in the table.
+        ///
+        class bucket_type final
+        {
+        public:
+            /// @brief stores the id of the site, 0 if the bucket is empty,
+            ///   or busy if the site is being written
+            _Atomic bsl::uint32 m_id;
+            /// @brief stores the site's location
+            site_entry m_entry;
+        };
+
+        /// @brief stores the buckets (bsl::array depends on bsl::result,
+        ///   which uses this table, so a plain array is used instead)
+        bucket_type m_buckets[site_table_size]{};    // NOLINT
+
+    public:
+        /// <!-- description -->
+        ///   @brief Adds the provided site to the table if it is not
+        ///     already in the table.
+        ///   @include example_error_trace_overview.hpp
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param entry the site to add
+        ///   @return Returns true if the site is in the table, false if
+        ///     the table is full.
+        ///
+        [[maybe_unused]] bool
+        add(site_entry const &entry) noexcept
+        {
+            bsl::uint32 const id{entry.id().get()};
+            for (bsl::uint32 i{}; i < num_buckets; ++i) {
+                bsl::uint32 const bucket{(id + i) & bucket_mask};
+                bucket_type *const b{&m_buckets[bucket]};    // NOLINT
+
+                bsl::uint32 cur{__c11_atomic_load(&b->m_id, __ATOMIC_ACQUIRE)};
+                if (0U == cur) {
+                    /// NOTE:
+                    /// - The bucket is claimed with a compare and swap that
+                    ///   marks it busy. The site's id is only published
+                    ///   (with a release) once its location is written, so
+                    ///   find() never returns a location that is still
+                    ///   being written. If another thread claims the
+                    ///   bucket first, its result is checked below, the
+                    ///   same as if the bucket had already been full. A
+                    ///   busy bucket is skipped instead of waited on, so
+                    ///   if two threads add the same new site at the same
+                    ///   time, it might be stored twice, which is harmless.
+                    ///
+
+                    if (__c11_atomic_compare_exchange_strong(
+                            &b->m_id, &cur, busy, __ATOMIC_ACQUIRE, __ATOMIC_ACQUIRE)) {
+                        b->m_entry = entry;
+                        __c11_atomic_store(&b->m_id, id, __ATOMIC_RELEASE);
+                        return true;
+                    }
+                }
+
+                if (cur == id) {
+                    return true;
+                }
+            }
+
+            return false;
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns the site in the table with the provided id,
+        ///     or a nullptr if the table does not have a site with the
+        ///     provided id.
+        ///   @include example_error_trace_overview.hpp
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param id the id of the site to find
+        ///   @return Returns the site with the provided id, or a nullptr
+        ///
+        [[nodiscard]] site_entry const *
+        find(site_id const &id) const noexcept
+        {
+            if (!id.valid()) {
+                return nullptr;
+            }
+
+            for (bsl::uint32 i{}; i < num_buckets; ++i) {
+                bsl::uint32 const bucket{(id.get() + i) & bucket_mask};
+                bucket_type const *const b{&m_buckets[bucket]};    // NOLINT
+
+                bsl::uint32 const cur{__c11_atomic_load(&b->m_id, __ATOMIC_ACQUIRE)};
+                if (0U == cur) {
+                    return nullptr;
+                }
+
+                /// NOTE:
+                /// - A busy bucket is still being written, so it is
+                ///   treated as not matching. busy is never a valid id.
+                ///
+
+                if ((cur == id.get()) && (busy != cur)) {
+                    return &b->m_entry;
+                }
+            }
+
+            return nullptr;
+        }
+    };
+
+    /// <!-- description -->
+    ///   @brief Returns the global bsl::site_table, which is stored in
+    ///     the "bsl_sites" linker section.
+    ///   @include example_error_trace_overview.hpp
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @return Returns the global bsl::site_table
+    ///
+    [[nodiscard]] inline site_table &
+    sites() noexcept
+    {
+        [[gnu::section("bsl_sites")]] static site_table s_sites{};
+        return s_sites;
+    }
+
+    /// <!-- description -->
+    ///   @brief Outputs the provided bsl::site_entry to the provided
+    ///     output type as "file:line (function)".
+    ///   @related bsl::site_entry
+    ///   @include example_error_trace_overview.hpp
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @tparam T the type of outputter provided
+    ///   @param o the instance of the outputter used to output the value.
+    ///   @param entry the bsl::site_entry to output
+    ///   @return return o
+    ///
+    template<typename T>
+    [[maybe_unused]] constexpr out<T>
+    operator<<(out<T> const o, site_entry const &entry) noexcept
+    {
+        if constexpr (!o) {
+            return o;
+        }
+
+        return o << entry.file_name() << ':' << entry.line() << " (" << entry.function_name()
+                 << ')';
+    }
+}
+
+#endif
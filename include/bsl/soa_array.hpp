@@ -0,0 +1,339 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+///
+/// @file soa_array.hpp
+///
+
+#ifndef BSL_SOA_ARRAY_HPP
+#define BSL_SOA_ARRAY_HPP
+
+#include "details/soa_array_columns.hpp"
+
+#include "convert.hpp"
+#include "cstdint.hpp"
+#include "forward.hpp"
+#include "invoke.hpp"
+#include "invoke_result.hpp"
+#include "is_bool.hpp"
+#include "is_invocable.hpp"
+#include "is_nothrow_invocable.hpp"
+#include "safe_integral.hpp"
+#include "soa_reference.hpp"
+#include "span.hpp"
+
+namespace bsl
+{
+    /// @class bsl::soa_array
+    ///
+    /// <!-- description -->
+    ///   @brief A bsl::soa_array is a fixed size array of N elements, each
+    ///     with one field per type in TS, that is stored as a structure of
+    ///     arrays instead of an array of structures: every field (column)
+    ///     is stored in its own contiguous, cache line aligned array. A
+    ///     loop that only touches one or two fields therefore only loads
+    ///     the cache lines of those fields. Columns are accessed using
+    ///     column<I>(), which returns a span that can be handed to a
+    ///     vectorized kernel, individual fields using at_if<I>(), whole
+    ///     elements using element(), which returns a proxy, and selected
+    ///     columns can be visited using bsl::for_each<I...>().
+    ///   @include example_soa_array_overview.hpp
+    ///
+    /// <!-- template parameters -->
+    ///   @tparam N the number of elements in the array. Cannot be 0
+    ///   @tparam TS the type of each field (column). Cannot be empty
+    ///
+    template<bsl::uintmax N, typename... TS>
+    class soa_array final
+    {
+        static_assert(N != 0, "soa_arrays of size 0 are not supported");
+        static_assert(sizeof...(TS) != 0, "soa_arrays with no columns are not supported");
+
+        /// @brief stores the columns
+        details::soa_columns<N, TS...> m_columns{};
+
+    public:
+        /// @brief alias for: the type of column I
+        template<bsl::uintmax I>
+        using column_type = typename details::soa_element_type<I, TS...>::type;
+        /// @brief alias for: safe_uintmax
+        using size_type = safe_uintmax;
+        /// @brief alias for: soa_reference<soa_array>
+        using reference_type = soa_reference<soa_array>;
+        /// @brief alias for: soa_reference<soa_array const>
+        using const_reference_type = soa_reference<soa_array const>;
+
+        /// <!-- description -->
+        ///   @brief Returns a span of column I
+        ///   @include example_soa_array_overview.hpp
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @tparam I the index of the column to return
+        ///   @return Returns a span of column I
+        ///
+        template<bsl::uintmax I>
+        [[nodiscard]] constexpr auto
+        column() noexcept -> span<column_type<I>, N>
+        {
+            return span<column_type<I>, N>{m_columns.template get<I>().data()};
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns a span of column I
+        ///   @include example_soa_array_overview.hpp
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @tparam I the index of the column to return
+        ///   @return Returns a span of column I
+        ///
+        template<bsl::uintmax I>
+        [[nodiscard]] constexpr auto
+        column() const noexcept -> span<column_type<I> const, N>
+        {
+            return span<column_type<I> const, N>{m_columns.template get<I>().data()};
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns a pointer to field I of the element at index
+        ///     "index". If the index is out of bounds, this function
+        ///     returns a nullptr.
+        ///   @include example_soa_array_overview.hpp
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @tparam I the index of the field (column) to return
+        ///   @param index the index of the element
+        ///   @return Returns a pointer to field I of the element at index
+        ///     "index". If the index is out of bounds, this function
+        ///     returns a nullptr.
+        ///
+        template<bsl::uintmax I>
+        [[nodiscard]] constexpr auto
+        at_if(size_type const &index) noexcept -> column_type<I> *
+        {
+            return m_columns.template get<I>().at_if(index);
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns a pointer to field I of the element at index
+        ///     "index". If the index is out of bounds, this function
+        ///     returns a nullptr.
+        ///   @include example_soa_array_overview.hpp
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @tparam I the index of the field (column) to return
+        ///   @param index the index of the element
+        ///   @return Returns a pointer to field I of the element at index
+        ///     "index". If the index is out of bounds, this function
+        ///     returns a nullptr.
+        ///
+        template<bsl::uintmax I>
+        [[nodiscard]] constexpr auto
+        at_if(size_type const &index) const noexcept -> column_type<I> const *
+        {
+            return m_columns.template get<I>().at_if(index);
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns a proxy to the element at index "index". If
+        ///     the index is out of bounds, the proxy is invalid.
+        ///   @include example_soa_array_overview.hpp
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param index the index of the element
+        ///   @return Returns a proxy to the element at index "index"
+        ///
+        [[nodiscard]] constexpr reference_type
+        element(size_type const &index) noexcept
+        {
+            return reference_type{*this, index};
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns a proxy to the element at index "index". If
+        ///     the index is out of bounds, the proxy is invalid.
+        ///   @include example_soa_array_overview.hpp
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param index the index of the element
+        ///   @return Returns a proxy to the element at index "index"
+        ///
+        [[nodiscard]] constexpr const_reference_type
+        element(size_type const &index) const noexcept
+        {
+            return const_reference_type{*this, index};
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns the number of elements in the array
+        ///   @include example_soa_array_overview.hpp
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Returns the number of elements in the array
+        ///
+        [[nodiscard]] static constexpr size_type
+        size() noexcept
+        {
+            return to_umax(N);
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns the number of fields (columns) in each element
+        ///   @include example_soa_array_overview.hpp
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Returns the number of fields (columns) in each element
+        ///
+        [[nodiscard]] static constexpr size_type
+        columns() noexcept
+        {
+            return to_umax(sizeof...(TS));
+        }
+    };
+
+    namespace details
+    {
+        /// <!-- description -->
+        ///   @brief Implements bsl::for_each for a bsl::soa_array, for both
+        ///     const and non-const soa_arrays.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @tparam I the indexes of the columns to visit
+        ///   @tparam SOA the type of bsl::soa_array (possibly const)
+        ///   @tparam FUNC the type of function to execute
+        ///   @param soa the soa_array to iterate over
+        ///   @param f the function to execute on each element
+        ///
+        template<bsl::uintmax... I, typename SOA, typename FUNC>
+        constexpr void
+        soa_for_each(SOA &soa, FUNC &&f) noexcept(    // --
+            is_nothrow_invocable<FUNC, decltype(*soa.template at_if<I>(to_umax(0)))...>::value ||
+            is_nothrow_invocable<
+                FUNC,
+                decltype(*soa.template at_if<I>(to_umax(0)))...,
+                safe_uintmax const &>::value)
+        {
+            constexpr bool eo{
+                is_invocable<FUNC, decltype(*soa.template at_if<I>(to_umax(0)))...>::value};
+            constexpr bool ei{is_invocable<
+                FUNC,
+                decltype(*soa.template at_if<I>(to_umax(0)))...,
+                safe_uintmax const &>::value};
+            static_assert(eo || ei, "the function you provided to bsl::for_each is invalid");
+
+            for (safe_uintmax i{}; i < SOA::size(); ++i) {
+                if constexpr (eo) {
+                    using ret_type =
+                        invoke_result_t<FUNC, decltype(*soa.template at_if<I>(to_umax(0)))...>;
+                    if constexpr (is_bool<ret_type>::value) {
+                        if (!invoke(
+                                bsl::forward<FUNC>(f),
+                                soa.template column<I>().data()[i.get()]...)) {    // NOLINT
+                            break;
+                        }
+                    }
+                    else {
+                        invoke(
+                            bsl::forward<FUNC>(f),
+                            soa.template column<I>().data()[i.get()]...);    // NOLINT
+                    }
+                }
+                else {
+                    using ret_type = invoke_result_t<
+                        FUNC,
+                        decltype(*soa.template at_if<I>(to_umax(0)))...,
+                        safe_uintmax const &>;
+                    if constexpr (is_bool<ret_type>::value) {
+                        if (!invoke(
+                                bsl::forward<FUNC>(f),
+                                soa.template column<I>().data()[i.get()]...,    // NOLINT
+                                i)) {
+                            break;
+                        }
+                    }
+                    else {
+                        invoke(
+                            bsl::forward<FUNC>(f),
+                            soa.template column<I>().data()[i.get()]...,    // NOLINT
+                            i);
+                    }
+                }
+            }
+        }
+    }
+
+    /// <!-- description -->
+    ///   @brief Executes "f" on every element of "soa", passing only the
+    ///     fields of the columns listed in I (in the order listed). For
+    ///     example, bsl::for_each<0, 2>(soa, f) calls f(col0, col2) for
+    ///     each element, and only ever loads columns 0 and 2. "f" may also
+    ///     take the index of the element as its last argument. Like the
+    ///     rest of the bsl::for_each overloads, "f" may return
+    ///     bsl::for_each_break to break from the loop.
+    ///   @include example_soa_array_overview.hpp
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @tparam I the indexes of the columns to visit
+    ///   @tparam N the number of elements in the array
+    ///   @tparam TS the type of each field (column)
+    ///   @tparam FUNC the type of function to execute
+    ///   @param soa the soa_array to iterate over
+    ///   @param f the function to execute on each element
+    ///
+    template<bsl::uintmax... I, bsl::uintmax N, typename... TS, typename FUNC>
+    constexpr void
+    for_each(soa_array<N, TS...> &soa, FUNC &&f) noexcept(    // --
+        noexcept(details::soa_for_each<I...>(soa, bsl::forward<FUNC>(f))))
+    {
+        static_assert(sizeof...(I) != 0, "the columns to visit must be provided");
+        details::soa_for_each<I...>(soa, bsl::forward<FUNC>(f));
+    }
+
+    /// <!-- description -->
+    ///   @brief Executes "f" on every element of "soa", passing only the
+    ///     fields of the columns listed in I (in the order listed). For
+    ///     example, bsl::for_each<0, 2>(soa, f) calls f(col0, col2) for
+    ///     each element, and only ever loads columns 0 and 2. "f" may also
+    ///     take the index of the element as its last argument. Like the
+    ///     rest of the bsl::for_each overloads, "f" may return
+    ///     bsl::for_each_break to break from the loop.
+    ///   @include example_soa_array_overview.hpp
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @tparam I the indexes of the columns to visit
+    ///   @tparam N the number of elements in the array
+    ///   @tparam TS the type of each field (column)
+    ///   @tparam FUNC the type of function to execute
+    ///   @param soa the soa_array to iterate over
+    ///   @param f the function to execute on each element
+    ///
+    template<bsl::uintmax... I, bsl::uintmax N, typename... TS, typename FUNC>
+    constexpr void
+    for_each(soa_array<N, TS...> const &soa, FUNC &&f) noexcept(    // --
+        noexcept(details::soa_for_each<I...>(soa, bsl::forward<FUNC>(f))))
+    {
+        static_assert(sizeof...(I) != 0, "the columns to visit must be provided");
+        details::soa_for_each<I...>(soa, bsl::forward<FUNC>(f));
+    }
+}
+
+#endif
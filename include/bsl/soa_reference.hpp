@@ -0,0 +1,117 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+///
+/// @file soa_reference.hpp
+///
+
+#ifndef BSL_SOA_REFERENCE_HPP
+#define BSL_SOA_REFERENCE_HPP
+
+#include "cstdint.hpp"
+#include "safe_integral.hpp"
+
+namespace bsl
+{
+    /// @class bsl::soa_reference
+    ///
+    /// <!-- description -->
+    ///   @brief A bsl::soa_reference is the proxy returned by
+    ///     bsl::soa_array::element(). Since the fields of an element in a
+    ///     bsl::soa_array are stored in different columns, there is no
+    ///     single object to return a reference to. Instead, this proxy
+    ///     stores the soa_array and the index of the element, and get_if()
+    ///     returns a pointer to one of its fields. If the index is out of
+    ///     bounds, the proxy is invalid and get_if() returns a nullptr.
+    ///   @include example_soa_array_overview.hpp
+    ///
+    /// <!-- template parameters -->
+    ///   @tparam SOA the type of bsl::soa_array (possibly const)
+    ///
+    template<typename SOA>
+    class soa_reference final
+    {
+    public:
+        /// <!-- description -->
+        ///   @brief Creates a proxy to element "index" of "soa".
+        ///   @include example_soa_array_overview.hpp
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param soa the soa_array that stores the element
+        ///   @param index the index of the element
+        ///
+        constexpr soa_reference(SOA &soa, safe_uintmax const &index) noexcept
+            : m_soa{&soa}, m_index{index}
+        {}
+
+        /// <!-- description -->
+        ///   @brief Returns a pointer to field I of the element, or a
+        ///     nullptr if the proxy is invalid.
+        ///   @include example_soa_array_overview.hpp
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @tparam I the index of the field (column) to return
+        ///   @return Returns a pointer to field I of the element, or a
+        ///     nullptr if the proxy is invalid.
+        ///
+        template<bsl::uintmax I>
+        [[nodiscard]] constexpr auto
+        get_if() const noexcept
+        {
+            return m_soa->template at_if<I>(m_index);
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns the index of the element
+        ///   @include example_soa_array_overview.hpp
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Returns the index of the element
+        ///
+        [[nodiscard]] constexpr safe_uintmax const &
+        index() const noexcept
+        {
+            return m_index;
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns true if the index of the element is in bounds
+        ///   @include example_soa_array_overview.hpp
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Returns true if the index of the element is in bounds
+        ///
+        [[nodiscard]] constexpr explicit operator bool() const noexcept
+        {
+            return (!!m_index) && (m_index < SOA::size());
+        }
+
+    private:
+        /// @brief stores a pointer to the soa_array that stores the element
+        SOA *m_soa;
+        /// @brief stores the index of the element
+        safe_uintmax m_index;
+    };
+}
+
+#endif
@@ -33,7 +33,9 @@
 #include "contiguous_iterator.hpp"
 #include "convert.hpp"
 #include "debug.hpp"
+#include "dynamic_extent.hpp"
 #include "is_same.hpp"
+#include "is_trivially_copyable.hpp"
 #include "npos.hpp"
 #include "reverse_iterator.hpp"
 #include "safe_integral.hpp"
@@ -72,22 +74,37 @@ namespace bsl
     ///     - We do not provide any of the as_byte helper functions as they
     ///       would all require a reinterpret_cast which is not allowed
     ///       by AUTOSAR.
-    ///     - A bsl::span is always a dynamic_extent type. The reason the
-    ///       dynamic_extent type exists in a std::span is to optimize away
-    ///       the need to store the size of the array the span is viewing.
-    ///       This is only useful for C-style arrays which are not supported
-    ///       as they are not compliant with AUTOSAR. If you need a C-style
-    ///       array, use a bsl::array, in which case you have no need for a
-    ///       bsl::span. Instead, a bsl::span is useful when you have an
-    ///       array in memory that is not in your control (for example, a
-    ///       device's memory).
+    ///     - By default, a bsl::span is a dynamic_extent type, which
+    ///       stores the number of elements it views and checks every
+    ///       access against it. When the number of elements is known at
+    ///       compile time (for example, a page), use bsl::span<T, N>
+    ///       instead, which only stores a pointer. Unlike a std::span, a
+    ///       static extent span is only constructed from a pointer (or
+    ///       from a dynamic span of the same size) as C-style arrays are
+    ///       not compliant with AUTOSAR.
+    ///   @include example_span_overview.hpp
+    ///
+    /// <!-- template parameters -->
+    ///   @tparam T the type of element being viewed.
+    ///   @tparam N the number of elements being viewed, or
+    ///     bsl::dynamic_extent if the number of elements is only known
+    ///     at runtime.
+    ///
+    template<typename T, bsl::uintmax N = dynamic_extent>
+    class span;
+
+    /// @class bsl::span<T, bsl::dynamic_extent>
+    ///
+    /// <!-- description -->
+    ///   @brief A bsl::span whose size is only known at runtime. See
+    ///     bsl::span for more details.
     ///   @include example_span_overview.hpp
     ///
     /// <!-- template parameters -->
     ///   @tparam T the type of element being viewed.
     ///
     template<typename T>
-    class span final    // NOLINT
+    class span<T, dynamic_extent> final    // NOLINT
     {
         static_assert(!is_same<T, char_type>::value, "use bsl::string_view instead");
 
@@ -773,6 +790,492 @@ namespace bsl
         size_type m_count;
     };
 
+    /// @brief deduces a dynamic extent span from a pointer and a count
+    template<typename T>
+    span(T *, safe_uintmax const &) -> span<T>;
+
+    /// @class bsl::span
+    ///
+    /// <!-- description -->
+    ///   @brief A bsl::span whose size is the compile-time constant N. The
+    ///     span only stores a pointer (it is the size of a pointer), and
+    ///     because the bounds are a constant, an index check against a
+    ///     constant index folds away at compile time. A static extent span
+    ///     converts implicitly to a dynamic extent span, so it can be
+    ///     passed to any function that takes a bsl::span<T>, and can be
+    ///     created from a dynamic extent span whose size is N. Like the
+    ///     dynamic extent span, a default constructed span is invalid,
+    ///     and all of its accessors return a nullptr.
+    ///   @include span/example_span_static_extent.hpp
+    ///
+    /// <!-- template parameters -->
+    ///   @tparam T the type of element being viewed.
+    ///   @tparam N the number of elements being viewed.
+    ///
+    template<typename T, bsl::uintmax N>
+    class span final    // NOLINT
+    {
+        static_assert(!is_same<T, char_type>::value, "use bsl::string_view instead");
+        static_assert(N != 0, "spans of size 0 are not supported");
+
+    public:
+        /// @brief alias for: T
+        using value_type = T;
+        /// @brief alias for: safe_uintmax
+        using size_type = safe_uintmax;
+        /// @brief alias for: safe_uintmax
+        using difference_type = safe_uintmax;
+        /// @brief alias for: T &
+        using reference_type = T &;
+        /// @brief alias for: T &
+        using const_reference_type = T const &;
+        /// @brief alias for: T *
+        using pointer_type = T *;
+        /// @brief alias for: T const *
+        using const_pointer_type = T const *;
+        /// @brief alias for: contiguous_iterator<T>
+        using iterator_type = contiguous_iterator<T>;
+        /// @brief alias for: contiguous_iterator<T const>
+        using const_iterator_type = contiguous_iterator<T const>;
+
+        /// @brief stores the number of elements in the span
+        static constexpr bsl::uintmax extent{N};
+
+        /// <!-- description -->
+        ///   @brief Default constructor that creates a span with
+        ///     data() == nullptr and size() == 0. All accessors
+        ///     will return a nullptr if used.
+        ///   @include span/example_span_static_extent.hpp
+        ///
+        constexpr span() noexcept = default;
+
+        /// <!-- description -->
+        ///   @brief Creates a span given a pointer to an array of N
+        ///     elements. Note that the array must be contiguous in memory
+        ///     and [ptr, ptr + N) must be a valid range.
+        ///   @include span/example_span_static_extent.hpp
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param ptr a pointer to the array being spaned.
+        ///
+        explicit constexpr span(pointer_type const ptr) noexcept    // --
+            : m_ptr{ptr}
+        {
+            if (nullptr == m_ptr) {
+                bsl::alert() << "span: invalid constructor args\n";
+                bsl::alert() << "  - ptr: " << static_cast<void const *>(ptr) << bsl::endl;
+            }
+        }
+
+        /// <!-- description -->
+        ///   @brief Creates a span from a dynamic extent span, which must
+        ///     view exactly N elements. If it does not, an invalid span is
+        ///     created.
+        ///   @include span/example_span_static_extent.hpp
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param spn the dynamic extent span to create the span from
+        ///
+        explicit constexpr span(span<T> spn) noexcept    // --
+            : m_ptr{}
+        {
+            if (spn.size() != to_umax(N)) {
+                bsl::alert() << "span: invalid constructor args\n";
+                bsl::alert() << "  - size: " << spn.size() << bsl::endl;
+                return;
+            }
+
+            m_ptr = spn.data();
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns a dynamic extent span of the same elements.
+        ///     This conversion is implicit, so a static extent span can
+        ///     be passed to any function that takes a bsl::span<T>.
+        ///   @include span/example_span_static_extent.hpp
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Returns a dynamic extent span of the same elements.
+        ///
+        [[nodiscard]] constexpr operator span<T>() const noexcept    // PRQA S 2180 // NOLINT
+        {
+            if (nullptr == m_ptr) {
+                return {};
+            }
+
+            return span<T>{m_ptr, to_umax(N)};
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns a pointer to the instance of T stored at index
+        ///     "index". If the index is out of bounds, or the view is invalid,
+        ///     this function returns a nullptr.
+        ///   @include span/example_span_static_extent.hpp
+        ///
+        ///   SUPPRESSION: PRQA 4024 - false positive
+        ///   - We suppress this because A9-3-1 states that we should
+        ///     not provide a non-const reference or pointer to private
+        ///     member function, unless the class mimics a smart pointer or
+        ///     a containter. This class mimics a container.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param index the index of the instance to return
+        ///   @return Returns a pointer to the instance of T stored at index
+        ///     "index". If the index is out of bounds, or the view is invalid,
+        ///     this function returns a nullptr.
+        ///
+        [[nodiscard]] constexpr pointer_type
+        at_if(size_type const &index) noexcept
+        {
+            if ((!index) || (index.get() >= N) || (nullptr == m_ptr)) {
+                bsl::error() << "span: index out of range: " << index << '\n';
+                return nullptr;
+            }
+
+            return &m_ptr[index.get()];    // PRQA S 4024 // NOLINT
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns a pointer to the instance of T stored at index
+        ///     "index". If the index is out of bounds, or the view is invalid,
+        ///     this function returns a nullptr.
+        ///   @include span/example_span_static_extent.hpp
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param index the index of the instance to return
+        ///   @return Returns a pointer to the instance of T stored at index
+        ///     "index". If the index is out of bounds, or the view is invalid,
+        ///     this function returns a nullptr.
+        ///
+        [[nodiscard]] constexpr const_pointer_type
+        at_if(size_type const &index) const noexcept
+        {
+            if ((!index) || (index.get() >= N) || (nullptr == m_ptr)) {
+                bsl::error() << "span: index out of range: " << index << '\n';
+                return nullptr;
+            }
+
+            return &m_ptr[index.get()];    // NOLINT
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns a pointer to the instance of T stored at index
+        ///     "0". If the view is invalid, this function returns a nullptr.
+        ///   @include span/example_span_static_extent.hpp
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Returns a pointer to the instance of T stored at index
+        ///     "0". If the view is invalid, this function returns a nullptr.
+        ///
+        [[nodiscard]] constexpr pointer_type
+        front_if() noexcept
+        {
+            return this->at_if(to_umax(0));
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns a pointer to the instance of T stored at index
+        ///     "0". If the view is invalid, this function returns a nullptr.
+        ///   @include span/example_span_static_extent.hpp
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Returns a pointer to the instance of T stored at index
+        ///     "0". If the view is invalid, this function returns a nullptr.
+        ///
+        [[nodiscard]] constexpr const_pointer_type
+        front_if() const noexcept
+        {
+            return this->at_if(to_umax(0));
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns a pointer to the instance of T stored at index
+        ///     "N - 1". If the view is invalid, this function returns a
+        ///     nullptr.
+        ///   @include span/example_span_static_extent.hpp
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Returns a pointer to the instance of T stored at index
+        ///     "N - 1". If the view is invalid, this function returns a
+        ///     nullptr.
+        ///
+        [[nodiscard]] constexpr pointer_type
+        back_if() noexcept
+        {
+            return this->at_if(to_umax(N - 1U));
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns a pointer to the instance of T stored at index
+        ///     "N - 1". If the view is invalid, this function returns a
+        ///     nullptr.
+        ///   @include span/example_span_static_extent.hpp
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Returns a pointer to the instance of T stored at index
+        ///     "N - 1". If the view is invalid, this function returns a
+        ///     nullptr.
+        ///
+        [[nodiscard]] constexpr const_pointer_type
+        back_if() const noexcept
+        {
+            return this->at_if(to_umax(N - 1U));
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns a pointer to the array being viewed. If this is
+        ///     a default constructed view, or the view was constructed in
+        ///     error, this will return a nullptr.
+        ///   @include span/example_span_static_extent.hpp
+        ///
+        ///   SUPPRESSION: PRQA 4625 - false positive
+        ///   - We suppress this because A9-3-1 states that we should
+        ///     not provide a non-const reference or pointer to private
+        ///     member function, unless the class mimics a smart pointer or
+        ///     a containter. This class mimics a container.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Returns a pointer to the array being viewed. If this is
+        ///     a default constructed view, or the view was constructed in
+        ///     error, this will return a nullptr.
+        ///
+        [[nodiscard]] constexpr pointer_type
+        data() noexcept
+        {
+            return m_ptr;    // PRQA S 4625
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns a pointer to the array being viewed. If this is
+        ///     a default constructed view, or the view was constructed in
+        ///     error, this will return a nullptr.
+        ///   @include span/example_span_static_extent.hpp
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Returns a pointer to the array being viewed. If this is
+        ///     a default constructed view, or the view was constructed in
+        ///     error, this will return a nullptr.
+        ///
+        [[nodiscard]] constexpr const_pointer_type
+        data() const noexcept
+        {
+            return m_ptr;
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns an iterator to the first element of the view.
+        ///   @include span/example_span_static_extent.hpp
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Returns an iterator to the first element of the view.
+        ///
+        [[nodiscard]] constexpr iterator_type
+        begin() noexcept
+        {
+            return iterator_type{m_ptr, this->size(), to_umax(0)};
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns an iterator to the first element of the view.
+        ///   @include span/example_span_static_extent.hpp
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Returns an iterator to the first element of the view.
+        ///
+        [[nodiscard]] constexpr const_iterator_type
+        begin() const noexcept
+        {
+            return const_iterator_type{m_ptr, this->size(), to_umax(0)};
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns an iterator to the first element of the view.
+        ///   @include span/example_span_static_extent.hpp
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Returns an iterator to the first element of the view.
+        ///
+        [[nodiscard]] constexpr const_iterator_type
+        cbegin() const noexcept
+        {
+            return const_iterator_type{m_ptr, this->size(), to_umax(0)};
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns an iterator to one past the last element of the
+        ///     view. If you attempt to access this iterator, a nullptr will
+        ///     always be returned.
+        ///   @include span/example_span_static_extent.hpp
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Returns an iterator to one past the last element of the
+        ///     view. If you attempt to access this iterator, a nullptr will
+        ///     always be returned.
+        ///
+        [[nodiscard]] constexpr iterator_type
+        end() noexcept
+        {
+            return iterator_type{m_ptr, this->size(), this->size()};
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns an iterator to one past the last element of the
+        ///     view. If you attempt to access this iterator, a nullptr will
+        ///     always be returned.
+        ///   @include span/example_span_static_extent.hpp
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Returns an iterator to one past the last element of the
+        ///     view. If you attempt to access this iterator, a nullptr will
+        ///     always be returned.
+        ///
+        [[nodiscard]] constexpr const_iterator_type
+        end() const noexcept
+        {
+            return const_iterator_type{m_ptr, this->size(), this->size()};
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns an iterator to one past the last element of the
+        ///     view. If you attempt to access this iterator, a nullptr will
+        ///     always be returned.
+        ///   @include span/example_span_static_extent.hpp
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Returns an iterator to one past the last element of the
+        ///     view. If you attempt to access this iterator, a nullptr will
+        ///     always be returned.
+        ///
+        [[nodiscard]] constexpr const_iterator_type
+        cend() const noexcept
+        {
+            return const_iterator_type{m_ptr, this->size(), this->size()};
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns size() == 0, which is only true if this is a
+        ///     default constructed view, or the view was constructed in
+        ///     error.
+        ///   @include span/example_span_static_extent.hpp
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Returns size() == 0
+        ///
+        [[nodiscard]] constexpr bool
+        empty() const noexcept
+        {
+            return nullptr == m_ptr;
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns !empty()
+        ///   @include span/example_span_static_extent.hpp
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Returns !empty()
+        ///
+        [[nodiscard]] constexpr explicit operator bool() const noexcept
+        {
+            return !this->empty();
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns N. If this is a default constructed view, or
+        ///     the view was constructed in error, this will return 0.
+        ///   @include span/example_span_static_extent.hpp
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Returns N. If this is a default constructed view, or
+        ///     the view was constructed in error, this will return 0.
+        ///
+        [[nodiscard]] constexpr size_type
+        size() const noexcept
+        {
+            if (nullptr == m_ptr) {
+                return to_umax(0);
+            }
+
+            return to_umax(N);
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns size() * sizeof(T)
+        ///   @include span/example_span_static_extent.hpp
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Returns size() * sizeof(T)
+        ///
+        [[nodiscard]] constexpr size_type
+        size_bytes() const noexcept
+        {
+            return this->size() * to_umax(sizeof(T));
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns a span of the first COUNT elements of this
+        ///     span. The bounds are checked at compile time.
+        ///   @include span/example_span_static_extent.hpp
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @tparam COUNT the number of elements of the new subspan
+        ///   @return Returns a span of the first COUNT elements of this
+        ///     span.
+        ///
+        template<bsl::uintmax COUNT>
+        [[nodiscard]] constexpr span<T, COUNT>
+        first() const noexcept
+        {
+            return this->template subspan<0U, COUNT>();
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns a span of the last COUNT elements of this span.
+        ///     The bounds are checked at compile time.
+        ///   @include span/example_span_static_extent.hpp
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @tparam COUNT the number of elements of the new subspan
+        ///   @return Returns a span of the last COUNT elements of this
+        ///     span.
+        ///
+        template<bsl::uintmax COUNT>
+        [[nodiscard]] constexpr span<T, COUNT>
+        last() const noexcept
+        {
+            static_assert(COUNT <= N, "COUNT is out of bounds");
+            return this->template subspan<N - COUNT, COUNT>();
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns a span of the COUNT elements of this span that
+        ///     start at OFFSET. The bounds are checked at compile time.
+        ///   @include span/example_span_static_extent.hpp
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @tparam OFFSET the starting position of the new span
+        ///   @tparam COUNT the number of elements of the new subspan
+        ///   @return Returns a span of the COUNT elements of this span that
+        ///     start at OFFSET.
+        ///
+        template<bsl::uintmax OFFSET, bsl::uintmax COUNT>
+        [[nodiscard]] constexpr span<T, COUNT>
+        subspan() const noexcept
+        {
+            static_assert(OFFSET < N, "OFFSET is out of bounds");
+            static_assert(COUNT <= (N - OFFSET), "COUNT is out of bounds");
+
+            if (nullptr == m_ptr) {
+                return {};
+            }
+
+            return span<T, COUNT>{&m_ptr[OFFSET]};    // NOLINT
+        }
+
+    private:
+        /// @brief stores a pointer to the array being viewed
+        pointer_type m_ptr;
+    };
+
     /// <!-- description -->
     ///   @brief Returns a span<byte const> given a pointer to an array
     ///     type and the total number of bytes
@@ -807,6 +1310,57 @@ namespace bsl
         return as_bytes(spn.data(), spn.size_bytes());
     }
 
+    /// <!-- description -->
+    ///   @brief Returns a span<byte const, N * sizeof(T)> given an existing
+    ///     span<T, N>
+    ///   @include span/example_span_static_extent.hpp
+    ///   @related bsl::span
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param spn the span<T, N> to convert into a span<byte const>
+    ///   @return Returns a span<byte const, N * sizeof(T)> given an existing
+    ///     span<T, N>
+    ///
+    template<typename T, bsl::uintmax N>
+    [[nodiscard]] constexpr span<byte const, N * sizeof(T)>
+    as_bytes(span<T, N> const spn) noexcept
+    {
+        return span<byte const, N * sizeof(T)>{static_cast<byte const *>(
+            static_cast<void const *>(spn.data()))};
+    }
+
+    /// <!-- description -->
+    ///   @brief Returns a span<T const> given a pointer to an array of T
+    ///     and the total number of bytes in the array. Any bytes that do
+    ///     not make up a complete T are not included in the span. This
+    ///     is used to view raw memory, like a file mapped with
+    ///     bsl::ifmap, as an array of T. T must be trivially copyable,
+    ///     and if ptr is not aligned for T, an empty span is returned.
+    ///   @include span/example_span_as_span.hpp
+    ///   @related bsl::span
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @tparam T the type of element to view the bytes as
+    ///   @param ptr a pointer to the array to create the span for
+    ///   @param bytes the total number of bytes in the array
+    ///   @return Returns a span<T const> given a pointer to an array
+    ///     of T and the total number of bytes in the array, or an empty
+    ///     span if ptr is not aligned for T
+    ///
+    template<typename T>
+    [[nodiscard]] span<T const>
+    as_span(void const *const ptr, safe_uintmax const &bytes) noexcept
+    {
+        static_assert(is_trivially_copyable<T>::value, "T must be trivially copyable");
+
+        if ((to_uptr(ptr) % to_uptr(alignof(T))).is_pos()) {
+            bsl::error() << "as_span: ptr is not properly aligned\n";
+            return {};
+        }
+
+        return {static_cast<T const *>(ptr), bytes / to_umax(sizeof(T))};
+    }
+
     /// <!-- description -->
     ///   @brief Returns a span<byte> given a pointer to an array
     ///     type and the total number of bytes
@@ -841,6 +1395,24 @@ namespace bsl
         return as_writable_bytes(spn.data(), spn.size_bytes());
     }
 
+    /// <!-- description -->
+    ///   @brief Returns a span<byte, N * sizeof(T)> given an existing
+    ///     span<T, N>
+    ///   @include span/example_span_static_extent.hpp
+    ///   @related bsl::span
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param spn the span<T, N> to convert into a span<byte>
+    ///   @return Returns a span<byte, N * sizeof(T)> given an existing
+    ///     span<T, N>
+    ///
+    template<typename T, bsl::uintmax N>
+    [[nodiscard]] constexpr span<byte, N * sizeof(T)>
+    as_writable_bytes(span<T, N> spn) noexcept
+    {
+        return span<byte, N * sizeof(T)>{static_cast<byte *>(static_cast<void *>(spn.data()))};
+    }
+
     /// <!-- description -->
     ///   @brief Returns true if two spans have the same size and contain
     ///     the same contents. Returns false otherwise.
@@ -0,0 +1,116 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+///
+/// @file stable_partition.hpp
+///
+
+#ifndef BSL_STABLE_PARTITION_HPP
+#define BSL_STABLE_PARTITION_HPP
+
+#include "details/compact_impl.hpp"
+#include "details/value_type_for.hpp"
+
+#include "convert.hpp"
+#include "debug.hpp"
+#include "errc_type.hpp"
+#include "is_nothrow_invocable.hpp"
+#include "is_nothrow_move_assignable.hpp"
+#include "is_same.hpp"
+#include "is_trivially_copyable.hpp"
+#include "move.hpp"
+#include "result.hpp"
+#include "safe_integral.hpp"
+#include "span.hpp"
+
+namespace bsl
+{
+    /// <!-- description -->
+    ///   @brief Reorders the elements of a view so that the elements for
+    ///     which "pred" returns true come before the elements for which
+    ///     "pred" returns false, keeping the order of the elements within
+    ///     each group. The elements of the second group are staged in
+    ///     "scratch", which must be at least as large as the view, and is
+    ///     left in a valid but unspecified state. If the elements are
+    ///     trivially copyable, the view is partitioned without branching
+    ///     on the result of "pred".
+    ///   @include example_stable_partition_overview.hpp
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @tparam VIEW the type of view to partition
+    ///   @tparam T the type of element being partitioned
+    ///   @tparam PRED the type of predicate to use
+    ///   @param vw the view to partition
+    ///   @param scratch the scratch space to use
+    ///   @param pred returns true if an element belongs to the first group
+    ///   @return Returns the number of elements in the first group (i.e.,
+    ///     the index of the first element of the second group), or
+    ///     bsl::errc_failure if scratch is too small.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @throw throws if the move assignment of an element throws
+    ///
+    template<typename VIEW, typename T, typename PRED>
+    [[nodiscard]] constexpr result<safe_uintmax>
+    stable_partition(VIEW &vw, span<T> scratch, PRED &&pred) noexcept(    // --
+        is_nothrow_move_assignable<T>::value)
+    {
+        static_assert(is_same<details::value_type_for<VIEW>, T>::value, "scratch type mismatch");
+        static_assert(is_nothrow_invocable<PRED, T const &>::value, "pred must be noexcept");
+
+        if (scratch.size() < vw.size()) {
+            bsl::error() << "stable_partition: scratch is too small\n";
+            return {errc_failure};
+        }
+
+        if constexpr (is_trivially_copyable<T>::value) {
+            return {to_umax(details::compact_stable_partition(
+                vw.data(), vw.size().get(), scratch.data(), pred))};
+        }
+        else {
+            safe_uintmax first{};
+            safe_uintmax second{};
+            for (safe_uintmax i{}; i < vw.size(); ++i) {
+                if (pred(*vw.at_if(i))) {
+                    if (first != i) {
+                        *vw.at_if(first) = bsl::move(*vw.at_if(i));
+                    }
+
+                    ++first;
+                }
+                else {
+                    *scratch.at_if(second) = bsl::move(*vw.at_if(i));
+                    ++second;
+                }
+            }
+
+            for (safe_uintmax i{}; i < second; ++i) {
+                *vw.at_if(first + i) = bsl::move(*scratch.at_if(i));
+            }
+
+            return {first};
+        }
+    }
+}
+
+#endif
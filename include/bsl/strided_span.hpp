@@ -0,0 +1,352 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+///
+/// @file strided_span.hpp
+///
+
+#ifndef BSL_STRIDED_SPAN_HPP
+#define BSL_STRIDED_SPAN_HPP
+
+#include "char_type.hpp"
+#include "convert.hpp"
+#include "debug.hpp"
+#include "is_same.hpp"
+#include "safe_integral.hpp"
+#include "span.hpp"
+
+namespace bsl
+{
+    /// @class bsl::strided_span
+    ///
+    /// <!-- description -->
+    ///   @brief A bsl::strided_span is a non-owning view of every
+    ///     "stride"th element of an array, starting with the first (for
+    ///     example, a single column of a row-major matrix, or a single
+    ///     channel of interleaved samples). Element "i" of the view is
+    ///     element "i * stride" of the array. Like the bsl::span, all
+    ///     accessors are _if() versions which return a nullptr on error,
+    ///     and a bsl::strided_span can be iterated using bsl::for_each.
+    ///   @include example_strided_span_overview.hpp
+    ///
+    /// <!-- template parameters -->
+    ///   @tparam T the type of element being viewed.
+    ///
+    template<typename T>
+    class strided_span final
+    {
+        static_assert(!is_same<T, char_type>::value, "use bsl::string_view instead");
+
+    public:
+        /// @brief alias for: T
+        using value_type = T;
+        /// @brief alias for: safe_uintmax
+        using size_type = safe_uintmax;
+        /// @brief alias for: safe_uintmax
+        using difference_type = safe_uintmax;
+        /// @brief alias for: T &
+        using reference_type = T &;
+        /// @brief alias for: T &
+        using const_reference_type = T const &;
+        /// @brief alias for: T *
+        using pointer_type = T *;
+        /// @brief alias for: T const *
+        using const_pointer_type = T const *;
+
+        /// <!-- description -->
+        ///   @brief Default constructor that creates a strided_span with
+        ///     data() == nullptr and size() == 0. All accessors
+        ///     will return a nullptr if used.
+        ///   @include example_strided_span_overview.hpp
+        ///
+        constexpr strided_span() noexcept = default;
+
+        /// <!-- description -->
+        ///   @brief Creates a strided_span of "count" elements, each
+        ///     "stride" elements apart, starting at "ptr". Note that
+        ///     [ptr, ptr + (count - 1) * stride] must be a valid range. If
+        ///     any of the arguments are invalid, an invalid view is created.
+        ///   @include example_strided_span_overview.hpp
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param ptr a pointer to the first element being viewed
+        ///   @param count the number of elements being viewed
+        ///   @param stride the distance (in elements) between two elements
+        ///
+        constexpr strided_span(
+            pointer_type const ptr, size_type const &count, size_type const &stride) noexcept
+            : m_ptr{ptr}, m_count{count}, m_stride{stride}
+        {
+            if ((nullptr == m_ptr) || m_count.is_zero() || m_stride.is_zero() ||
+                (!((m_count - size_type::one()) * m_stride))) {
+                bsl::alert() << "strided_span: invalid constructor args\n";
+                bsl::alert() << "  - ptr: " << static_cast<void const *>(ptr) << bsl::endl;
+                bsl::alert() << "  - count: " << count << bsl::endl;
+                bsl::alert() << "  - stride: " << stride << bsl::endl;
+
+                *this = strided_span{};
+            }
+        }
+
+        /// <!-- description -->
+        ///   @brief Creates a strided_span of every "stride"th element of
+        ///     "spn", starting with the first. The resulting view contains
+        ///     ceil(spn.size() / stride) elements. If "spn" is invalid or
+        ///     "stride" is 0, an invalid view is created.
+        ///   @include example_strided_span_overview.hpp
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param spn the span to create the strided_span from
+        ///   @param stride the distance (in elements) between two elements
+        ///
+        constexpr strided_span(span<T> spn, size_type const &stride) noexcept
+            : m_ptr{}, m_count{}, m_stride{}
+        {
+            if (spn.empty() || stride.is_zero()) {
+                bsl::alert() << "strided_span: invalid constructor args\n";
+                bsl::alert() << "  - size: " << spn.size() << bsl::endl;
+                bsl::alert() << "  - stride: " << stride << bsl::endl;
+                return;
+            }
+
+            m_ptr = spn.data();
+            m_count = ((spn.size() - size_type::one()) / stride) + size_type::one();
+            m_stride = stride;
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns a pointer to the instance of T stored at index
+        ///     "index" (i.e., element "index * stride()" of the underlying
+        ///     array). If the index is out of bounds, or the view is
+        ///     invalid, this function returns a nullptr.
+        ///   @include example_strided_span_overview.hpp
+        ///
+        ///   SUPPRESSION: PRQA 4024 - false positive
+        ///   - We suppress this because A9-3-1 states that we should
+        ///     not provide a non-const reference or pointer to private
+        ///     member function, unless the class mimics a smart pointer or
+        ///     a containter. This class mimics a container.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param index the index of the instance to return
+        ///   @return Returns a pointer to the instance of T stored at index
+        ///     "index". If the index is out of bounds, or the view is invalid,
+        ///     this function returns a nullptr.
+        ///
+        [[nodiscard]] constexpr pointer_type
+        at_if(size_type const &index) noexcept
+        {
+            if ((!index) || (index >= m_count)) {
+                bsl::error() << "strided_span: index out of range: " << index << '\n';
+                return nullptr;
+            }
+
+            return &m_ptr[(index * m_stride).get()];    // PRQA S 4024 // NOLINT
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns a pointer to the instance of T stored at index
+        ///     "index" (i.e., element "index * stride()" of the underlying
+        ///     array). If the index is out of bounds, or the view is
+        ///     invalid, this function returns a nullptr.
+        ///   @include example_strided_span_overview.hpp
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param index the index of the instance to return
+        ///   @return Returns a pointer to the instance of T stored at index
+        ///     "index". If the index is out of bounds, or the view is invalid,
+        ///     this function returns a nullptr.
+        ///
+        [[nodiscard]] constexpr const_pointer_type
+        at_if(size_type const &index) const noexcept
+        {
+            if ((!index) || (index >= m_count)) {
+                bsl::error() << "strided_span: index out of range: " << index << '\n';
+                return nullptr;
+            }
+
+            return &m_ptr[(index * m_stride).get()];    // NOLINT
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns a pointer to the instance of T stored at index
+        ///     "0". If the index is out of bounds, or the view is invalid,
+        ///     this function returns a nullptr.
+        ///   @include example_strided_span_overview.hpp
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Returns a pointer to the instance of T stored at index
+        ///     "0". If the index is out of bounds, or the view is invalid,
+        ///     this function returns a nullptr.
+        ///
+        [[nodiscard]] constexpr pointer_type
+        front_if() noexcept
+        {
+            return this->at_if(to_umax(0));
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns a pointer to the instance of T stored at index
+        ///     "0". If the index is out of bounds, or the view is invalid,
+        ///     this function returns a nullptr.
+        ///   @include example_strided_span_overview.hpp
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Returns a pointer to the instance of T stored at index
+        ///     "0". If the index is out of bounds, or the view is invalid,
+        ///     this function returns a nullptr.
+        ///
+        [[nodiscard]] constexpr const_pointer_type
+        front_if() const noexcept
+        {
+            return this->at_if(to_umax(0));
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns a pointer to the instance of T stored at index
+        ///     "size() - 1". If the index is out of bounds, or the view is
+        ///     invalid, this function returns a nullptr.
+        ///   @include example_strided_span_overview.hpp
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Returns a pointer to the instance of T stored at index
+        ///     "size() - 1". If the index is out of bounds, or the view is
+        ///     invalid, this function returns a nullptr.
+        ///
+        [[nodiscard]] constexpr pointer_type
+        back_if() noexcept
+        {
+            return this->at_if(m_count.is_pos() ? (m_count - to_umax(1)) : to_umax(0));
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns a pointer to the instance of T stored at index
+        ///     "size() - 1". If the index is out of bounds, or the view is
+        ///     invalid, this function returns a nullptr.
+        ///   @include example_strided_span_overview.hpp
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Returns a pointer to the instance of T stored at index
+        ///     "size() - 1". If the index is out of bounds, or the view is
+        ///     invalid, this function returns a nullptr.
+        ///
+        [[nodiscard]] constexpr const_pointer_type
+        back_if() const noexcept
+        {
+            return this->at_if(m_count.is_pos() ? (m_count - to_umax(1)) : to_umax(0));
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns a pointer to the first element being viewed. If
+        ///     this is a default constructed view, or the view was
+        ///     constructed in error, this will return a nullptr.
+        ///   @include example_strided_span_overview.hpp
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Returns a pointer to the first element being viewed
+        ///
+        [[nodiscard]] constexpr pointer_type
+        data() noexcept
+        {
+            return m_ptr;
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns a pointer to the first element being viewed. If
+        ///     this is a default constructed view, or the view was
+        ///     constructed in error, this will return a nullptr.
+        ///   @include example_strided_span_overview.hpp
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Returns a pointer to the first element being viewed
+        ///
+        [[nodiscard]] constexpr const_pointer_type
+        data() const noexcept
+        {
+            return m_ptr;
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns size() == 0
+        ///   @include example_strided_span_overview.hpp
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Returns size() == 0
+        ///
+        [[nodiscard]] constexpr bool
+        empty() const noexcept
+        {
+            return m_count.is_zero();
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns !empty()
+        ///   @include example_strided_span_overview.hpp
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Returns !empty()
+        ///
+        [[nodiscard]] constexpr explicit operator bool() const noexcept
+        {
+            return !this->empty();
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns the number of elements being viewed
+        ///   @include example_strided_span_overview.hpp
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Returns the number of elements being viewed
+        ///
+        [[nodiscard]] constexpr size_type const &
+        size() const noexcept
+        {
+            return m_count;
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns the distance (in elements) between two
+        ///     elements being viewed, or 0 if the view is invalid.
+        ///   @include example_strided_span_overview.hpp
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Returns the distance (in elements) between two
+        ///     elements being viewed
+        ///
+        [[nodiscard]] constexpr size_type const &
+        stride() const noexcept
+        {
+            return m_stride;
+        }
+
+    private:
+        /// @brief stores a pointer to the first element being viewed
+        pointer_type m_ptr;
+        /// @brief stores the number of elements being viewed
+        size_type m_count;
+        /// @brief stores the distance between two elements being viewed
+        size_type m_stride;
+    };
+}
+
+#endif
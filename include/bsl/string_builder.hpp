@@ -0,0 +1,207 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+///
+/// @file string_builder.hpp
+///
+
+#ifndef BSL_STRING_BUILDER_HPP
+#define BSL_STRING_BUILDER_HPP
+
+#include "details/string_builder_out.hpp"
+
+#include "cstr_type.hpp"
+#include "fixed_string.hpp"
+#include "fmt.hpp"
+#include "fmt_options.hpp"
+#include "safe_integral.hpp"
+#include "string_view.hpp"
+
+namespace bsl
+{
+    /// @class bsl::string_builder
+    ///
+    /// <!-- description -->
+    ///   @brief Builds a bsl::fixed_string in place using the same "<<"
+    ///     syntax as bsl::print(). Any type that can be given to
+    ///     bsl::print() through a fmt_impl() overload (including bsl::fmt)
+    ///     can be given to a bsl::string_builder, and the result is
+    ///     formatted exactly as it would be on the console. No memory is
+    ///     allocated. If the result does not fit, it is truncated, and the
+    ///     bsl::string_builder will evaluate to false.
+    ///   @include example_string_builder_overview.hpp
+    ///
+    /// <!-- template parameters -->
+    ///   @tparam N the max number of characters the builder can store.
+    ///
+    template<bsl::uintmax N>
+    class string_builder final
+    {
+        /// @brief stores the string being built
+        fixed_string<N> m_str;
+
+    public:
+        /// <!-- description -->
+        ///   @brief Creates an empty bsl::string_builder
+        ///   @include example_string_builder_overview.hpp
+        ///
+        constexpr string_builder() noexcept    // --
+            : m_str{}
+        {}
+
+        /// <!-- description -->
+        ///   @brief Returns the string that has been built so far.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Returns the string that has been built so far.
+        ///
+        [[nodiscard]] constexpr fixed_string<N> &
+        str() noexcept
+        {
+            return m_str;
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns the string that has been built so far.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Returns the string that has been built so far.
+        ///
+        [[nodiscard]] constexpr fixed_string<N> const &
+        str() const noexcept
+        {
+            return m_str;
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns a '\0' terminated version of the string that
+        ///     has been built so far.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Returns a '\0' terminated version of the string that
+        ///     has been built so far.
+        ///
+        [[nodiscard]] constexpr cstr_type
+        c_str() const noexcept
+        {
+            return m_str.c_str();
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns a bsl::string_view of the string that has been
+        ///     built so far.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Returns a bsl::string_view of the string that has been
+        ///     built so far.
+        ///
+        [[nodiscard]] constexpr string_view
+        view() const noexcept
+        {
+            return m_str.view();
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns the number of characters that have been built
+        ///     so far.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Returns the number of characters that have been built
+        ///     so far.
+        ///
+        [[nodiscard]] constexpr safe_uintmax const &
+        size() const noexcept
+        {
+            return m_str.size();
+        }
+
+        /// <!-- description -->
+        ///   @brief Empties the builder so that it can be reused.
+        ///
+        constexpr void
+        clear() noexcept
+        {
+            m_str.clear();
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns true if everything given to the builder fit,
+        ///     false if the result was truncated.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Returns true if everything given to the builder fit,
+        ///     false if the result was truncated.
+        ///
+        [[nodiscard]] constexpr explicit operator bool() const noexcept
+        {
+            return !m_str.truncated();
+        }
+    };
+
+    /// <!-- description -->
+    ///   @brief Appends the provided formatted argument to the provided
+    ///     bsl::string_builder. If you want to provide support for your
+    ///     own type, DO NOT overload this function. Instead, overload the
+    ///     fmt_impl function.
+    ///   @related bsl::string_builder
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @tparam N the max size of the bsl::string_builder
+    ///   @tparam U the type of value being ouputter using bsl::fmt
+    ///   @param b the instance of the bsl::string_builder to append to.
+    ///   @param arg a bsl::fmt that contains the value being outputted as
+    ///     well as any format instructions.
+    ///   @return return b
+    ///
+    template<bsl::uintmax N, typename U>
+    [[maybe_unused]] constexpr string_builder<N> &
+    operator<<(string_builder<N> &b, fmt<U> &&arg) noexcept
+    {
+        fmt_impl(details::string_builder_out<N>{b.str()}, arg.m_ops, arg.m_val);    // NOLINT
+        return b;
+    }
+
+    /// <!-- description -->
+    ///   @brief Appends the provided argument to the provided
+    ///     bsl::string_builder. If you want to provide support for your
+    ///     own type, DO NOT overload this function. Instead, overload the
+    ///     fmt_impl function.
+    ///   @related bsl::string_builder
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @tparam N the max size of the bsl::string_builder
+    ///   @tparam U the type of value being appended
+    ///   @param b the instance of the bsl::string_builder to append to.
+    ///   @param arg the value to append
+    ///   @return return b
+    ///
+    template<bsl::uintmax N, typename U>
+    [[maybe_unused]] constexpr string_builder<N> &
+    operator<<(string_builder<N> &b, U const &arg) noexcept
+    {
+        fmt_impl(details::string_builder_out<N>{b.str()}, nullops, arg);    // NOLINT
+        return b;
+    }
+}
+
+#endif
@@ -0,0 +1,95 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+///
+/// @file swap_ranges.hpp
+///
+
+#ifndef BSL_SWAP_RANGES_HPP
+#define BSL_SWAP_RANGES_HPP
+
+#include "details/range_ops.hpp"
+#include "details/value_type_for.hpp"
+
+#include "convert.hpp"
+#include "is_constant_evaluated.hpp"
+#include "is_nothrow_swappable.hpp"
+#include "is_same.hpp"
+#include "is_trivially_copyable.hpp"
+#include "safe_integral.hpp"
+#include "swap.hpp"
+
+namespace bsl
+{
+    /// <!-- description -->
+    ///   @brief Swaps the elements of two views, element by element, up
+    ///     to the size of the smaller view. If the elements are trivially
+    ///     copyable and the views do not overlap, at run-time the views
+    ///     are swapped as raw memory, one 64 byte block at a time.
+    ///     Otherwise, and at compile-time, the elements are swapped one
+    ///     at a time using bsl::swap.
+    ///   @include example_swap_ranges_overview.hpp
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @tparam VIEW1 the type of the first view
+    ///   @tparam VIEW2 the type of the second view
+    ///   @param lhs the first view to swap
+    ///   @param rhs the second view to swap
+    ///   @return Returns the number of elements that were swapped
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @throw throws if the swap of two elements throws
+    ///
+    template<typename VIEW1, typename VIEW2>
+    [[maybe_unused]] constexpr safe_uintmax
+    swap_ranges(VIEW1 &lhs, VIEW2 &rhs) noexcept(    // --
+        is_nothrow_swappable<details::value_type_for<VIEW1>>::value)
+    {
+        using value_type = details::value_type_for<VIEW1>;
+        static_assert(
+            is_same<value_type, details::value_type_for<VIEW2>>::value,
+            "both views must have the same value_type");
+
+        safe_uintmax const count{lhs.size().min(rhs.size())};
+        if (count.is_zero()) {
+            return to_umax(0);
+        }
+
+        if constexpr (is_trivially_copyable<value_type>::value) {
+            if (!is_constant_evaluated()) {
+                if (!details::range_overlaps(lhs.data(), rhs.data(), count.get())) {
+                    details::range_swap(lhs.data(), rhs.data(), count.get());
+                    return count;
+                }
+            }
+        }
+
+        for (safe_uintmax i{}; i < count; ++i) {
+            bsl::swap(*lhs.at_if(i), *rhs.at_if(i));
+        }
+
+        return count;
+    }
+}
+
+#endif
@@ -0,0 +1,506 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+///
+/// @file task.hpp
+///
+
+#ifndef BSL_TASK_HPP
+#define BSL_TASK_HPP
+
+#include "details/frame_pool_promise.hpp"
+#include "errc_type.hpp"
+#include "error_trace.hpp"
+#include "exchange.hpp"
+#include "move.hpp"
+#include "result.hpp"
+
+// Notes: --
+// - Coroutines need C++20, and the PERFORCE build is C++17, so this
+//   header is empty unless the compiler supports them.
+//
+#if !BSL_PERFORCE && defined(__cpp_impl_coroutine)
+
+#include <coroutine>    // NOLINT
+
+namespace bsl
+{
+    template<typename T>
+    class task;
+
+    namespace details
+    {
+        /// @class bsl::details::task_final_awaiter
+        ///
+        /// <!-- description -->
+        ///   @brief Used by a bsl::task when it completes to resume
+        ///     whoever was awaiting it (using symmetric transfer so that
+        ///     long chains of tasks do not grow the stack). If nobody is
+        ///     awaiting the task, control is returned to whoever resumed it
+        ///     last (for example, a bsl::run_queue).
+        ///
+        class task_final_awaiter final
+        {
+        public:
+            /// <!-- description -->
+            ///   @brief Always returns false as a completed task must
+            ///     always suspend so that its result can be read.
+            ///
+            /// <!-- inputs/outputs -->
+            ///   @return Always returns false
+            ///
+            [[nodiscard]] static constexpr bool
+            await_ready() noexcept
+            {
+                return false;
+            }
+
+            /// <!-- description -->
+            ///   @brief Returns the coroutine that is awaiting the
+            ///     completed task, or a noop coroutine if there is none.
+            ///
+            /// <!-- inputs/outputs -->
+            ///   @tparam PROMISE the type of promise of the completed task
+            ///   @param hndl the handle of the completed task
+            ///   @return Returns the coroutine to resume next
+            ///
+            template<typename PROMISE>
+            [[nodiscard]] static std::coroutine_handle<>
+            await_suspend(std::coroutine_handle<PROMISE> const hndl) noexcept
+            {
+                if (auto const cont{hndl.promise().continuation()}) {
+                    return cont;
+                }
+
+                return std::noop_coroutine();
+            }
+
+            /// <!-- description -->
+            ///   @brief Does nothing as a completed task is never resumed
+            ///
+            static constexpr void
+            await_resume() noexcept
+            {}
+        };
+
+        /// @class bsl::details::task_promise
+        ///
+        /// <!-- description -->
+        ///   @brief Defines the promise type of a bsl::task. The promise
+        ///     stores the task's bsl::result, which starts off as an
+        ///     untraced bsl::errc_failure until the task executes a
+        ///     co_return (so creating a task does not add an error to the
+        ///     bsl::error_trace), as well as the coroutine that is
+        ///     awaiting the task (if any).
+        ///
+        /// <!-- template parameters -->
+        ///   @tparam T the type of value returned by the task
+        ///
+        template<typename T>
+        class task_promise final : public frame_pool_promise
+        {
+            /// @brief stores the result of the task
+            result<T> m_result{untraced, errc_failure};
+            /// @brief stores the coroutine awaiting this task (if any)
+            std::coroutine_handle<> m_continuation{};
+
+        public:
+            /// <!-- description -->
+            ///   @brief Returns the bsl::task that owns this promise
+            ///
+            /// <!-- inputs/outputs -->
+            ///   @return Returns the bsl::task that owns this promise
+            ///
+            [[nodiscard]] task<T>
+            get_return_object() noexcept
+            {
+                return task<T>{std::coroutine_handle<task_promise>::from_promise(*this)};
+            }
+
+            /// <!-- description -->
+            ///   @brief Called by the compiler when the frame of the task
+            ///     could not be allocated. The resulting bsl::task is
+            ///     invalid and reports bsl::errc_failure when awaited.
+            ///
+            /// <!-- inputs/outputs -->
+            ///   @return Returns an invalid bsl::task
+            ///
+            [[nodiscard]] static task<T>
+            get_return_object_on_allocation_failure() noexcept
+            {
+                return task<T>{};
+            }
+
+            /// <!-- description -->
+            ///   @brief A bsl::task is lazy and does not start executing
+            ///     until it is either awaited or resumed.
+            ///
+            /// <!-- inputs/outputs -->
+            ///   @return Returns std::suspend_always
+            ///
+            [[nodiscard]] static constexpr std::suspend_always
+            initial_suspend() noexcept
+            {
+                return {};
+            }
+
+            /// <!-- description -->
+            ///   @brief Resumes the coroutine awaiting this task (if any)
+            ///
+            /// <!-- inputs/outputs -->
+            ///   @return Returns a bsl::details::task_final_awaiter
+            ///
+            [[nodiscard]] static constexpr task_final_awaiter
+            final_suspend() noexcept
+            {
+                return {};
+            }
+
+            /// <!-- description -->
+            ///   @brief Stores the result of a co_return. The result can
+            ///     either be a T or an error code.
+            ///
+            /// <!-- inputs/outputs -->
+            ///   @param res the result of the task
+            ///
+            constexpr void
+            return_value(result<T> &&res) noexcept
+            {
+                m_result = bsl::move(res);
+            }
+
+            /// <!-- description -->
+            ///   @brief Exceptions are not supported by the BSL. This
+            ///     function is only provided as it is required by the
+            ///     compiler.
+            ///
+            static constexpr void
+            unhandled_exception() noexcept
+            {}
+
+            /// <!-- description -->
+            ///   @brief Returns the stored bsl::result
+            ///
+            /// <!-- inputs/outputs -->
+            ///   @return Returns the stored bsl::result
+            ///
+            [[nodiscard]] constexpr result<T> &
+            get() noexcept
+            {
+                return m_result;
+            }
+
+            /// <!-- description -->
+            ///   @brief Returns the coroutine awaiting this task (if any)
+            ///
+            /// <!-- inputs/outputs -->
+            ///   @return Returns the coroutine awaiting this task (if any)
+            ///
+            [[nodiscard]] constexpr std::coroutine_handle<>
+            continuation() const noexcept
+            {
+                return m_continuation;
+            }
+
+            /// <!-- description -->
+            ///   @brief Sets the coroutine awaiting this task
+            ///
+            /// <!-- inputs/outputs -->
+            ///   @param cont the coroutine awaiting this task
+            ///
+            constexpr void
+            set_continuation(std::coroutine_handle<> const cont) noexcept
+            {
+                m_continuation = cont;
+            }
+        };
+    }
+
+    /// @class bsl::task
+    ///
+    /// <!-- description -->
+    ///   @brief Implements a lazy, single result coroutine that does not
+    ///     require a heap or exceptions. A task's frame is allocated from
+    ///     the first bsl::frame_pool that is passed to the coroutine as an
+    ///     argument, and a task returns a bsl::result<T> instead of
+    ///     throwing. A task can either be awaited by another task using
+    ///     co_await (which returns the bsl::result<T> of the task), or it
+    ///     can be resumed directly (for example, by a bsl::run_queue),
+    ///     after which the result can be read using get().
+    ///
+    /// <!-- notes -->
+    ///   @note If the task's frame could not be allocated, the task is
+    ///     invalid (i.e., operator bool returns false) and it will report
+    ///     bsl::errc_failure when awaited or when get() is called. In
+    ///     other words, an out of memory condition is just another error.
+    ///   @include example_task_overview.hpp
+    ///
+    /// <!-- template parameters -->
+    ///   @tparam T the type of value returned by the task
+    ///
+    template<typename T>
+    class task final
+    {
+        /// @brief stores a handle to the task's coroutine
+        std::coroutine_handle<details::task_promise<T>> m_hndl;
+
+    public:
+        /// @brief alias for: T
+        using value_type = T;
+        /// @brief alias for: details::task_promise<T>
+        using promise_type = details::task_promise<T>;
+
+        /// @class bsl::task::awaiter
+        ///
+        /// <!-- description -->
+        ///   @brief Returned by co_await to await the completion of a
+        ///     bsl::task. The awaiting coroutine is suspended and the
+        ///     task is resumed in its place. Once the task completes, the
+        ///     awaiting coroutine is resumed with the task's result.
+        ///
+        class awaiter final
+        {
+            /// @brief stores a handle to the task being awaited
+            std::coroutine_handle<promise_type> m_hndl;
+
+        public:
+            /// <!-- description -->
+            ///   @brief Creates a bsl::task::awaiter
+            ///
+            /// <!-- inputs/outputs -->
+            ///   @param hndl a handle to the task being awaited
+            ///
+            explicit constexpr awaiter(std::coroutine_handle<promise_type> const hndl) noexcept
+                : m_hndl{hndl}
+            {}
+
+            /// <!-- description -->
+            ///   @brief Returns true if the task is invalid or has already
+            ///     completed, in which case there is no need to suspend.
+            ///
+            /// <!-- inputs/outputs -->
+            ///   @return Returns true if there is no need to suspend
+            ///
+            [[nodiscard]] bool
+            await_ready() const noexcept
+            {
+                return (!m_hndl) || m_hndl.done();
+            }
+
+            /// <!-- description -->
+            ///   @brief Stores the awaiting coroutine in the task and
+            ///     then transfers control to the task.
+            ///
+            /// <!-- inputs/outputs -->
+            ///   @param cont the awaiting coroutine
+            ///   @return Returns the task's coroutine, which is resumed next
+            ///
+            [[nodiscard]] std::coroutine_handle<>
+            await_suspend(std::coroutine_handle<> const cont) noexcept
+            {
+                m_hndl.promise().set_continuation(cont);
+                return m_hndl;
+            }
+
+            /// <!-- description -->
+            ///   @brief Returns the result of the task
+            ///
+            /// <!-- inputs/outputs -->
+            ///   @return Returns the result of the task
+            ///
+            [[nodiscard]] result<T>
+            await_resume() noexcept
+            {
+                if (!m_hndl) {
+                    return {errc_failure};
+                }
+
+                return bsl::move(m_hndl.promise().get());
+            }
+        };
+
+        /// <!-- description -->
+        ///   @brief Default constructor. Creates an invalid task.
+        ///
+        constexpr task() noexcept = default;
+
+        /// <!-- description -->
+        ///   @brief Creates a bsl::task given a handle to the task's
+        ///     coroutine. Used by the task's promise.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param hndl a handle to the task's coroutine
+        ///
+        explicit constexpr task(std::coroutine_handle<promise_type> const hndl) noexcept
+            : m_hndl{hndl}
+        {}
+
+        /// <!-- description -->
+        ///   @brief Destroyes a previously created bsl::task, returning
+        ///     its frame back to the bsl::frame_pool it came from.
+        ///
+        ~task() noexcept
+        {
+            if (m_hndl) {
+                m_hndl.destroy();
+            }
+        }
+
+        /// <!-- description -->
+        ///   @brief copy constructor
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param o the object being copied
+        ///
+        task(task const &o) noexcept = delete;
+
+        /// <!-- description -->
+        ///   @brief move constructor
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param o the object being moved
+        ///
+        constexpr task(task &&o) noexcept    // --
+            : m_hndl{bsl::exchange(o.m_hndl, {})}
+        {}
+
+        /// <!-- description -->
+        ///   @brief copy assignment
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param o the object being copied
+        ///   @return a reference to *this
+        ///
+        [[maybe_unused]] task &operator=(task const &o) &noexcept = delete;
+
+        /// <!-- description -->
+        ///   @brief move assignment
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param o the object being moved
+        ///   @return a reference to *this
+        ///
+        [[maybe_unused]] task &
+        operator=(task &&o) &noexcept
+        {
+            if (this != &o) {
+                if (m_hndl) {
+                    m_hndl.destroy();
+                }
+
+                m_hndl = bsl::exchange(o.m_hndl, {});
+            }
+
+            return *this;
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns a bsl::task::awaiter that can be used to
+        ///     co_await the completion of this task.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Returns a bsl::task::awaiter
+        ///
+        [[nodiscard]] constexpr awaiter
+        operator co_await() const &noexcept
+        {
+            return awaiter{m_hndl};
+        }
+
+        /// <!-- description -->
+        ///   @brief Resumes the task until its next suspension point. If
+        ///     the task is invalid or has already completed, this
+        ///     function does nothing.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Returns true if the task has completed, false otherwise
+        ///
+        [[maybe_unused]] bool
+        resume() const noexcept
+        {
+            if (this->done()) {
+                return true;
+            }
+
+            m_hndl.resume();
+            return m_hndl.done();
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns true if the task is invalid or has completed
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Returns true if the task is invalid or has completed
+        ///
+        [[nodiscard]] bool
+        done() const noexcept
+        {
+            return (!m_hndl) || m_hndl.done();
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns the result of the task. If the task is invalid
+        ///     or has not completed, bsl::errc_failure is returned.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Returns the result of the task
+        ///
+        [[nodiscard]] result<T>
+        get() const noexcept
+        {
+            if ((!m_hndl) || (!m_hndl.done())) {
+                return {errc_failure};
+            }
+
+            return m_hndl.promise().get();
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns a handle to the task's coroutine. This is used
+        ///     by executors like the bsl::run_queue to schedule the task.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Returns a handle to the task's coroutine
+        ///
+        [[nodiscard]] constexpr std::coroutine_handle<>
+        handle() const noexcept
+        {
+            return m_hndl;
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns true if the task's frame was allocated
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Returns true if the task's frame was allocated
+        ///
+        [[nodiscard]] constexpr explicit operator bool() const noexcept
+        {
+            return static_cast<bool>(m_hndl);
+        }
+    };
+}
+
+#endif
+
+#endif
@@ -0,0 +1,77 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+///
+/// @file transform_exclusive_scan.hpp
+///
+
+#ifndef BSL_TRANSFORM_EXCLUSIVE_SCAN_HPP
+#define BSL_TRANSFORM_EXCLUSIVE_SCAN_HPP
+
+#include "details/scan_impl.hpp"
+
+#include "forward.hpp"
+#include "is_nothrow_invocable.hpp"
+#include "result.hpp"
+#include "safe_integral.hpp"
+#include "span.hpp"
+
+namespace bsl
+{
+    /// <!-- description -->
+    ///   @brief Same as bsl::exclusive_scan, except that each element of
+    ///     src is first passed to "f", and the value returned by "f" is
+    ///     added to the running total instead (i.e., dst[0] = init and
+    ///     dst[i] = init + f(src[0]) + ... + f(src[i - 1])). "f" must
+    ///     return a T.
+    ///   @include example_transform_exclusive_scan_overview.hpp
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @tparam T the type of element to scan
+    ///   @tparam FUNC the type of transform to apply to each element
+    ///   @param src the elements to scan
+    ///   @param dst where to store the running total
+    ///   @param init the value to start the running total with
+    ///   @param f the transform to apply to each element
+    ///   @return Returns the number of elements stored in dst,
+    ///     bsl::errc_failure if dst is smaller than src, or
+    ///     bsl::errc_unsigned_wrap/bsl::errc_signed_overflow if the
+    ///     running total overflows.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @throw throws if "f" throws
+    ///
+    template<typename T, typename FUNC>
+    [[nodiscard]] constexpr result<safe_uintmax>
+    transform_exclusive_scan(
+        span<T const> const &src,
+        span<T> dst,
+        T const &init,
+        FUNC &&f) noexcept(is_nothrow_invocable<FUNC, T const &>::value)
+    {
+        return details::scan_impl<false>(
+            "transform_exclusive_scan", src, dst, init, bsl::forward<FUNC>(f));
+    }
+}
+
+#endif
@@ -0,0 +1,306 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+///
+/// @file tuple.hpp
+///
+
+#ifndef BSL_TUPLE_HPP
+#define BSL_TUPLE_HPP
+
+#include "cstdint.hpp"
+#include "move.hpp"
+#include "tuple_element.hpp"
+#include "tuple_size.hpp"
+
+namespace bsl
+{
+    /// @class bsl::tuple
+    ///
+    /// <!-- description -->
+    ///   @brief Provides the specialization of bsl::tuple for an empty
+    ///     tuple, which ends the recursion.
+    ///   @include example_tuple_overview.hpp
+    ///
+    template<>
+    class tuple<> final
+    {};
+
+    /// @class bsl::tuple
+    ///
+    /// <!-- description -->
+    ///   @brief A bsl::tuple is a fixed size collection of values of
+    ///     different types, which is useful for returning more than one
+    ///     value from a function without having to define a struct. Unlike
+    ///     a std::tuple, a bsl::tuple is a simple recursive aggregate of
+    ///     its elements, so:
+    ///     - elements that are empty types (for example stateless
+    ///       comparators) take up no space, as every element is marked
+    ///       [[no_unique_address]].
+    ///     - a bsl::tuple is trivially copyable if all of its elements are.
+    ///     - elements are accessed using get<I>(), and a bsl::tuple can be
+    ///       decomposed using structured bindings.
+    ///     - elements are always initialized together, either using the
+    ///       default constructor, which value initializes every element,
+    ///       or by providing a value for each element.
+    ///   @include example_tuple_overview.hpp
+    ///
+    /// <!-- template parameters -->
+    ///   @tparam T the type of the first element in the tuple
+    ///   @tparam TS the types of the remaining elements in the tuple
+    ///
+    template<typename T, typename... TS>
+    class tuple<T, TS...> final
+    {
+        /// @brief stores the first element
+        [[no_unique_address]] T m_head{};
+        /// @brief stores the remaining elements
+        [[no_unique_address]] tuple<TS...> m_tail{};
+
+    public:
+        /// <!-- description -->
+        ///   @brief Default constructor. All of the elements are value
+        ///     initialized.
+        ///   @include example_tuple_overview.hpp
+        ///
+        constexpr tuple() noexcept = default;
+
+        /// <!-- description -->
+        ///   @brief Creates a tuple by copying the provided values, one
+        ///     per element. This constructor is not explicit so that a
+        ///     function can return a tuple using "return {a, b};".
+        ///   @include example_tuple_overview.hpp
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param head the value of the first element
+        ///   @param tail the values of the remaining elements
+        ///
+        constexpr tuple(T const &head, TS const &... tail) noexcept    // PRQA S 2180 // NOLINT
+            : m_head{head}, m_tail{tail...}
+        {}
+
+        /// <!-- description -->
+        ///   @brief Returns a reference to element I
+        ///   @include example_tuple_overview.hpp
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @tparam I the index of the element to return
+        ///   @return Returns a reference to element I
+        ///
+        template<bsl::uintmax I>
+        [[nodiscard]] constexpr auto
+        get() &noexcept -> tuple_element_t<I, tuple> &
+        {
+            if constexpr (I == 0U) {
+                return m_head;
+            }
+            else {
+                return m_tail.template get<I - 1U>();
+            }
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns a reference to element I
+        ///   @include example_tuple_overview.hpp
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @tparam I the index of the element to return
+        ///   @return Returns a reference to element I
+        ///
+        template<bsl::uintmax I>
+        [[nodiscard]] constexpr auto
+        get() const &noexcept -> tuple_element_t<I, tuple> const &
+        {
+            if constexpr (I == 0U) {
+                return m_head;
+            }
+            else {
+                return m_tail.template get<I - 1U>();
+            }
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns an rvalue reference to element I, which allows
+        ///     an element to be moved out of a temporary tuple.
+        ///   @include example_tuple_overview.hpp
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @tparam I the index of the element to return
+        ///   @return Returns an rvalue reference to element I
+        ///
+        template<bsl::uintmax I>
+        [[nodiscard]] constexpr auto
+        get() &&noexcept -> tuple_element_t<I, tuple> &&
+        {
+            if constexpr (I == 0U) {
+                return bsl::move(m_head);
+            }
+            else {
+                return bsl::move(m_tail).template get<I - 1U>();
+            }
+        }
+    };
+
+    /// @brief deduces the types of a bsl::tuple from the provided values
+    template<typename... TS>
+    tuple(TS const &...) -> tuple<TS...>;
+
+    /// <!-- description -->
+    ///   @brief Returns a reference to element I of the provided tuple
+    ///   @include example_tuple_overview.hpp
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @tparam I the index of the element to return
+    ///   @tparam TS the types of the elements in the tuple
+    ///   @param t the tuple to get the element from
+    ///   @return Returns a reference to element I of the provided tuple
+    ///
+    template<bsl::uintmax I, typename... TS>
+    [[nodiscard]] constexpr auto
+    get(tuple<TS...> &t) noexcept -> tuple_element_t<I, tuple<TS...>> &
+    {
+        return t.template get<I>();
+    }
+
+    /// <!-- description -->
+    ///   @brief Returns a reference to element I of the provided tuple
+    ///   @include example_tuple_overview.hpp
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @tparam I the index of the element to return
+    ///   @tparam TS the types of the elements in the tuple
+    ///   @param t the tuple to get the element from
+    ///   @return Returns a reference to element I of the provided tuple
+    ///
+    template<bsl::uintmax I, typename... TS>
+    [[nodiscard]] constexpr auto
+    get(tuple<TS...> const &t) noexcept -> tuple_element_t<I, tuple<TS...>> const &
+    {
+        return t.template get<I>();
+    }
+
+    /// <!-- description -->
+    ///   @brief Returns an rvalue reference to element I of the provided
+    ///     tuple
+    ///   @include example_tuple_overview.hpp
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @tparam I the index of the element to return
+    ///   @tparam TS the types of the elements in the tuple
+    ///   @param t the tuple to get the element from
+    ///   @return Returns an rvalue reference to element I of the provided
+    ///     tuple
+    ///
+    template<bsl::uintmax I, typename... TS>
+    [[nodiscard]] constexpr auto
+    get(tuple<TS...> &&t) noexcept -> tuple_element_t<I, tuple<TS...>> &&
+    {
+        return bsl::move(t).template get<I>();
+    }
+}
+
+/// NOTE:
+/// - Structured bindings look up the size and element types of a tuple-like
+///   type using std::tuple_size and std::tuple_element, which means that
+///   these are the only hooks that must live in namespace std. The BSL does
+///   not include any standard headers, so they are declared here using the
+///   same signatures as the standard library, and then specialized for the
+///   bsl::tuple using bsl::tuple_size and bsl::tuple_element.
+///
+
+namespace std    // NOLINT
+{
+    /// @brief used by structured bindings to get the size of a tuple
+    template<typename T>
+    struct tuple_size;    // NOLINT
+
+    /// @brief used by structured bindings to get the type of an element
+    template<decltype(sizeof(0)) I, typename T>
+    struct tuple_element;    // NOLINT
+
+    /// @struct std::tuple_size
+    ///
+    /// <!-- description -->
+    ///   @brief Provides the size of a bsl::tuple to structured bindings
+    ///
+    /// <!-- template parameters -->
+    ///   @tparam TS the types of the elements in the tuple
+    ///
+    template<typename... TS>
+    struct tuple_size<bsl::tuple<TS...>> final    // NOLINT
+    {
+        /// @brief the number of elements in the tuple
+        static constexpr decltype(sizeof(0)) value{bsl::tuple_size<bsl::tuple<TS...>>::value};
+    };
+
+    /// @struct std::tuple_size
+    ///
+    /// <!-- description -->
+    ///   @brief Provides the size of a bsl::tuple to structured bindings
+    ///
+    /// <!-- template parameters -->
+    ///   @tparam TS the types of the elements in the tuple
+    ///
+    template<typename... TS>
+    struct tuple_size<bsl::tuple<TS...> const> final    // NOLINT
+    {
+        /// @brief the number of elements in the tuple
+        static constexpr decltype(sizeof(0)) value{bsl::tuple_size<bsl::tuple<TS...>>::value};
+    };
+
+    /// @struct std::tuple_element
+    ///
+    /// <!-- description -->
+    ///   @brief Provides the type of an element of a bsl::tuple to
+    ///     structured bindings
+    ///
+    /// <!-- template parameters -->
+    ///   @tparam I the index of the element to query
+    ///   @tparam TS the types of the elements in the tuple
+    ///
+    template<decltype(sizeof(0)) I, typename... TS>
+    struct tuple_element<I, bsl::tuple<TS...>> final    // NOLINT
+    {
+        /// @brief the type of element I
+        using type = bsl::tuple_element_t<I, bsl::tuple<TS...>>;
+    };
+
+    /// @struct std::tuple_element
+    ///
+    /// <!-- description -->
+    ///   @brief Provides the type of an element of a bsl::tuple to
+    ///     structured bindings
+    ///
+    /// <!-- template parameters -->
+    ///   @tparam I the index of the element to query
+    ///   @tparam TS the types of the elements in the tuple
+    ///
+    template<decltype(sizeof(0)) I, typename... TS>
+    struct tuple_element<I, bsl::tuple<TS...> const> final    // NOLINT
+    {
+        /// @brief the type of element I
+        using type = bsl::tuple_element_t<I, bsl::tuple<TS...> const>;
+    };
+}
+
+#endif
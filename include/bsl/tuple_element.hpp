@@ -0,0 +1,119 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+///
+/// @file tuple_element.hpp
+///
+
+#ifndef BSL_TUPLE_ELEMENT_HPP
+#define BSL_TUPLE_ELEMENT_HPP
+
+#include "cstdint.hpp"
+
+namespace bsl
+{
+    /// @brief defined in tuple.hpp
+    template<typename... TS>
+    class tuple;
+
+    /// @class bsl::tuple_element
+    ///
+    /// <!-- description -->
+    ///   @brief Provides the member typedef type, which is the type of
+    ///     element I in the provided bsl::tuple.
+    ///   @include example_tuple_overview.hpp
+    ///
+    /// <!-- template parameters -->
+    ///   @tparam I the index of the element to query
+    ///   @tparam T the bsl::tuple to query
+    ///
+    template<bsl::uintmax I, typename T>
+    class tuple_element;
+
+    /// @class bsl::tuple_element
+    ///
+    /// <!-- description -->
+    ///   @brief Provides the member typedef type, which is the type of
+    ///     element I in the provided bsl::tuple.
+    ///   @include example_tuple_overview.hpp
+    ///
+    /// <!-- template parameters -->
+    ///   @tparam I the index of the element to query
+    ///   @tparam T the type of the first element in the tuple
+    ///   @tparam TS the types of the remaining elements in the tuple
+    ///
+    template<bsl::uintmax I, typename T, typename... TS>
+    class tuple_element<I, tuple<T, TS...>> final
+    {
+        static_assert(I <= sizeof...(TS), "tuple index out of range");
+
+    public:
+        /// @brief provides the member typedef type
+        using type = typename tuple_element<I - 1U, tuple<TS...>>::type;
+    };
+
+    /// @class bsl::tuple_element
+    ///
+    /// <!-- description -->
+    ///   @brief Provides the member typedef type, which is the type of
+    ///     element I in the provided bsl::tuple. This specialization
+    ///     ends the recursion.
+    ///   @include example_tuple_overview.hpp
+    ///
+    /// <!-- template parameters -->
+    ///   @tparam T the type of the first element in the tuple
+    ///   @tparam TS the types of the remaining elements in the tuple
+    ///
+    template<typename T, typename... TS>
+    class tuple_element<0U, tuple<T, TS...>> final
+    {
+    public:
+        /// @brief provides the member typedef type
+        using type = T;
+    };
+
+    /// @class bsl::tuple_element
+    ///
+    /// <!-- description -->
+    ///   @brief Provides the member typedef type, which is the type of
+    ///     element I in the provided bsl::tuple, const qualified.
+    ///   @include example_tuple_overview.hpp
+    ///
+    /// <!-- template parameters -->
+    ///   @tparam I the index of the element to query
+    ///   @tparam TS the types of the elements in the tuple
+    ///
+    template<bsl::uintmax I, typename... TS>
+    class tuple_element<I, tuple<TS...> const> final
+    {
+    public:
+        /// @brief provides the member typedef type
+        using type = typename tuple_element<I, tuple<TS...>>::type const;
+    };
+
+    /// @brief a helper that reduces the verbosity of bsl::tuple_element
+    template<bsl::uintmax I, typename T>
+    using tuple_element_t = typename tuple_element<I, T>::type;
+}
+
+#endif
@@ -0,0 +1,84 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+///
+/// @file tuple_size.hpp
+///
+
+#ifndef BSL_TUPLE_SIZE_HPP
+#define BSL_TUPLE_SIZE_HPP
+
+#include "cstdint.hpp"
+#include "integral_constant.hpp"
+
+namespace bsl
+{
+    /// @brief defined in tuple.hpp
+    template<typename... TS>
+    class tuple;
+
+    /// @class bsl::tuple_size
+    ///
+    /// <!-- description -->
+    ///   @brief Provides the member constant value equal to the number
+    ///     of elements in the provided bsl::tuple.
+    ///   @include example_tuple_overview.hpp
+    ///
+    /// <!-- template parameters -->
+    ///   @tparam T the bsl::tuple to query
+    ///
+    template<typename T>
+    class tuple_size;
+
+    /// @class bsl::tuple_size
+    ///
+    /// <!-- description -->
+    ///   @brief Provides the member constant value equal to the number
+    ///     of elements in the provided bsl::tuple.
+    ///   @include example_tuple_overview.hpp
+    ///
+    /// <!-- template parameters -->
+    ///   @tparam TS the types of the elements in the tuple
+    ///
+    template<typename... TS>
+    class tuple_size<tuple<TS...>> final :    // --
+        public integral_constant<bsl::uintmax, sizeof...(TS)>
+    {};
+
+    /// @class bsl::tuple_size
+    ///
+    /// <!-- description -->
+    ///   @brief Provides the member constant value equal to the number
+    ///     of elements in the provided bsl::tuple.
+    ///   @include example_tuple_overview.hpp
+    ///
+    /// <!-- template parameters -->
+    ///   @tparam TS the types of the elements in the tuple
+    ///
+    template<typename... TS>
+    class tuple_size<tuple<TS...> const> final :    // --
+        public integral_constant<bsl::uintmax, sizeof...(TS)>
+    {};
+}
+
+#endif
@@ -0,0 +1,101 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+///
+/// @file unique.hpp
+///
+
+#ifndef BSL_UNIQUE_HPP
+#define BSL_UNIQUE_HPP
+
+#include "details/compact_impl.hpp"
+#include "details/value_type_for.hpp"
+
+#include "convert.hpp"
+#include "is_nothrow_invocable.hpp"
+#include "is_nothrow_move_assignable.hpp"
+#include "is_trivially_copyable.hpp"
+#include "move.hpp"
+#include "safe_integral.hpp"
+
+namespace bsl
+{
+    /// <!-- description -->
+    ///   @brief Removes all but the first element of each group of
+    ///     consecutive equal elements in a view by moving the elements
+    ///     that are kept to the front of the view, keeping their order.
+    ///     Sort the view first to remove all duplicates. The elements
+    ///     after the returned size are left in a valid but unspecified
+    ///     state. If the elements are trivially copyable, the view is
+    ///     compacted without branching on the result of "equal".
+    ///   @include example_unique_overview.hpp
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @tparam VIEW the type of view to compact
+    ///   @tparam EQUAL the type of equality comparison to use
+    ///   @param vw the view to compact
+    ///   @param equal returns true if two elements are equal (defaults
+    ///     to operator==)
+    ///   @return Returns the number of elements that were kept (i.e.,
+    ///     the new size of the view).
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @throw throws if the move assignment of an element throws
+    ///
+    template<typename VIEW, typename EQUAL = details::compact_equal>
+    [[maybe_unused]] constexpr safe_uintmax
+    unique(VIEW &vw, EQUAL &&equal = EQUAL{}) noexcept(    // --
+        is_nothrow_move_assignable<details::value_type_for<VIEW>>::value)
+    {
+        using value_type = details::value_type_for<VIEW>;
+        static_assert(
+            is_nothrow_invocable<EQUAL, value_type const &, value_type const &>::value,
+            "equal must be noexcept");
+
+        if (vw.empty()) {
+            return to_umax(0);
+        }
+
+        if constexpr (is_trivially_copyable<value_type>::value) {
+            return to_umax(details::compact_unique(vw.data(), vw.size().get(), equal));
+        }
+        else {
+            safe_uintmax kept{safe_uintmax::one()};
+            for (safe_uintmax i{safe_uintmax::one()}; i < vw.size(); ++i) {
+                if (equal(*vw.at_if(kept - safe_uintmax::one()), *vw.at_if(i))) {
+                    continue;
+                }
+
+                if (kept != i) {
+                    *vw.at_if(kept) = bsl::move(*vw.at_if(i));
+                }
+
+                ++kept;
+            }
+
+            return kept;
+        }
+    }
+}
+
+#endif
@@ -216,6 +216,45 @@ namespace bsl
         }
     };
 
+    /// <!-- description -->
+    ///   @brief Advances a xorshift generator and returns its next value.
+    ///     Unit tests use this when they need a large, pseudo random data
+    ///     set that is still the same on every run. "state" must not be
+    ///     0, or every value returned will be 0.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param state the state of the generator to advance
+    ///   @return Returns the next pseudo random value
+    ///
+    [[nodiscard]] constexpr bsl::uint32
+    ut_random(bsl::uint32 &state) noexcept
+    {
+        state ^= (state << 13U);
+        state ^= (state >> 17U);
+        state ^= (state << 5U);
+        return state;
+    }
+
+    /// <!-- description -->
+    ///   @brief Fills a view with pseudo random values in [0, range)
+    ///     using bsl::ut_random. The same view is filled with the same
+    ///     values on every call.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @tparam VIEW the type of view to fill
+    ///   @param vw the view to fill
+    ///   @param range the number of distinct values to generate
+    ///
+    template<typename VIEW>
+    constexpr void
+    ut_fill_random(VIEW &vw, bsl::uint32 const range) noexcept
+    {
+        bsl::uint32 state{0x12345678U};
+        for (bsl::safe_uintmax i{}; i < vw.size(); ++i) {
+            *vw.at_if(i) = ut_random(state) % range;
+        }
+    }
+
     /// <!-- description -->
     ///   @brief Outputs a message and returns bsl::exit_success
     ///
@@ -0,0 +1,117 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+#include <bsl/apply.hpp>
+#include <bsl/convert.hpp>
+#include <bsl/safe_integral.hpp>
+#include <bsl/tuple.hpp>
+#include <bsl/ut.hpp>
+
+namespace
+{
+    /// <!-- description -->
+    ///   @brief Returns a + b, used to test bsl::apply with a function
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param a the first value to add
+    ///   @param b the second value to add
+    ///   @return Returns a + b
+    ///
+    [[nodiscard]] constexpr bsl::safe_uint64
+    add(bsl::safe_uint64 const &a, bsl::safe_uint64 const &b) noexcept
+    {
+        return a + b;
+    }
+}
+
+/// <!-- description -->
+///   @brief Used to execute the actual checks. We put the checks in this
+///     function so that we can validate the tests both at compile-time
+///     and at run-time. If a bsl::ut_check fails, the tests will either
+///     fail fast at run-time, or will produce a compile-time error.
+///
+/// <!-- inputs/outputs -->
+///   @return Always returns bsl::exit_success.
+///
+constexpr bsl::exit_code
+tests() noexcept
+{
+    bsl::ut_scenario{"apply"} = []() {
+        bsl::ut_given{} = []() {
+            bsl::tuple const t{bsl::to_u64(4), bsl::to_u64(38)};
+            bsl::ut_then{} = [&t]() {
+                bsl::ut_check(bsl::apply(&add, t) == bsl::to_u64(42));
+                bsl::ut_check(
+                    bsl::apply(
+                        [](bsl::safe_uint64 const &a, bsl::safe_uint64 const &b) noexcept {
+                            return a * b;
+                        },
+                        t) == bsl::to_u64(152));
+            };
+        };
+
+        bsl::ut_given{} = []() {
+            bsl::tuple<bsl::safe_uint64, bool> t{bsl::to_u64(1), false};
+            bsl::ut_when{} = [&t]() {
+                bsl::apply(
+                    [](bsl::safe_uint64 &val, bool &flag) noexcept {
+                        val = bsl::to_u64(2);
+                        flag = true;
+                    },
+                    t);
+
+                bsl::ut_then{} = [&t]() {
+                    bsl::ut_check(t.get<0>() == bsl::to_u64(2));
+                    bsl::ut_check(t.get<1>());
+                };
+            };
+        };
+
+        bsl::ut_given{} = []() {
+            bsl::ut_then{} = []() {
+                bsl::ut_check(bsl::apply([]() noexcept { return true; }, bsl::tuple<>{}));
+                bsl::ut_check(
+                    bsl::apply(&add, bsl::tuple{bsl::to_u64(1), bsl::to_u64(2)}) ==
+                    bsl::to_u64(3));
+            };
+        };
+    };
+
+    return bsl::ut_success();
+}
+
+/// <!-- description -->
+///   @brief Main function for this unit test. If a call to ut_check() fails
+///     the application will fast fail. If all calls to ut_check() pass, this
+///     function will successfully return with bsl::exit_success.
+///
+/// <!-- inputs/outputs -->
+///   @return Always returns bsl::exit_success.
+///
+bsl::exit_code
+main() noexcept
+{
+    static_assert(tests() == bsl::ut_success());
+    return tests();
+}
@@ -0,0 +1,231 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+#include <bsl/basic_addr.hpp>
+#include <bsl/convert.hpp>
+#include <bsl/page_index.hpp>
+#include <bsl/page_size.hpp>
+#include <bsl/phys_addr.hpp>
+#include <bsl/safe_integral.hpp>
+#include <bsl/ut.hpp>
+#include <bsl/virt_addr.hpp>
+
+/// <!-- description -->
+///   @brief Used to execute the actual checks. We put the checks in this
+///     function so that we can validate the tests both at compile-time
+///     and at run-time. If a bsl::ut_check fails, the tests will either
+///     fail fast at run-time, or will produce a compile-time error.
+///
+/// <!-- inputs/outputs -->
+///   @return Always returns bsl::exit_success.
+///
+constexpr bsl::exit_code
+tests() noexcept
+{
+    using namespace bsl;
+
+    bsl::ut_scenario{"page size"} = []() {
+        bsl::ut_then{} = []() {
+            bsl::ut_check(page_size == to_umax(0x1000));
+            bsl::ut_check(page_shift == to_umax(12).get());
+            bsl::ut_check(page_mask == to_umax(0xFFF).get());
+        };
+    };
+
+    bsl::ut_scenario{"default constructor"} = []() {
+        bsl::ut_given{} = []() {
+            phys_addr const addr{};
+            bsl::ut_then{} = [&addr]() {
+                bsl::ut_check(addr.get() == to_umax(0));
+                bsl::ut_check(!addr.failure());
+            };
+        };
+    };
+
+    bsl::ut_scenario{"arithmetic"} = []() {
+        bsl::ut_given{} = []() {
+            phys_addr const addr{to_umax(0x1000)};
+            bsl::ut_then{} = [&addr]() {
+                bsl::ut_check((addr + to_umax(0x10)).get() == to_umax(0x1010));
+                bsl::ut_check((addr - to_umax(0x10)).get() == to_umax(0xFF0));
+                bsl::ut_check((addr + to_umax(0x10)) - addr == to_umax(0x10));
+            };
+        };
+
+        bsl::ut_given{} = []() {
+            virt_addr addr{to_umax(0x1000)};
+            bsl::ut_then{} = [&addr]() {
+                addr += to_umax(0x20);
+                bsl::ut_check(addr.get() == to_umax(0x1020));
+                addr -= to_umax(0x10);
+                bsl::ut_check(addr.get() == to_umax(0x1010));
+            };
+        };
+
+        bsl::ut_given_at_runtime{} = []() {
+            phys_addr const addr{to_umax(0x10)};
+            bsl::ut_then{} = [&addr]() {
+                bsl::ut_check((addr - to_umax(0x20)).failure());
+                bsl::ut_check((addr + safe_uintmax{safe_uintmax::max()}).failure());
+            };
+        };
+    };
+
+    bsl::ut_scenario{"comparisons"} = []() {
+        bsl::ut_given{} = []() {
+            phys_addr const addr1{to_umax(0x1000)};
+            phys_addr const addr2{to_umax(0x2000)};
+            bsl::ut_then{} = [&addr1, &addr2]() {
+                bsl::ut_check(addr1 == addr1);
+                bsl::ut_check(addr1 != addr2);
+                bsl::ut_check(addr1 < addr2);
+                bsl::ut_check(addr2 > addr1);
+                bsl::ut_check(!(addr2 < addr1));
+                bsl::ut_check(!(addr1 > addr2));
+            };
+        };
+    };
+
+    bsl::ut_scenario{"page_of"} = []() {
+        bsl::ut_given{} = []() {
+            phys_addr const addr{to_umax(0x12345)};
+            bsl::ut_then{} = [&addr]() {
+                bsl::ut_check(page_of(addr) == phys_page_index{to_umax(0x12)});
+                bsl::ut_check(page_of(addr) != phys_page_index{to_umax(0x13)});
+                bsl::ut_check(page_of(phys_addr{to_umax(0x12000)}) == page_of(addr));
+            };
+        };
+
+        bsl::ut_given{} = []() {
+            phys_addr const addr{safe_uintmax::zero(true)};
+            bsl::ut_then{} = [&addr]() {
+                bsl::ut_check(page_of(addr).failure());
+            };
+        };
+    };
+
+    bsl::ut_scenario{"offset_in_page"} = []() {
+        bsl::ut_given{} = []() {
+            virt_addr const addr{to_umax(0x12345)};
+            bsl::ut_then{} = [&addr]() {
+                bsl::ut_check(offset_in_page(addr) == to_umax(0x345));
+                bsl::ut_check(offset_in_page(virt_addr{to_umax(0x12000)}) == to_umax(0));
+            };
+        };
+
+        bsl::ut_given{} = []() {
+            virt_addr const addr{safe_uintmax::zero(true)};
+            bsl::ut_then{} = [&addr]() {
+                bsl::ut_check(offset_in_page(addr).failure());
+            };
+        };
+    };
+
+    bsl::ut_scenario{"is_page_aligned"} = []() {
+        bsl::ut_then{} = []() {
+            bsl::ut_check(is_page_aligned(phys_addr{to_umax(0)}));
+            bsl::ut_check(is_page_aligned(phys_addr{to_umax(0x12000)}));
+            bsl::ut_check(!is_page_aligned(phys_addr{to_umax(0x12001)}));
+            bsl::ut_check(!is_page_aligned(phys_addr{to_umax(0x12FFF)}));
+            bsl::ut_check(!is_page_aligned(phys_addr{safe_uintmax::zero(true)}));
+        };
+    };
+
+    bsl::ut_scenario{"align_down"} = []() {
+        bsl::ut_then{} = []() {
+            bsl::ut_check(align_down(phys_addr{to_umax(0x12345)}).get() == to_umax(0x12000));
+            bsl::ut_check(align_down(phys_addr{to_umax(0x12000)}).get() == to_umax(0x12000));
+            bsl::ut_check(align_down(phys_addr{to_umax(0xFFF)}).get() == to_umax(0));
+            bsl::ut_check(align_down(phys_addr{safe_uintmax::zero(true)}).failure());
+        };
+    };
+
+    bsl::ut_scenario{"align_up"} = []() {
+        bsl::ut_then{} = []() {
+            bsl::ut_check(align_up(virt_addr{to_umax(0x12345)}).get() == to_umax(0x13000));
+            bsl::ut_check(align_up(virt_addr{to_umax(0x12000)}).get() == to_umax(0x12000));
+            bsl::ut_check(align_up(virt_addr{to_umax(0x1)}).get() == to_umax(0x1000));
+            bsl::ut_check(align_up(virt_addr{to_umax(0)}).get() == to_umax(0));
+            bsl::ut_check(align_up(virt_addr{safe_uintmax::zero(true)}).failure());
+        };
+
+        bsl::ut_given{} = []() {
+            safe_uintmax const max{safe_uintmax::max()};
+            bsl::ut_then{} = [&max]() {
+                bsl::ut_check(!align_up(virt_addr{max - to_umax(0xFFF)}).failure());
+                bsl::ut_check(align_up(virt_addr{max - to_umax(0xFFE)}).failure());
+                bsl::ut_check(align_up(virt_addr{max}).failure());
+            };
+        };
+    };
+
+    bsl::ut_scenario{"addr_of"} = []() {
+        bsl::ut_then{} = []() {
+            bsl::ut_check(addr_of(phys_page_index{to_umax(0x12)}).get() == to_umax(0x12000));
+            bsl::ut_check(addr_of(virt_page_index{}).get() == to_umax(0));
+            bsl::ut_check(addr_of(page_of(phys_addr{to_umax(0x12345)})) ==
+                          align_down(phys_addr{to_umax(0x12345)}));
+            bsl::ut_check(addr_of(page_of(virt_addr{to_umax(0x12345)})) ==
+                          align_down(virt_addr{to_umax(0x12345)}));
+            bsl::ut_check(addr_of(phys_page_index{safe_uintmax::zero(true)}).failure());
+        };
+
+        bsl::ut_given{} = []() {
+            safe_uintmax const max{safe_uintmax::max() >> page_shift};
+            bsl::ut_then{} = [&max]() {
+                bsl::ut_check(!addr_of(phys_page_index{max}).failure());
+                bsl::ut_check(addr_of(phys_page_index{max + to_umax(1)}).failure());
+            };
+        };
+    };
+
+    bsl::ut_scenario{"page_index"} = []() {
+        bsl::ut_given{} = []() {
+            virt_page_index const idx{to_umax(0x12)};
+            bsl::ut_then{} = [&idx]() {
+                bsl::ut_check(idx.get() == to_umax(0x12));
+                bsl::ut_check(!idx.failure());
+                bsl::ut_check(idx + to_umax(1) == virt_page_index{to_umax(0x13)});
+                bsl::ut_check(virt_page_index{}.get() == to_umax(0));
+            };
+        };
+    };
+
+    return bsl::ut_success();
+}
+
+/// <!-- description -->
+///   @brief Main function for this unit test. If a call to ut_check() fails
+///     the application will fast fail. If all calls to ut_check() pass, this
+///     function will successfully return with bsl::exit_success.
+///
+/// <!-- inputs/outputs -->
+///   @return Always returns bsl::exit_success.
+///
+bsl::exit_code
+main() noexcept
+{
+    static_assert(tests() == bsl::ut_success());
+    return tests();
+}
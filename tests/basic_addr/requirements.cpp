@@ -0,0 +1,142 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+#include <bsl/basic_addr.hpp>
+#include <bsl/convert.hpp>
+#include <bsl/declval.hpp>
+#include <bsl/is_detected.hpp>
+#include <bsl/is_trivially_copyable.hpp>
+#include <bsl/page_index.hpp>
+#include <bsl/phys_addr.hpp>
+#include <bsl/safe_integral.hpp>
+#include <bsl/ut.hpp>
+#include <bsl/virt_addr.hpp>
+
+namespace
+{
+    /// @brief detects lhs + rhs
+    template<typename L, typename R>
+    using add_type = decltype(bsl::declval<L const &>() + bsl::declval<R const &>());
+
+    /// @brief detects lhs - rhs
+    template<typename L, typename R>
+    using sub_type = decltype(bsl::declval<L const &>() - bsl::declval<R const &>());
+
+    /// @brief detects lhs == rhs
+    template<typename L, typename R>
+    using eql_type = decltype(bsl::declval<L const &>() == bsl::declval<R const &>());
+
+    /// @brief detects lhs < rhs
+    template<typename L, typename R>
+    using lt_type = decltype(bsl::declval<L const &>() < bsl::declval<R const &>());
+
+    /// @brief detects A{bsl::addr_of(idx)}
+    template<typename A, typename I>
+    using addr_of_type = decltype(A{bsl::addr_of(bsl::declval<I const &>())});
+
+    /// @brief detects bsl::addr_of<TAG>(idx)
+    template<typename TAG, typename I>
+    using addr_of_tag_type = decltype(bsl::addr_of<TAG>(bsl::declval<I const &>()));
+}
+
+/// <!-- description -->
+///   @brief Main function for this unit test. If a call to ut_check() fails
+///     the application will fast fail. If all calls to ut_check() pass, this
+///     function will successfully return with bsl::exit_success.
+///
+/// <!-- inputs/outputs -->
+///   @return Always returns bsl::exit_success.
+///
+bsl::exit_code
+main() noexcept
+{
+    using namespace bsl;
+
+    bsl::ut_scenario{"verify supports trivially copyable"} = []() {
+        static_assert(is_trivially_copyable<phys_addr>::value);
+        static_assert(is_trivially_copyable<virt_addr>::value);
+        static_assert(is_trivially_copyable<phys_page_index>::value);
+        static_assert(is_trivially_copyable<virt_page_index>::value);
+    };
+
+    bsl::ut_scenario{"verify address kinds cannot be mixed"} = []() {
+        static_assert(is_detected<sub_type, phys_addr, phys_addr>::value);
+        static_assert(!is_detected<sub_type, phys_addr, virt_addr>::value);
+        static_assert(!is_detected<sub_type, virt_addr, phys_addr>::value);
+        static_assert(is_detected<eql_type, virt_addr, virt_addr>::value);
+        static_assert(!is_detected<eql_type, phys_addr, virt_addr>::value);
+        static_assert(!is_detected<lt_type, virt_addr, phys_addr>::value);
+        static_assert(!is_detected<add_type, phys_addr, phys_addr>::value);
+        static_assert(!is_detected<add_type, phys_addr, virt_addr>::value);
+        static_assert(!is_detected<add_type, phys_addr, phys_page_index>::value);
+        static_assert(!is_detected<eql_type, phys_page_index, safe_uintmax>::value);
+        static_assert(!is_detected<eql_type, phys_page_index, virt_page_index>::value);
+    };
+
+    bsl::ut_scenario{"verify pages keep the kind of address"} = []() {
+        static_assert(is_detected<addr_of_type, phys_addr, phys_page_index>::value);
+        static_assert(is_detected<addr_of_type, virt_addr, virt_page_index>::value);
+        static_assert(!is_detected<addr_of_type, phys_addr, virt_page_index>::value);
+        static_assert(!is_detected<addr_of_type, virt_addr, phys_page_index>::value);
+        static_assert(!is_detected<addr_of_tag_type, phys_addr, virt_page_index>::value);
+        static_assert(
+            !is_detected<addr_of_tag_type, details::phys_addr_tag, virt_page_index>::value);
+    };
+
+    bsl::ut_scenario{"verify noexcept"} = []() {
+        bsl::ut_given{} = []() {
+            phys_addr addr{};
+            phys_page_index const idx{};
+            bsl::ut_then{} = [&addr, &idx]() {
+                static_assert(noexcept(phys_addr{}));
+                static_assert(noexcept(phys_addr{to_umax(0)}));
+                static_assert(noexcept(addr.get()));
+                static_assert(noexcept(addr.failure()));
+                static_assert(noexcept(addr += to_umax(0)));
+                static_assert(noexcept(addr -= to_umax(0)));
+                static_assert(noexcept(addr + to_umax(0)));
+                static_assert(noexcept(addr - to_umax(0)));
+                static_assert(noexcept(addr - addr));
+                static_assert(noexcept(addr == addr));
+                static_assert(noexcept(addr != addr));
+                static_assert(noexcept(addr < addr));
+                static_assert(noexcept(addr > addr));
+                static_assert(noexcept(page_of(addr)));
+                static_assert(noexcept(offset_in_page(addr)));
+                static_assert(noexcept(is_page_aligned(addr)));
+                static_assert(noexcept(align_down(addr)));
+                static_assert(noexcept(align_up(addr)));
+                static_assert(noexcept(addr_of(idx)));
+                static_assert(noexcept(phys_page_index{}));
+                static_assert(noexcept(idx.get()));
+                static_assert(noexcept(idx.failure()));
+                static_assert(noexcept(idx == idx));
+                static_assert(noexcept(idx != idx));
+                static_assert(noexcept(idx + to_umax(0)));
+            };
+        };
+    };
+
+    return bsl::ut_success();
+}
@@ -0,0 +1,143 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+#include <bsl/bitfield.hpp>
+#include <bsl/convert.hpp>
+#include <bsl/cstdint.hpp>
+#include <bsl/safe_integral.hpp>
+#include <bsl/ut.hpp>
+
+namespace
+{
+    /// @class reg8
+    ///
+    /// <!-- description -->
+    ///   @brief An 8 bit register used for testing
+    ///
+    class reg8 final
+    {
+    public:
+        /// @brief the type used to store the register
+        using value_type = bsl::uint8;
+    };
+
+    /// @class reg64
+    ///
+    /// <!-- description -->
+    ///   @brief A 64 bit register used for testing
+    ///
+    class reg64 final
+    {
+    public:
+        /// @brief the type used to store the register
+        using value_type = bsl::uint64;
+    };
+}
+
+/// <!-- description -->
+///   @brief Used to execute the actual checks. We put the checks in this
+///     function so that we can validate the tests both at compile-time
+///     and at run-time. If a bsl::ut_check fails, the tests will either
+///     fail fast at run-time, or will produce a compile-time error.
+///
+/// <!-- inputs/outputs -->
+///   @return Always returns bsl::exit_success.
+///
+constexpr bsl::exit_code
+tests() noexcept
+{
+    using namespace bsl;
+
+    bsl::ut_scenario{"offset, width, max and mask"} = []() {
+        bsl::ut_then{} = []() {
+            using low = bitfield<reg8, 0U, 1U>;
+            using mid = bitfield<reg8, 2U, 3U>;
+            using all = bitfield<reg8, 0U, 8U>;
+            using top = bitfield<reg64, 63U, 1U>;
+            using wide = bitfield<reg64, 0U, 64U>;
+
+            bsl::ut_check(low::offset() == 0U);
+            bsl::ut_check(low::width() == 1U);
+            bsl::ut_check(low::max() == to_u8(0x1).get());
+            bsl::ut_check(low::mask() == to_u8(0x1).get());
+
+            bsl::ut_check(mid::offset() == 2U);
+            bsl::ut_check(mid::width() == 3U);
+            bsl::ut_check(mid::max() == to_u8(0x7).get());
+            bsl::ut_check(mid::mask() == to_u8(0x1C).get());
+
+            bsl::ut_check(all::max() == to_u8(0xFF).get());
+            bsl::ut_check(all::mask() == to_u8(0xFF).get());
+
+            bsl::ut_check(top::max() == to_u64(0x1).get());
+            bsl::ut_check(top::mask() == to_u64(0x8000000000000000).get());
+
+            bsl::ut_check(wide::max() == safe_uint64::max());
+            bsl::ut_check(wide::mask() == safe_uint64::max());
+        };
+    };
+
+    bsl::ut_scenario{"get"} = []() {
+        bsl::ut_then{} = []() {
+            using mid = bitfield<reg8, 2U, 3U>;
+            using top = bitfield<reg64, 60U, 4U>;
+
+            bsl::ut_check(mid::get(to_u8(0xFF)) == to_u8(0x7));
+            bsl::ut_check(mid::get(to_u8(0x14)) == to_u8(0x5));
+            bsl::ut_check(mid::get(to_u8(0xE3)) == to_u8(0x0));
+            bsl::ut_check(mid::get(safe_uint8::zero(true)).failure());
+            bsl::ut_check(top::get(to_u64(0xA000000000000001)) == to_u64(0xA));
+        };
+    };
+
+    bsl::ut_scenario{"fits and to_bits"} = []() {
+        bsl::ut_then{} = []() {
+            using mid = bitfield<reg8, 2U, 3U>;
+
+            bsl::ut_check(mid::fits(to_u8(0)));
+            bsl::ut_check(mid::fits(to_u8(7)));
+            bsl::ut_check(!mid::fits(to_u8(8)));
+            bsl::ut_check(!mid::fits(safe_uint8::zero(true)));
+            bsl::ut_check(mid::to_bits(to_u8(0x5)) == to_u8(0x14).get());
+            bsl::ut_check(mid::to_bits(to_u8(0xFF)) == to_u8(0x1C).get());
+        };
+    };
+
+    return bsl::ut_success();
+}
+
+/// <!-- description -->
+///   @brief Main function for this unit test. If a call to ut_check() fails
+///     the application will fast fail. If all calls to ut_check() pass, this
+///     function will successfully return with bsl::exit_success.
+///
+/// <!-- inputs/outputs -->
+///   @return Always returns bsl::exit_success.
+///
+bsl::exit_code
+main() noexcept
+{
+    static_assert(tests() == bsl::ut_success());
+    return tests();
+}
@@ -0,0 +1,80 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+#include <bsl/bitfield.hpp>
+#include <bsl/convert.hpp>
+#include <bsl/cstdint.hpp>
+#include <bsl/ut.hpp>
+
+namespace
+{
+    /// @class reg32
+    ///
+    /// <!-- description -->
+    ///   @brief A 32 bit register used for testing
+    ///
+    class reg32 final
+    {
+    public:
+        /// @brief the type used to store the register
+        using value_type = bsl::uint32;
+    };
+}
+
+/// <!-- description -->
+///   @brief Main function for this unit test. If a call to ut_check() fails
+///     the application will fast fail. If all calls to ut_check() pass, this
+///     function will successfully return with bsl::exit_success.
+///
+/// <!-- inputs/outputs -->
+///   @return Always returns bsl::exit_success.
+///
+bsl::exit_code
+main() noexcept
+{
+    using namespace bsl;
+
+    bsl::ut_scenario{"verify noexcept"} = []() {
+        bsl::ut_then{} = []() {
+            using field = bitfield<reg32, 4U, 4U>;
+            static_assert(noexcept(field::offset()));
+            static_assert(noexcept(field::width()));
+            static_assert(noexcept(field::max()));
+            static_assert(noexcept(field::mask()));
+            static_assert(noexcept(field::get(to_u32(0))));
+            static_assert(noexcept(field::to_bits(to_u32(0))));
+            static_assert(noexcept(field::fits(to_u32(0))));
+        };
+    };
+
+    bsl::ut_scenario{"verify constexpr"} = []() {
+        bsl::ut_then{} = []() {
+            using field = bitfield<reg32, 4U, 4U>;
+            static_assert(field::mask() == 0xF0U);
+            static_assert(field::get(to_u32(0x12345678)) == to_u32(0x7));
+        };
+    };
+
+    return bsl::ut_success();
+}
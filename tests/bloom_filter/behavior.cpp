@@ -0,0 +1,236 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+#include <bsl/bloom_filter.hpp>
+#include <bsl/array.hpp>
+#include <bsl/byte.hpp>
+#include <bsl/convert.hpp>
+#include <bsl/cstdint.hpp>
+#include <bsl/discard.hpp>
+#include <bsl/result.hpp>
+#include <bsl/safe_integral.hpp>
+#include <bsl/span.hpp>
+#include <bsl/string_view.hpp>
+#include <bsl/ut.hpp>
+
+namespace
+{
+    /// @brief the filter type used by the tests (64 Kbit, 7 hashes)
+    using filter_type = bsl::bloom_filter<65536, 7>;
+
+    /// @brief the number of keys added by the tests
+    constexpr bsl::uint64 num_keys{6000U};
+    /// @brief the size of a page, used to make frame-like keys
+    constexpr bsl::uint64 page{0x1000U};
+
+    /// @brief stores a filter for the tests
+    filter_type g_filter1{};
+    /// @brief stores a filter for the tests
+    filter_type g_filter2{};
+    /// @brief stores a serialized filter for the tests
+    bsl::array<bsl::byte, 8192> g_buf{};
+}
+
+/// <!-- description -->
+///   @brief Used to execute the actual checks. We put the checks in this
+///     function so that we can validate the tests both at compile-time
+///     and at run-time. If a bsl::ut_check fails, the tests will either
+///     fail fast at run-time, or will produce a compile-time error.
+///
+/// <!-- inputs/outputs -->
+///   @return Always returns bsl::exit_success.
+///
+constexpr bsl::exit_code
+tests() noexcept
+{
+    bsl::ut_scenario{"properties"} = []() {
+        bsl::ut_given{} = []() {
+            bsl::ut_then{} = []() {
+                bsl::ut_check(filter_type::bits() == bsl::to_umax(65536));
+                bsl::ut_check(filter_type::hashes() == bsl::to_umax(7));
+                bsl::ut_check(filter_type::size_bytes() == bsl::to_umax(8192));
+                bsl::ut_check(bsl::bloom_filter<512, 1>::size_bytes() == bsl::to_umax(64));
+            };
+        };
+    };
+
+    bsl::ut_scenario{"add and contains"} = []() {
+        bsl::ut_given{} = []() {
+            bsl::bloom_filter<1024, 4> filter{};
+            bsl::ut_when{} = [&filter]() {
+                filter.add(bsl::to_u64(42));
+                bsl::ut_then{} = [&filter]() {
+                    bsl::ut_check(filter.contains(bsl::to_u64(42)));
+                    bsl::ut_check(!filter.empty());
+                };
+            };
+        };
+
+        bsl::ut_given{} = []() {
+            bsl::bloom_filter<1024, 4> filter{};
+            bsl::ut_when{} = [&filter]() {
+                filter.add(bsl::safe_uint64::zero(true));
+                bsl::ut_then{} = [&filter]() {
+                    bsl::ut_check(filter.empty());
+                    bsl::ut_check(!filter.contains(bsl::safe_uint64::zero(true)));
+                };
+            };
+        };
+
+        bsl::ut_given_at_runtime{} = []() {
+            bsl::bloom_filter<1024, 4> filter{};
+            bsl::string_view const key{"page hash"};
+            bsl::ut_when{} = [&filter, &key]() {
+                filter.add(bsl::as_bytes(key.data(), key.size()));
+                bsl::ut_then{} = [&filter, &key]() {
+                    bsl::ut_check(filter.contains(bsl::as_bytes(key.data(), key.size())));
+                    filter.clear();
+                    bsl::ut_check(filter.empty());
+                    bsl::ut_check(!filter.contains(bsl::as_bytes(key.data(), key.size())));
+                };
+            };
+        };
+    };
+
+    bsl::ut_scenario{"key 0 sets K bits"} = []() {
+        bsl::ut_given_at_runtime{} = []() {
+            bsl::bloom_filter<512, 4> filter{};
+            bsl::array<bsl::byte, 64> buf{};
+            bsl::ut_when{} = [&filter, &buf]() {
+                filter.add(bsl::to_u64(0));
+                bsl::discard(filter.serialize({buf.data(), buf.size()}));
+                bsl::ut_then{} = [&filter, &buf]() {
+                    bsl::uint32 count{};
+                    for (bsl::safe_uintmax i{}; i < buf.size(); ++i) {
+                        auto val{buf.at_if(i)->to_integer<bsl::uint32>()};
+                        for (; val != 0U; val &= (val - 1U)) {
+                            ++count;
+                        }
+                    }
+
+                    bsl::ut_check(count == 4U);
+                    bsl::ut_check(filter.contains(bsl::to_u64(0)));
+                };
+            };
+        };
+    };
+
+    bsl::ut_scenario{"no false negatives and few false positives"} = []() {
+        bsl::ut_given_at_runtime{} = []() {
+            g_filter1.clear();
+            for (bsl::uint64 i{}; i < num_keys; ++i) {
+                g_filter1.add(bsl::to_u64(i * page));
+            }
+
+            bsl::ut_then{} = []() {
+                for (bsl::uint64 i{}; i < num_keys; ++i) {
+                    bsl::ut_check(g_filter1.contains(bsl::to_u64(i * page)));
+                }
+
+                constexpr bsl::uint64 queries{100000U};
+                constexpr bsl::uintmax max_false_positives{1500U};
+
+                bsl::uintmax false_positives{};
+                for (bsl::uint64 i{}; i < queries; ++i) {
+                    if (g_filter1.contains(bsl::to_u64((i * page) + 1U))) {
+                        ++false_positives;
+                    }
+                }
+
+                bsl::ut_check(false_positives < max_false_positives);
+            };
+        };
+    };
+
+    bsl::ut_scenario{"merge"} = []() {
+        bsl::ut_given_at_runtime{} = []() {
+            g_filter1.clear();
+            g_filter2.clear();
+            for (bsl::uint64 i{}; i < num_keys; ++i) {
+                g_filter1.add(bsl::to_u64(i));
+                g_filter2.add(bsl::to_u64(i + num_keys));
+            }
+
+            bsl::ut_when{} = []() {
+                g_filter1.merge(g_filter2);
+                bsl::ut_then{} = []() {
+                    for (bsl::uint64 i{}; i < (num_keys + num_keys); ++i) {
+                        bsl::ut_check(g_filter1.contains(bsl::to_u64(i)));
+                    }
+                };
+            };
+        };
+    };
+
+    bsl::ut_scenario{"serialize"} = []() {
+        bsl::ut_given_at_runtime{} = []() {
+            g_filter1.clear();
+            g_filter2.clear();
+            for (bsl::uint64 i{}; i < num_keys; ++i) {
+                g_filter1.add(bsl::to_u64(i));
+            }
+
+            bsl::ut_when{} = []() {
+                auto const dst{bsl::span<bsl::byte>{g_buf.data(), g_buf.size()}};
+                auto const src{bsl::span<bsl::byte const>{g_buf.data(), g_buf.size()}};
+                auto const written{g_filter1.serialize(dst)};
+                auto const read{g_filter2.deserialize(src)};
+                bsl::ut_then{} = [&written, &read]() {
+                    bsl::ut_check(written == bsl::result<bsl::safe_uintmax>{g_buf.size()});
+                    bsl::ut_check(read == bsl::result<bsl::safe_uintmax>{g_buf.size()});
+                    for (bsl::uint64 i{}; i < num_keys; ++i) {
+                        bsl::ut_check(g_filter2.contains(bsl::to_u64(i)));
+                    }
+                };
+            };
+        };
+
+        bsl::ut_given_at_runtime{} = []() {
+            auto const small{bsl::span<bsl::byte>{g_buf.data(), bsl::to_umax(64)}};
+            auto const src{bsl::span<bsl::byte const>{g_buf.data(), bsl::to_umax(64)}};
+            bsl::ut_then{} = [&small, &src]() {
+                bsl::ut_check(g_filter1.serialize(small).errc() == bsl::errc_failure);
+                bsl::ut_check(g_filter2.deserialize(src).errc() == bsl::errc_invalid_argument);
+                bsl::ut_check(g_filter2.deserialize({}).errc() == bsl::errc_invalid_argument);
+            };
+        };
+    };
+
+    return bsl::ut_success();
+}
+
+/// <!-- description -->
+///   @brief Main function for this unit test. If a call to ut_check() fails
+///     the application will fast fail. If all calls to ut_check() pass, this
+///     function will successfully return with bsl::exit_success.
+///
+/// <!-- inputs/outputs -->
+///   @return Always returns bsl::exit_success.
+///
+bsl::exit_code
+main() noexcept
+{
+    static_assert(tests() == bsl::ut_success());
+    return tests();
+}
@@ -0,0 +1,83 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+#include <bsl/bloom_filter.hpp>
+#include <bsl/array.hpp>
+#include <bsl/byte.hpp>
+#include <bsl/convert.hpp>
+#include <bsl/span.hpp>
+#include <bsl/ut.hpp>
+
+/// <!-- description -->
+///   @brief Main function for this unit test. If a call to ut_check() fails
+///     the application will fast fail. If all calls to ut_check() pass, this
+///     function will successfully return with bsl::exit_success.
+///
+/// <!-- inputs/outputs -->
+///   @return Always returns bsl::exit_success.
+///
+bsl::exit_code
+main() noexcept
+{
+    using namespace bsl;
+
+    bsl::ut_scenario{"verify noexcept"} = []() {
+        bsl::ut_given_at_runtime{} = []() {
+            bloom_filter<512, 2> filter{};
+            bsl::array<bsl::byte, 64> buf{};
+            span<byte> const dst{buf.data(), buf.size()};
+            span<byte const> const src{buf.data(), buf.size()};
+            bsl::ut_then{} = [&filter, &dst, &src]() {
+                static_assert(noexcept(bloom_filter<512, 2>{}));
+                static_assert(noexcept(filter.add(to_u64(0))));
+                static_assert(noexcept(filter.add(src)));
+                static_assert(noexcept(filter.contains(to_u64(0))));
+                static_assert(noexcept(filter.contains(src)));
+                static_assert(noexcept(filter.merge(filter)));
+                static_assert(noexcept(filter.clear()));
+                static_assert(noexcept(filter.empty()));
+                static_assert(noexcept(filter.bits()));
+                static_assert(noexcept(filter.hashes()));
+                static_assert(noexcept(filter.size_bytes()));
+                static_assert(noexcept(filter.serialize(dst)));
+                static_assert(noexcept(filter.deserialize(src)));
+            };
+        };
+    };
+
+    bsl::ut_scenario{"verify constness"} = []() {
+        bsl::ut_given_at_runtime{} = []() {
+            bloom_filter<512, 2> const filter{};
+            bsl::array<bsl::byte, 64> buf{};
+            span<byte> const dst{buf.data(), buf.size()};
+            bsl::ut_then{} = [&filter, &dst]() {
+                bsl::ut_check(!filter.contains(to_u64(0)));
+                bsl::ut_check(filter.empty());
+                bsl::ut_check(filter.serialize(dst).success());
+            };
+        };
+    };
+
+    return bsl::ut_success();
+}
@@ -0,0 +1,244 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+#include <bsl/bounded_integral.hpp>
+#include <bsl/array.hpp>
+#include <bsl/convert.hpp>
+#include <bsl/cstdint.hpp>
+#include <bsl/is_same.hpp>
+#include <bsl/safe_integral.hpp>
+#include <bsl/ut.hpp>
+
+namespace
+{
+    /// <!-- description -->
+    ///   @brief Returns bsl::to_bounded<B>(val), which must succeed
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @tparam B the type of bsl::bounded_integral to return
+    ///   @param val the value to convert
+    ///   @return Returns bsl::to_bounded<B>(val)
+    ///
+    template<typename B>
+    [[nodiscard]] constexpr auto
+    make_bounded(bsl::safe_integral<typename B::value_type> const &val) noexcept -> B
+    {
+        auto const res{bsl::to_bounded<B>(val)};
+        return *res.get_if();
+    }
+}
+
+/// <!-- description -->
+///   @brief Used to execute the actual checks. We put the checks in this
+///     function so that we can validate the tests both at compile-time
+///     and at run-time. If a bsl::ut_check fails, the tests will either
+///     fail fast at run-time, or will produce a compile-time error.
+///
+/// <!-- inputs/outputs -->
+///   @return Always returns bsl::exit_success.
+///
+constexpr bsl::exit_code
+tests() noexcept
+{
+    bsl::ut_scenario{"bounded_integral construction"} = []() {
+        bsl::ut_given{} = []() {
+            bsl::bounded_integral<bsl::uintmax, 3U, 9U> val{};
+            bsl::ut_then{} = [&val]() {
+                bsl::ut_check(val.get() == 3U);
+                bsl::ut_check(val.min() == 3U);
+                bsl::ut_check(val.max() == 9U);
+                bsl::ut_check(val.to_safe() == bsl::to_umax(3));
+            };
+        };
+
+        bsl::ut_given{} = []() {
+            auto const val{bsl::bounded_constant<bsl::int32, -4>};
+            bsl::ut_then{} = [&val]() {
+                bsl::ut_check(val.get() == -4);
+                bsl::ut_check(val.min() == -4);
+                bsl::ut_check(val.max() == -4);
+            };
+        };
+
+        bsl::ut_given{} = []() {
+            bsl::bounded_integral<bsl::uintmax, 0U, 15U> val{
+                bsl::bounded_constant<bsl::uintmax, 7U>};
+            bsl::ut_then{} = [&val]() {
+                bsl::ut_check(val.get() == 7U);
+            };
+        };
+    };
+
+    bsl::ut_scenario{"to_bounded"} = []() {
+        bsl::ut_given{} = []() {
+            using index_type = bsl::bounded_index<16U>;
+            bsl::ut_then{} = []() {
+                auto const res{bsl::to_bounded<index_type>(bsl::to_umax(15))};
+                bsl::ut_check(res.success());
+                bsl::ut_check(res.get_if()->get() == 15U);
+            };
+        };
+
+        bsl::ut_given_at_runtime{} = []() {
+            using index_type = bsl::bounded_integral<bsl::int32, -2, 2>;
+            bsl::ut_then{} = []() {
+                bsl::ut_check(bsl::to_bounded<index_type>(bsl::to_i32(-2)).success());
+                bsl::ut_check(bsl::to_bounded<index_type>(bsl::to_i32(3)).failure());
+                bsl::ut_check(bsl::to_bounded<index_type>(bsl::to_i32(-3)).failure());
+                bsl::ut_check(
+                    bsl::to_bounded<index_type>(bsl::safe_int32::zero(true)).errc() ==
+                    bsl::errc_index_out_of_bounds);
+            };
+        };
+    };
+
+    bsl::ut_scenario{"bounded_integral arithmetic that fits"} = []() {
+        bsl::ut_given{} = []() {
+            auto const row{make_bounded<bsl::bounded_index<4U>>(bsl::to_umax(2))};
+            auto const col{make_bounded<bsl::bounded_index<8U>>(bsl::to_umax(5))};
+            bsl::ut_then{} = [&row, &col]() {
+                auto const idx{row * bsl::bounded_constant<bsl::uintmax, 8U> + col};
+                static_assert(bsl::is_same<decltype(idx), bsl::bounded_index<32U> const>::value);
+                bsl::ut_check(idx.get() == 21U);
+
+                auto const diff{col - row};
+                static_assert(bsl::is_same<decltype(diff), bsl::safe_uintmax const>::value);
+                bsl::ut_check(diff == bsl::to_umax(3));
+            };
+        };
+
+        bsl::ut_given{} = []() {
+            auto const lhs{make_bounded<bsl::bounded_integral<bsl::int32, -3, 2>>(bsl::to_i32(-3))};
+            auto const rhs{make_bounded<bsl::bounded_integral<bsl::int32, -5, 4>>(bsl::to_i32(4))};
+            bsl::ut_then{} = [&lhs, &rhs]() {
+                auto const prod{lhs * rhs};
+                static_assert(bsl::is_same<
+                              decltype(prod),
+                              bsl::bounded_integral<bsl::int32, -12, 15> const>::value);
+                bsl::ut_check(prod.get() == -12);
+
+                auto const sum{lhs + rhs};
+                static_assert(bsl::is_same<
+                              decltype(sum),
+                              bsl::bounded_integral<bsl::int32, -8, 6> const>::value);
+                bsl::ut_check(sum.get() == 1);
+
+                auto const diff{lhs - rhs};
+                static_assert(bsl::is_same<
+                              decltype(diff),
+                              bsl::bounded_integral<bsl::int32, -7, 7> const>::value);
+                bsl::ut_check(diff.get() == -7);
+            };
+        };
+
+        bsl::ut_given{} = []() {
+            auto const cnt{
+                make_bounded<bsl::bounded_integral<bsl::uint32, 0U, 1000U>>(bsl::to_u32(999))};
+            bsl::ut_then{} = [&cnt]() {
+                auto const rem{cnt % bsl::bounded_constant<bsl::uint32, 16U>};
+                static_assert(bsl::is_same<
+                              decltype(rem),
+                              bsl::bounded_integral<bsl::uint32, 0U, 15U> const>::value);
+                bsl::ut_check(rem.get() == 7U);
+
+                auto const msk{cnt & bsl::bounded_constant<bsl::uint32, 0x3FU>};
+                static_assert(bsl::is_same<
+                              decltype(msk),
+                              bsl::bounded_integral<bsl::uint32, 0U, 0x3FU> const>::value);
+                bsl::ut_check(msk.get() == 39U);
+            };
+        };
+    };
+
+    bsl::ut_scenario{"bounded_integral arithmetic that might not fit"} = []() {
+        bsl::ut_given_at_runtime{} = []() {
+            auto const lhs{
+                make_bounded<bsl::bounded_integral<bsl::uint8, 0U, 200U>>(bsl::to_u8(200))};
+            auto const rhs{
+                make_bounded<bsl::bounded_integral<bsl::uint8, 0U, 100U>>(bsl::to_u8(100))};
+            bsl::ut_then{} = [&lhs, &rhs]() {
+                auto const sum{lhs + rhs};
+                static_assert(bsl::is_same<decltype(sum), bsl::safe_uint8 const>::value);
+                bsl::ut_check(sum.failure());
+
+                auto const prod{lhs * rhs};
+                static_assert(bsl::is_same<decltype(prod), bsl::safe_uint8 const>::value);
+                bsl::ut_check(prod.failure());
+
+                auto const diff{lhs - rhs};
+                static_assert(bsl::is_same<decltype(diff), bsl::safe_uint8 const>::value);
+                bsl::ut_check(diff == bsl::to_u8(100));
+            };
+        };
+    };
+
+    bsl::ut_scenario{"bounded_integral comparisons"} = []() {
+        bsl::ut_given{} = []() {
+            auto const one{bsl::bounded_constant<bsl::uintmax, 1U>};
+            auto const two{bsl::bounded_constant<bsl::uintmax, 2U>};
+            bsl::ut_then{} = [&one, &two]() {
+                bsl::ut_check(one == one);
+                bsl::ut_check(one != two);
+                bsl::ut_check(one < two);
+                bsl::ut_check(!(two < one));
+            };
+        };
+    };
+
+    bsl::ut_scenario{"array indexed by a bounded_integral"} = []() {
+        bsl::ut_given{} = []() {
+            bsl::array<bsl::uint32, 4> arr{1U, 2U, 3U, 4U};
+            bsl::ut_then{} = [&arr]() {
+                auto const idx{bsl::bounded_constant<bsl::uintmax, 3U>};
+                bsl::ut_check(*arr.at_if(idx) == 4U);
+                *arr.at_if(bsl::bounded_index<4U>{}) = 42U;
+                bsl::ut_check(*arr.front_if() == 42U);
+            };
+        };
+
+        bsl::ut_given{} = []() {
+            bsl::array<bsl::uint32, 4> const arr{1U, 2U, 3U, 4U};
+            bsl::ut_then{} = [&arr]() {
+                bsl::ut_check(*arr.at_if(bsl::bounded_index<2U>{}) == 1U);
+            };
+        };
+    };
+
+    return bsl::ut_success();
+}
+
+/// <!-- description -->
+///   @brief Main function for this unit test. If a call to ut_check() fails
+///     the application will fast fail. If all calls to ut_check() pass, this
+///     function will successfully return with bsl::exit_success.
+///
+/// <!-- inputs/outputs -->
+///   @return Always returns bsl::exit_success.
+///
+bsl::exit_code
+main() noexcept
+{
+    static_assert(tests() == bsl::ut_success());
+    return tests();
+}
@@ -0,0 +1,210 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+#include <bsl/array.hpp>
+#include <bsl/convert.hpp>
+#include <bsl/convert_n.hpp>
+#include <bsl/cstdint.hpp>
+#include <bsl/numeric_limits.hpp>
+#include <bsl/safe_integral.hpp>
+#include <bsl/span.hpp>
+#include <bsl/ut.hpp>
+
+namespace
+{
+    /// @brief the number of elements used by the tests (spans 3 blocks)
+    constexpr bsl::uintmax num{80U};
+
+    /// <!-- description -->
+    ///   @brief Returns an array whose elements are all "val", except for
+    ///     the element at "idx", which is set to "bad".
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @tparam F the type of element to store
+    ///   @param val the value of each element
+    ///   @param idx the index of the element to set to "bad"
+    ///   @param bad the value to store at "idx"
+    ///   @return Returns the resulting array
+    ///
+    template<typename F>
+    [[nodiscard]] constexpr bsl::array<F, num>
+    make(F const val, bsl::uintmax const idx, F const bad) noexcept
+    {
+        bsl::array<F, num> src{};
+        for (bsl::uintmax i{}; i < num; ++i) {
+            *src.at_if(bsl::to_umax(i)) = (i == idx) ? bad : val;
+        }
+
+        return src;
+    }
+
+    /// <!-- description -->
+    ///   @brief Runs bsl::convert_n on "src", and returns true if the
+    ///     result agrees with running bsl::convert on each element, and
+    ///     the index returned is "expected".
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @tparam T the type to convert to
+    ///   @tparam F the type to convert from
+    ///   @param src the elements to convert
+    ///   @param expected the result convert_n is expected to return
+    ///   @return Returns true if convert_n agrees with bsl::convert
+    ///
+    template<typename T, typename F>
+    [[nodiscard]] constexpr bool
+    check_n(bsl::array<F, num> const &src, bsl::uintmax const expected) noexcept
+    {
+        bsl::array<T, num> dst{};
+        bsl::span<F const> const from{src.data(), src.size()};
+        bsl::span<T> const to{dst.data(), dst.size()};
+
+        bsl::safe_uintmax const ret{bsl::convert_n(from, to)};
+        if (ret != bsl::to_umax(expected)) {
+            return false;
+        }
+
+        for (bsl::safe_uintmax i{}; i < ret; ++i) {
+            if (*dst.at_if(i) != bsl::convert<T>(*src.at_if(i)).get()) {
+                return false;
+            }
+        }
+
+        return true;
+    }
+}
+
+/// <!-- description -->
+///   @brief Used to execute the actual checks. We put the checks in this
+///     function so that we can validate the tests both at compile-time
+///     and at run-time. If a bsl::ut_check fails, the tests will either
+///     fail fast at run-time, or will produce a compile-time error.
+///
+/// <!-- inputs/outputs -->
+///   @return Always returns bsl::exit_success.
+///
+constexpr bsl::exit_code
+tests() noexcept
+{
+    using namespace bsl;
+
+    bsl::ut_scenario{"empty"} = []() {
+        bsl::ut_given{} = []() {
+            bsl::span<bsl::uint64 const> const src{};
+            bsl::span<bsl::uint32> const dst{};
+            bsl::ut_then{} = [&src, &dst]() {
+                bsl::ut_check(convert_n(src, dst) == to_umax(0));
+            };
+        };
+    };
+
+    bsl::ut_scenario{"narrowing unsigned to unsigned"} = []() {
+        bsl::ut_then{} = []() {
+            constexpr bsl::uint64 max32{numeric_limits<bsl::uint32>::max()};
+            constexpr bsl::uint64 big{max32 + 1U};
+            bsl::ut_check(check_n<bsl::uint32>(make<bsl::uint64>(42U, num, 0U), num));
+            bsl::ut_check(check_n<bsl::uint32>(make<bsl::uint64>(42U, 0U, max32), num));
+            bsl::ut_check(check_n<bsl::uint32>(make<bsl::uint64>(42U, 0U, big), 0U));
+            bsl::ut_check(check_n<bsl::uint32>(make<bsl::uint64>(42U, 31U, big), 31U));
+            bsl::ut_check(check_n<bsl::uint32>(make<bsl::uint64>(42U, 32U, big), 32U));
+            bsl::ut_check(check_n<bsl::uint32>(make<bsl::uint64>(42U, 79U, big), 79U));
+            bsl::ut_check(check_n<bsl::uint16>(make<bsl::uint64>(1U, 50U, 65536U), 50U));
+        };
+    };
+
+    bsl::ut_scenario{"narrowing signed to signed"} = []() {
+        bsl::ut_then{} = []() {
+            constexpr bsl::int64 min16{numeric_limits<bsl::int16>::min()};
+            constexpr bsl::int64 max16{numeric_limits<bsl::int16>::max()};
+            bsl::ut_check(check_n<bsl::int16>(make<bsl::int64>(-42, 5U, min16), num));
+            bsl::ut_check(check_n<bsl::int16>(make<bsl::int64>(-42, 5U, max16), num));
+            bsl::ut_check(check_n<bsl::int16>(make<bsl::int64>(-42, 5U, min16 - 1), 5U));
+            bsl::ut_check(check_n<bsl::int16>(make<bsl::int64>(42, 70U, max16 + 1), 70U));
+        };
+    };
+
+    bsl::ut_scenario{"mixed signedness"} = []() {
+        bsl::ut_then{} = []() {
+            constexpr bsl::uint64 max32{numeric_limits<bsl::int32>::max()};
+            bsl::ut_check(check_n<bsl::uint8>(make<bsl::int32>(7, 40U, 255), num));
+            bsl::ut_check(check_n<bsl::uint8>(make<bsl::int32>(7, 40U, -1), 40U));
+            bsl::ut_check(check_n<bsl::uint8>(make<bsl::int32>(7, 40U, 256), 40U));
+            bsl::ut_check(check_n<bsl::uint64>(make<bsl::int8>(7, 3U, -128), 3U));
+            bsl::ut_check(check_n<bsl::int32>(make<bsl::uint64>(7U, 3U, max32), num));
+            bsl::ut_check(check_n<bsl::int32>(make<bsl::uint64>(7U, 3U, max32 + 1U), 3U));
+            bsl::ut_check(check_n<bsl::int8>(make<bsl::uint8>(7U, 9U, 128U), 9U));
+        };
+    };
+
+    bsl::ut_scenario{"widening"} = []() {
+        bsl::ut_then{} = []() {
+            bsl::ut_check(check_n<bsl::int64>(make<bsl::int8>(-128, 9U, 127), num));
+            bsl::ut_check(check_n<bsl::uint64>(make<bsl::uint16>(1U, 9U, 65535U), num));
+            bsl::ut_check(check_n<bsl::int32>(make<bsl::uint16>(1U, 9U, 65535U), num));
+            bsl::ut_check(check_n<bsl::uint32>(make<bsl::uint32>(1U, 9U, 2U), num));
+        };
+    };
+
+    bsl::ut_scenario{"non-const source"} = []() {
+        bsl::ut_given{} = []() {
+            bsl::array<bsl::uint64, 3U> src{1U, 2U, 3U};
+            bsl::array<bsl::uint8, 3U> dst{};
+            bsl::ut_then{} = [&src, &dst]() {
+                bsl::span<bsl::uint64> const from{src.data(), src.size()};
+                bsl::span<bsl::uint8> const to{dst.data(), dst.size()};
+                bsl::ut_check(convert_n(from, to) == to_umax(3));
+                bsl::ut_check(*dst.at_if(to_umax(2)) == to_u8(3));
+            };
+        };
+    };
+
+    bsl::ut_scenario{"dst is too small"} = []() {
+        bsl::ut_given_at_runtime{} = []() {
+            bsl::array<bsl::uint64, 3U> const src{1U, 2U, 3U};
+            bsl::array<bsl::uint8, 2U> dst{};
+            bsl::ut_then{} = [&src, &dst]() {
+                bsl::span<bsl::uint64 const> const from{src.data(), src.size()};
+                bsl::span<bsl::uint8> const to{dst.data(), dst.size()};
+                bsl::ut_check(convert_n(from, to).failure());
+                bsl::ut_check(*dst.at_if(to_umax(0)) == to_u8(0));
+            };
+        };
+    };
+
+    return bsl::ut_success();
+}
+
+/// <!-- description -->
+///   @brief Main function for this unit test. If a call to ut_check() fails
+///     the application will fast fail. If all calls to ut_check() pass, this
+///     function will successfully return with bsl::exit_success.
+///
+/// <!-- inputs/outputs -->
+///   @return Always returns bsl::exit_success.
+///
+bsl::exit_code
+main() noexcept
+{
+    static_assert(tests() == bsl::ut_success());
+    return tests();
+}
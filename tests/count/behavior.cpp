@@ -0,0 +1,150 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+#include <bsl/count.hpp>
+#include <bsl/array.hpp>
+#include <bsl/byte.hpp>
+#include <bsl/convert.hpp>
+#include <bsl/cstdint.hpp>
+#include <bsl/safe_integral.hpp>
+#include <bsl/span.hpp>
+#include <bsl/string_view.hpp>
+#include <bsl/ut.hpp>
+
+/// <!-- description -->
+///   @brief Used to execute the actual checks. We put the checks in this
+///     function so that we can validate the tests both at compile-time
+///     and at run-time. If a bsl::ut_check fails, the tests will either
+///     fail fast at run-time, or will produce a compile-time error.
+///
+/// <!-- inputs/outputs -->
+///   @return Always returns bsl::exit_success.
+///
+constexpr bsl::exit_code
+tests() noexcept
+{
+    bsl::ut_scenario{"count empty"} = []() {
+        bsl::ut_given{} = []() {
+            bsl::span<bsl::uint32 const> spn{};
+            bsl::string_view str{};
+            bsl::ut_then{} = [&spn, &str]() {
+                bsl::ut_check(bsl::count(spn, 42U) == bsl::to_umax(0));
+                bsl::ut_check(bsl::count(str, '\n') == bsl::to_umax(0));
+            };
+        };
+    };
+
+    bsl::ut_scenario{"count integrals"} = []() {
+        bsl::ut_given{} = []() {
+            bsl::array<bsl::uint32, 6> arr{1U, 2U, 1U, 3U, 1U, 2U};
+            bsl::ut_then{} = [&arr]() {
+                bsl::ut_check(bsl::count(arr, 1U) == bsl::to_umax(3));
+                bsl::ut_check(bsl::count(arr, 2U) == bsl::to_umax(2));
+                bsl::ut_check(bsl::count(arr, 4U) == bsl::to_umax(0));
+            };
+        };
+
+        bsl::ut_given{} = []() {
+            bsl::array<bsl::safe_int32, 4> arr{
+                bsl::to_i32(-1), bsl::to_i32(2), bsl::to_i32(-1), bsl::to_i32(-1)};
+            bsl::ut_then{} = [&arr]() {
+                bsl::ut_check(bsl::count(arr, bsl::to_i32(-1)) == bsl::to_umax(3));
+            };
+        };
+    };
+
+    bsl::ut_scenario{"count bytes"} = []() {
+        bsl::ut_given{} = []() {
+            bsl::string_view str{"line 1\nline 2\n\nline 4 is a bit longer\nend"};
+            bsl::ut_then{} = [&str]() {
+                bsl::ut_check(bsl::count(str, '\n') == bsl::to_umax(4));
+                bsl::ut_check(bsl::count(str, 'l') == bsl::to_umax(4));
+                bsl::ut_check(bsl::count(str, 'z') == bsl::to_umax(0));
+            };
+        };
+
+        bsl::ut_given{} = []() {
+            bsl::array<bsl::uint8, 37> arr{};
+            bsl::ut_then{} = [&arr]() {
+                bsl::ut_check(bsl::count(arr, bsl::uint8{}) == bsl::to_umax(37));
+                *arr.back_if() = static_cast<bsl::uint8>(0xFFU);
+                *arr.front_if() = static_cast<bsl::uint8>(0xFFU);
+                bsl::ut_check(bsl::count(arr, static_cast<bsl::uint8>(0xFFU)) == bsl::to_umax(2));
+                bsl::ut_check(bsl::count(arr, bsl::uint8{}) == bsl::to_umax(35));
+            };
+        };
+
+        bsl::ut_given{} = []() {
+            bsl::array<bsl::byte, 19> arr{};
+            bsl::ut_then{} = [&arr]() {
+                *arr.at_if(bsl::to_umax(7)) = bsl::byte{static_cast<bsl::uint8>(0x80U)};
+                *arr.at_if(bsl::to_umax(16)) = bsl::byte{static_cast<bsl::uint8>(0x80U)};
+                bsl::ut_check(
+                    bsl::count(arr, bsl::byte{static_cast<bsl::uint8>(0x80U)}) ==
+                    bsl::to_umax(2));
+                bsl::ut_check(bsl::count(arr, bsl::byte{}) == bsl::to_umax(17));
+            };
+        };
+    };
+
+    bsl::ut_scenario{"count bytes at run-time"} = []() {
+        bsl::ut_given_at_runtime{} = []() {
+            bsl::array<bsl::uint8, 1027> arr{};
+            bsl::ut_then{} = [&arr]() {
+                for (bsl::safe_uintmax i{}; i < arr.size(); ++i) {
+                    *arr.at_if(i) = static_cast<bsl::uint8>((i % bsl::to_umax(7)).get());
+                }
+
+                for (bsl::safe_uintmax i{}; i < bsl::to_umax(8); ++i) {
+                    bsl::span<bsl::uint8 const> spn{arr.at_if(i), arr.size() - i};
+                    bsl::safe_uintmax expected{};
+                    for (bsl::safe_uintmax j{}; j < spn.size(); ++j) {
+                        if (*spn.at_if(j) == static_cast<bsl::uint8>(3U)) {
+                            ++expected;
+                        }
+                    }
+
+                    bsl::ut_check(bsl::count(spn, static_cast<bsl::uint8>(3U)) == expected);
+                }
+            };
+        };
+    };
+
+    return bsl::ut_success();
+}
+
+/// <!-- description -->
+///   @brief Main function for this unit test. If a call to ut_check() fails
+///     the application will fast fail. If all calls to ut_check() pass, this
+///     function will successfully return with bsl::exit_success.
+///
+/// <!-- inputs/outputs -->
+///   @return Always returns bsl::exit_success.
+///
+bsl::exit_code
+main() noexcept
+{
+    static_assert(tests() == bsl::ut_success());
+    return tests();
+}
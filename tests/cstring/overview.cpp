@@ -22,6 +22,7 @@
 /// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
 /// SOFTWARE.
 
+#include <bsl/array.hpp>
 #include <bsl/cstring.hpp>
 #include <bsl/cstr_type.hpp>
 #include <bsl/ut.hpp>
@@ -81,5 +82,20 @@ main() noexcept
         };
     };
 
+    bsl::ut_scenario{"builtin_memcpy"} = []() {
+        bsl::ut_given{} = []() {
+            bsl::array<bsl::char_type, 6> dst{};
+            bsl::cstr_type msg{"Hello"};
+            bsl::ut_then{} = [&dst, &msg]() {
+                bsl::ut_check(builtin_memcpy(nullptr, msg, to_umax(5)) == nullptr);
+                bsl::ut_check(builtin_memcpy(dst.data(), nullptr, to_umax(5)) == dst.data());
+                bsl::ut_check(builtin_memcpy(dst.data(), msg, to_umax(0)) == dst.data());
+                bsl::ut_check(builtin_strlen(dst.data()) == to_umax(0));
+                bsl::ut_check(builtin_memcpy(dst.data(), msg, to_umax(5)) == dst.data());
+                bsl::ut_check(builtin_strncmp(dst.data(), msg, to_umax(5)) == 0);
+            };
+        };
+    };
+
     return bsl::ut_success();
 }
@@ -0,0 +1,240 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+#include <bsl/divider.hpp>
+#include <bsl/convert.hpp>
+#include <bsl/cstdint.hpp>
+#include <bsl/numeric_limits.hpp>
+#include <bsl/safe_integral.hpp>
+#include <bsl/ut.hpp>
+
+namespace
+{
+    /// <!-- description -->
+    ///   @brief Returns true if dividing "n" by a bsl::divider for "d"
+    ///     gives the same quotient, remainder and error state as the
+    ///     bsl::safe_integral operators.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @tparam T the integral type to divide
+    ///   @param n the value to divide
+    ///   @param div the divider to check
+    ///   @return Returns true if the results match
+    ///
+    template<typename T>
+    [[nodiscard]] constexpr auto
+    matches(T const n, bsl::divider<T> const &div) noexcept -> bool
+    {
+        bsl::safe_integral<T> const sn{n};
+        bsl::safe_integral<T> const quo{sn / div};
+        bsl::safe_integral<T> const rem{sn % div};
+
+        return (quo == (sn / div.divisor())) && (rem == (sn % div.divisor()));
+    }
+
+    /// <!-- description -->
+    ///   @brief Returns true if every n of type T (which must be 8 bits)
+    ///     matches for every non-zero divisor
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @tparam T the 8 bit integral type to check
+    ///   @return Returns true if every n and divisor match
+    ///
+    template<typename T>
+    [[nodiscard]] constexpr auto
+    matches_exhaustive() noexcept -> bool
+    {
+        constexpr bsl::int32 min{static_cast<bsl::int32>(bsl::numeric_limits<T>::min())};
+        constexpr bsl::int32 max{static_cast<bsl::int32>(bsl::numeric_limits<T>::max())};
+
+        for (bsl::int32 d{min}; d <= max; ++d) {
+            if (0 == d) {
+                continue;
+            }
+
+            bsl::divider<T> const div{bsl::safe_integral<T>{static_cast<T>(d)}};
+            for (bsl::int32 n{min}; n <= max; ++n) {
+                if ((n == min) && (d == -1)) {
+                    continue;
+                }
+
+                if (!matches(static_cast<T>(n), div)) {
+                    return false;
+                }
+            }
+        }
+
+        return true;
+    }
+
+    /// <!-- description -->
+    ///   @brief Returns true if a set of edge cases and pseudo random
+    ///     values match for a set of edge case and pseudo random
+    ///     divisors
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @tparam T the unsigned integral type to check
+    ///   @return Returns true if every n and divisor match
+    ///
+    template<typename T>
+    [[nodiscard]] constexpr auto
+    matches_sampled() noexcept -> bool
+    {
+        constexpr T max{bsl::numeric_limits<T>::max()};
+        constexpr bsl::uint32 bits{static_cast<bsl::uint32>(sizeof(T) * 8U)};
+
+        bsl::uint32 state{0x12345678U};
+        for (bsl::uint32 i{}; i < 200U; ++i) {
+            bsl::uint64 const hi{static_cast<bsl::uint64>(bsl::ut_random(state)) << 32U};
+            bsl::uint64 const rnd{hi | static_cast<bsl::uint64>(bsl::ut_random(state))};
+
+            T d{static_cast<T>(rnd >> (64U - (1U + (i % bits))))};
+            if (i < bits) {
+                d = static_cast<T>(static_cast<T>(1) << i);
+            }
+
+            if ((i >= bits) && (i < (bits * 2U))) {
+                d = static_cast<T>((static_cast<T>(1) << (i - bits)) + static_cast<T>(1));
+            }
+
+            if (static_cast<T>(0) == d) {
+                d = max;
+            }
+
+            bsl::divider<T> const div{bsl::safe_integral<T>{d}};
+            T const edges[]{
+                static_cast<T>(0),
+                static_cast<T>(1),
+                static_cast<T>(d - static_cast<T>(1)),
+                d,
+                static_cast<T>(d + static_cast<T>(1)),
+                static_cast<T>(max - static_cast<T>(1)),
+                max,
+                static_cast<T>(rnd)};
+
+            for (T const n : edges) {
+                if (!matches(n, div)) {
+                    return false;
+                }
+            }
+        }
+
+        return true;
+    }
+}
+
+/// <!-- description -->
+///   @brief Used to execute the actual checks. We put the checks in this
+///     function so that we can validate the tests both at compile-time
+///     and at run-time. If a bsl::ut_check fails, the tests will either
+///     fail fast at run-time, or will produce a compile-time error.
+///
+/// <!-- inputs/outputs -->
+///   @return Always returns bsl::exit_success.
+///
+constexpr bsl::exit_code
+tests() noexcept
+{
+    bsl::ut_scenario{"divider"} = []() {
+        bsl::ut_given{} = []() {
+            bsl::divider<bsl::uintmax> const page{bsl::to_umax(0x1000)};
+            bsl::divider<bsl::uintmax> const line{bsl::to_umax(64)};
+            bsl::divider<bsl::uintmax> const stride{bsl::to_umax(24)};
+            bsl::ut_then{} = [&page, &line, &stride]() {
+                bsl::ut_check(page.divisor() == bsl::to_umax(0x1000));
+                bsl::ut_check((bsl::to_umax(0x12345) / page) == bsl::to_umax(0x12));
+                bsl::ut_check((bsl::to_umax(0x12345) % page) == bsl::to_umax(0x345));
+                bsl::ut_check((bsl::to_umax(130) / line) == bsl::to_umax(2));
+                bsl::ut_check((bsl::to_umax(130) % line) == bsl::to_umax(2));
+                bsl::ut_check((bsl::to_umax(100) / stride) == bsl::to_umax(4));
+                bsl::ut_check((bsl::to_umax(100) % stride) == bsl::to_umax(4));
+            };
+        };
+
+        bsl::ut_given{} = []() {
+            bsl::divider<bsl::int32> const neg{bsl::to_i32(-7)};
+            bsl::divider<bsl::int32> const pos{bsl::to_i32(7)};
+            bsl::ut_then{} = [&neg, &pos]() {
+                bsl::ut_check((bsl::to_i32(50) / neg) == bsl::to_i32(-7));
+                bsl::ut_check((bsl::to_i32(50) % neg) == bsl::to_i32(1));
+                bsl::ut_check((bsl::to_i32(-50) / pos) == bsl::to_i32(-7));
+                bsl::ut_check((bsl::to_i32(-50) % pos) == bsl::to_i32(-1));
+                bsl::ut_check((bsl::to_i32(-50) / neg) == bsl::to_i32(7));
+                bsl::ut_check(matches(bsl::numeric_limits<bsl::int32>::min(), neg));
+                bsl::ut_check(matches(bsl::numeric_limits<bsl::int32>::max(), pos));
+            };
+        };
+    };
+
+    bsl::ut_scenario{"divider matches safe_integral"} = []() {
+        bsl::ut_given_at_runtime{} = []() {
+            bsl::ut_then{} = []() {
+                bsl::ut_check(matches_exhaustive<bsl::uint8>());
+                bsl::ut_check(matches_exhaustive<bsl::int8>());
+                bsl::ut_check(matches_sampled<bsl::uint16>());
+                bsl::ut_check(matches_sampled<bsl::uint32>());
+                bsl::ut_check(matches_sampled<bsl::uint64>());
+            };
+        };
+    };
+
+    bsl::ut_scenario{"divider errors"} = []() {
+        bsl::ut_given_at_runtime{} = []() {
+            bsl::divider<bsl::uint32> const zero{bsl::to_u32(0)};
+            bsl::divider<bsl::uint32> const bad{bsl::safe_uint32::zero(true)};
+            bsl::divider<bsl::int32> const neg_one{bsl::to_i32(-1)};
+            bsl::divider<bsl::uint32> const ten{bsl::to_u32(10)};
+            bsl::ut_then{} = [&zero, &bad, &neg_one, &ten]() {
+                bsl::ut_check((bsl::to_u32(42) / zero).failure());
+                bsl::ut_check((bsl::to_u32(42) % zero).failure());
+                bsl::ut_check((bsl::to_u32(42) / bad).failure());
+                bsl::ut_check((bsl::to_u32(42) % bad).failure());
+                bsl::ut_check((bsl::safe_uint32::zero(true) / ten).failure());
+                bsl::ut_check((bsl::safe_uint32::zero(true) % ten).failure());
+                bsl::ut_check((bsl::to_i32(bsl::numeric_limits<bsl::int32>::min()) / neg_one)
+                                  .failure());
+                bsl::ut_check((bsl::to_i32(bsl::numeric_limits<bsl::int32>::min()) % neg_one)
+                                  .failure());
+                bsl::ut_check((bsl::to_i32(5) / neg_one) == bsl::to_i32(-5));
+            };
+        };
+    };
+
+    return bsl::ut_success();
+}
+
+/// <!-- description -->
+///   @brief Main function for this unit test. If a call to ut_check() fails
+///     the application will fast fail. If all calls to ut_check() pass, this
+///     function will successfully return with bsl::exit_success.
+///
+/// <!-- inputs/outputs -->
+///   @return Always returns bsl::exit_success.
+///
+bsl::exit_code
+main() noexcept
+{
+    static_assert(tests() == bsl::ut_success());
+    return tests();
+}
@@ -0,0 +1,202 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+#include <bsl/cstdint.hpp>
+#include <bsl/errc_type.hpp>
+#include <bsl/error_trace.hpp>
+#include <bsl/result.hpp>
+#include <bsl/site_id.hpp>
+#include <bsl/site_table.hpp>
+#include <bsl/ut.hpp>
+
+namespace
+{
+    /// <!-- description -->
+    ///   @brief Returns a bsl::result that contains an error, used to
+    ///     test that bsl::result records errors.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @return Returns bsl::errc_failure
+    ///
+    [[nodiscard]] constexpr bsl::result<bsl::uint32>
+    fails() noexcept
+    {
+        return {bsl::errc_failure};
+    }
+}
+
+/// <!-- description -->
+///   @brief Used to execute the actual checks. We put the checks in this
+///     function so that we can validate the tests both at compile-time
+///     and at run-time. If a bsl::ut_check fails, the tests will either
+///     fail fast at run-time, or will produce a compile-time error.
+///
+/// <!-- inputs/outputs -->
+///   @return Always returns bsl::exit_success.
+///
+constexpr bsl::exit_code
+tests() noexcept
+{
+    using namespace bsl;
+
+    bsl::ut_scenario{"empty"} = []() {
+        bsl::ut_given_at_runtime{} = []() {
+            error_trace const trace{};
+            bsl::ut_then{} = [&trace]() {
+                bsl::ut_check(trace.size() == 0U);
+                bsl::ut_check(trace.total() == 0U);
+                bsl::ut_check(nullptr == trace.at_if(0U));
+            };
+        };
+    };
+
+    bsl::ut_scenario{"record"} = []() {
+        bsl::ut_given_at_runtime{} = []() {
+            error_trace trace{};
+            bsl::ut_when{} = [&trace]() {
+                trace.record(site_entry{"file.cpp", "func", 1}, 10);
+                trace.record(site_entry{"file.cpp", "func", 2}, 20);
+                bsl::ut_then{} = [&trace]() {
+                    bsl::ut_check(trace.size() == 2U);
+                    bsl::ut_check(trace.total() == 2U);
+                    bsl::ut_check(trace.at_if(0U)->site() == site_id::current("file.cpp", 2));
+                    bsl::ut_check(trace.at_if(0U)->location().line() == 2);
+                    bsl::ut_check(trace.at_if(0U)->errc() == 20);
+                    bsl::ut_check(trace.at_if(1U)->site() == site_id::current("file.cpp", 1));
+                    bsl::ut_check(trace.at_if(1U)->location().line() == 1);
+                    bsl::ut_check(trace.at_if(1U)->errc() == 10);
+                    bsl::ut_check(trace.at_if(0U)->tsc() >= trace.at_if(1U)->tsc());
+                    bsl::ut_check(nullptr == trace.at_if(2U));
+                };
+            };
+
+            bsl::ut_when{} = [&trace]() {
+                trace.clear();
+                bsl::ut_then{} = [&trace]() {
+                    bsl::ut_check(trace.size() == 0U);
+                    bsl::ut_check(nullptr == trace.at_if(0U));
+                };
+            };
+        };
+    };
+
+    bsl::ut_scenario{"the oldest errors are replaced"} = []() {
+        bsl::ut_given_at_runtime{} = []() {
+            error_trace trace{};
+            bsl::ut_when{} = [&trace]() {
+                for (bsl::uint32 i{}; i < static_cast<bsl::uint32>(error_trace_size + 3U); ++i) {
+                    trace.record(site_entry{}, static_cast<bsl::int32>(i));
+                }
+
+                bsl::ut_then{} = [&trace]() {
+                    auto const last{static_cast<bsl::int32>(error_trace_size + 2U)};
+                    bsl::ut_check(trace.size() == error_trace_size);
+                    bsl::ut_check(trace.total() == (error_trace_size + 3U));
+                    bsl::ut_check(trace.at_if(0U)->errc() == last);
+                    bsl::ut_check(trace.at_if(error_trace_size - 1U)->errc() == 3);
+                    bsl::ut_check(nullptr == trace.at_if(error_trace_size));
+                };
+            };
+        };
+    };
+
+    bsl::ut_scenario{"result and errc_type record errors"} = []() {
+        bsl::ut_given_at_runtime{} = []() {
+            this_thread_error_trace().clear();
+            bsl::ut_when{} = []() {
+                bsl::result<bsl::uint32> const res{fails()};
+                bsl::ut_then{} = [&res]() {
+                    error_trace const &trace{this_thread_error_trace()};
+                    bsl::ut_check(res.errc() == errc_failure);
+                    bsl::ut_check(trace.size() == 1U);
+                    bsl::ut_check(trace.at_if(0U)->errc() == errc_failure.get());
+
+                    site_entry const &site{trace.at_if(0U)->location()};
+                    bsl::ut_check(site.id() == trace.at_if(0U)->site());
+                    bsl::ut_check(nullptr != site.file_name());
+                    bsl::ut_check(site.line() > 0);
+                };
+            };
+
+            bsl::ut_when{} = []() {
+                this_thread_error_trace().clear();
+                errc_type const errc{-42};
+                bsl::ut_then{} = [&errc]() {
+                    error_trace const &trace{this_thread_error_trace()};
+                    bsl::ut_check(errc.failure());
+                    bsl::ut_check(trace.size() == 1U);
+                    bsl::ut_check(trace.at_if(0U)->errc() == -42);
+                };
+            };
+
+            bsl::ut_when{} = []() {
+                this_thread_error_trace().clear();
+                errc_type const errc{0};
+                bsl::result<bsl::uint32> const res{42U};
+                bsl::ut_then{} = [&errc, &res]() {
+                    bsl::ut_check(errc.success());
+                    bsl::ut_check(res.success());
+                    bsl::ut_check(this_thread_error_trace().size() == 0U);
+                };
+            };
+        };
+    };
+
+    bsl::ut_scenario{"untraced errors are not recorded"} = []() {
+        bsl::ut_given_at_runtime{} = []() {
+            this_thread_error_trace().clear();
+            bsl::ut_when{} = []() {
+                bsl::result<bsl::uint32> const res{untraced, errc_failure};
+                bsl::ut_then{} = [&res]() {
+                    bsl::ut_check(res.errc() == errc_failure);
+                    bsl::ut_check(this_thread_error_trace().size() == 0U);
+                };
+            };
+        };
+    };
+
+    bsl::ut_scenario{"nothing is recorded during constant evaluation"} = []() {
+        bsl::ut_then{} = []() {
+            bsl::result<bsl::uint32> const res{fails()};
+            bsl::ut_check(res.failure());
+        };
+    };
+
+    return bsl::ut_success();
+}
+
+/// <!-- description -->
+///   @brief Main function for this unit test. If a call to ut_check() fails
+///     the application will fast fail. If all calls to ut_check() pass, this
+///     function will successfully return with bsl::exit_success.
+///
+/// <!-- inputs/outputs -->
+///   @return Always returns bsl::exit_success.
+///
+bsl::exit_code
+main() noexcept
+{
+    static_assert(tests() == bsl::ut_success());
+    return tests();
+}
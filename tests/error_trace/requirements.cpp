@@ -0,0 +1,73 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+#include <bsl/error_trace.hpp>
+#include <bsl/is_trivially_copyable.hpp>
+#include <bsl/site_id.hpp>
+#include <bsl/site_table.hpp>
+#include <bsl/ut.hpp>
+
+/// <!-- description -->
+///   @brief Main function for this unit test. If a call to ut_check() fails
+///     the application will fast fail. If all calls to ut_check() pass, this
+///     function will successfully return with bsl::exit_success.
+///
+/// <!-- inputs/outputs -->
+///   @return Always returns bsl::exit_success.
+///
+bsl::exit_code
+main() noexcept
+{
+    using namespace bsl;
+
+    bsl::ut_scenario{"verify supports trivially copyable"} = []() {
+        static_assert(is_trivially_copyable<error_trace_entry>::value);
+        static_assert(is_trivially_copyable<error_trace>::value);
+    };
+
+    bsl::ut_scenario{"verify noexcept"} = []() {
+        bsl::ut_given{} = []() {
+            error_trace trace{};
+            error_trace_entry const entry{};
+            bsl::ut_then{} = [&trace, &entry]() {
+                static_assert(noexcept(error_trace_entry{}));
+                static_assert(noexcept(error_trace_entry{site_entry{}, 0, 0U}));
+                static_assert(noexcept(entry.site()));
+                static_assert(noexcept(entry.location()));
+                static_assert(noexcept(entry.errc()));
+                static_assert(noexcept(entry.tsc()));
+                static_assert(noexcept(error_trace{}));
+                static_assert(noexcept(trace.record(site_entry{}, 0)));
+                static_assert(noexcept(trace.size()));
+                static_assert(noexcept(trace.total()));
+                static_assert(noexcept(trace.at_if(0U)));
+                static_assert(noexcept(trace.clear()));
+                static_assert(noexcept(this_thread_error_trace()));
+                static_assert(noexcept(record_error(site_entry{}, 0)));
+            };
+        };
+    };
+
+    return bsl::ut_success();
+}
@@ -0,0 +1,354 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+#include <bsl/event_loop.hpp>
+#include <bsl/array.hpp>
+#include <bsl/convert.hpp>
+#include <bsl/discard.hpp>
+#include <bsl/safe_integral.hpp>
+#include <bsl/ut.hpp>
+
+#include <unistd.h>
+
+namespace
+{
+    constexpr bsl::uintmax num_sources{4U};
+    using loop_t = bsl::event_loop<num_sources>;
+
+    class fixture_pipe final
+    {
+    public:
+        bsl::array<bsl::int32, 2> m_fds;
+
+        fixture_pipe() noexcept
+        {
+            bsl::discard(pipe(m_fds.data()));
+        }
+
+        ~fixture_pipe() noexcept
+        {
+            close(*m_fds.front_if());
+            close(*m_fds.back_if());
+        }
+
+        fixture_pipe(fixture_pipe const &o) noexcept = delete;
+        fixture_pipe(fixture_pipe &&o) noexcept = delete;
+        fixture_pipe &operator=(fixture_pipe const &o) &noexcept = delete;
+        fixture_pipe &operator=(fixture_pipe &&o) &noexcept = delete;
+
+        [[nodiscard]] bsl::int32
+        rd() const noexcept
+        {
+            return *m_fds.front_if();
+        }
+
+        [[nodiscard]] bsl::int32
+        wr() const noexcept
+        {
+            return *m_fds.back_if();
+        }
+
+        void
+        fill() const noexcept
+        {
+            bsl::uint8 const val{42U};
+            bsl::discard(write(this->wr(), &val, sizeof(val)));
+        }
+    };
+}
+
+/// <!-- description -->
+///   @brief Used to execute the actual checks. We put the checks in this
+///     function so that we can validate the tests both at compile-time
+///     and at run-time. If a bsl::ut_check fails, the tests will either
+///     fail fast at run-time, or will produce a compile-time error.
+///
+/// <!-- inputs/outputs -->
+///   @return Always returns bsl::exit_success.
+///
+constexpr bsl::exit_code
+tests() noexcept
+{
+    bsl::ut_scenario{"constructor"} = []() {
+        bsl::ut_given_at_runtime{} = []() {
+            loop_t loop{};
+            bsl::ut_then{} = [&loop]() {
+                bsl::ut_check(!!loop);
+                bsl::ut_check(loop.run_once(0).is_zero());
+            };
+        };
+    };
+
+    bsl::ut_scenario{"add"} = []() {
+        bsl::ut_given_at_runtime{} = []() {
+            loop_t loop{};
+            fixture_pipe p{};
+            auto cb{[](bsl::int32 const fd, bsl::uint32 const events) noexcept {
+                bsl::discard(fd);
+                bsl::discard(events);
+            }};
+            bsl::ut_then{} = [&loop, &p, &cb]() {
+                bsl::ut_check(!loop.add(-1, bsl::event_loop_read, cb));
+                bsl::ut_check(!loop.add(p.rd(), bsl::event_loop_read, {}));
+                bsl::ut_check(loop.add(p.rd(), bsl::event_loop_read, cb));
+                bsl::ut_check(!loop.add(p.rd(), bsl::event_loop_read, cb));
+            };
+        };
+
+        bsl::ut_given_at_runtime{} = []() {
+            loop_t loop{};
+            fixture_pipe p1{};
+            fixture_pipe p2{};
+            fixture_pipe p3{};
+            auto cb{[](bsl::int32 const fd, bsl::uint32 const events) noexcept {
+                bsl::discard(fd);
+                bsl::discard(events);
+            }};
+            bsl::ut_then{} = [&loop, &p1, &p2, &p3, &cb]() {
+                bsl::ut_check(loop.add(p1.rd(), bsl::event_loop_read, cb));
+                bsl::ut_check(loop.add(p1.wr(), bsl::event_loop_write, cb));
+                bsl::ut_check(loop.add(p2.rd(), bsl::event_loop_read, cb));
+                bsl::ut_check(loop.add(p2.wr(), bsl::event_loop_write, cb));
+                bsl::ut_check(!loop.add(p3.rd(), bsl::event_loop_read, cb));
+                bsl::ut_check(loop.remove(p2.wr()));
+                bsl::ut_check(loop.add(p3.rd(), bsl::event_loop_read, cb));
+            };
+        };
+    };
+
+    bsl::ut_scenario{"dispatch"} = []() {
+        bsl::ut_given_at_runtime{} = []() {
+            loop_t loop{};
+            fixture_pipe p{};
+            bsl::int32 fd_called{-1};
+            bsl::uint32 events_called{};
+            auto cb{[&fd_called, &events_called](
+                        bsl::int32 const fd, bsl::uint32 const events) noexcept {
+                fd_called = fd;
+                events_called = events;
+            }};
+            bsl::ut_when{} = [&loop, &p, &cb, &fd_called, &events_called]() {
+                bsl::ut_check(loop.add(p.rd(), bsl::event_loop_read, cb));
+                bsl::ut_then{} = [&loop, &p, &fd_called, &events_called]() {
+                    bsl::ut_check(loop.run_once(0).is_zero());
+                    p.fill();
+                    bsl::ut_check(loop.run_once(0) == bsl::to_umax(1));
+                    bsl::ut_check(p.rd() == fd_called);
+                    bsl::ut_check(bsl::event_loop_read == events_called);
+                };
+            };
+        };
+
+        bsl::ut_given_at_runtime{} = []() {
+            loop_t loop{};
+            fixture_pipe p{};
+            bsl::uint32 events_called{};
+            auto cb{[&events_called](bsl::int32 const fd, bsl::uint32 const events) noexcept {
+                bsl::discard(fd);
+                events_called = events;
+            }};
+            bsl::ut_when{} = [&loop, &p, &cb, &events_called]() {
+                bsl::ut_check(loop.add(p.wr(), 0U, cb));
+                bsl::ut_then{} = [&loop, &p, &events_called]() {
+                    bsl::ut_check(loop.run_once(0).is_zero());
+                    bsl::ut_check(loop.modify(p.wr(), bsl::event_loop_write));
+                    bsl::ut_check(loop.run_once(0) == bsl::to_umax(1));
+                    bsl::ut_check(bsl::event_loop_write == events_called);
+                    bsl::ut_check(!loop.modify(p.rd(), bsl::event_loop_read));
+                };
+            };
+        };
+    };
+
+    bsl::ut_scenario{"remove"} = []() {
+        bsl::ut_given_at_runtime{} = []() {
+            loop_t loop{};
+            fixture_pipe p{};
+            bsl::safe_uintmax count{};
+            auto cb{[&count](bsl::int32 const fd, bsl::uint32 const events) noexcept {
+                bsl::discard(fd);
+                bsl::discard(events);
+                ++count;
+            }};
+            bsl::ut_when{} = [&loop, &p, &cb, &count]() {
+                bsl::ut_check(loop.add(p.rd(), bsl::event_loop_read, cb));
+                bsl::ut_then{} = [&loop, &p, &count]() {
+                    bsl::ut_check(loop.remove(p.rd()));
+                    bsl::ut_check(!loop.remove(p.rd()));
+                    p.fill();
+                    bsl::ut_check(loop.run_once(0).is_zero());
+                    bsl::ut_check(count.is_zero());
+                };
+            };
+        };
+
+        bsl::ut_given_at_runtime{} = []() {
+            loop_t loop{};
+            fixture_pipe p1{};
+            fixture_pipe p2{};
+            bsl::safe_uintmax count{};
+            auto cb{[&loop, &p1, &p2, &count](
+                        bsl::int32 const fd, bsl::uint32 const events) noexcept {
+                bsl::discard(events);
+                bsl::discard(loop.remove(p1.rd()));
+                bsl::discard(loop.remove(p2.rd()));
+                bsl::discard(fd);
+                ++count;
+            }};
+            bsl::ut_when{} = [&loop, &p1, &p2, &cb, &count]() {
+                bsl::ut_check(loop.add(p1.rd(), bsl::event_loop_read, cb));
+                bsl::ut_check(loop.add(p2.rd(), bsl::event_loop_read, cb));
+                bsl::ut_then{} = [&loop, &p1, &p2, &count]() {
+                    p1.fill();
+                    p2.fill();
+                    bsl::ut_check(loop.run_once(0) == bsl::to_umax(1));
+                    bsl::ut_check(count == bsl::to_umax(1));
+                };
+            };
+        };
+    };
+
+    bsl::ut_scenario{"timers"} = []() {
+        bsl::ut_given_at_runtime{} = []() {
+            loop_t loop{};
+            auto cb{[](bsl::int32 const fd, bsl::uint32 const events) noexcept {
+                bsl::discard(fd);
+                bsl::discard(events);
+            }};
+            bsl::ut_then{} = [&loop, &cb]() {
+                bsl::ut_check(loop.add_timer({}, false, cb).errc() == bsl::errc_invalid_argument);
+                bsl::ut_check(!loop.add_timer(bsl::to_umax(1000), false, {}));
+            };
+        };
+
+        bsl::ut_given_at_runtime{} = []() {
+            loop_t loop{};
+            bsl::safe_uintmax count{};
+            auto cb{[&count](bsl::int32 const fd, bsl::uint32 const events) noexcept {
+                bsl::discard(fd);
+                bsl::discard(events);
+                ++count;
+            }};
+            bsl::ut_when{} = [&loop, &cb, &count]() {
+                auto const fd{loop.add_timer(bsl::to_umax(1000000), false, cb)};
+                bsl::ut_then{} = [&loop, &fd, &count]() {
+                    bsl::ut_check(fd.success());
+                    bsl::ut_check(loop.run_once(1000) == bsl::to_umax(1));
+                    bsl::ut_check(loop.run_once(10).is_zero());
+                    bsl::ut_check(count == bsl::to_umax(1));
+                    bsl::ut_check(loop.remove(*fd.get_if()));
+                };
+            };
+        };
+
+        bsl::ut_given_at_runtime{} = []() {
+            loop_t loop{};
+            bsl::safe_uintmax count{};
+            auto cb{[&count](bsl::int32 const fd, bsl::uint32 const events) noexcept {
+                bsl::discard(fd);
+                bsl::discard(events);
+                ++count;
+            }};
+            bsl::ut_when{} = [&loop, &cb, &count]() {
+                bsl::ut_check(loop.add_timer(bsl::to_umax(1000000), true, cb).success());
+                bsl::ut_then{} = [&loop, &count]() {
+                    while (count < bsl::to_umax(3)) {
+                        bsl::discard(loop.run_once(1000));
+                    }
+                };
+            };
+        };
+    };
+
+    bsl::ut_scenario{"post"} = []() {
+        bsl::ut_given_at_runtime{} = []() {
+            loop_t loop{};
+            bsl::safe_uintmax count{};
+            loop_t::post_type const func{[](void *const ctx) noexcept {
+                ++*static_cast<bsl::safe_uintmax *>(ctx);
+            }};
+            bsl::ut_then{} = [&loop, &func, &count]() {
+                bsl::ut_check(!loop.post(nullptr, &count));
+                bsl::ut_check(loop.post(func, &count));
+                bsl::ut_check(loop.post(func, &count));
+                bsl::ut_check(loop.run_once(0) == bsl::to_umax(2));
+                bsl::ut_check(count == bsl::to_umax(2));
+            };
+        };
+
+        bsl::ut_given_at_runtime{} = []() {
+            loop_t loop{};
+            loop_t::post_type const func{[](void *const ctx) noexcept {
+                bsl::discard(ctx);
+            }};
+            bsl::ut_then{} = [&loop, &func]() {
+                for (bsl::safe_uintmax i{}; i < num_sources; ++i) {
+                    bsl::ut_check(loop.post(func, nullptr));
+                }
+
+                bsl::ut_check(!loop.post(func, nullptr));
+            };
+        };
+    };
+
+    bsl::ut_scenario{"run/stop"} = []() {
+        bsl::ut_given_at_runtime{} = []() {
+            loop_t loop{};
+            bsl::safe_uintmax count{};
+            loop_t::post_type const func{[](void *const ctx) noexcept {
+                ++*static_cast<bsl::safe_uintmax *>(ctx);
+            }};
+            loop_t::post_type const stop{[](void *const ctx) noexcept {
+                static_cast<loop_t *>(ctx)->stop();
+            }};
+            bsl::ut_then{} = [&loop, &func, &stop, &count]() {
+                bsl::ut_check(loop.post(func, &count));
+                bsl::ut_check(loop.post(stop, &loop));
+                loop.run();
+                bsl::ut_check(count == bsl::to_umax(1));
+                bsl::ut_check(loop.post(func, &count));
+                bsl::ut_check(loop.post(stop, &loop));
+                loop.run();
+                bsl::ut_check(count == bsl::to_umax(2));
+            };
+        };
+    };
+
+    return bsl::ut_success();
+}
+
+/// <!-- description -->
+///   @brief Main function for this unit test. If a call to ut_check() fails
+///     the application will fast fail. If all calls to ut_check() pass, this
+///     function will successfully return with bsl::exit_success.
+///
+/// <!-- inputs/outputs -->
+///   @return Always returns bsl::exit_success.
+///
+bsl::exit_code
+main() noexcept
+{
+    static_assert(tests() == bsl::ut_success());
+    return tests();
+}
@@ -0,0 +1,166 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+#include <bsl/exclusive_scan.hpp>
+#include <bsl/array.hpp>
+#include <bsl/convert.hpp>
+#include <bsl/cstdint.hpp>
+#include <bsl/errc_type.hpp>
+#include <bsl/iota.hpp>
+#include <bsl/safe_integral.hpp>
+#include <bsl/span.hpp>
+#include <bsl/ut.hpp>
+
+/// <!-- description -->
+///   @brief Used to execute the actual checks. We put the checks in this
+///     function so that we can validate the tests both at compile-time
+///     and at run-time. If a bsl::ut_check fails, the tests will either
+///     fail fast at run-time, or will produce a compile-time error.
+///
+/// <!-- inputs/outputs -->
+///   @return Always returns bsl::exit_success.
+///
+constexpr bsl::exit_code
+tests() noexcept
+{
+    bsl::ut_scenario{"exclusive_scan empty"} = []() {
+        bsl::ut_given{} = []() {
+            bsl::span<bsl::safe_uint64 const> src{};
+            bsl::span<bsl::safe_uint64> dst{};
+            bsl::ut_then{} = [&src, &dst]() {
+                auto const ret{bsl::exclusive_scan(src, dst, bsl::to_u64(42))};
+                bsl::ut_check(ret.success());
+                bsl::ut_check(ret.get_if()->is_zero());
+            };
+        };
+    };
+
+    bsl::ut_scenario{"exclusive_scan dst too small"} = []() {
+        bsl::ut_given_at_runtime{} = []() {
+            bsl::array<bsl::uint32, 4> src{};
+            bsl::array<bsl::uint32, 3> dst{};
+            bsl::ut_then{} = [&src, &dst]() {
+                auto const ret{bsl::exclusive_scan(
+                    bsl::span<bsl::uint32 const>{src.data(), src.size()},
+                    bsl::span<bsl::uint32>{dst.data(), dst.size()},
+                    0U)};
+                bsl::ut_check(ret.errc() == bsl::errc_failure);
+            };
+        };
+    };
+
+    bsl::ut_scenario{"exclusive_scan"} = []() {
+        bsl::ut_given{} = []() {
+            bsl::array<bsl::safe_uint64, 100> src{};
+            bsl::array<bsl::safe_uint64, 100> dst{};
+            bsl::ut_when{} = [&src, &dst]() {
+                bsl::iota(src, bsl::to_u64(0));
+                bsl::ut_then{} = [&src, &dst]() {
+                    auto const ret{bsl::exclusive_scan(
+                        bsl::span<bsl::safe_uint64 const>{src.data(), src.size()},
+                        bsl::span<bsl::safe_uint64>{dst.data(), dst.size()},
+                        bsl::to_u64(1))};
+                    bsl::ut_check(*ret.get_if() == src.size());
+                    for (bsl::safe_uintmax i{}; i < dst.size(); ++i) {
+                        bsl::safe_uint64 const n{bsl::to_u64(i)};
+                        bsl::safe_uint64 const m{n - bsl::to_u64(n.is_pos())};
+                        bsl::safe_uint64 const sum{(n * m) / bsl::to_u64(2)};
+                        bsl::ut_check(*dst.at_if(i) == sum + bsl::to_u64(1));
+                    }
+                };
+            };
+        };
+
+        bsl::ut_given{} = []() {
+            bsl::array<bsl::uint32, 4> arr{3U, 5U, 0U, 2U};
+            bsl::ut_when{} = [&arr]() {
+                bsl::span<bsl::uint32> const spn{arr.data(), arr.size()};
+                bsl::ut_then{} = [&arr, &spn]() {
+                    auto const ret{bsl::exclusive_scan(
+                        bsl::span<bsl::uint32 const>{spn.data(), spn.size()}, spn, 0U)};
+                    bsl::ut_check(ret.success());
+                    bsl::ut_check(*arr.at_if(bsl::to_umax(0)) == 0U);
+                    bsl::ut_check(*arr.at_if(bsl::to_umax(1)) == 3U);
+                    bsl::ut_check(*arr.at_if(bsl::to_umax(2)) == 8U);
+                    bsl::ut_check(*arr.at_if(bsl::to_umax(3)) == 8U);
+                };
+            };
+        };
+    };
+
+    bsl::ut_scenario{"exclusive_scan overflow"} = []() {
+        bsl::ut_given_at_runtime{} = []() {
+            bsl::array<bsl::uint8, 3> src{1U, 1U, 255U};
+            bsl::array<bsl::uint8, 3> dst{};
+            bsl::ut_then{} = [&src, &dst]() {
+                auto const ret{bsl::exclusive_scan(
+                    bsl::span<bsl::uint8 const>{src.data(), src.size()},
+                    bsl::span<bsl::uint8>{dst.data(), dst.size()},
+                    bsl::uint8{})};
+                bsl::ut_check(ret.success());
+            };
+        };
+
+        bsl::ut_given_at_runtime{} = []() {
+            bsl::array<bsl::uint8, 3> src{1U, 255U, 1U};
+            bsl::array<bsl::uint8, 3> dst{};
+            bsl::ut_then{} = [&src, &dst]() {
+                auto const ret{bsl::exclusive_scan(
+                    bsl::span<bsl::uint8 const>{src.data(), src.size()},
+                    bsl::span<bsl::uint8>{dst.data(), dst.size()},
+                    bsl::uint8{})};
+                bsl::ut_check(ret.errc() == bsl::errc_unsigned_wrap);
+            };
+        };
+
+        bsl::ut_given_at_runtime{} = []() {
+            bsl::array<bsl::safe_int32, 2> src{bsl::to_i32(1), bsl::to_i32(1)};
+            bsl::array<bsl::safe_int32, 2> dst{};
+            bsl::ut_then{} = [&src, &dst]() {
+                auto const ret{bsl::exclusive_scan(
+                    bsl::span<bsl::safe_int32 const>{src.data(), src.size()},
+                    bsl::span<bsl::safe_int32>{dst.data(), dst.size()},
+                    bsl::safe_int32::zero(true))};
+                bsl::ut_check(ret.errc() == bsl::errc_signed_overflow);
+            };
+        };
+    };
+
+    return bsl::ut_success();
+}
+
+/// <!-- description -->
+///   @brief Main function for this unit test. If a call to ut_check() fails
+///     the application will fast fail. If all calls to ut_check() pass, this
+///     function will successfully return with bsl::exit_success.
+///
+/// <!-- inputs/outputs -->
+///   @return Always returns bsl::exit_success.
+///
+bsl::exit_code
+main() noexcept
+{
+    static_assert(tests() == bsl::ut_success());
+    return tests();
+}
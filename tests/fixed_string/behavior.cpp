@@ -0,0 +1,246 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+#include <bsl/fixed_string.hpp>
+#include <bsl/convert.hpp>
+#include <bsl/string_view.hpp>
+#include <bsl/ut.hpp>
+
+/// <!-- description -->
+///   @brief Used to execute the actual checks. We put the checks in this
+///     function so that we can validate the tests both at compile-time
+///     and at run-time. If a bsl::ut_check fails, the tests will either
+///     fail fast at run-time, or will produce a compile-time error.
+///
+/// <!-- inputs/outputs -->
+///   @return Always returns bsl::exit_success.
+///
+constexpr bsl::exit_code
+tests() noexcept
+{
+    bsl::ut_scenario{"default constructor"} = []() {
+        bsl::ut_given{} = []() {
+            bsl::fixed_string<8> const str{};
+            bsl::ut_then{} = [&str]() {
+                bsl::ut_check(!str);
+                bsl::ut_check(str.empty());
+                bsl::ut_check(str.size().is_zero());
+                bsl::ut_check(str.length().is_zero());
+                bsl::ut_check(!str.truncated());
+                bsl::ut_check(str == "");
+                bsl::ut_check(str.view().empty());
+                bsl::ut_check(nullptr == str.front_if());
+                bsl::ut_check(nullptr == str.back_if());
+                bsl::ut_check('\0' == *str.c_str());
+            };
+        };
+    };
+
+    bsl::ut_scenario{"cstr_type constructor"} = []() {
+        bsl::ut_given{} = []() {
+            bsl::fixed_string<8> const str{"eth0"};
+            bsl::ut_then{} = [&str]() {
+                bsl::ut_check(!!str);
+                bsl::ut_check(str.size() == bsl::to_umax(4));
+                bsl::ut_check(str == "eth0");
+                bsl::ut_check(str != "eth1");
+                bsl::ut_check(str != "eth");
+                bsl::ut_check(!str.truncated());
+                bsl::ut_check('e' == *str.front_if());
+                bsl::ut_check('0' == *str.back_if());
+                bsl::ut_check(str.view() == "eth0");
+            };
+        };
+
+        bsl::ut_given{} = []() {
+            bsl::fixed_string<4> const str{"Hello World"};
+            bsl::ut_then{} = [&str]() {
+                bsl::ut_check(str.size() == bsl::to_umax(4));
+                bsl::ut_check(str == "Hell");
+                bsl::ut_check(str.truncated());
+            };
+        };
+
+        bsl::ut_given{} = []() {
+            bsl::cstr_type const msg{};
+            bsl::fixed_string<4> const str{msg};
+            bsl::ut_then{} = [&str]() {
+                bsl::ut_check(str.empty());
+                bsl::ut_check(!str.truncated());
+            };
+        };
+    };
+
+    bsl::ut_scenario{"string_view constructor"} = []() {
+        bsl::ut_given{} = []() {
+            bsl::string_view const view{"Hello World", bsl::to_umax(5)};
+            bsl::fixed_string<8> const str{view};
+            bsl::ut_then{} = [&str]() {
+                bsl::ut_check(str == "Hello");
+                bsl::ut_check(str.view() == "Hello");
+            };
+        };
+    };
+
+    bsl::ut_scenario{"at_if"} = []() {
+        bsl::ut_given{} = []() {
+            bsl::fixed_string<8> str{"abc"};
+            bsl::ut_then{} = [&str]() {
+                bsl::ut_check('b' == *str.at_if(bsl::to_umax(1)));
+                bsl::ut_check(nullptr == str.at_if(bsl::to_umax(3)));
+                bsl::ut_check(nullptr == str.at_if(bsl::to_umax(8)));
+                bsl::ut_check(nullptr == str.at_if(bsl::safe_uintmax::zero(true)));
+                *str.at_if(bsl::to_umax(1)) = 'z';
+                bsl::ut_check(str == "azc");
+            };
+        };
+
+        bsl::ut_given{} = []() {
+            bsl::fixed_string<8> const str{"abc"};
+            bsl::ut_then{} = [&str]() {
+                bsl::ut_check('c' == *str.at_if(bsl::to_umax(2)));
+                bsl::ut_check(nullptr == str.at_if(bsl::to_umax(3)));
+                bsl::ut_check(nullptr == str.at_if(bsl::safe_uintmax::zero(true)));
+            };
+        };
+    };
+
+    bsl::ut_scenario{"append"} = []() {
+        bsl::ut_given{} = []() {
+            bsl::fixed_string<8> str{"/dev"};
+            bsl::ut_when{} = [&str]() {
+                bsl::ut_check(str.append("/tty"));
+                bsl::ut_then{} = [&str]() {
+                    bsl::ut_check(str == "/dev/tty");
+                    bsl::ut_check(str.size() == bsl::fixed_string<8>::max_size());
+                    bsl::ut_check(!str.truncated());
+                };
+            };
+        };
+
+        bsl::ut_given{} = []() {
+            bsl::fixed_string<8> str{"/dev"};
+            bsl::ut_when{} = [&str]() {
+                bsl::ut_check(!str.append("/ttyS0"));
+                bsl::ut_then{} = [&str]() {
+                    bsl::ut_check(str == "/dev/tty");
+                    bsl::ut_check(str.truncated());
+                    bsl::ut_check(!str.append("x"));
+                    bsl::ut_check(!str.push_back('x'));
+                    bsl::ut_check(str == "/dev/tty");
+                };
+            };
+        };
+
+        bsl::ut_given{} = []() {
+            bsl::fixed_string<8> str{};
+            bsl::ut_when{} = [&str]() {
+                bsl::ut_check(str.append(bsl::string_view{"abcdef", bsl::to_umax(3)}));
+                bsl::ut_check(str.append(bsl::string_view{}));
+                bsl::ut_check(str.push_back('!'));
+                bsl::ut_then{} = [&str]() {
+                    bsl::ut_check(str == "abc!");
+                };
+            };
+        };
+
+        bsl::ut_given{} = []() {
+            bsl::fixed_string<8> str{};
+            bsl::ut_then{} = [&str]() {
+                bsl::ut_check(!str.append(nullptr));
+                bsl::ut_check(str.append("abc", bsl::to_umax(0)));
+                bsl::ut_check(!str.append("abc", bsl::safe_uintmax::zero(true)));
+                bsl::ut_check(str.empty());
+                bsl::ut_check(!str.truncated());
+            };
+        };
+    };
+
+    bsl::ut_scenario{"clear"} = []() {
+        bsl::ut_given{} = []() {
+            bsl::fixed_string<4> str{"Hello"};
+            bsl::ut_when{} = [&str]() {
+                str.clear();
+                bsl::ut_then{} = [&str]() {
+                    bsl::ut_check(str.empty());
+                    bsl::ut_check(!str.truncated());
+                    bsl::ut_check(str == "");
+                };
+            };
+        };
+    };
+
+    bsl::ut_scenario{"iterators"} = []() {
+        bsl::ut_given{} = []() {
+            bsl::fixed_string<8> const str{"abc"};
+            bsl::ut_then{} = [&str]() {
+                bsl::ut_check('a' == *str.begin().get_if());
+                bsl::ut_check(str.cbegin().index().is_zero());
+                bsl::ut_check(str.cend().index() == bsl::to_umax(3));
+            };
+        };
+
+        bsl::ut_given{} = []() {
+            bsl::fixed_string<8> str{"abc"};
+            bsl::ut_then{} = [&str]() {
+                *str.begin().get_if() = 'z';
+                bsl::ut_check(str == "zbc");
+                bsl::ut_check(str.begin().index().is_zero());
+                bsl::ut_check(str.end().index() == bsl::to_umax(3));
+            };
+        };
+    };
+
+    bsl::ut_scenario{"equals"} = []() {
+        bsl::ut_given{} = []() {
+            bsl::fixed_string<8> const str1{"abc"};
+            bsl::fixed_string<16> const str2{"abc"};
+            bsl::fixed_string<16> const str3{"abcd"};
+            bsl::fixed_string<16> const str4{};
+            bsl::ut_then{} = [&str1, &str2, &str3, &str4]() {
+                bsl::ut_check(str1 == str2);
+                bsl::ut_check(str1 != str3);
+                bsl::ut_check(str1 != str4);
+                bsl::ut_check(str4 == bsl::fixed_string<1>{});
+            };
+        };
+    };
+
+    return bsl::ut_success();
+}
+
+/// <!-- description -->
+///   @brief Main function for this unit test. If a call to ut_check() fails
+///     the application will fast fail. If all calls to ut_check() pass, this
+///     function will successfully return with bsl::exit_success.
+///
+/// <!-- inputs/outputs -->
+///   @return Always returns bsl::exit_success.
+///
+bsl::exit_code
+main() noexcept
+{
+    static_assert(tests() == bsl::ut_success());
+    return tests();
+}
@@ -0,0 +1,145 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+#include <bsl/fixed_string.hpp>
+#include <bsl/convert.hpp>
+#include <bsl/discard.hpp>
+#include <bsl/is_trivially_copyable.hpp>
+#include <bsl/ut.hpp>
+
+namespace
+{
+    class fixture_t final
+    {
+        bsl::fixed_string<8> str{};
+
+    public:
+        [[nodiscard]] constexpr bool
+        test_member_const() const
+        {
+            bsl::discard(str.at_if(bsl::to_umax(0)));
+            bsl::discard(str.front_if());
+            bsl::discard(str.back_if());
+            bsl::discard(str.c_str());
+            bsl::discard(str.data());
+            bsl::discard(str.view());
+            bsl::discard(str.begin());
+            bsl::discard(str.cbegin());
+            bsl::discard(str.end());
+            bsl::discard(str.cend());
+            bsl::discard(str.empty());
+            bsl::discard(!!str);
+            bsl::discard(str.size());
+            bsl::discard(str.length());
+            bsl::discard(str.max_size());
+            bsl::discard(str.truncated());
+
+            return true;
+        }
+
+        [[nodiscard]] constexpr bool
+        test_member_nonconst()
+        {
+            bsl::discard(str.at_if(bsl::to_umax(0)));
+            bsl::discard(str.begin());
+            bsl::discard(str.end());
+            bsl::discard(str.append("a"));
+            bsl::discard(str.append("a", bsl::to_umax(1)));
+            bsl::discard(str.append(bsl::string_view{}));
+            bsl::discard(str.push_back('a'));
+            str.clear();
+
+            return true;
+        }
+    };
+
+    constexpr fixture_t fixture1{};
+}
+
+/// <!-- description -->
+///   @brief Main function for this unit test. If a call to ut_check() fails
+///     the application will fast fail. If all calls to ut_check() pass, this
+///     function will successfully return with bsl::exit_success.
+///
+/// <!-- inputs/outputs -->
+///   @return Always returns bsl::exit_success.
+///
+bsl::exit_code
+main() noexcept
+{
+    using namespace bsl;
+
+    bsl::ut_scenario{"verify trivially copyable"} = []() {
+        static_assert(is_trivially_copyable<fixed_string<8>>::value);
+    };
+
+    bsl::ut_scenario{"verify noexcept"} = []() {
+        bsl::ut_given{} = []() {
+            fixed_string<8> str1{};
+            fixed_string<8> str2{};
+            bsl::ut_then{} = []() {
+                static_assert(noexcept(fixed_string<8>{}));
+                static_assert(noexcept(fixed_string<8>{"a"}));
+                static_assert(noexcept(fixed_string<8>{string_view{}}));
+                static_assert(noexcept(str1.at_if(to_umax(0))));
+                static_assert(noexcept(str1.front_if()));
+                static_assert(noexcept(str1.back_if()));
+                static_assert(noexcept(str1.c_str()));
+                static_assert(noexcept(str1.data()));
+                static_assert(noexcept(str1.view()));
+                static_assert(noexcept(str1.begin()));
+                static_assert(noexcept(str1.cbegin()));
+                static_assert(noexcept(str1.end()));
+                static_assert(noexcept(str1.cend()));
+                static_assert(noexcept(str1.empty()));
+                static_assert(noexcept(!!str1));
+                static_assert(noexcept(str1.size()));
+                static_assert(noexcept(str1.length()));
+                static_assert(noexcept(str1.max_size()));
+                static_assert(noexcept(str1.truncated()));
+                static_assert(noexcept(str1.clear()));
+                static_assert(noexcept(str1.append("a")));
+                static_assert(noexcept(str1.append("a", to_umax(1))));
+                static_assert(noexcept(str1.append(string_view{})));
+                static_assert(noexcept(str1.push_back('a')));
+                static_assert(noexcept(str1 == str2));
+                static_assert(noexcept(str1 == "a"));
+                static_assert(noexcept(str1 != str2));
+                static_assert(noexcept(str1 != "a"));
+            };
+        };
+    };
+
+    bsl::ut_scenario{"verify constness"} = []() {
+        bsl::ut_given{} = []() {
+            fixture_t fixture2{};
+            bsl::ut_then{} = [&fixture2]() {
+                static_assert(fixture1.test_member_const());
+                bsl::ut_check(fixture2.test_member_nonconst());
+            };
+        };
+    };
+
+    return bsl::ut_success();
+}
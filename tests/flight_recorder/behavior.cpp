@@ -0,0 +1,212 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+#include <bsl/cstdint.hpp>
+#include <bsl/debug.hpp>
+#include <bsl/flight_recorder.hpp>
+#include <bsl/ut.hpp>
+
+namespace
+{
+    /// <!-- description -->
+    ///   @brief Returns true if the provided strings are the same
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param lhs the first string to compare
+    ///   @param rhs the second string to compare
+    ///   @return Returns true if the provided strings are the same
+    ///
+    [[nodiscard]] constexpr bool
+    same(bsl::cstr_type const lhs, bsl::cstr_type const rhs) noexcept
+    {
+        bsl::uintmax i{};
+        for (; ('\0' != lhs[i]) && (lhs[i] == rhs[i]); ++i) {    // NOLINT
+        }
+
+        return lhs[i] == rhs[i];    // NOLINT
+    }
+}
+
+/// <!-- description -->
+///   @brief Used to execute the actual checks. We put the checks in this
+///     function so that we can validate the tests both at compile-time
+///     and at run-time. If a bsl::ut_check fails, the tests will either
+///     fail fast at run-time, or will produce a compile-time error.
+///
+/// <!-- inputs/outputs -->
+///   @return Always returns bsl::exit_success.
+///
+constexpr bsl::exit_code
+tests() noexcept
+{
+    using namespace bsl;
+
+    bsl::ut_scenario{"empty"} = []() {
+        bsl::ut_given_at_runtime{} = []() {
+            flight_recorder const recorder{};
+            bsl::ut_then{} = [&recorder]() {
+                bsl::ut_check(recorder.size() == 0U);
+                bsl::ut_check(recorder.total() == 0U);
+                bsl::ut_check(nullptr == recorder.at_if(0U));
+            };
+        };
+    };
+
+    bsl::ut_scenario{"put without a record is dropped"} = []() {
+        bsl::ut_given_at_runtime{} = []() {
+            flight_recorder recorder{};
+            bsl::ut_when{} = [&recorder]() {
+                recorder.put('*');
+                recorder.put("42");
+                bsl::ut_then{} = [&recorder]() {
+                    bsl::ut_check(recorder.size() == 0U);
+                };
+            };
+        };
+    };
+
+    bsl::ut_scenario{"records"} = []() {
+        bsl::ut_given_at_runtime{} = []() {
+            flight_recorder recorder{};
+            bsl::ut_when{} = [&recorder]() {
+                recorder.begin();
+                recorder.put("the answer is ");
+                recorder.put("42");
+                recorder.begin();
+                recorder.put('*');
+                recorder.put(nullptr);
+                bsl::ut_then{} = [&recorder]() {
+                    bsl::ut_check(recorder.size() == 2U);
+                    bsl::ut_check(recorder.total() == 2U);
+                    bsl::ut_check(same(recorder.at_if(0U), "the answer is 42"));
+                    bsl::ut_check(same(recorder.at_if(1U), "*"));
+                    bsl::ut_check(nullptr == recorder.at_if(2U));
+                };
+            };
+
+            bsl::ut_when{} = [&recorder]() {
+                recorder.clear();
+                bsl::ut_then{} = [&recorder]() {
+                    bsl::ut_check(recorder.size() == 0U);
+                    bsl::ut_check(nullptr == recorder.at_if(0U));
+                };
+            };
+        };
+    };
+
+    bsl::ut_scenario{"long records are truncated"} = []() {
+        bsl::ut_given_at_runtime{} = []() {
+            flight_recorder recorder{};
+            bsl::ut_when{} = [&recorder]() {
+                recorder.begin();
+                for (bsl::uintmax i{}; i < (flight_record_size * 2U); ++i) {
+                    recorder.put('*');
+                }
+
+                bsl::ut_then{} = [&recorder]() {
+                    bsl::uintmax len{};
+                    for (; '\0' != recorder.at_if(0U)[len]; ++len) {    // NOLINT
+                    }
+
+                    bsl::ut_check(len == (flight_record_size - 1U));
+                };
+            };
+        };
+    };
+
+    bsl::ut_scenario{"the oldest records are replaced"} = []() {
+        bsl::ut_given_at_runtime{} = []() {
+            flight_recorder recorder{};
+            bsl::ut_when{} = [&recorder]() {
+                for (bsl::uintmax i{}; i < (flight_recorder_size + 2U); ++i) {
+                    recorder.begin();
+                    recorder.put(static_cast<bsl::char_type>('a' + (i % 26U)));
+                }
+
+                bsl::ut_then{} = [&recorder]() {
+                    auto const last{(flight_recorder_size + 1U) % 26U};
+                    bsl::ut_check(recorder.size() == flight_recorder_size);
+                    bsl::ut_check(recorder.total() == (flight_recorder_size + 2U));
+                    bsl::ut_check(recorder.at_if(0U)[0] == 'c');    // NOLINT
+                    bsl::ut_check(
+                        recorder.at_if(flight_recorder_size - 1U)[0] ==    // NOLINT
+                        static_cast<bsl::char_type>('a' + last));
+                };
+            };
+        };
+    };
+
+    bsl::ut_scenario{"filtered debug output is recorded and dumped by error"} = []() {
+        bsl::ut_given_at_runtime{} = []() {
+            this_thread_flight_recorder().clear();
+            bsl::ut_when{} = []() {
+                bsl::debug<bsl::vvv>() << "the answer is " << 42 << bsl::endl;
+                bsl::alert<bsl::vvv>() << "*";
+                bsl::ut_then{} = []() {
+                    flight_recorder const &recorder{this_thread_flight_recorder()};
+                    if constexpr (bsl::vvv > BSL_DEBUG_LEVEL) {
+                        bsl::ut_check(recorder.size() == 2U);
+                        bsl::ut_check(same(recorder.at_if(0U), "the answer is 42\n"));
+                        bsl::ut_check(same(recorder.at_if(1U), "*"));
+                    }
+                    else {
+                        bsl::ut_check(recorder.size() == 0U);
+                    }
+                };
+            };
+
+            bsl::ut_when{} = []() {
+                bsl::print() << this_thread_flight_recorder();
+                bsl::error() << "dumps the flight recorder\n";
+                bsl::ut_then{} = []() {
+                    bsl::ut_check(this_thread_flight_recorder().size() == 0U);
+                };
+            };
+        };
+    };
+
+    bsl::ut_scenario{"nothing is recorded during constant evaluation"} = []() {
+        bsl::ut_then{} = []() {
+            bsl::debug<bsl::vvv>() << "the answer is " << 42 << bsl::endl;
+            bsl::error() << "the answer is " << 42 << bsl::endl;
+        };
+    };
+
+    return bsl::ut_success();
+}
+
+/// <!-- description -->
+///   @brief Main function for this unit test. If a call to ut_check() fails
+///     the application will fast fail. If all calls to ut_check() pass, this
+///     function will successfully return with bsl::exit_success.
+///
+/// <!-- inputs/outputs -->
+///   @return Always returns bsl::exit_success.
+///
+bsl::exit_code
+main() noexcept
+{
+    static_assert(tests() == bsl::ut_success());
+    return tests();
+}
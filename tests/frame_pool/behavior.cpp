@@ -0,0 +1,167 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+#include <bsl/frame_pool.hpp>
+#include <bsl/array.hpp>
+#include <bsl/ut.hpp>
+
+/// <!-- description -->
+///   @brief Used to execute the actual checks. We put the checks in this
+///     function so that we can validate the tests both at compile-time
+///     and at run-time. If a bsl::ut_check fails, the tests will either
+///     fail fast at run-time, or will produce a compile-time error.
+///
+/// <!-- inputs/outputs -->
+///   @return Always returns bsl::exit_success.
+///
+constexpr bsl::exit_code
+tests() noexcept
+{
+    bsl::ut_scenario{"default constructor"} = []() {
+        bsl::ut_given_at_runtime{} = []() {
+            bsl::frame_pool pool{};
+            bsl::ut_then{} = [&pool]() {
+                bsl::ut_check(!pool);
+                bsl::ut_check(pool.capacity().is_zero());
+                bsl::ut_check(pool.available().is_zero());
+                bsl::ut_check(pool.block_size().is_zero());
+                bsl::ut_check(nullptr == pool.allocate(bsl::to_umax(1)));
+            };
+        };
+    };
+
+    bsl::ut_scenario{"invalid constructor args"} = []() {
+        bsl::ut_given_at_runtime{} = []() {
+            bsl::frame_pool pool{{}, bsl::to_umax(64)};
+            bsl::ut_then{} = [&pool]() {
+                bsl::ut_check(!pool);
+            };
+        };
+
+        bsl::ut_given_at_runtime{} = []() {
+            alignas(64) bsl::array<bsl::byte, 256> buf{};
+            bsl::frame_pool pool{{buf.data(), buf.size()}, bsl::to_umax(0)};
+            bsl::ut_then{} = [&pool]() {
+                bsl::ut_check(!pool);
+            };
+        };
+
+        bsl::ut_given_at_runtime{} = []() {
+            alignas(64) bsl::array<bsl::byte, 256> buf{};
+            bsl::frame_pool pool{{buf.at_if(bsl::to_umax(1)), bsl::to_umax(255)}, bsl::to_umax(64)};
+            bsl::ut_then{} = [&pool]() {
+                bsl::ut_check(!pool);
+            };
+        };
+
+        bsl::ut_given_at_runtime{} = []() {
+            alignas(64) bsl::array<bsl::byte, 32> buf{};
+            bsl::frame_pool pool{{buf.data(), buf.size()}, bsl::to_umax(64)};
+            bsl::ut_then{} = [&pool]() {
+                bsl::ut_check(!pool);
+            };
+        };
+    };
+
+    bsl::ut_scenario{"constructor"} = []() {
+        bsl::ut_given_at_runtime{} = []() {
+            alignas(64) bsl::array<bsl::byte, 256> buf{};
+            bsl::frame_pool pool{{buf.data(), buf.size()}, bsl::to_umax(48)};
+            bsl::ut_then{} = [&pool]() {
+                bsl::ut_check(!!pool);
+                bsl::ut_check(pool.block_size() == bsl::to_umax(48));
+                bsl::ut_check(pool.capacity() == bsl::to_umax(4));
+                bsl::ut_check(pool.available() == bsl::to_umax(4));
+            };
+        };
+
+        bsl::ut_given_at_runtime{} = []() {
+            alignas(64) bsl::array<bsl::byte, 256> buf{};
+            bsl::frame_pool pool{{buf.data(), buf.size()}, bsl::to_umax(42)};
+            bsl::ut_then{} = [&pool]() {
+                bsl::ut_check(pool.block_size() == bsl::to_umax(48));
+            };
+        };
+    };
+
+    bsl::ut_scenario{"allocate/deallocate"} = []() {
+        bsl::ut_given_at_runtime{} = []() {
+            alignas(64) bsl::array<bsl::byte, 256> buf{};
+            bsl::frame_pool pool{{buf.data(), buf.size()}, bsl::to_umax(48)};
+            bsl::ut_then{} = [&pool]() {
+                bsl::ut_check(nullptr == pool.allocate(bsl::to_umax(49)));
+                bsl::ut_check(pool.available() == bsl::to_umax(4));
+            };
+        };
+
+        bsl::ut_given_at_runtime{} = []() {
+            alignas(64) bsl::array<bsl::byte, 256> buf{};
+            bsl::frame_pool pool{{buf.data(), buf.size()}, bsl::to_umax(48)};
+            bsl::ut_when{} = [&pool]() {
+                void *const ptr1{pool.allocate(bsl::to_umax(48))};
+                void *const ptr2{pool.allocate(bsl::to_umax(1))};
+                void *const ptr3{pool.allocate(bsl::to_umax(16))};
+                void *const ptr4{pool.allocate(bsl::to_umax(32))};
+                bsl::ut_then{} = [&pool, ptr1, ptr2, ptr3, ptr4]() {
+                    bsl::ut_check(nullptr != ptr1);
+                    bsl::ut_check(nullptr != ptr2);
+                    bsl::ut_check(nullptr != ptr3);
+                    bsl::ut_check(nullptr != ptr4);
+                    bsl::ut_check(ptr1 != ptr2);
+                    bsl::ut_check((bsl::to_uptr(ptr1) % pool.alignment()).is_zero());
+                    bsl::ut_check(pool.available().is_zero());
+                    bsl::ut_check(nullptr == pool.allocate(bsl::to_umax(1)));
+
+                    bsl::frame_pool::deallocate(ptr2);
+                    bsl::ut_check(pool.available() == bsl::to_umax(1));
+                    bsl::ut_check(ptr2 == pool.allocate(bsl::to_umax(1)));
+
+                    bsl::frame_pool::deallocate(ptr1);
+                    bsl::frame_pool::deallocate(ptr2);
+                    bsl::frame_pool::deallocate(ptr3);
+                    bsl::frame_pool::deallocate(ptr4);
+                    bsl::frame_pool::deallocate(nullptr);
+                    bsl::ut_check(pool.available() == bsl::to_umax(4));
+                };
+            };
+        };
+    };
+
+    return bsl::ut_success();
+}
+
+/// <!-- description -->
+///   @brief Main function for this unit test. If a call to ut_check() fails
+///     the application will fast fail. If all calls to ut_check() pass, this
+///     function will successfully return with bsl::exit_success.
+///
+/// <!-- inputs/outputs -->
+///   @return Always returns bsl::exit_success.
+///
+bsl::exit_code
+main() noexcept
+{
+    static_assert(tests() == bsl::ut_success());
+    return tests();
+}
@@ -0,0 +1,84 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+#include <bsl/frame_pool.hpp>
+#include <bsl/is_copy_assignable.hpp>
+#include <bsl/is_copy_constructible.hpp>
+#include <bsl/is_move_assignable.hpp>
+#include <bsl/is_move_constructible.hpp>
+#include <bsl/ut.hpp>
+
+/// <!-- description -->
+///   @brief Main function for this unit test. If a call to ut_check() fails
+///     the application will fast fail. If all calls to ut_check() pass, this
+///     function will successfully return with bsl::exit_success.
+///
+/// <!-- inputs/outputs -->
+///   @return Always returns bsl::exit_success.
+///
+bsl::exit_code
+main() noexcept
+{
+    using namespace bsl;
+
+    bsl::ut_scenario{"frame_pool can neither be copied nor moved"} = []() {
+        bsl::ut_then{} = []() {
+            static_assert(!is_copy_constructible<frame_pool>::value);
+            static_assert(!is_move_constructible<frame_pool>::value);
+            static_assert(!is_copy_assignable<frame_pool>::value);
+            static_assert(!is_move_assignable<frame_pool>::value);
+        };
+    };
+
+    bsl::ut_scenario{"verify noexcept"} = []() {
+        bsl::ut_given{} = []() {
+            frame_pool pool{};
+            bsl::ut_then{} = []() {
+                static_assert(noexcept(frame_pool{}));
+                static_assert(noexcept(frame_pool{span<byte>{}, safe_uintmax{}}));
+                static_assert(noexcept(frame_pool::alignment()));
+                static_assert(noexcept(pool.allocate(safe_uintmax{})));
+                static_assert(noexcept(frame_pool::deallocate(nullptr)));
+                static_assert(noexcept(pool.capacity()));
+                static_assert(noexcept(pool.available()));
+                static_assert(noexcept(pool.block_size()));
+                static_assert(noexcept(!!pool));
+            };
+        };
+    };
+
+    bsl::ut_scenario{"verify constness"} = []() {
+        bsl::ut_given{} = []() {
+            frame_pool const pool{};
+            bsl::ut_then{} = []() {
+                static_assert(noexcept(pool.capacity()));
+                static_assert(noexcept(pool.available()));
+                static_assert(noexcept(pool.block_size()));
+                static_assert(noexcept(!!pool));
+            };
+        };
+    };
+
+    return bsl::ut_success();
+}
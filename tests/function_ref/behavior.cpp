@@ -0,0 +1,161 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+#include <bsl/function_ref.hpp>
+#include <bsl/convert.hpp>
+#include <bsl/safe_integral.hpp>
+#include <bsl/ut.hpp>
+
+namespace
+{
+    [[nodiscard]] bsl::safe_uintmax
+    add_one(bsl::safe_uintmax const &val) noexcept
+    {
+        return val + bsl::to_umax(1);
+    }
+
+    class functor final
+    {
+    public:
+        bsl::safe_uintmax m_sum;
+
+        [[nodiscard]] bsl::safe_uintmax
+        operator()(bsl::safe_uintmax const &val) noexcept
+        {
+            m_sum += val;
+            return m_sum;
+        }
+    };
+}
+
+/// <!-- description -->
+///   @brief Used to execute the actual checks. We put the checks in this
+///     function so that we can validate the tests both at compile-time
+///     and at run-time. If a bsl::ut_check fails, the tests will either
+///     fail fast at run-time, or will produce a compile-time error.
+///
+/// <!-- inputs/outputs -->
+///   @return Always returns bsl::exit_success.
+///
+constexpr bsl::exit_code
+tests() noexcept
+{
+    bsl::ut_scenario{"default constructor"} = []() {
+        bsl::ut_given_at_runtime{} = []() {
+            bsl::function_ref<bsl::safe_uintmax(bsl::safe_uintmax const &)> fr{};
+            bsl::ut_then{} = [&fr]() {
+                bsl::ut_check(!fr);
+                bsl::ut_check(fr(bsl::to_umax(42)).is_zero());
+            };
+        };
+
+        bsl::ut_given_at_runtime{} = []() {
+            bsl::function_ref<void()> fr{};
+            bsl::ut_then{} = [&fr]() {
+                bsl::ut_check(!fr);
+                fr();
+            };
+        };
+
+        bsl::ut_given{} = []() {
+            bsl::function_ref<void()> const fr{};
+            bsl::ut_then{} = [&fr]() {
+                bsl::ut_check(!fr);
+            };
+        };
+    };
+
+    bsl::ut_scenario{"function pointer"} = []() {
+        bsl::ut_given_at_runtime{} = []() {
+            bsl::function_ref<bsl::safe_uintmax(bsl::safe_uintmax const &)> fr{&add_one};
+            bsl::ut_then{} = [&fr]() {
+                bsl::ut_check(!!fr);
+                bsl::ut_check(fr(bsl::to_umax(42)) == bsl::to_umax(43));
+            };
+        };
+
+        bsl::ut_given_at_runtime{} = []() {
+            bsl::safe_uintmax (*fp)(bsl::safe_uintmax const &){};
+            bsl::function_ref<bsl::safe_uintmax(bsl::safe_uintmax const &)> fr{fp};
+            bsl::ut_then{} = [&fr]() {
+                bsl::ut_check(!fr);
+            };
+        };
+    };
+
+    bsl::ut_scenario{"lambda"} = []() {
+        bsl::ut_given_at_runtime{} = []() {
+            bsl::safe_uintmax sum{};
+            auto func{[&sum](bsl::safe_uintmax const &val) noexcept {
+                sum += val;
+            }};
+            bsl::function_ref<void(bsl::safe_uintmax const &)> fr{func};
+            bsl::ut_then{} = [&fr, &sum]() {
+                fr(bsl::to_umax(23));
+                fr(bsl::to_umax(42));
+                bsl::ut_check(sum == bsl::to_umax(65));
+            };
+        };
+
+        bsl::ut_given_at_runtime{} = []() {
+            auto const func{[](bsl::safe_uintmax const &val) noexcept {
+                return val + bsl::to_umax(2);
+            }};
+            bsl::function_ref<bsl::safe_uintmax(bsl::safe_uintmax const &)> fr{func};
+            bsl::ut_then{} = [&fr]() {
+                bsl::ut_check(fr(bsl::to_umax(40)) == bsl::to_umax(42));
+            };
+        };
+    };
+
+    bsl::ut_scenario{"functor"} = []() {
+        bsl::ut_given_at_runtime{} = []() {
+            functor f{};
+            bsl::function_ref<bsl::safe_uintmax(bsl::safe_uintmax const &)> fr1{f};
+            bsl::function_ref<bsl::safe_uintmax(bsl::safe_uintmax const &)> fr2{fr1};
+            bsl::ut_then{} = [&f, &fr1, &fr2]() {
+                bsl::ut_check(fr1(bsl::to_umax(23)) == bsl::to_umax(23));
+                bsl::ut_check(fr2(bsl::to_umax(42)) == bsl::to_umax(65));
+                bsl::ut_check(f.m_sum == bsl::to_umax(65));
+            };
+        };
+    };
+
+    return bsl::ut_success();
+}
+
+/// <!-- description -->
+///   @brief Main function for this unit test. If a call to ut_check() fails
+///     the application will fast fail. If all calls to ut_check() pass, this
+///     function will successfully return with bsl::exit_success.
+///
+/// <!-- inputs/outputs -->
+///   @return Always returns bsl::exit_success.
+///
+bsl::exit_code
+main() noexcept
+{
+    static_assert(tests() == bsl::ut_success());
+    return tests();
+}
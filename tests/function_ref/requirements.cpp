@@ -0,0 +1,79 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+#include <bsl/function_ref.hpp>
+#include <bsl/is_constructible.hpp>
+#include <bsl/is_trivially_copyable.hpp>
+#include <bsl/ut.hpp>
+
+namespace
+{
+    class callable final
+    {
+    public:
+        constexpr void
+        operator()() const noexcept
+        {}
+    };
+}
+
+/// <!-- description -->
+///   @brief Main function for this unit test. If a call to ut_check() fails
+///     the application will fast fail. If all calls to ut_check() pass, this
+///     function will successfully return with bsl::exit_success.
+///
+/// <!-- inputs/outputs -->
+///   @return Always returns bsl::exit_success.
+///
+bsl::exit_code
+main() noexcept
+{
+    using namespace bsl;
+
+    bsl::ut_scenario{"verify trivially copyable"} = []() {
+        static_assert(is_trivially_copyable<function_ref<void()>>::value);
+    };
+
+    bsl::ut_scenario{"verify temporaries are rejected"} = []() {
+        static_assert(is_constructible<function_ref<void()>, callable &>::value);
+        static_assert(is_constructible<function_ref<void()>, callable const &>::value);
+        static_assert(!is_constructible<function_ref<void()>, callable>::value);
+        static_assert(!is_constructible<function_ref<void()>, callable &&>::value);
+    };
+
+    bsl::ut_scenario{"verify noexcept"} = []() {
+        bsl::ut_given{} = []() {
+            function_ref<void()> fr{};
+            callable c{};
+            bsl::ut_then{} = []() {
+                static_assert(noexcept(function_ref<void()>{}));
+                static_assert(noexcept(function_ref<void()>{c}));
+                static_assert(noexcept(fr()));
+                static_assert(noexcept(!!fr));
+            };
+        };
+    };
+
+    return bsl::ut_success();
+}
@@ -0,0 +1,158 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+#include <bsl/generator.hpp>
+#include <bsl/array.hpp>
+#include <bsl/convert.hpp>
+#include <bsl/frame_pool.hpp>
+#include <bsl/safe_integral.hpp>
+#include <bsl/ut.hpp>
+
+namespace
+{
+    [[nodiscard]] bsl::generator<bsl::safe_uintmax>
+    count(bsl::frame_pool &pool, bsl::safe_uintmax const n) noexcept
+    {
+        bsl::discard(pool);
+        for (bsl::safe_uintmax i{}; i < n; ++i) {
+            co_yield i;
+        }
+    }
+}
+
+/// <!-- description -->
+///   @brief Used to execute the actual checks. We put the checks in this
+///     function so that we can validate the tests both at compile-time
+///     and at run-time. If a bsl::ut_check fails, the tests will either
+///     fail fast at run-time, or will produce a compile-time error.
+///
+/// <!-- inputs/outputs -->
+///   @return Always returns bsl::exit_success.
+///
+constexpr bsl::exit_code
+tests() noexcept
+{
+    bsl::ut_scenario{"default constructor"} = []() {
+        bsl::ut_given_at_runtime{} = []() {
+            bsl::generator<bsl::safe_uintmax> gen{};
+            bsl::ut_then{} = [&gen]() {
+                bsl::ut_check(!gen);
+                bsl::ut_check(!gen.next());
+                bsl::ut_check(nullptr == gen.get_if());
+            };
+        };
+    };
+
+    bsl::ut_scenario{"next"} = []() {
+        bsl::ut_given_at_runtime{} = []() {
+            alignas(64) bsl::array<bsl::byte, 4096> buf{};
+            bsl::frame_pool pool{{buf.data(), buf.size()}, bsl::to_umax(1008)};
+            bsl::ut_when{} = [&pool]() {
+                auto gen{count(pool, bsl::to_umax(3))};
+                bsl::ut_then{} = [&pool, &gen]() {
+                    bsl::ut_check(!!gen);
+                    bsl::ut_check(nullptr == gen.get_if());
+                    bsl::ut_check(pool.available() == bsl::to_umax(3));
+                    bsl::ut_check(gen.next());
+                    bsl::ut_check(*gen.get_if() == bsl::to_umax(0));
+                    bsl::ut_check(gen.next());
+                    bsl::ut_check(*gen.get_if() == bsl::to_umax(1));
+                    bsl::ut_check(gen.next());
+                    bsl::ut_check(*gen.get_if() == bsl::to_umax(2));
+                    bsl::ut_check(!gen.next());
+                    bsl::ut_check(nullptr == gen.get_if());
+                    bsl::ut_check(!gen.next());
+                };
+            };
+            bsl::ut_then{} = [&pool]() {
+                bsl::ut_check(pool.available() == bsl::to_umax(4));
+            };
+        };
+
+        bsl::ut_given_at_runtime{} = []() {
+            alignas(64) bsl::array<bsl::byte, 4096> buf{};
+            bsl::frame_pool pool{{buf.data(), buf.size()}, bsl::to_umax(1008)};
+            bsl::ut_when{} = [&pool]() {
+                auto gen{count(pool, bsl::to_umax(0))};
+                bsl::ut_then{} = [&gen]() {
+                    bsl::ut_check(!gen.next());
+                    bsl::ut_check(nullptr == gen.get_if());
+                };
+            };
+        };
+    };
+
+    bsl::ut_scenario{"out of frames"} = []() {
+        bsl::ut_given_at_runtime{} = []() {
+            alignas(64) bsl::array<bsl::byte, 1024> buf{};
+            bsl::frame_pool pool{{buf.data(), buf.size()}, bsl::to_umax(1008)};
+            bsl::ut_when{} = [&pool]() {
+                auto gen1{count(pool, bsl::to_umax(3))};
+                auto gen2{count(pool, bsl::to_umax(3))};
+                bsl::ut_then{} = [&gen1, &gen2]() {
+                    bsl::ut_check(!!gen1);
+                    bsl::ut_check(!gen2);
+                    bsl::ut_check(!gen2.next());
+                };
+            };
+        };
+    };
+
+    bsl::ut_scenario{"move"} = []() {
+        bsl::ut_given_at_runtime{} = []() {
+            alignas(64) bsl::array<bsl::byte, 4096> buf{};
+            bsl::frame_pool pool{{buf.data(), buf.size()}, bsl::to_umax(1008)};
+            bsl::ut_when{} = [&pool]() {
+                auto gen1{count(pool, bsl::to_umax(3))};
+                auto gen2{bsl::move(gen1)};
+                bsl::ut_then{} = [&pool, &gen1, &gen2]() {
+                    bsl::ut_check(!gen1);
+                    bsl::ut_check(gen2.next());
+                    gen1 = count(pool, bsl::to_umax(1));
+                    gen2 = bsl::move(gen1);
+                    bsl::ut_check(pool.available() == bsl::to_umax(3));
+                    bsl::ut_check(gen2.next());
+                    bsl::ut_check(*gen2.get_if() == bsl::to_umax(0));
+                };
+            };
+        };
+    };
+
+    return bsl::ut_success();
+}
+
+/// <!-- description -->
+///   @brief Main function for this unit test. If a call to ut_check() fails
+///     the application will fast fail. If all calls to ut_check() pass, this
+///     function will successfully return with bsl::exit_success.
+///
+/// <!-- inputs/outputs -->
+///   @return Always returns bsl::exit_success.
+///
+bsl::exit_code
+main() noexcept
+{
+    static_assert(tests() == bsl::ut_success());
+    return tests();
+}
@@ -0,0 +1,184 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+#include <bsl/hex.hpp>
+#include <bsl/array.hpp>
+#include <bsl/byte.hpp>
+#include <bsl/convert.hpp>
+#include <bsl/cstdint.hpp>
+#include <bsl/fixed_string.hpp>
+#include <bsl/result.hpp>
+#include <bsl/safe_integral.hpp>
+#include <bsl/span.hpp>
+#include <bsl/ut.hpp>
+
+namespace
+{
+    /// @brief the size of the buffers used by the round trip test
+    constexpr bsl::uintmax buf_size{300U};
+
+    /// @brief stores the input of the round trip test
+    bsl::array<bsl::uint8, buf_size> g_in{};
+    /// @brief stores the output of the round trip test
+    bsl::array<bsl::uint8, buf_size> g_back{};
+    /// @brief stores the text of the round trip test
+    bsl::fixed_string<buf_size + buf_size> g_text{};
+}
+
+/// <!-- description -->
+///   @brief Used to execute the actual checks. We put the checks in this
+///     function so that we can validate the tests both at compile-time
+///     and at run-time. If a bsl::ut_check fails, the tests will either
+///     fail fast at run-time, or will produce a compile-time error.
+///
+/// <!-- inputs/outputs -->
+///   @return Always returns bsl::exit_success.
+///
+constexpr bsl::exit_code
+tests() noexcept
+{
+    bsl::ut_scenario{"sizes"} = []() {
+        bsl::ut_given{} = []() {
+            bsl::ut_then{} = []() {
+                bsl::ut_check(bsl::hex_encoded_size(bsl::to_umax(0)) == bsl::to_umax(0));
+                bsl::ut_check(bsl::hex_encoded_size(bsl::to_umax(5)) == bsl::to_umax(10));
+                bsl::ut_check(bsl::hex_decoded_size(bsl::to_umax(10)) == bsl::to_umax(5));
+                bsl::ut_check(bsl::hex_decoded_size(bsl::to_umax(11)) == bsl::to_umax(5));
+                bsl::ut_check(!bsl::hex_encoded_size(bsl::safe_uintmax::zero(true)));
+            };
+        };
+    };
+
+    bsl::ut_scenario{"encode"} = []() {
+        bsl::ut_given_at_runtime{} = []() {
+            bsl::array<bsl::uint8, 7> const data{0x00U, 0x12U, 0xABU, 0xFFU, 0x9AU, 0x5CU, 0x01U};
+            bsl::fixed_string<20> str{"0x"};
+            bsl::ut_when{} = [&data, &str]() {
+                auto const ret{bsl::hex_encode(bsl::as_bytes(data.data(), data.size()), str)};
+                bsl::ut_then{} = [&str, &ret]() {
+                    bsl::ut_check(ret == bsl::result<bsl::safe_uintmax>{bsl::to_umax(14)});
+                    bsl::ut_check(str == "0x0012abff9a5c01");
+                };
+            };
+        };
+
+        bsl::ut_given_at_runtime{} = []() {
+            bsl::fixed_string<4> str{"ab"};
+            bsl::ut_then{} = [&str]() {
+                auto const ret{bsl::hex_encode({}, str)};
+                bsl::ut_check(ret == bsl::result<bsl::safe_uintmax>{bsl::to_umax(0)});
+                bsl::ut_check(str == "ab");
+            };
+        };
+
+        bsl::ut_given_at_runtime{} = []() {
+            bsl::array<bsl::uint8, 2> const data{0x12U, 0x34U};
+            bsl::fixed_string<4> str{"a"};
+            bsl::ut_when{} = [&data, &str]() {
+                auto const ret{bsl::hex_encode(bsl::as_bytes(data.data(), data.size()), str)};
+                bsl::ut_then{} = [&str, &ret]() {
+                    bsl::ut_check(ret.errc() == bsl::errc_failure);
+                    bsl::ut_check(str == "a");
+                    bsl::ut_check(!str.truncated());
+                };
+            };
+        };
+    };
+
+    bsl::ut_scenario{"decode"} = []() {
+        bsl::ut_given_at_runtime{} = []() {
+            bsl::array<bsl::uint8, 4> data{};
+            bsl::ut_when{} = [&data]() {
+                auto const dst{bsl::as_writable_bytes(data.data(), data.size())};
+                auto const ret{bsl::hex_decode("09aFBc7e", dst)};
+                bsl::ut_then{} = [&data, &ret]() {
+                    bsl::ut_check(ret == bsl::result<bsl::safe_uintmax>{bsl::to_umax(4)});
+                    bsl::ut_check(*data.at_if(bsl::to_umax(0)) == 0x09U);
+                    bsl::ut_check(*data.at_if(bsl::to_umax(1)) == 0xAFU);
+                    bsl::ut_check(*data.at_if(bsl::to_umax(2)) == 0xBCU);
+                    bsl::ut_check(*data.at_if(bsl::to_umax(3)) == 0x7EU);
+                };
+            };
+        };
+
+        bsl::ut_given_at_runtime{} = []() {
+            bsl::array<bsl::uint8, 4> data{};
+            bsl::ut_when{} = [&data]() {
+                auto const dst{bsl::as_writable_bytes(data.data(), data.size())};
+                bsl::ut_then{} = [&dst]() {
+                    constexpr auto inval{bsl::errc_invalid_argument};
+                    auto const empty{bsl::hex_decode({}, dst)};
+                    bsl::ut_check(empty == bsl::result<bsl::safe_uintmax>{bsl::to_umax(0)});
+                    bsl::ut_check(bsl::hex_decode("abc", dst).errc() == inval);
+                    bsl::ut_check(bsl::hex_decode("0x12", dst).errc() == inval);
+                    bsl::ut_check(bsl::hex_decode("12 4", dst).errc() == inval);
+                    bsl::ut_check(bsl::hex_decode("1g", dst).errc() == inval);
+                    bsl::ut_check(bsl::hex_decode("G1", dst).errc() == inval);
+                    bsl::ut_check(bsl::hex_decode("0123456789", dst).errc() == bsl::errc_failure);
+                };
+            };
+        };
+    };
+
+    bsl::ut_scenario{"round trip"} = []() {
+        bsl::ut_given_at_runtime{} = []() {
+            constexpr bsl::uint8 mul{37U};
+            for (bsl::safe_uintmax i{}; i < g_in.size(); ++i) {
+                *g_in.at_if(i) = static_cast<bsl::uint8>(i.get() * mul);
+            }
+
+            bsl::ut_then{} = []() {
+                for (bsl::safe_uintmax n{bsl::to_umax(1)}; n <= g_in.size(); ++n) {
+                    g_text.clear();
+                    auto const src{bsl::as_bytes(g_in.data(), n)};
+                    auto const dst{bsl::as_writable_bytes(g_back.data(), g_back.size())};
+
+                    bsl::ut_check(bsl::hex_encode(src, g_text).success());
+                    bsl::ut_check(g_text.size() == n + n);
+                    bsl::ut_check(bsl::hex_decode(g_text.view(), dst).success());
+                    for (bsl::safe_uintmax i{}; i < n; ++i) {
+                        bsl::ut_check(*g_in.at_if(i) == *g_back.at_if(i));
+                    }
+                }
+            };
+        };
+    };
+
+    return bsl::ut_success();
+}
+
+/// <!-- description -->
+///   @brief Main function for this unit test. If a call to ut_check() fails
+///     the application will fast fail. If all calls to ut_check() pass, this
+///     function will successfully return with bsl::exit_success.
+///
+/// <!-- inputs/outputs -->
+///   @return Always returns bsl::exit_success.
+///
+bsl::exit_code
+main() noexcept
+{
+    static_assert(tests() == bsl::ut_success());
+    return tests();
+}
@@ -0,0 +1,183 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+#include <bsl/intern_table.hpp>
+#include <bsl/convert.hpp>
+#include <bsl/error_trace.hpp>
+#include <bsl/result.hpp>
+#include <bsl/safe_integral.hpp>
+#include <bsl/string_view.hpp>
+#include <bsl/ut.hpp>
+
+namespace
+{
+    /// @brief defines the table used by most of the tests
+    using table_type = bsl::intern_table<8, 64>;
+}
+
+/// <!-- description -->
+///   @brief Used to execute the actual checks. We put the checks in this
+///     function so that we can validate the tests both at compile-time
+///     and at run-time. If a bsl::ut_check fails, the tests will either
+///     fail fast at run-time, or will produce a compile-time error.
+///
+/// <!-- inputs/outputs -->
+///   @return Always returns bsl::exit_success.
+///
+constexpr bsl::exit_code
+tests() noexcept
+{
+    bsl::ut_scenario{"empty table"} = []() {
+        bsl::ut_given_at_runtime{} = []() {
+            table_type table{};
+            bsl::this_thread_error_trace().clear();
+            bsl::ut_then{} = [&table]() {
+                bsl::ut_check(table.size().is_zero());
+                bsl::ut_check(table.max_size() == bsl::to_umax(8));
+                bsl::ut_check(!table.find("cpu"));
+                bsl::ut_check(bsl::this_thread_error_trace().size() == 0U);
+                bsl::ut_check(table.get(bsl::to_u32(0)).empty());
+                bsl::ut_check(table.get(bsl::safe_uint32::zero(true)).empty());
+            };
+        };
+    };
+
+    bsl::ut_scenario{"intern"} = []() {
+        bsl::ut_given_at_runtime{} = []() {
+            table_type table{};
+            bsl::ut_when{} = [&table]() {
+                auto const id1{table.intern("cpu")};
+                auto const id2{table.intern("net")};
+                auto const id3{table.intern("cpu")};
+                bsl::ut_then{} = [&table, &id1, &id2, &id3]() {
+                    bsl::ut_check(id1 == bsl::result<bsl::safe_uint32>{bsl::to_u32(0)});
+                    bsl::ut_check(id2 == bsl::result<bsl::safe_uint32>{bsl::to_u32(1)});
+                    bsl::ut_check(id3 == bsl::result<bsl::safe_uint32>{bsl::to_u32(0)});
+                    bsl::ut_check(table.size() == bsl::to_umax(2));
+                    bsl::ut_check(table.get(bsl::to_u32(0)) == "cpu");
+                    bsl::ut_check(table.get(bsl::to_u32(1)) == "net");
+                    bsl::ut_check(table.get(bsl::to_u32(2)).empty());
+                    bsl::ut_check(table.find("net") == id2);
+                    bsl::ut_check(!table.find("disk"));
+                };
+            };
+        };
+
+        bsl::ut_given_at_runtime{} = []() {
+            table_type table{};
+            bsl::string_view const view{"cpu0/net1", bsl::to_umax(4)};
+            bsl::ut_when{} = [&table, &view]() {
+                auto const id{table.intern(view)};
+                bsl::ut_then{} = [&table, &id]() {
+                    bsl::ut_check(id == bsl::result<bsl::safe_uint32>{bsl::to_u32(0)});
+                    bsl::ut_check(table.get(bsl::to_u32(0)) == "cpu0");
+                    bsl::ut_check(table.find("cpu0") == id);
+                    bsl::ut_check(!table.find("cpu"));
+                    bsl::ut_check(!table.find("cpu0/"));
+                };
+            };
+        };
+
+        bsl::ut_given_at_runtime{} = []() {
+            table_type table{};
+            bsl::ut_then{} = [&table]() {
+                bsl::ut_check(!table.intern(bsl::string_view{}));
+                bsl::ut_check(!table.find(bsl::string_view{}));
+                bsl::ut_check(table.size().is_zero());
+            };
+        };
+    };
+
+    bsl::ut_scenario{"table is full"} = []() {
+        bsl::ut_given_at_runtime{} = []() {
+            bsl::intern_table<2, 64> table{};
+            bsl::ut_when{} = [&table]() {
+                bsl::discard(table.intern("a"));
+                bsl::discard(table.intern("b"));
+                bsl::ut_then{} = [&table]() {
+                    bsl::ut_check(!table.intern("c"));
+                    auto const id{table.intern("a")};
+                    bsl::ut_check(id == bsl::result<bsl::safe_uint32>{bsl::to_u32(0)});
+                    bsl::ut_check(table.size() == bsl::to_umax(2));
+                };
+            };
+        };
+
+        bsl::ut_given_at_runtime{} = []() {
+            bsl::intern_table<8, 8> table{};
+            bsl::ut_when{} = [&table]() {
+                bsl::discard(table.intern("abcd"));
+                bsl::ut_then{} = [&table]() {
+                    bsl::ut_check(!table.intern("efg"));
+                    bsl::ut_check(!!table.intern("ef"));
+                    bsl::ut_check(table.get(bsl::to_u32(1)) == "ef");
+                };
+            };
+        };
+    };
+
+    bsl::ut_scenario{"many strings"} = []() {
+        bsl::ut_given_at_runtime{} = []() {
+            bsl::intern_table<64, 512> table{};
+            bsl::array<bsl::char_type, 3> name{};
+            bsl::ut_when{} = [&table, &name]() {
+                constexpr auto letters{bsl::to_umax(8)};
+                for (bsl::safe_uintmax i{}; i < bsl::to_umax(64); ++i) {
+                    auto const hi{static_cast<bsl::char_type>('A' + (i / letters).get())};
+                    auto const lo{static_cast<bsl::char_type>('a' + (i % letters).get())};
+                    *name.at_if(bsl::to_umax(0)) = hi;
+                    *name.at_if(bsl::to_umax(1)) = lo;
+
+                    auto const id{table.intern(bsl::string_view{name.data(), bsl::to_umax(2)})};
+                    bsl::ut_check(id == bsl::result<bsl::safe_uint32>{bsl::to_u32(i)});
+                }
+                bsl::ut_then{} = [&table]() {
+                    auto const id{table.find("Ce")};
+                    bsl::ut_check(table.size() == bsl::to_umax(64));
+                    bsl::ut_check(table.get(bsl::to_u32(0)) == "Aa");
+                    bsl::ut_check(table.get(bsl::to_u32(63)) == "Hh");
+                    bsl::ut_check(id == bsl::result<bsl::safe_uint32>{bsl::to_u32(20)});
+                    bsl::ut_check(!table.intern("Ii"));
+                };
+            };
+        };
+    };
+
+    return bsl::ut_success();
+}
+
+/// <!-- description -->
+///   @brief Main function for this unit test. If a call to ut_check() fails
+///     the application will fast fail. If all calls to ut_check() pass, this
+///     function will successfully return with bsl::exit_success.
+///
+/// <!-- inputs/outputs -->
+///   @return Always returns bsl::exit_success.
+///
+bsl::exit_code
+main() noexcept
+{
+    static_assert(tests() == bsl::ut_success());
+    return tests();
+}
@@ -0,0 +1,78 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+#include <bsl/intern_table.hpp>
+#include <bsl/convert.hpp>
+#include <bsl/is_copy_constructible.hpp>
+#include <bsl/is_move_constructible.hpp>
+#include <bsl/string_view.hpp>
+#include <bsl/ut.hpp>
+
+/// <!-- description -->
+///   @brief Main function for this unit test. If a call to ut_check() fails
+///     the application will fast fail. If all calls to ut_check() pass, this
+///     function will successfully return with bsl::exit_success.
+///
+/// <!-- inputs/outputs -->
+///   @return Always returns bsl::exit_success.
+///
+bsl::exit_code
+main() noexcept
+{
+    using namespace bsl;
+
+    bsl::ut_scenario{"verify not copyable or movable"} = []() {
+        static_assert(!is_copy_constructible<intern_table<8, 64>>::value);
+        static_assert(!is_move_constructible<intern_table<8, 64>>::value);
+    };
+
+    bsl::ut_scenario{"verify noexcept"} = []() {
+        bsl::ut_given_at_runtime{} = []() {
+            intern_table<8, 64> table{};
+            bsl::ut_then{} = [&table]() {
+                static_assert(noexcept(intern_table<8, 64>{}));
+                static_assert(noexcept(table.intern(string_view{})));
+                static_assert(noexcept(table.find(string_view{})));
+                static_assert(noexcept(table.get(to_u32(0))));
+                static_assert(noexcept(table.size()));
+                static_assert(noexcept(table.max_size()));
+            };
+        };
+    };
+
+    bsl::ut_scenario{"verify constness"} = []() {
+        bsl::ut_given_at_runtime{} = []() {
+            intern_table<8, 64> table{};
+            bsl::ut_then{} = [&table]() {
+                auto const &ctable{table};
+                bsl::ut_check(!!table.intern("cpu"));
+                bsl::ut_check(!!ctable.find("cpu"));
+                bsl::ut_check(ctable.get(to_u32(0)) == "cpu");
+                bsl::ut_check(ctable.size() == to_umax(1));
+            };
+        };
+    };
+
+    return bsl::ut_success();
+}
@@ -0,0 +1,109 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+#include <bsl/iota.hpp>
+#include <bsl/array.hpp>
+#include <bsl/convert.hpp>
+#include <bsl/cstdint.hpp>
+#include <bsl/safe_integral.hpp>
+#include <bsl/span.hpp>
+#include <bsl/ut.hpp>
+
+/// <!-- description -->
+///   @brief Used to execute the actual checks. We put the checks in this
+///     function so that we can validate the tests both at compile-time
+///     and at run-time. If a bsl::ut_check fails, the tests will either
+///     fail fast at run-time, or will produce a compile-time error.
+///
+/// <!-- inputs/outputs -->
+///   @return Always returns bsl::exit_success.
+///
+constexpr bsl::exit_code
+tests() noexcept
+{
+    bsl::ut_scenario{"iota empty"} = []() {
+        bsl::ut_given{} = []() {
+            bsl::span<bsl::safe_uint64> spn{};
+            bsl::ut_then{} = [&spn]() {
+                bsl::iota(spn, bsl::to_u64(42));
+                bsl::ut_check(spn.empty());
+            };
+        };
+    };
+
+    bsl::ut_scenario{"iota"} = []() {
+        bsl::ut_given{} = []() {
+            bsl::array<bsl::safe_uint64, 10> arr{};
+            bsl::ut_when{} = [&arr]() {
+                bsl::iota(arr, bsl::to_u64(42));
+                bsl::ut_then{} = [&arr]() {
+                    for (bsl::safe_uintmax i{}; i < arr.size(); ++i) {
+                        bsl::ut_check(*arr.at_if(i) == bsl::to_u64(42) + bsl::to_u64(i));
+                    }
+                };
+            };
+        };
+
+        bsl::ut_given{} = []() {
+            bsl::array<bsl::uint8, 4> arr{};
+            bsl::ut_when{} = [&arr]() {
+                bsl::iota(arr, bsl::uint8{});
+                bsl::ut_then{} = [&arr]() {
+                    bsl::ut_check(*arr.at_if(bsl::to_umax(0)) == 0U);
+                    bsl::ut_check(*arr.at_if(bsl::to_umax(3)) == 3U);
+                };
+            };
+        };
+    };
+
+    bsl::ut_scenario{"iota overflow"} = []() {
+        bsl::ut_given_at_runtime{} = []() {
+            bsl::array<bsl::safe_uint8, 3> arr{};
+            bsl::ut_when{} = [&arr]() {
+                bsl::iota(arr, bsl::to_u8(254));
+                bsl::ut_then{} = [&arr]() {
+                    bsl::ut_check(!arr.at_if(bsl::to_umax(1))->failure());
+                    bsl::ut_check(arr.at_if(bsl::to_umax(2))->failure());
+                };
+            };
+        };
+    };
+
+    return bsl::ut_success();
+}
+
+/// <!-- description -->
+///   @brief Main function for this unit test. If a call to ut_check() fails
+///     the application will fast fail. If all calls to ut_check() pass, this
+///     function will successfully return with bsl::exit_success.
+///
+/// <!-- inputs/outputs -->
+///   @return Always returns bsl::exit_success.
+///
+bsl::exit_code
+main() noexcept
+{
+    static_assert(tests() == bsl::ut_success());
+    return tests();
+}
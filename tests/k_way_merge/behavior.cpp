@@ -0,0 +1,206 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+#include <bsl/k_way_merge.hpp>
+#include <bsl/array.hpp>
+#include <bsl/convert.hpp>
+#include <bsl/cstdint.hpp>
+#include <bsl/errc_type.hpp>
+#include <bsl/iota.hpp>
+#include <bsl/safe_integral.hpp>
+#include <bsl/span.hpp>
+#include <bsl/ut.hpp>
+
+namespace
+{
+    /// @brief defines the type of run used by the tests
+    using run_type = bsl::span<bsl::uint32 const>;
+}
+
+/// <!-- description -->
+///   @brief Used to execute the actual checks. We put the checks in this
+///     function so that we can validate the tests both at compile-time
+///     and at run-time. If a bsl::ut_check fails, the tests will either
+///     fail fast at run-time, or will produce a compile-time error.
+///
+/// <!-- inputs/outputs -->
+///   @return Always returns bsl::exit_success.
+///
+constexpr bsl::exit_code
+tests() noexcept
+{
+    bsl::ut_scenario{"k_way_merge no runs"} = []() {
+        bsl::ut_given{} = []() {
+            bsl::span<run_type const> runs{};
+            bsl::span<bsl::uint32> dst{};
+            bsl::ut_then{} = [&runs, &dst]() {
+                auto const ret{bsl::k_way_merge(runs, dst)};
+                bsl::ut_check(ret.success());
+                bsl::ut_check(ret.get_if()->is_zero());
+            };
+        };
+    };
+
+    bsl::ut_scenario{"k_way_merge invalid args"} = []() {
+        bsl::ut_given_at_runtime{} = []() {
+            bsl::array<bsl::uint32, 4> data{};
+            bsl::array<run_type, 65> runs{};
+            bsl::array<bsl::uint32, 4> dst{};
+            bsl::ut_when{} = [&data, &runs, &dst]() {
+                *runs.front_if() = run_type{data.data(), data.size()};
+                bsl::ut_then{} = [&runs, &dst]() {
+                    auto const ret{bsl::k_way_merge(runs, bsl::span{dst.data(), dst.size()})};
+                    bsl::ut_check(ret.errc() == bsl::errc_invalid_argument);
+                };
+            };
+        };
+
+        bsl::ut_given_at_runtime{} = []() {
+            bsl::array<bsl::uint32, 4> data{};
+            bsl::array<run_type, 2> runs{};
+            bsl::array<bsl::uint32, 7> dst{};
+            bsl::ut_when{} = [&data, &runs, &dst]() {
+                *runs.front_if() = run_type{data.data(), data.size()};
+                *runs.back_if() = run_type{data.data(), data.size()};
+                bsl::ut_then{} = [&runs, &dst]() {
+                    auto const ret{bsl::k_way_merge(runs, bsl::span{dst.data(), dst.size()})};
+                    bsl::ut_check(ret.errc() == bsl::errc_failure);
+                };
+            };
+        };
+    };
+
+    bsl::ut_scenario{"k_way_merge"} = []() {
+        bsl::ut_given{} = []() {
+            bsl::array<bsl::uint32, 4> run0{1U, 4U, 7U, 10U};
+            bsl::array<bsl::uint32, 3> run1{0U, 5U, 11U};
+            bsl::array<bsl::uint32, 3> run2{2U, 3U, 6U};
+            bsl::array<run_type, 4> runs{};
+            bsl::array<bsl::uint32, 10> dst{};
+            bsl::ut_when{} = [&run0, &run1, &run2, &runs, &dst]() {
+                *runs.at_if(bsl::to_umax(0)) = run_type{run0.data(), run0.size()};
+                *runs.at_if(bsl::to_umax(1)) = run_type{run1.data(), run1.size()};
+                *runs.at_if(bsl::to_umax(3)) = run_type{run2.data(), run2.size()};
+                bsl::ut_then{} = [&runs, &dst]() {
+                    auto const ret{bsl::k_way_merge(runs, bsl::span{dst.data(), dst.size()})};
+                    bsl::ut_check(*ret.get_if() == dst.size());
+                    bsl::ut_check(
+                        dst ==
+                        bsl::array<bsl::uint32, 10>{0U, 1U, 2U, 3U, 4U, 5U, 6U, 7U, 10U, 11U});
+                };
+            };
+        };
+
+        bsl::ut_given{} = []() {
+            bsl::array<bsl::uint32, 2> run0{0U, 3U};
+            bsl::array<run_type, 1> runs{};
+            bsl::array<bsl::uint32, 2> dst{};
+            bsl::ut_when{} = [&run0, &runs, &dst]() {
+                *runs.front_if() = run_type{run0.data(), run0.size()};
+                bsl::ut_then{} = [&runs, &dst]() {
+                    auto const ret{bsl::k_way_merge(runs, bsl::span{dst.data(), dst.size()})};
+                    bsl::ut_check(*ret.get_if() == dst.size());
+                    bsl::ut_check(dst == bsl::array<bsl::uint32, 2>{0U, 3U});
+                };
+            };
+        };
+    };
+
+    bsl::ut_scenario{"k_way_merge max runs"} = []() {
+        bsl::ut_given_at_runtime{} = []() {
+            bsl::array<bsl::uint32, 64 * 4> data{};
+            bsl::array<run_type, 64> runs{};
+            bsl::array<bsl::uint32, 64 * 4> dst{};
+            bsl::ut_when{} = [&data, &runs, &dst]() {
+                bsl::iota(data, bsl::uint32{});
+                for (bsl::safe_uintmax i{}; i < runs.size(); ++i) {
+                    for (bsl::safe_uintmax j{}; j < bsl::to_umax(4); ++j) {
+                        *data.at_if((i * bsl::to_umax(4)) + j) =
+                            bsl::to_u32(i + (j * runs.size())).get();
+                    }
+
+                    *runs.at_if(i) = run_type{data.at_if(i * bsl::to_umax(4)), bsl::to_umax(4)};
+                }
+
+                bsl::ut_then{} = [&runs, &dst]() {
+                    bsl::safe_uintmax i{};
+                    bool sorted{true};
+                    auto const ret{bsl::k_way_merge(
+                        runs, [&i, &sorted](bsl::uint32 const &val) noexcept {
+                            if (bsl::to_umax(val) != i) {
+                                sorted = false;
+                            }
+                            ++i;
+                        })};
+                    bsl::ut_check(*ret.get_if() == dst.size());
+                    bsl::ut_check(sorted);
+                };
+            };
+        };
+    };
+
+    bsl::ut_scenario{"k_way_merge is stable"} = []() {
+        bsl::ut_given{} = []() {
+            bsl::array<bsl::uint32, 3> run0{10U, 20U, 30U};
+            bsl::array<bsl::uint32, 3> run1{11U, 21U, 31U};
+            bsl::array<bsl::uint32, 3> run2{12U, 22U, 32U};
+            bsl::array<run_type, 3> runs{};
+            bsl::array<bsl::uint32, 9> dst{};
+            bsl::ut_when{} = [&run0, &run1, &run2, &runs, &dst]() {
+                *runs.at_if(bsl::to_umax(0)) = run_type{run0.data(), run0.size()};
+                *runs.at_if(bsl::to_umax(1)) = run_type{run1.data(), run1.size()};
+                *runs.at_if(bsl::to_umax(2)) = run_type{run2.data(), run2.size()};
+                bsl::ut_then{} = [&runs, &dst]() {
+                    auto const ret{bsl::k_way_merge(
+                        runs,
+                        bsl::span{dst.data(), dst.size()},
+                        [](bsl::uint32 const &a, bsl::uint32 const &b) noexcept -> bool {
+                            return (a / 10U) < (b / 10U);
+                        })};
+                    bsl::ut_check(ret.success());
+                    bsl::ut_check(
+                        dst ==
+                        bsl::array<bsl::uint32, 9>{10U, 11U, 12U, 20U, 21U, 22U, 30U, 31U, 32U});
+                };
+            };
+        };
+    };
+
+    return bsl::ut_success();
+}
+
+/// <!-- description -->
+///   @brief Main function for this unit test. If a call to ut_check() fails
+///     the application will fast fail. If all calls to ut_check() pass, this
+///     function will successfully return with bsl::exit_success.
+///
+/// <!-- inputs/outputs -->
+///   @return Always returns bsl::exit_success.
+///
+bsl::exit_code
+main() noexcept
+{
+    static_assert(tests() == bsl::ut_success());
+    return tests();
+}
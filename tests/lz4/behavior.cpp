@@ -0,0 +1,413 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+#include <bsl/lz4.hpp>
+#include <bsl/array.hpp>
+#include <bsl/byte.hpp>
+#include <bsl/convert.hpp>
+#include <bsl/cstdint.hpp>
+#include <bsl/safe_integral.hpp>
+#include <bsl/span.hpp>
+#include <bsl/ut.hpp>
+
+namespace
+{
+    /// @brief "hello world " * 4, compressed by the reference LZ4 library
+    constexpr bsl::array<bsl::uint8, 22> ref_block{
+        0xCFU, 0x68U, 0x65U, 0x6CU, 0x6CU, 0x6FU, 0x20U, 0x77U, 0x6FU, 0x72U, 0x6CU,
+        0x64U, 0x20U, 0x0CU, 0x00U, 0x0CU, 0x50U, 0x6FU, 0x72U, 0x6CU, 0x64U, 0x20U};
+
+    /// @brief "abc" * 7 as a frame with a content size and content checksum
+    constexpr bsl::array<bsl::uint8, 39> ref_frame1{
+        0x04U, 0x22U, 0x4DU, 0x18U, 0x6CU, 0x40U, 0x15U, 0x00U, 0x00U, 0x00U,
+        0x00U, 0x00U, 0x00U, 0x00U, 0x4CU, 0x0CU, 0x00U, 0x00U, 0x00U, 0x39U,
+        0x61U, 0x62U, 0x63U, 0x03U, 0x00U, 0x50U, 0x62U, 0x63U, 0x61U, 0x62U,
+        0x63U, 0x00U, 0x00U, 0x00U, 0x00U, 0xADU, 0xEDU, 0x55U, 0x35U};
+
+    /// @brief "abc" * 7 as a frame with linked blocks and block checksums
+    constexpr bsl::array<bsl::uint8, 39> ref_frame2{
+        0x04U, 0x22U, 0x4DU, 0x18U, 0x78U, 0x40U, 0x15U, 0x00U, 0x00U, 0x00U,
+        0x00U, 0x00U, 0x00U, 0x00U, 0x2FU, 0x0CU, 0x00U, 0x00U, 0x00U, 0x39U,
+        0x61U, 0x62U, 0x63U, 0x03U, 0x00U, 0x50U, 0x62U, 0x63U, 0x61U, 0x62U,
+        0x63U, 0xBCU, 0xD8U, 0xD6U, 0x3CU, 0x00U, 0x00U, 0x00U, 0x00U};
+
+    /// @brief an empty frame, as written by bsl::lz4_frame_compress
+    constexpr bsl::array<bsl::uint8, 15> ref_empty{
+        0x04U, 0x22U, 0x4DU, 0x18U, 0x64U, 0x40U, 0xA7U, 0x00U,
+        0x00U, 0x00U, 0x00U, 0x05U, 0x5DU, 0xCCU, 0x02U};
+
+    /// @brief the size of the buffers used by the tests
+    constexpr bsl::uintmax buf_size{0x30000U};
+
+    /// @brief stores the uncompressed input
+    bsl::array<bsl::uint8, buf_size> g_in{};
+    /// @brief stores the compressed output
+    bsl::array<bsl::uint8, buf_size + 0x100U> g_out{};
+    /// @brief stores the decompressed output
+    bsl::array<bsl::uint8, buf_size> g_back{};
+    /// @brief stores the compressor's scratch buffer
+    alignas(bsl::uint32) bsl::array<bsl::byte, 0x4000U> g_scratch{};
+
+    /// <!-- description -->
+    ///   @brief Returns a span of the first "size" bytes of arr
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @tparam N the size of arr
+    ///   @param arr the array to return a span for
+    ///   @param size the number of bytes in the span
+    ///   @return Returns a span of the first "size" bytes of arr
+    ///
+    template<bsl::uintmax N>
+    [[nodiscard]] bsl::span<bsl::byte const>
+    ro(bsl::array<bsl::uint8, N> const &arr,
+       bsl::safe_uintmax const &size = bsl::to_umax(N)) noexcept
+    {
+        return bsl::as_bytes(arr.data(), size);
+    }
+
+    /// <!-- description -->
+    ///   @brief Returns a writable span of arr
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @tparam N the size of arr
+    ///   @param arr the array to return a span for
+    ///   @return Returns a writable span of arr
+    ///
+    template<bsl::uintmax N>
+    [[nodiscard]] bsl::span<bsl::byte>
+    rw(bsl::array<bsl::uint8, N> &arr) noexcept
+    {
+        return bsl::as_writable_bytes(arr.data(), arr.size());
+    }
+
+    /// <!-- description -->
+    ///   @brief Returns the scratch buffer
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @return Returns the scratch buffer
+    ///
+    [[nodiscard]] bsl::span<bsl::byte>
+    scratch() noexcept
+    {
+        return {g_scratch.data(), g_scratch.size()};
+    }
+
+    /// <!-- description -->
+    ///   @brief Fills g_in with compressible text, followed by bytes that
+    ///     do not compress.
+    ///
+    inline void
+    fill_input() noexcept
+    {
+        constexpr bsl::uintmax half{buf_size / 2U};
+        constexpr bsl::uint32 mul{1103515245U};
+        constexpr bsl::uint32 add{12345U};
+        constexpr bsl::uint32 shift{16U};
+
+        bsl::uint32 seed{42U};
+        for (bsl::safe_uintmax i{}; i < g_in.size(); ++i) {
+            if (i.get() < half) {
+                *g_in.at_if(i) = static_cast<bsl::uint8>('a' + ((i.get() / 7U) % 5U));
+            }
+            else {
+                seed = (seed * mul) + add;
+                *g_in.at_if(i) = static_cast<bsl::uint8>(seed >> shift);
+            }
+        }
+    }
+
+    /// <!-- description -->
+    ///   @brief Returns true if the first "size" bytes of g_in and g_back
+    ///     are the same.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param size the number of bytes to compare
+    ///   @return Returns true if the bytes are the same.
+    ///
+    [[nodiscard]] inline bool
+    same(bsl::safe_uintmax const &size) noexcept
+    {
+        for (bsl::safe_uintmax i{}; i < size; ++i) {
+            if (*g_in.at_if(i) != *g_back.at_if(i)) {
+                return false;
+            }
+        }
+
+        return true;
+    }
+}
+
+/// <!-- description -->
+///   @brief Used to execute the actual checks. We put the checks in this
+///     function so that we can validate the tests both at compile-time
+///     and at run-time. If a bsl::ut_check fails, the tests will either
+///     fail fast at run-time, or will produce a compile-time error.
+///
+/// <!-- inputs/outputs -->
+///   @return Always returns bsl::exit_success.
+///
+constexpr bsl::exit_code
+tests() noexcept
+{
+    bsl::ut_scenario{"bounds"} = []() {
+        bsl::ut_given{} = []() {
+            bsl::ut_then{} = []() {
+                bsl::ut_check(bsl::lz4_compress_bound(bsl::to_umax(0)) == bsl::to_umax(16));
+                bsl::ut_check(bsl::lz4_compress_bound(bsl::to_umax(255)) == bsl::to_umax(272));
+                bsl::ut_check(bsl::lz4_frame_bound(bsl::to_umax(0)) == bsl::to_umax(15));
+                bsl::ut_check(bsl::lz4_frame_bound(bsl::to_umax(1)) == bsl::to_umax(20));
+                bsl::ut_check(bsl::lz4_frame_bound(bsl::to_umax(65537)) == bsl::to_umax(65560));
+                bsl::ut_check(!bsl::lz4_compress_bound(bsl::safe_uintmax::zero(true)));
+            };
+        };
+    };
+
+    bsl::ut_scenario{"decompress reference block"} = []() {
+        bsl::ut_given_at_runtime{} = []() {
+            bsl::array<bsl::uint8, 48> out{};
+            bsl::ut_when{} = [&out]() {
+                auto const ret{bsl::lz4_decompress_block(ro(ref_block), rw(out))};
+                bsl::ut_then{} = [&out, &ret]() {
+                    bsl::ut_check(ret == bsl::to_umax(48));
+                    bsl::ut_check('h' == *out.at_if(bsl::to_umax(36)));
+                    bsl::ut_check(' ' == *out.at_if(bsl::to_umax(47)));
+                };
+            };
+        };
+
+        bsl::ut_given_at_runtime{} = []() {
+            bsl::array<bsl::uint8, 47> out{};
+            bsl::ut_then{} = [&out]() {
+                bsl::ut_check(!bsl::lz4_decompress_block(ro(ref_block), rw(out)));
+                bsl::ut_check(!bsl::lz4_decompress_block(ro(ref_block, bsl::to_umax(21)), rw(out)));
+                bsl::ut_check(!bsl::lz4_decompress_block({}, rw(out)));
+            };
+        };
+    };
+
+    bsl::ut_scenario{"block round trip"} = []() {
+        bsl::ut_given_at_runtime{} = []() {
+            fill_input();
+            bsl::ut_when{} = []() {
+                auto const size{bsl::lz4_compress_block(ro(g_in), rw(g_out), scratch())};
+                auto const back{bsl::lz4_decompress_block(ro(g_out, size), rw(g_back))};
+                bsl::ut_then{} = [&size, &back]() {
+                    bsl::ut_check(!!size);
+                    bsl::ut_check(size <= bsl::lz4_compress_bound(g_in.size()));
+                    bsl::ut_check(back == g_in.size());
+                    bsl::ut_check(same(g_in.size()));
+                };
+            };
+        };
+
+        bsl::ut_given_at_runtime{} = []() {
+            bsl::array<bsl::uint8, 16> out{};
+            bsl::ut_then{} = [&out]() {
+                bsl::ut_check(bsl::lz4_compress_block({}, rw(out), scratch()) == bsl::to_umax(1));
+                auto const one{ro(out, bsl::to_umax(1))};
+                bsl::ut_check(bsl::lz4_decompress_block(one, rw(g_back)).is_zero());
+            };
+        };
+    };
+
+    bsl::ut_scenario{"block errors"} = []() {
+        bsl::ut_given_at_runtime{} = []() {
+            fill_input();
+            bsl::array<bsl::uint8, 16> out{};
+            bsl::ut_then{} = [&out]() {
+                bsl::ut_check(!bsl::lz4_compress_block(ro(g_in), rw(out), scratch()));
+                bsl::ut_check(!bsl::lz4_compress_block(ro(g_in), {}, scratch()));
+                bsl::ut_check(!bsl::lz4_compress_block(ro(g_in), rw(g_out), {}));
+                auto const misaligned{scratch().subspan(bsl::to_umax(1))};
+                auto const too_small{scratch().subspan(bsl::to_umax(4))};
+                bsl::ut_check(!bsl::lz4_compress_block(ro(g_in), rw(g_out), misaligned));
+                bsl::ut_check(!bsl::lz4_compress_block(ro(g_in), rw(g_out), too_small));
+            };
+        };
+    };
+
+    bsl::ut_scenario{"reference frames"} = []() {
+        bsl::ut_given_at_runtime{} = []() {
+            bsl::array<bsl::uint8, 21> out{};
+            bsl::ut_then{} = [&out]() {
+                auto const ret1{bsl::lz4_frame_decompress(ro(ref_frame1), rw(out))};
+                bsl::ut_check(ret1 == bsl::to_umax(21));
+                bsl::ut_check('c' == *out.back_if());
+                auto const ret2{bsl::lz4_frame_decompress(ro(ref_frame2), rw(out))};
+                bsl::ut_check(ret2 == bsl::to_umax(21));
+                bsl::ut_check('c' == *out.back_if());
+                bsl::ut_check(bsl::lz4_frame_decompress(ro(ref_empty), rw(out)).is_zero());
+            };
+        };
+
+        bsl::ut_given_at_runtime{} = []() {
+            bsl::array<bsl::uint8, 16> out{};
+            bsl::ut_then{} = [&out]() {
+                bsl::ut_check(bsl::lz4_frame_compress({}, rw(out), scratch()) == bsl::to_umax(15));
+                for (bsl::safe_uintmax i{}; i < ref_empty.size(); ++i) {
+                    bsl::ut_check(*out.at_if(i) == *ref_empty.at_if(i));
+                }
+            };
+        };
+    };
+
+    bsl::ut_scenario{"frame round trip"} = []() {
+        bsl::ut_given_at_runtime{} = []() {
+            fill_input();
+            bsl::ut_when{} = []() {
+                auto const size{bsl::lz4_frame_compress(ro(g_in), rw(g_out), scratch())};
+                auto const back{bsl::lz4_frame_decompress(ro(g_out, size), rw(g_back))};
+                bsl::ut_then{} = [&size, &back]() {
+                    bsl::ut_check(!!size);
+                    bsl::ut_check(size <= bsl::lz4_frame_bound(g_in.size()));
+                    bsl::ut_check(back == g_in.size());
+                    bsl::ut_check(same(g_in.size()));
+                };
+            };
+        };
+
+        bsl::ut_given_at_runtime{} = []() {
+            fill_input();
+            bsl::array<bsl::uint8, 64> out{};
+            bsl::ut_then{} = [&out]() {
+                bsl::ut_check(!bsl::lz4_frame_compress(ro(g_in), rw(out), scratch()));
+                bsl::ut_check(!bsl::lz4_frame_compress(ro(g_in), rw(g_out), {}));
+            };
+        };
+    };
+
+    bsl::ut_scenario{"frame reader"} = []() {
+        bsl::ut_given_at_runtime{} = []() {
+            fill_input();
+            auto const size{bsl::lz4_frame_compress(ro(g_in), rw(g_out), scratch())};
+            bsl::lz4_frame_reader reader{ro(g_out, size)};
+            bsl::array<bsl::uint8, 0x10000U> block{};
+            bsl::ut_when{} = [&reader, &block]() {
+                bsl::safe_uintmax total{};
+                bsl::safe_uintmax blocks{};
+                while (!reader.done()) {
+                    auto const ret{reader.next(rw(block))};
+                    bsl::ut_check(!!ret);
+                    for (bsl::safe_uintmax i{}; i < ret; ++i) {
+                        *g_back.at_if(total + i) = *block.at_if(i);
+                    }
+                    total += ret;
+                    ++blocks;
+                }
+                bsl::ut_then{} = [&reader, &block, &total, &blocks]() {
+                    bsl::ut_check(!!reader);
+                    bsl::ut_check(reader.block_max_size() == bsl::to_umax(0x10000U));
+                    bsl::ut_check(total == g_in.size());
+                    bsl::ut_check(blocks == bsl::to_umax(4));
+                    bsl::ut_check(same(total));
+                    bsl::ut_check(reader.verify(ro(g_back, total)));
+                    bsl::ut_check(!reader.verify(ro(g_back, total - bsl::to_umax(1))));
+                    bsl::ut_check(reader.next(rw(block)).is_zero());
+                };
+            };
+        };
+
+        bsl::ut_given_at_runtime{} = []() {
+            bsl::lz4_frame_reader reader{};
+            bsl::array<bsl::uint8, 16> out{};
+            bsl::ut_then{} = [&reader, &out]() {
+                bsl::ut_check(!reader);
+                bsl::ut_check(!reader.next(rw(out)));
+                bsl::ut_check(!reader.verify(ro(out)));
+            };
+        };
+    };
+
+    bsl::ut_scenario{"corrupt frames"} = []() {
+        bsl::ut_given_at_runtime{} = []() {
+            bsl::array<bsl::uint8, 39> frame{ref_frame1};
+            bsl::array<bsl::uint8, 21> out{};
+            bsl::ut_when{} = [&frame, &out]() {
+                *frame.at_if(bsl::to_umax(0)) = 0U;
+                bsl::ut_then{} = [&frame, &out]() {
+                    bsl::ut_check(!bsl::lz4_frame_reader{ro(frame)});
+                    bsl::ut_check(!bsl::lz4_frame_decompress(ro(frame), rw(out)));
+                };
+            };
+        };
+
+        bsl::ut_given_at_runtime{} = []() {
+            bsl::array<bsl::uint8, 39> frame{ref_frame1};
+            bsl::ut_when{} = [&frame]() {
+                *frame.at_if(bsl::to_umax(14)) = 0U;
+                bsl::ut_then{} = [&frame]() {
+                    bsl::ut_check(!bsl::lz4_frame_reader{ro(frame)});
+                };
+            };
+        };
+
+        bsl::ut_given_at_runtime{} = []() {
+            bsl::array<bsl::uint8, 39> frame{ref_frame1};
+            bsl::array<bsl::uint8, 21> out{};
+            bsl::ut_when{} = [&frame, &out]() {
+                *frame.at_if(bsl::to_umax(38)) = 0U;
+                bsl::ut_then{} = [&frame, &out]() {
+                    bsl::ut_check(!bsl::lz4_frame_decompress(ro(frame), rw(out)));
+                };
+            };
+        };
+
+        bsl::ut_given_at_runtime{} = []() {
+            bsl::array<bsl::uint8, 39> frame{ref_frame2};
+            bsl::array<bsl::uint8, 21> out{};
+            bsl::ut_when{} = [&frame, &out]() {
+                *frame.at_if(bsl::to_umax(25)) = 0x51U;
+                bsl::ut_then{} = [&frame, &out]() {
+                    bsl::ut_check(!bsl::lz4_frame_decompress(ro(frame), rw(out)));
+                };
+            };
+        };
+
+        bsl::ut_given_at_runtime{} = []() {
+            bsl::array<bsl::uint8, 20> out{};
+            bsl::ut_then{} = [&out]() {
+                bsl::ut_check(!bsl::lz4_frame_decompress(ro(ref_frame1), rw(out)));
+                auto const truncated{ro(ref_frame1, bsl::to_umax(30))};
+                bsl::ut_check(!bsl::lz4_frame_decompress(truncated, rw(out)));
+            };
+        };
+    };
+
+    return bsl::ut_success();
+}
+
+/// <!-- description -->
+///   @brief Main function for this unit test. If a call to ut_check() fails
+///     the application will fast fail. If all calls to ut_check() pass, this
+///     function will successfully return with bsl::exit_success.
+///
+/// <!-- inputs/outputs -->
+///   @return Always returns bsl::exit_success.
+///
+bsl::exit_code
+main() noexcept
+{
+    static_assert(tests() == bsl::ut_success());
+    return tests();
+}
@@ -0,0 +1,82 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+#include <bsl/lz4.hpp>
+#include <bsl/array.hpp>
+#include <bsl/byte.hpp>
+#include <bsl/convert.hpp>
+#include <bsl/span.hpp>
+#include <bsl/ut.hpp>
+
+/// <!-- description -->
+///   @brief Main function for this unit test. If a call to ut_check() fails
+///     the application will fast fail. If all calls to ut_check() pass, this
+///     function will successfully return with bsl::exit_success.
+///
+/// <!-- inputs/outputs -->
+///   @return Always returns bsl::exit_success.
+///
+bsl::exit_code
+main() noexcept
+{
+    using namespace bsl;
+
+    bsl::ut_scenario{"verify noexcept"} = []() {
+        bsl::ut_given_at_runtime{} = []() {
+            bsl::array<bsl::byte, 64> buf{};
+            span<byte const> const src{};
+            span<byte> const dst{buf.data(), buf.size()};
+            lz4_frame_reader reader{};
+            bsl::ut_then{} = [&src, &dst, &reader]() {
+                static_assert(noexcept(lz4_compress_bound(to_umax(0))));
+                static_assert(noexcept(lz4_frame_bound(to_umax(0))));
+                static_assert(noexcept(lz4_compress_block(src, dst, dst)));
+                static_assert(noexcept(lz4_decompress_block(src, dst)));
+                static_assert(noexcept(lz4_frame_compress(src, dst, dst)));
+                static_assert(noexcept(lz4_frame_decompress(src, dst)));
+                static_assert(noexcept(lz4_frame_reader{}));
+                static_assert(noexcept(lz4_frame_reader{src}));
+                static_assert(noexcept(reader.next(dst)));
+                static_assert(noexcept(reader.next(dst, to_umax(0))));
+                static_assert(noexcept(reader.verify(src)));
+                static_assert(noexcept(reader.block_max_size()));
+                static_assert(noexcept(reader.done()));
+                static_assert(noexcept(!reader));
+            };
+        };
+    };
+
+    bsl::ut_scenario{"verify constness"} = []() {
+        bsl::ut_given_at_runtime{} = []() {
+            lz4_frame_reader const reader{};
+            bsl::ut_then{} = [&reader]() {
+                bsl::ut_check(!reader);
+                bsl::ut_check(reader.block_max_size().is_zero());
+                bsl::ut_check(!reader.verify({}));
+            };
+        };
+    };
+
+    return bsl::ut_success();
+}
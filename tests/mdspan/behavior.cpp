@@ -0,0 +1,336 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+#include <bsl/mdspan.hpp>
+#include <bsl/array.hpp>
+#include <bsl/convert.hpp>
+#include <bsl/extents.hpp>
+#include <bsl/discard.hpp>
+#include <bsl/for_each.hpp>
+#include <bsl/layout_left.hpp>
+#include <bsl/layout_right.hpp>
+#include <bsl/safe_integral.hpp>
+#include <bsl/span.hpp>
+#include <bsl/ut.hpp>
+
+namespace
+{
+    /// @brief the shape used by the tests (2 rows, 3 columns)
+    using extents_type = bsl::extents<2, 3>;
+    /// @brief a row-major view of the test array
+    using row_major = bsl::mdspan<bsl::safe_int32, extents_type>;
+    /// @brief a column-major view of the test array
+    using col_major = bsl::mdspan<bsl::safe_int32, extents_type, bsl::layout_left>;
+    /// @brief a rank 3 view used by the tests
+    using cube = bsl::mdspan<bsl::safe_int32, bsl::extents<2, 3, 4>>;
+}
+
+/// <!-- description -->
+///   @brief Used to execute the actual checks. We put the checks in this
+///     function so that we can validate the tests both at compile-time
+///     and at run-time. If a bsl::ut_check fails, the tests will either
+///     fail fast at run-time, or will produce a compile-time error.
+///
+/// <!-- inputs/outputs -->
+///   @return Always returns bsl::exit_success.
+///
+constexpr bsl::exit_code
+tests() noexcept
+{
+    bsl::ut_scenario{"extents"} = []() {
+        bsl::ut_then{} = []() {
+            bsl::ut_check(extents_type::rank() == bsl::to_umax(2));
+            bsl::ut_check(extents_type::size() == bsl::to_umax(6));
+            bsl::ut_check(extents_type::extent(bsl::to_umax(0)) == bsl::to_umax(2));
+            bsl::ut_check(extents_type::extent(bsl::to_umax(1)) == bsl::to_umax(3));
+            bsl::ut_check(!extents_type::extent(bsl::to_umax(2)));
+            bsl::ut_check(!extents_type::extent(bsl::safe_uintmax::zero(true)));
+        };
+    };
+
+    bsl::ut_scenario{"strides"} = []() {
+        bsl::ut_then{} = []() {
+            bsl::ut_check(row_major::stride(bsl::to_umax(0)) == bsl::to_umax(3));
+            bsl::ut_check(row_major::stride(bsl::to_umax(1)) == bsl::to_umax(1));
+            bsl::ut_check(!row_major::stride(bsl::to_umax(2)));
+            bsl::ut_check(col_major::stride(bsl::to_umax(0)) == bsl::to_umax(1));
+            bsl::ut_check(col_major::stride(bsl::to_umax(1)) == bsl::to_umax(2));
+            bsl::ut_check(!col_major::stride(bsl::to_umax(2)));
+            bsl::ut_check(cube::stride(bsl::to_umax(0)) == bsl::to_umax(12));
+            bsl::ut_check(cube::stride(bsl::to_umax(1)) == bsl::to_umax(4));
+            bsl::ut_check(cube::stride(bsl::to_umax(2)) == bsl::to_umax(1));
+        };
+    };
+
+    bsl::ut_scenario{"memory order"} = []() {
+        bsl::ut_then{} = []() {
+            using ext = bsl::extents<2, 3, 4>;
+            bsl::ut_check(bsl::layout_right::dimension<ext>(bsl::to_umax(0)) == bsl::to_umax(2));
+            bsl::ut_check(bsl::layout_right::dimension<ext>(bsl::to_umax(2)) == bsl::to_umax(0));
+            bsl::ut_check(!bsl::layout_right::dimension<ext>(bsl::to_umax(3)));
+            bsl::ut_check(bsl::layout_left::dimension<ext>(bsl::to_umax(0)) == bsl::to_umax(0));
+            bsl::ut_check(bsl::layout_left::dimension<ext>(bsl::to_umax(2)) == bsl::to_umax(2));
+            bsl::ut_check(!bsl::layout_left::dimension<ext>(bsl::to_umax(3)));
+        };
+    };
+
+    bsl::ut_scenario{"default constructor"} = []() {
+        bsl::ut_given{} = []() {
+            row_major const md{};
+            bsl::ut_then{} = [&md]() {
+                bsl::ut_check(md.empty());
+                bsl::ut_check(!md);
+                bsl::ut_check(md.data() == nullptr);
+                bsl::ut_check(md.size() == bsl::to_umax(0));
+                bsl::ut_check(md.flat().empty());
+                bsl::ut_check(nullptr == md.at_if(bsl::to_umax(0), bsl::to_umax(0)));
+            };
+        };
+    };
+
+    bsl::ut_scenario{"pointer constructor"} = []() {
+        bsl::ut_given_at_runtime{} = []() {
+            bsl::ut_then{} = []() {
+                row_major const md{nullptr};
+                bsl::ut_check(md.empty());
+            };
+        };
+
+        bsl::ut_given{} = []() {
+            bsl::array<bsl::safe_int32, 6> arr{};
+            bsl::ut_then{} = [&arr]() {
+                row_major const md{arr.data()};
+                bsl::ut_check(!md.empty());
+                bsl::ut_check(!!md);
+                bsl::ut_check(md.data() == arr.data());
+                bsl::ut_check(md.size() == bsl::to_umax(6));
+                bsl::ut_check(md.flat().size() == bsl::to_umax(6));
+            };
+        };
+    };
+
+    bsl::ut_scenario{"span constructor"} = []() {
+        bsl::ut_given_at_runtime{} = []() {
+            bsl::array<bsl::safe_int32, 6> arr{};
+            bsl::ut_then{} = [&arr]() {
+                row_major const md{bsl::span<bsl::safe_int32>{arr.data(), bsl::to_umax(5)}};
+                bsl::ut_check(md.empty());
+            };
+        };
+
+        bsl::ut_given{} = []() {
+            bsl::array<bsl::safe_int32, 6> arr{};
+            bsl::ut_then{} = [&arr]() {
+                row_major const md{bsl::span<bsl::safe_int32>{arr.data(), arr.size()}};
+                bsl::ut_check(md.data() == arr.data());
+            };
+        };
+    };
+
+    bsl::ut_scenario{"at_if"} = []() {
+        bsl::ut_given{} = []() {
+            bsl::array<bsl::safe_int32, 6> arr{};
+            bsl::ut_when{} = [&arr]() {
+                for (bsl::safe_uintmax i{}; i < arr.size(); ++i) {
+                    *arr.at_if(i) = bsl::to_i32(static_cast<bsl::int32>(i.get()));
+                }
+
+                bsl::ut_then{} = [&arr]() {
+                    row_major md{arr.data()};
+                    bsl::ut_check(*md.at_if(bsl::to_umax(0), bsl::to_umax(0)) == bsl::to_i32(0));
+                    bsl::ut_check(*md.at_if(bsl::to_umax(0), bsl::to_umax(2)) == bsl::to_i32(2));
+                    bsl::ut_check(*md.at_if(bsl::to_umax(1), bsl::to_umax(0)) == bsl::to_i32(3));
+                    bsl::ut_check(*md.at_if(bsl::to_umax(1), bsl::to_umax(2)) == bsl::to_i32(5));
+                    bsl::ut_check(nullptr == md.at_if(bsl::to_umax(2), bsl::to_umax(0)));
+                    bsl::ut_check(nullptr == md.at_if(bsl::to_umax(0), bsl::to_umax(3)));
+                    bsl::ut_check(
+                        nullptr == md.at_if(bsl::safe_uintmax::zero(true), bsl::to_umax(0)));
+                };
+
+                bsl::ut_then{} = [&arr]() {
+                    col_major md{arr.data()};
+                    bsl::ut_check(*md.at_if(bsl::to_umax(0), bsl::to_umax(0)) == bsl::to_i32(0));
+                    bsl::ut_check(*md.at_if(bsl::to_umax(1), bsl::to_umax(0)) == bsl::to_i32(1));
+                    bsl::ut_check(*md.at_if(bsl::to_umax(0), bsl::to_umax(1)) == bsl::to_i32(2));
+                    bsl::ut_check(*md.at_if(bsl::to_umax(1), bsl::to_umax(2)) == bsl::to_i32(5));
+                    bsl::ut_check(nullptr == md.at_if(bsl::to_umax(2), bsl::to_umax(0)));
+                };
+
+                bsl::ut_then{} = [&arr]() {
+                    row_major const md{arr.data()};
+                    row_major::index_type const idx{bsl::to_umax(1), bsl::to_umax(1)};
+                    bsl::ut_check(*md.at_if(idx) == bsl::to_i32(4));
+                    bsl::ut_check(*md.at_if(bsl::to_umax(1), bsl::to_umax(1)) == bsl::to_i32(4));
+                };
+            };
+        };
+
+        bsl::ut_given{} = []() {
+            bsl::array<bsl::safe_int32, 24> arr{};
+            bsl::ut_when{} = [&arr]() {
+                cube md{arr.data()};
+                *md.at_if(bsl::to_umax(1), bsl::to_umax(2), bsl::to_umax(3)) = bsl::to_i32(42);
+                bsl::ut_then{} = [&arr]() {
+                    bsl::ut_check(*arr.back_if() == bsl::to_i32(42));
+                };
+            };
+        };
+    };
+
+    bsl::ut_scenario{"for_each visits in memory order"} = []() {
+        bsl::ut_given{} = []() {
+            bsl::array<bsl::safe_int32, 6> arr{};
+            bsl::ut_when{} = [&arr]() {
+                bsl::safe_int32 val{};
+                bsl::for_each(row_major{arr.data()}, [&val](bsl::safe_int32 &elem) noexcept {
+                    elem = val;
+                    ++val;
+                });
+
+                bsl::ut_then{} = [&arr]() {
+                    for (bsl::safe_uintmax i{}; i < arr.size(); ++i) {
+                        auto const expected{bsl::to_i32(static_cast<bsl::int32>(i.get()))};
+                        bsl::ut_check(*arr.at_if(i) == expected);
+                    }
+                };
+            };
+        };
+
+        bsl::ut_given{} = []() {
+            bsl::array<bsl::safe_int32, 6> arr{};
+            bsl::ut_when{} = [&arr]() {
+                bsl::safe_uintmax count{};
+                bsl::for_each(row_major{arr.data()}, [&count](bsl::safe_int32 &elem) noexcept {
+                    bsl::discard(elem);
+                    ++count;
+                    return count < bsl::to_umax(2);
+                });
+
+                bsl::ut_then{} = [&count]() {
+                    bsl::ut_check(count == bsl::to_umax(2));
+                };
+            };
+        };
+
+        bsl::ut_given{} = []() {
+            row_major md{};
+            bsl::ut_when{} = [&md]() {
+                bsl::safe_uintmax count{};
+                bsl::for_each(md, [&count](bsl::safe_int32 &elem) noexcept {
+                    bsl::discard(elem);
+                    ++count;
+                });
+
+                bsl::ut_then{} = [&count]() {
+                    bsl::ut_check(count.is_zero());
+                };
+            };
+        };
+    };
+
+    bsl::ut_scenario{"for_each with multi-index"} = []() {
+        bsl::ut_given{} = []() {
+            bsl::array<bsl::safe_int32, 6> arr{};
+            bsl::ut_when{} = [&arr]() {
+                row_major md{arr.data()};
+                bsl::for_each(
+                    md, [](bsl::safe_int32 &elem, row_major::index_type const &idx) noexcept {
+                        auto const i{*idx.at_if(bsl::to_umax(0))};
+                        auto const j{*idx.at_if(bsl::to_umax(1))};
+                        auto const val{(i * bsl::to_umax(10)) + j};
+                        elem = bsl::to_i32(static_cast<bsl::int32>(val.get()));
+                    });
+
+                bsl::ut_then{} = [&md]() {
+                    bsl::ut_check(*md.at_if(bsl::to_umax(0), bsl::to_umax(2)) == bsl::to_i32(2));
+                    bsl::ut_check(*md.at_if(bsl::to_umax(1), bsl::to_umax(0)) == bsl::to_i32(10));
+                    bsl::ut_check(*md.at_if(bsl::to_umax(1), bsl::to_umax(2)) == bsl::to_i32(12));
+                };
+            };
+        };
+
+        bsl::ut_given{} = []() {
+            bsl::array<bsl::safe_int32, 6> arr{};
+            bsl::ut_when{} = [&arr]() {
+                col_major md{arr.data()};
+                bsl::for_each(
+                    md, [](bsl::safe_int32 &elem, col_major::index_type const &idx) noexcept {
+                        auto const i{*idx.at_if(bsl::to_umax(0))};
+                        auto const j{*idx.at_if(bsl::to_umax(1))};
+                        auto const val{(i * bsl::to_umax(10)) + j};
+                        elem = bsl::to_i32(static_cast<bsl::int32>(val.get()));
+                    });
+
+                bsl::ut_then{} = [&arr, &md]() {
+                    bsl::ut_check(*arr.at_if(bsl::to_umax(1)) == bsl::to_i32(10));
+                    bsl::ut_check(*arr.at_if(bsl::to_umax(2)) == bsl::to_i32(1));
+                    bsl::ut_check(*md.at_if(bsl::to_umax(1), bsl::to_umax(2)) == bsl::to_i32(12));
+                };
+            };
+        };
+
+        bsl::ut_given{} = []() {
+            bsl::array<bsl::safe_int32, 24> arr{};
+            bsl::ut_when{} = [&arr]() {
+                cube md{arr.data()};
+                bsl::safe_uintmax count{};
+                bsl::for_each(
+                    md,
+                    [&count](bsl::safe_int32 &elem, cube::index_type const &idx) noexcept {
+                        elem = bsl::to_i32(static_cast<bsl::int32>(
+                            (*idx.at_if(bsl::to_umax(0)) * bsl::to_umax(100) +
+                             *idx.at_if(bsl::to_umax(1)) * bsl::to_umax(10) +
+                             *idx.at_if(bsl::to_umax(2)))
+                                .get()));
+                        ++count;
+                        return count < bsl::to_umax(23);
+                    });
+
+                bsl::ut_then{} = [&arr]() {
+                    bsl::ut_check(*arr.at_if(bsl::to_umax(4)) == bsl::to_i32(10));
+                    bsl::ut_check(*arr.at_if(bsl::to_umax(12)) == bsl::to_i32(100));
+                    bsl::ut_check(*arr.at_if(bsl::to_umax(22)) == bsl::to_i32(122));
+                    bsl::ut_check(*arr.at_if(bsl::to_umax(23)) == bsl::to_i32(0));
+                };
+            };
+        };
+    };
+
+    return bsl::ut_success();
+}
+
+/// <!-- description -->
+///   @brief Main function for this unit test. If a call to ut_check() fails
+///     the application will fast fail. If all calls to ut_check() pass, this
+///     function will successfully return with bsl::exit_success.
+///
+/// <!-- inputs/outputs -->
+///   @return Always returns bsl::exit_success.
+///
+bsl::exit_code
+main() noexcept
+{
+    static_assert(tests() == bsl::ut_success());
+    return tests();
+}
@@ -0,0 +1,100 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+#include <bsl/mdspan.hpp>
+#include <bsl/array.hpp>
+#include <bsl/convert.hpp>
+#include <bsl/extents.hpp>
+#include <bsl/for_each.hpp>
+#include <bsl/is_trivially_copyable.hpp>
+#include <bsl/safe_integral.hpp>
+#include <bsl/span.hpp>
+#include <bsl/ut.hpp>
+
+namespace
+{
+    /// @brief the mdspan type used by the tests
+    using md_type = bsl::mdspan<bsl::safe_int32, bsl::extents<2, 3>>;
+}
+
+/// <!-- description -->
+///   @brief Main function for this unit test. If a call to ut_check() fails
+///     the application will fast fail. If all calls to ut_check() pass, this
+///     function will successfully return with bsl::exit_success.
+///
+/// <!-- inputs/outputs -->
+///   @return Always returns bsl::exit_success.
+///
+bsl::exit_code
+main() noexcept
+{
+    using namespace bsl;
+
+    bsl::ut_scenario{"verify supports trivial types"} = []() {
+        static_assert(is_trivially_copyable<md_type>::value);
+    };
+
+    bsl::ut_scenario{"verify noexcept"} = []() {
+        bsl::ut_given_at_runtime{} = []() {
+            bsl::array<safe_int32, 6> arr{};
+            md_type md{arr.data()};
+            md_type::index_type const idx{};
+            bsl::ut_then{} = [&md, &arr, &idx]() {
+                static_assert(noexcept(md_type{}));
+                static_assert(noexcept(md_type{arr.data()}));
+                static_assert(noexcept(md_type{span<safe_int32>{arr.data(), arr.size()}}));
+                static_assert(noexcept(md.at_if(idx)));
+                static_assert(noexcept(md.at_if(to_umax(0), to_umax(0))));
+                static_assert(noexcept(md.data()));
+                static_assert(noexcept(md.flat()));
+                static_assert(noexcept(md.empty()));
+                static_assert(noexcept(!!md));
+                static_assert(noexcept(md.size()));
+                static_assert(noexcept(md_type::rank()));
+                static_assert(noexcept(md_type::extent(to_umax(0))));
+                static_assert(noexcept(md_type::stride(to_umax(0))));
+                static_assert(noexcept(for_each(md, [](safe_int32 &) noexcept {})));
+            };
+        };
+    };
+
+    bsl::ut_scenario{"verify constness"} = []() {
+        bsl::ut_given_at_runtime{} = []() {
+            bsl::array<safe_int32, 6> arr{};
+            md_type const md{arr.data()};
+            md_type::index_type const idx{};
+            bsl::ut_then{} = [&md, &idx]() {
+                bsl::ut_check(nullptr != md.at_if(idx));
+                bsl::ut_check(nullptr != md.at_if(to_umax(1), to_umax(2)));
+                bsl::ut_check(nullptr != md.data());
+                bsl::ut_check(!md.flat().empty());
+                bsl::ut_check(!md.empty());
+                bsl::ut_check(!!md);
+                bsl::ut_check(md.size() == to_umax(6));
+            };
+        };
+    };
+
+    return bsl::ut_success();
+}
@@ -0,0 +1,182 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+#include <bsl/merge.hpp>
+#include <bsl/array.hpp>
+#include <bsl/convert.hpp>
+#include <bsl/cstdint.hpp>
+#include <bsl/errc_type.hpp>
+#include <bsl/safe_integral.hpp>
+#include <bsl/span.hpp>
+#include <bsl/ut.hpp>
+
+namespace
+{
+    /// @class record
+    ///
+    /// <!-- description -->
+    ///   @brief Used to verify that merge is stable
+    ///
+    class record final
+    {
+    public:
+        /// @brief the key the records are sorted by
+        bsl::uint32 key;
+        /// @brief identifies where the record came from
+        bsl::uint32 tag;
+    };
+
+    /// @class record_less
+    ///
+    /// <!-- description -->
+    ///   @brief Orders records by key
+    ///
+    class record_less final
+    {
+    public:
+        /// <!-- description -->
+        ///   @brief Returns lhs.key < rhs.key
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param lhs the left hand side of the comparison
+        ///   @param rhs the right hand side of the comparison
+        ///   @return Returns lhs.key < rhs.key
+        ///
+        [[nodiscard]] constexpr auto
+        operator()(record const &lhs, record const &rhs) const noexcept -> bool
+        {
+            return lhs.key < rhs.key;
+        }
+    };
+}
+
+/// <!-- description -->
+///   @brief Used to execute the actual checks. We put the checks in this
+///     function so that we can validate the tests both at compile-time
+///     and at run-time. If a bsl::ut_check fails, the tests will either
+///     fail fast at run-time, or will produce a compile-time error.
+///
+/// <!-- inputs/outputs -->
+///   @return Always returns bsl::exit_success.
+///
+constexpr bsl::exit_code
+tests() noexcept
+{
+    bsl::ut_scenario{"merge empty"} = []() {
+        bsl::ut_given{} = []() {
+            bsl::span<bsl::safe_uint64 const> lhs{};
+            bsl::span<bsl::safe_uint64 const> rhs{};
+            bsl::span<bsl::safe_uint64> dst{};
+            bsl::ut_then{} = [&lhs, &rhs, &dst]() {
+                auto const ret{bsl::merge(lhs, rhs, dst)};
+                bsl::ut_check(ret.success());
+                bsl::ut_check(ret.get_if()->is_zero());
+            };
+        };
+    };
+
+    bsl::ut_scenario{"merge dst too small"} = []() {
+        bsl::ut_given_at_runtime{} = []() {
+            bsl::array<bsl::uint32, 2> lhs{1U, 3U};
+            bsl::array<bsl::uint32, 2> rhs{2U, 4U};
+            bsl::array<bsl::uint32, 3> dst{};
+            bsl::ut_then{} = [&lhs, &rhs, &dst]() {
+                auto const ret{bsl::merge(
+                    bsl::span<bsl::uint32 const>{lhs.data(), lhs.size()},
+                    bsl::span<bsl::uint32 const>{rhs.data(), rhs.size()},
+                    bsl::span<bsl::uint32>{dst.data(), dst.size()})};
+                bsl::ut_check(ret.errc() == bsl::errc_failure);
+            };
+        };
+    };
+
+    bsl::ut_scenario{"merge"} = []() {
+        bsl::ut_given{} = []() {
+            bsl::array<bsl::uint32, 4> lhs{1U, 3U, 5U, 7U};
+            bsl::array<bsl::uint32, 3> rhs{0U, 4U, 9U};
+            bsl::array<bsl::uint32, 7> dst{};
+            bsl::ut_then{} = [&lhs, &rhs, &dst]() {
+                auto const ret{bsl::merge(
+                    bsl::span<bsl::uint32 const>{lhs.data(), lhs.size()},
+                    bsl::span<bsl::uint32 const>{rhs.data(), rhs.size()},
+                    bsl::span<bsl::uint32>{dst.data(), dst.size()})};
+                bsl::ut_check(*ret.get_if() == dst.size());
+                bsl::ut_check(dst == bsl::array<bsl::uint32, 7>{0U, 1U, 3U, 4U, 5U, 7U, 9U});
+            };
+        };
+
+        bsl::ut_given{} = []() {
+            bsl::array<bsl::uint32, 3> lhs{7U, 5U, 1U};
+            bsl::array<bsl::uint32, 2> rhs{6U, 2U};
+            bsl::array<bsl::uint32, 5> dst{};
+            bsl::ut_then{} = [&lhs, &rhs, &dst]() {
+                auto const ret{bsl::merge(
+                    bsl::span<bsl::uint32 const>{lhs.data(), lhs.size()},
+                    bsl::span<bsl::uint32 const>{rhs.data(), rhs.size()},
+                    bsl::span<bsl::uint32>{dst.data(), dst.size()},
+                    [](bsl::uint32 const &a, bsl::uint32 const &b) noexcept -> bool {
+                        return a > b;
+                    })};
+                bsl::ut_check(ret.success());
+                bsl::ut_check(dst == bsl::array<bsl::uint32, 5>{7U, 6U, 5U, 2U, 1U});
+            };
+        };
+
+        bsl::ut_given{} = []() {
+            bsl::array<record, 2> lhs{record{1U, 0U}, record{2U, 0U}};
+            bsl::array<record, 2> rhs{record{1U, 1U}, record{2U, 1U}};
+            bsl::array<bsl::uint32, 4> tags{};
+            bsl::ut_then{} = [&lhs, &rhs, &tags]() {
+                bsl::safe_uintmax i{};
+                auto const count{bsl::merge(
+                    bsl::span<record const>{lhs.data(), lhs.size()},
+                    bsl::span<record const>{rhs.data(), rhs.size()},
+                    [&tags, &i](record const &rec) noexcept {
+                        *tags.at_if(i) = rec.tag;
+                        ++i;
+                    },
+                    record_less{})};
+                bsl::ut_check(count == bsl::to_umax(4));
+                bsl::ut_check(tags == bsl::array<bsl::uint32, 4>{0U, 1U, 0U, 1U});
+            };
+        };
+    };
+
+    return bsl::ut_success();
+}
+
+/// <!-- description -->
+///   @brief Main function for this unit test. If a call to ut_check() fails
+///     the application will fast fail. If all calls to ut_check() pass, this
+///     function will successfully return with bsl::exit_success.
+///
+/// <!-- inputs/outputs -->
+///   @return Always returns bsl::exit_success.
+///
+bsl::exit_code
+main() noexcept
+{
+    static_assert(tests() == bsl::ut_success());
+    return tests();
+}
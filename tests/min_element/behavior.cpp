@@ -0,0 +1,112 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+#include <bsl/min_element.hpp>
+#include <bsl/array.hpp>
+#include <bsl/convert.hpp>
+#include <bsl/cstdint.hpp>
+#include <bsl/safe_integral.hpp>
+#include <bsl/span.hpp>
+#include <bsl/string_view.hpp>
+#include <bsl/ut.hpp>
+
+/// <!-- description -->
+///   @brief Used to execute the actual checks. We put the checks in this
+///     function so that we can validate the tests both at compile-time
+///     and at run-time. If a bsl::ut_check fails, the tests will either
+///     fail fast at run-time, or will produce a compile-time error.
+///
+/// <!-- inputs/outputs -->
+///   @return Always returns bsl::exit_success.
+///
+constexpr bsl::exit_code
+tests() noexcept
+{
+    bsl::ut_scenario{"min_element empty"} = []() {
+        bsl::ut_given{} = []() {
+            bsl::span<bsl::uint32 const> spn{};
+            bsl::ut_then{} = [&spn]() {
+                bsl::ut_check(nullptr == bsl::min_element(spn));
+            };
+        };
+    };
+
+    bsl::ut_scenario{"min_element"} = []() {
+        bsl::ut_given{} = []() {
+            bsl::array<bsl::uint32, 6> arr{4U, 1U, 8U, 9U, 1U, 9U};
+            bsl::ut_then{} = [&arr]() {
+                auto const greater{
+                    [](bsl::uint32 const &a, bsl::uint32 const &b) noexcept { return a > b; }};
+                bsl::ut_check(bsl::min_element(arr) == arr.at_if(bsl::to_umax(1)));
+                bsl::ut_check(bsl::min_element(arr, greater) == arr.at_if(bsl::to_umax(3)));
+            };
+        };
+
+        bsl::ut_given{} = []() {
+            bsl::array<bsl::safe_int32, 4> arr{
+                bsl::to_i32(1), bsl::to_i32(7), bsl::to_i32(-5), bsl::to_i32(4)};
+            bsl::ut_then{} = [&arr]() {
+                bsl::ut_check(*bsl::min_element(arr) == bsl::to_i32(-5));
+            };
+        };
+
+        bsl::ut_given{} = []() {
+            bsl::string_view str{"the quick brown fox jumps over the lazy dog"};
+            bsl::ut_then{} = [&str]() {
+                bsl::ut_check(*bsl::min_element(str) == ' ');
+            };
+        };
+    };
+
+    bsl::ut_scenario{"min_element large"} = []() {
+        bsl::ut_given{} = []() {
+            bsl::array<bsl::int32, 100> arr{};
+            for (bsl::safe_uintmax i{}; i < arr.size(); ++i) {
+                *arr.at_if(i) = static_cast<bsl::int32>((i % bsl::to_umax(13)).get());
+            }
+
+            *arr.at_if(bsl::to_umax(77)) = -1;
+            bsl::ut_then{} = [&arr]() {
+                bsl::ut_check(bsl::min_element(arr) == arr.at_if(bsl::to_umax(77)));
+            };
+        };
+    };
+
+    return bsl::ut_success();
+}
+
+/// <!-- description -->
+///   @brief Main function for this unit test. If a call to ut_check() fails
+///     the application will fast fail. If all calls to ut_check() pass, this
+///     function will successfully return with bsl::exit_success.
+///
+/// <!-- inputs/outputs -->
+///   @return Always returns bsl::exit_success.
+///
+bsl::exit_code
+main() noexcept
+{
+    static_assert(tests() == bsl::ut_success());
+    return tests();
+}
@@ -0,0 +1,114 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+#include <bsl/minmax_element.hpp>
+#include <bsl/array.hpp>
+#include <bsl/convert.hpp>
+#include <bsl/cstdint.hpp>
+#include <bsl/safe_integral.hpp>
+#include <bsl/span.hpp>
+#include <bsl/string_view.hpp>
+#include <bsl/ut.hpp>
+
+/// <!-- description -->
+///   @brief Used to execute the actual checks. We put the checks in this
+///     function so that we can validate the tests both at compile-time
+///     and at run-time. If a bsl::ut_check fails, the tests will either
+///     fail fast at run-time, or will produce a compile-time error.
+///
+/// <!-- inputs/outputs -->
+///   @return Always returns bsl::exit_success.
+///
+constexpr bsl::exit_code
+tests() noexcept
+{
+    bsl::ut_scenario{"minmax_element empty"} = []() {
+        bsl::ut_given{} = []() {
+            bsl::span<bsl::uint32 const> spn{};
+            bsl::ut_then{} = [&spn]() {
+                auto const [min, max]{bsl::minmax_element(spn)};
+                bsl::ut_check(nullptr == min);
+                bsl::ut_check(nullptr == max);
+            };
+        };
+    };
+
+    bsl::ut_scenario{"minmax_element"} = []() {
+        bsl::ut_given{} = []() {
+            bsl::array<bsl::uint32, 6> arr{4U, 1U, 9U, 8U, 1U, 9U};
+            bsl::ut_then{} = [&arr]() {
+                auto const [min, max]{bsl::minmax_element(arr)};
+                bsl::ut_check(min == arr.at_if(bsl::to_umax(1)));
+                bsl::ut_check(max == arr.at_if(bsl::to_umax(5)));
+            };
+        };
+
+        bsl::ut_given{} = []() {
+            bsl::array<bsl::uint32, 6> arr{4U, 1U, 9U, 8U, 1U, 9U};
+            bsl::ut_then{} = [&arr]() {
+                auto const greater{
+                    [](bsl::uint32 const &a, bsl::uint32 const &b) noexcept { return a > b; }};
+                auto const [min, max]{bsl::minmax_element(arr, greater)};
+                bsl::ut_check(min == arr.at_if(bsl::to_umax(2)));
+                bsl::ut_check(max == arr.at_if(bsl::to_umax(4)));
+            };
+        };
+
+        bsl::ut_given{} = []() {
+            bsl::array<bsl::safe_int32, 5> arr{
+                bsl::to_i32(1), bsl::to_i32(7), bsl::to_i32(-5), bsl::to_i32(7), bsl::to_i32(-5)};
+            bsl::ut_then{} = [&arr]() {
+                auto const [min, max]{bsl::minmax_element(arr)};
+                bsl::ut_check(min == arr.at_if(bsl::to_umax(2)));
+                bsl::ut_check(max == arr.at_if(bsl::to_umax(3)));
+            };
+        };
+
+        bsl::ut_given{} = []() {
+            bsl::string_view str{"hello"};
+            bsl::ut_then{} = [&str]() {
+                auto const [min, max]{bsl::minmax_element(str)};
+                bsl::ut_check('e' == *min);
+                bsl::ut_check('o' == *max);
+            };
+        };
+    };
+
+    return bsl::ut_success();
+}
+
+/// <!-- description -->
+///   @brief Main function for this unit test. If a call to ut_check() fails
+///     the application will fast fail. If all calls to ut_check() pass, this
+///     function will successfully return with bsl::exit_success.
+///
+/// <!-- inputs/outputs -->
+///   @return Always returns bsl::exit_success.
+///
+bsl::exit_code
+main() noexcept
+{
+    static_assert(tests() == bsl::ut_success());
+    return tests();
+}
@@ -0,0 +1,187 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+#include <bsl/nth_element.hpp>
+#include <bsl/array.hpp>
+#include <bsl/convert.hpp>
+#include <bsl/cstdint.hpp>
+#include <bsl/iota.hpp>
+#include <bsl/reverse.hpp>
+#include <bsl/safe_integral.hpp>
+#include <bsl/span.hpp>
+#include <bsl/ut.hpp>
+
+namespace
+{
+    /// <!-- description -->
+    ///   @brief Returns true if the element at "nth" partitions the view
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @tparam VIEW the type of view to check
+    ///   @param vw the view to check
+    ///   @param nth the index of the element that was selected
+    ///   @return Returns true if the element at "nth" partitions the view
+    ///
+    template<typename VIEW>
+    [[nodiscard]] constexpr auto
+    is_partitioned_at(VIEW const &vw, bsl::safe_uintmax const &nth) noexcept -> bool
+    {
+        auto const &val{*vw.at_if(nth)};
+        for (bsl::safe_uintmax i{}; i < vw.size(); ++i) {
+            if ((i < nth) && (val < *vw.at_if(i))) {
+                return false;
+            }
+
+            if ((i > nth) && (*vw.at_if(i) < val)) {
+                return false;
+            }
+        }
+
+        return true;
+    }
+}
+
+/// <!-- description -->
+///   @brief Used to execute the actual checks. We put the checks in this
+///     function so that we can validate the tests both at compile-time
+///     and at run-time. If a bsl::ut_check fails, the tests will either
+///     fail fast at run-time, or will produce a compile-time error.
+///
+/// <!-- inputs/outputs -->
+///   @return Always returns bsl::exit_success.
+///
+constexpr bsl::exit_code
+tests() noexcept
+{
+    bsl::ut_scenario{"nth_element invalid args"} = []() {
+        bsl::ut_given{} = []() {
+            bsl::array<bsl::uint32, 4> arr{4U, 3U, 2U, 1U};
+            bsl::span<bsl::uint32> spn{};
+            bsl::ut_then{} = [&arr, &spn]() {
+                bsl::ut_check(nullptr == bsl::nth_element(arr, bsl::safe_uintmax::zero(true)));
+                bsl::ut_check(nullptr == bsl::nth_element(arr, bsl::to_umax(4)));
+                bsl::ut_check(nullptr == bsl::nth_element(spn, bsl::to_umax(0)));
+                bsl::ut_check(arr == bsl::array<bsl::uint32, 4>{4U, 3U, 2U, 1U});
+            };
+        };
+    };
+
+    bsl::ut_scenario{"nth_element small"} = []() {
+        bsl::ut_given{} = []() {
+            bsl::array<bsl::uint32, 5> arr{5U, 1U, 4U, 2U, 3U};
+            bsl::ut_then{} = [&arr]() {
+                bsl::ut_check(*bsl::nth_element(arr, bsl::to_umax(2)) == 3U);
+                bsl::ut_check(*bsl::nth_element(arr, bsl::to_umax(0)) == 1U);
+                bsl::ut_check(*bsl::nth_element(arr, bsl::to_umax(4)) == 5U);
+            };
+        };
+
+        bsl::ut_given{} = []() {
+            bsl::array<bsl::uint32, 5> arr{5U, 1U, 4U, 2U, 3U};
+            bsl::ut_then{} = [&arr]() {
+                auto const *const ptr{bsl::nth_element(
+                    arr, bsl::to_umax(0), [](bsl::uint32 const &a, bsl::uint32 const &b) noexcept {
+                        return a > b;
+                    })};
+                bsl::ut_check(*ptr == 5U);
+            };
+        };
+    };
+
+    bsl::ut_scenario{"nth_element large"} = []() {
+        bsl::ut_given_at_runtime{} = []() {
+            bsl::array<bsl::uint32, 1000> arr{};
+            bsl::ut_then{} = [&arr]() {
+                for (bsl::safe_uintmax nth{}; nth < arr.size(); nth += bsl::to_umax(37)) {
+                    bsl::ut_fill_random(arr, 1000U);
+                    bsl::nth_element(arr, nth);
+                    bsl::ut_check(is_partitioned_at(arr, nth));
+                }
+            };
+        };
+
+        bsl::ut_given_at_runtime{} = []() {
+            bsl::array<bsl::uint32, 1000> arr{};
+            bsl::ut_then{} = [&arr]() {
+                bsl::ut_fill_random(arr, 3U);
+                bsl::nth_element(arr, bsl::to_umax(990));
+                bsl::ut_check(is_partitioned_at(arr, bsl::to_umax(990)));
+            };
+        };
+
+        bsl::ut_given_at_runtime{} = []() {
+            bsl::array<bsl::uint32, 1000> arr{};
+            bsl::ut_then{} = [&arr]() {
+                bsl::iota(arr, bsl::uint32{});
+                bsl::ut_check(*bsl::nth_element(arr, bsl::to_umax(500)) == 500U);
+                bsl::iota(arr, bsl::uint32{});
+                bsl::reverse(arr);
+                bsl::ut_check(*bsl::nth_element(arr, bsl::to_umax(990)) == 990U);
+            };
+        };
+
+        bsl::ut_given_at_runtime{} = []() {
+            bsl::array<bsl::uint32, 1001> arr{};
+            bsl::ut_then{} = [&arr]() {
+                for (bsl::safe_uintmax i{}; i < arr.size(); ++i) {
+                    *arr.at_if(i) = bsl::to_u32(i.min(arr.size() - i)).get();
+                }
+
+                bsl::ut_check(*bsl::nth_element(arr, bsl::to_umax(999)) == 500U);
+                bsl::ut_check(is_partitioned_at(arr, bsl::to_umax(999)));
+            };
+        };
+    };
+
+    bsl::ut_scenario{"nth_element safe_integral"} = []() {
+        bsl::ut_given{} = []() {
+            bsl::array<bsl::safe_uint64, 40> arr{};
+            bsl::ut_when{} = [&arr]() {
+                bsl::iota(arr, bsl::to_u64(0));
+                bsl::reverse(arr);
+                bsl::ut_then{} = [&arr]() {
+                    bsl::ut_check(*bsl::nth_element(arr, bsl::to_umax(20)) == bsl::to_u64(20));
+                    bsl::ut_check(is_partitioned_at(arr, bsl::to_umax(20)));
+                };
+            };
+        };
+    };
+
+    return bsl::ut_success();
+}
+
+/// <!-- description -->
+///   @brief Main function for this unit test. If a call to ut_check() fails
+///     the application will fast fail. If all calls to ut_check() pass, this
+///     function will successfully return with bsl::exit_success.
+///
+/// <!-- inputs/outputs -->
+///   @return Always returns bsl::exit_success.
+///
+bsl::exit_code
+main() noexcept
+{
+    static_assert(tests() == bsl::ut_success());
+    return tests();
+}
@@ -0,0 +1,186 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+#include <bsl/convert.hpp>
+#include <bsl/page_span.hpp>
+#include <bsl/phys_addr.hpp>
+#include <bsl/safe_integral.hpp>
+#include <bsl/ut.hpp>
+#include <bsl/virt_addr.hpp>
+
+/// <!-- description -->
+///   @brief Used to execute the actual checks. We put the checks in this
+///     function so that we can validate the tests both at compile-time
+///     and at run-time. If a bsl::ut_check fails, the tests will either
+///     fail fast at run-time, or will produce a compile-time error.
+///
+/// <!-- inputs/outputs -->
+///   @return Always returns bsl::exit_success.
+///
+constexpr bsl::exit_code
+tests() noexcept
+{
+    using namespace bsl;
+
+    bsl::ut_scenario{"default constructor"} = []() {
+        bsl::ut_given{} = []() {
+            page_span<phys_addr> const span{};
+            bsl::ut_then{} = [&span]() {
+                bsl::ut_check(span.empty());
+                bsl::ut_check(!span.failure());
+                bsl::ut_check(span.size() == to_umax(0));
+                bsl::ut_check(span.base() == phys_addr{});
+            };
+        };
+    };
+
+    bsl::ut_scenario{"empty range"} = []() {
+        bsl::ut_given{} = []() {
+            page_span<phys_addr> const span{phys_addr{to_umax(0x1234)}, to_umax(0)};
+            bsl::ut_then{} = [&span]() {
+                bsl::ut_check(span.empty());
+                bsl::ut_check(!span.failure());
+            };
+        };
+    };
+
+    bsl::ut_scenario{"range within one page"} = []() {
+        bsl::ut_given{} = []() {
+            page_span<phys_addr> const span{phys_addr{to_umax(0x1234)}, to_umax(0x10)};
+            bsl::ut_then{} = [&span]() {
+                bsl::ut_check(span.size() == to_umax(1));
+                bsl::ut_check(span.page(to_umax(0)).get() == to_umax(0x1000));
+                bsl::ut_check(span.addr(to_umax(0)).get() == to_umax(0x1234));
+                bsl::ut_check(span.bytes(to_umax(0)) == to_umax(0x10));
+            };
+        };
+
+        bsl::ut_given{} = []() {
+            page_span<phys_addr> const span{phys_addr{to_umax(0x1000)}, to_umax(0x1000)};
+            bsl::ut_then{} = [&span]() {
+                bsl::ut_check(span.size() == to_umax(1));
+                bsl::ut_check(span.addr(to_umax(0)).get() == to_umax(0x1000));
+                bsl::ut_check(span.bytes(to_umax(0)) == to_umax(0x1000));
+            };
+        };
+    };
+
+    bsl::ut_scenario{"range across pages"} = []() {
+        bsl::ut_given{} = []() {
+            page_span<virt_addr> const span{virt_addr{to_umax(0x1FF0)}, to_umax(0x1020)};
+            bsl::ut_then{} = [&span]() {
+                bsl::ut_check(span.size() == to_umax(3));
+                bsl::ut_check(span.page(to_umax(0)).get() == to_umax(0x1000));
+                bsl::ut_check(span.page(to_umax(1)).get() == to_umax(0x2000));
+                bsl::ut_check(span.page(to_umax(2)).get() == to_umax(0x3000));
+                bsl::ut_check(span.addr(to_umax(0)).get() == to_umax(0x1FF0));
+                bsl::ut_check(span.addr(to_umax(1)).get() == to_umax(0x2000));
+                bsl::ut_check(span.addr(to_umax(2)).get() == to_umax(0x3000));
+                bsl::ut_check(span.bytes(to_umax(0)) == to_umax(0x10));
+                bsl::ut_check(span.bytes(to_umax(1)) == to_umax(0x1000));
+                bsl::ut_check(span.bytes(to_umax(2)) == to_umax(0x10));
+            };
+        };
+
+        bsl::ut_given{} = []() {
+            page_span<virt_addr> const span{virt_addr{to_umax(0x1FF0)}, to_umax(0x2010)};
+            bsl::ut_then{} = [&span]() {
+                safe_uintmax total{};
+                for (safe_uintmax i{}; i < span.size(); ++i) {
+                    total += span.bytes(i);
+                }
+
+                bsl::ut_check(span.size() == to_umax(3));
+                bsl::ut_check(total == to_umax(0x2010));
+            };
+        };
+    };
+
+    bsl::ut_scenario{"range at the end of the address space"} = []() {
+        bsl::ut_given{} = []() {
+            safe_uintmax const max{safe_uintmax::max()};
+            page_span<phys_addr> const span{phys_addr{max - to_umax(0xF)}, to_umax(0x10)};
+            bsl::ut_then{} = [&span]() {
+                bsl::ut_check(span.size() == to_umax(1));
+                bsl::ut_check(!span.failure());
+                bsl::ut_check(span.bytes(to_umax(0)) == to_umax(0x10));
+            };
+        };
+    };
+
+    bsl::ut_scenario{"invalid ranges"} = []() {
+        bsl::ut_given_at_runtime{} = []() {
+            safe_uintmax const max{safe_uintmax::max()};
+            page_span<phys_addr> const span{phys_addr{max - to_umax(0xF)}, to_umax(0x11)};
+            bsl::ut_then{} = [&span]() {
+                bsl::ut_check(span.failure());
+                bsl::ut_check(span.empty());
+                bsl::ut_check(span.size().failure());
+            };
+        };
+
+        bsl::ut_given_at_runtime{} = []() {
+            page_span<phys_addr> const span{phys_addr{safe_uintmax::zero(true)}, to_umax(1)};
+            bsl::ut_then{} = [&span]() {
+                bsl::ut_check(span.failure());
+            };
+        };
+    };
+
+    bsl::ut_scenario{"index out of bounds"} = []() {
+        bsl::ut_given_at_runtime{} = []() {
+            page_span<phys_addr> const span{phys_addr{to_umax(0x1000)}, to_umax(0x10)};
+            bsl::ut_then{} = [&span]() {
+                bsl::ut_check(span.page(to_umax(1)).failure());
+                bsl::ut_check(span.addr(to_umax(1)).failure());
+                bsl::ut_check(span.bytes(to_umax(1)).failure());
+                bsl::ut_check(span.page(safe_uintmax::zero(true)).failure());
+            };
+        };
+
+        bsl::ut_given_at_runtime{} = []() {
+            page_span<phys_addr> const span{};
+            bsl::ut_then{} = [&span]() {
+                bsl::ut_check(span.addr(to_umax(0)).failure());
+            };
+        };
+    };
+
+    return bsl::ut_success();
+}
+
+/// <!-- description -->
+///   @brief Main function for this unit test. If a call to ut_check() fails
+///     the application will fast fail. If all calls to ut_check() pass, this
+///     function will successfully return with bsl::exit_success.
+///
+/// <!-- inputs/outputs -->
+///   @return Always returns bsl::exit_success.
+///
+bsl::exit_code
+main() noexcept
+{
+    static_assert(tests() == bsl::ut_success());
+    return tests();
+}
@@ -0,0 +1,137 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+#include <bsl/partial_sort.hpp>
+#include <bsl/array.hpp>
+#include <bsl/convert.hpp>
+#include <bsl/cstdint.hpp>
+#include <bsl/iota.hpp>
+#include <bsl/reverse.hpp>
+#include <bsl/safe_integral.hpp>
+#include <bsl/span.hpp>
+#include <bsl/ut.hpp>
+
+/// <!-- description -->
+///   @brief Used to execute the actual checks. We put the checks in this
+///     function so that we can validate the tests both at compile-time
+///     and at run-time. If a bsl::ut_check fails, the tests will either
+///     fail fast at run-time, or will produce a compile-time error.
+///
+/// <!-- inputs/outputs -->
+///   @return Always returns bsl::exit_success.
+///
+constexpr bsl::exit_code
+tests() noexcept
+{
+    bsl::ut_scenario{"partial_sort invalid args"} = []() {
+        bsl::ut_given_at_runtime{} = []() {
+            bsl::array<bsl::uint32, 4> arr{4U, 3U, 2U, 1U};
+            bsl::ut_then{} = [&arr]() {
+                bsl::partial_sort(arr, bsl::safe_uintmax::zero(true));
+                bsl::ut_check(arr == bsl::array<bsl::uint32, 4>{4U, 3U, 2U, 1U});
+            };
+        };
+    };
+
+    bsl::ut_scenario{"partial_sort edge cases"} = []() {
+        bsl::ut_given{} = []() {
+            bsl::array<bsl::uint32, 4> arr{4U, 3U, 2U, 1U};
+            bsl::span<bsl::uint32> spn{};
+            bsl::ut_then{} = [&arr, &spn]() {
+                bsl::partial_sort(spn, bsl::to_umax(4));
+                bsl::partial_sort(arr, bsl::to_umax(0));
+                bsl::ut_check(arr == bsl::array<bsl::uint32, 4>{4U, 3U, 2U, 1U});
+                bsl::partial_sort(arr, bsl::to_umax(42));
+                bsl::ut_check(arr == bsl::array<bsl::uint32, 4>{1U, 2U, 3U, 4U});
+            };
+        };
+    };
+
+    bsl::ut_scenario{"partial_sort"} = []() {
+        bsl::ut_given{} = []() {
+            bsl::array<bsl::uint32, 8> arr{7U, 2U, 8U, 1U, 6U, 3U, 5U, 4U};
+            bsl::ut_then{} = [&arr]() {
+                bsl::partial_sort(arr, bsl::to_umax(3));
+                bsl::ut_check(*arr.at_if(bsl::to_umax(0)) == 1U);
+                bsl::ut_check(*arr.at_if(bsl::to_umax(1)) == 2U);
+                bsl::ut_check(*arr.at_if(bsl::to_umax(2)) == 3U);
+            };
+        };
+
+        bsl::ut_given{} = []() {
+            bsl::array<bsl::safe_uint64, 40> arr{};
+            bsl::ut_when{} = [&arr]() {
+                bsl::iota(arr, bsl::to_u64(0));
+                bsl::ut_then{} = [&arr]() {
+                    bsl::partial_sort(
+                        arr,
+                        bsl::to_umax(5),
+                        [](bsl::safe_uint64 const &a, bsl::safe_uint64 const &b) noexcept {
+                            return a > b;
+                        });
+                    for (bsl::safe_uintmax i{}; i < bsl::to_umax(5); ++i) {
+                        bsl::ut_check(*arr.at_if(i) == bsl::to_u64(39) - bsl::to_u64(i));
+                    }
+                };
+            };
+        };
+
+        bsl::ut_given_at_runtime{} = []() {
+            bsl::array<bsl::uint32, 1000> arr{};
+            bsl::array<bsl::uint32, 1000> sorted{};
+            bsl::ut_when{} = [&arr, &sorted]() {
+                bsl::ut_fill_random(sorted, 100U);
+                bsl::partial_sort(sorted, sorted.size());
+                bsl::ut_then{} = [&arr, &sorted]() {
+                    for (bsl::safe_uintmax i{bsl::to_umax(1)}; i < sorted.size(); ++i) {
+                        bsl::ut_check(*sorted.at_if(i - bsl::to_umax(1)) <= *sorted.at_if(i));
+                    }
+
+                    bsl::ut_fill_random(arr, 100U);
+                    bsl::partial_sort(arr, bsl::to_umax(100));
+                    for (bsl::safe_uintmax i{}; i < bsl::to_umax(100); ++i) {
+                        bsl::ut_check(*arr.at_if(i) == *sorted.at_if(i));
+                    }
+                };
+            };
+        };
+    };
+
+    return bsl::ut_success();
+}
+
+/// <!-- description -->
+///   @brief Main function for this unit test. If a call to ut_check() fails
+///     the application will fast fail. If all calls to ut_check() pass, this
+///     function will successfully return with bsl::exit_success.
+///
+/// <!-- inputs/outputs -->
+///   @return Always returns bsl::exit_success.
+///
+bsl::exit_code
+main() noexcept
+{
+    static_assert(tests() == bsl::ut_success());
+    return tests();
+}
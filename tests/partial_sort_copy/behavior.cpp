@@ -0,0 +1,127 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+#include <bsl/partial_sort_copy.hpp>
+#include <bsl/array.hpp>
+#include <bsl/convert.hpp>
+#include <bsl/cstdint.hpp>
+#include <bsl/partial_sort.hpp>
+#include <bsl/safe_integral.hpp>
+#include <bsl/span.hpp>
+#include <bsl/ut.hpp>
+
+/// <!-- description -->
+///   @brief Used to execute the actual checks. We put the checks in this
+///     function so that we can validate the tests both at compile-time
+///     and at run-time. If a bsl::ut_check fails, the tests will either
+///     fail fast at run-time, or will produce a compile-time error.
+///
+/// <!-- inputs/outputs -->
+///   @return Always returns bsl::exit_success.
+///
+constexpr bsl::exit_code
+tests() noexcept
+{
+    bsl::ut_scenario{"partial_sort_copy empty"} = []() {
+        bsl::ut_given{} = []() {
+            bsl::array<bsl::uint32, 4> arr{4U, 3U, 2U, 1U};
+            bsl::ut_then{} = [&arr]() {
+                bsl::ut_check(bsl::partial_sort_copy(
+                                  bsl::span<bsl::uint32 const>{}, bsl::span{arr.data(), arr.size()})
+                                  .is_zero());
+                bsl::ut_check(bsl::partial_sort_copy(
+                                  bsl::span<bsl::uint32 const>{arr.data(), arr.size()},
+                                  bsl::span<bsl::uint32>{})
+                                  .is_zero());
+            };
+        };
+    };
+
+    bsl::ut_scenario{"partial_sort_copy"} = []() {
+        bsl::ut_given{} = []() {
+            bsl::array<bsl::uint32, 8> src{7U, 2U, 8U, 1U, 6U, 3U, 5U, 4U};
+            bsl::array<bsl::uint32, 3> dst{};
+            bsl::ut_then{} = [&src, &dst]() {
+                auto const count{bsl::partial_sort_copy(
+                    bsl::span<bsl::uint32 const>{src.data(), src.size()},
+                    bsl::span{dst.data(), dst.size()})};
+                bsl::ut_check(count == dst.size());
+                bsl::ut_check(dst == bsl::array<bsl::uint32, 3>{1U, 2U, 3U});
+                bsl::ut_check(src == bsl::array<bsl::uint32, 8>{7U, 2U, 8U, 1U, 6U, 3U, 5U, 4U});
+            };
+        };
+
+        bsl::ut_given{} = []() {
+            bsl::array<bsl::uint32, 3> src{3U, 1U, 2U};
+            bsl::array<bsl::uint32, 5> dst{};
+            bsl::ut_then{} = [&src, &dst]() {
+                auto const count{bsl::partial_sort_copy(
+                    bsl::span<bsl::uint32 const>{src.data(), src.size()},
+                    bsl::span{dst.data(), dst.size()},
+                    [](bsl::uint32 const &a, bsl::uint32 const &b) noexcept {
+                        return a > b;
+                    })};
+                bsl::ut_check(count == src.size());
+                bsl::ut_check(dst == bsl::array<bsl::uint32, 5>{3U, 2U, 1U, 0U, 0U});
+            };
+        };
+
+        bsl::ut_given_at_runtime{} = []() {
+            bsl::array<bsl::uint32, 1000> src{};
+            bsl::array<bsl::uint32, 1000> sorted{};
+            bsl::array<bsl::uint32, 50> dst{};
+            bsl::ut_when{} = [&src, &sorted, &dst]() {
+                bsl::ut_fill_random(src, 1000U);
+                bsl::ut_fill_random(sorted, 1000U);
+                bsl::partial_sort(sorted, sorted.size());
+                bsl::ut_then{} = [&src, &sorted, &dst]() {
+                    bsl::ut_check(
+                        bsl::partial_sort_copy(
+                            bsl::span<bsl::uint32 const>{src.data(), src.size()},
+                            bsl::span{dst.data(), dst.size()}) == dst.size());
+                    for (bsl::safe_uintmax i{}; i < dst.size(); ++i) {
+                        bsl::ut_check(*dst.at_if(i) == *sorted.at_if(i));
+                    }
+                };
+            };
+        };
+    };
+
+    return bsl::ut_success();
+}
+
+/// <!-- description -->
+///   @brief Main function for this unit test. If a call to ut_check() fails
+///     the application will fast fail. If all calls to ut_check() pass, this
+///     function will successfully return with bsl::exit_success.
+///
+/// <!-- inputs/outputs -->
+///   @return Always returns bsl::exit_success.
+///
+bsl::exit_code
+main() noexcept
+{
+    static_assert(tests() == bsl::ut_success());
+    return tests();
+}
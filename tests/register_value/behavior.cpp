@@ -0,0 +1,218 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+#include <bsl/bitfield.hpp>
+#include <bsl/convert.hpp>
+#include <bsl/cstdint.hpp>
+#include <bsl/register_value.hpp>
+#include <bsl/safe_integral.hpp>
+#include <bsl/ut.hpp>
+
+namespace
+{
+    /// @class cr0
+    ///
+    /// <!-- description -->
+    ///   @brief A register laid out like CR0, used for testing
+    ///
+    class cr0 final
+    {
+    public:
+        /// @brief the type used to store the register
+        using value_type = bsl::uint64;
+    };
+
+    /// @brief CR0.PE
+    using cr0_pe = bsl::bitfield<cr0, 0U, 1U>;
+    /// @brief CR0.MP
+    using cr0_mp = bsl::bitfield<cr0, 1U, 1U>;
+    /// @brief CR0.NE
+    using cr0_ne = bsl::bitfield<cr0, 5U, 1U>;
+    /// @brief CR0.PG
+    using cr0_pg = bsl::bitfield<cr0, 31U, 1U>;
+    /// @brief a multi-bit field used for testing
+    using cr0_xx = bsl::bitfield<cr0, 8U, 4U>;
+    /// @brief the top 16 bits, used for testing
+    using cr0_hi = bsl::bitfield<cr0, 48U, 16U>;
+
+    /// @class reg8
+    ///
+    /// <!-- description -->
+    ///   @brief An 8 bit register used for testing
+    ///
+    class reg8 final
+    {
+    public:
+        /// @brief the type used to store the register
+        using value_type = bsl::uint8;
+    };
+
+    /// @brief the low nibble of reg8
+    using reg8_lo = bsl::bitfield<reg8, 0U, 4U>;
+    /// @brief the high nibble of reg8
+    using reg8_hi = bsl::bitfield<reg8, 4U, 4U>;
+}
+
+/// <!-- description -->
+///   @brief Used to execute the actual checks. We put the checks in this
+///     function so that we can validate the tests both at compile-time
+///     and at run-time. If a bsl::ut_check fails, the tests will either
+///     fail fast at run-time, or will produce a compile-time error.
+///
+/// <!-- inputs/outputs -->
+///   @return Always returns bsl::exit_success.
+///
+constexpr bsl::exit_code
+tests() noexcept
+{
+    using namespace bsl;
+
+    bsl::ut_scenario{"constructors"} = []() {
+        bsl::ut_then{} = []() {
+            bsl::ut_check(register_value<cr0>{}.get() == to_u64(0));
+            bsl::ut_check(register_value<cr0>{to_u64(0x80000011)}.get() == to_u64(0x80000011));
+            bsl::ut_check(!register_value<cr0>{}.failure());
+            bsl::ut_check(register_value<cr0>{safe_uint64::zero(true)}.failure());
+        };
+    };
+
+    bsl::ut_scenario{"read"} = []() {
+        bsl::ut_given{} = []() {
+            register_value<cr0> const reg{to_u64(0xFFFF000080000A21)};
+            bsl::ut_then{} = [&reg]() {
+                bsl::ut_check(reg.read<cr0_pe>() == to_u64(1));
+                bsl::ut_check(reg.read<cr0_mp>() == to_u64(0));
+                bsl::ut_check(reg.read<cr0_ne>() == to_u64(1));
+                bsl::ut_check(reg.read<cr0_pg>() == to_u64(1));
+                bsl::ut_check(reg.read<cr0_xx>() == to_u64(0xA));
+                bsl::ut_check(reg.read<cr0_hi>() == to_u64(0xFFFF));
+            };
+        };
+
+        bsl::ut_given{} = []() {
+            register_value<cr0> const reg{safe_uint64::zero(true)};
+            bsl::ut_then{} = [&reg]() {
+                bsl::ut_check(reg.read<cr0_pe>().failure());
+            };
+        };
+    };
+
+    bsl::ut_scenario{"is_set and is_clear"} = []() {
+        bsl::ut_given{} = []() {
+            register_value<cr0> const reg{to_u64(0x80000021)};
+            bsl::ut_then{} = [&reg]() {
+                bsl::ut_check(reg.is_set<cr0_pe>());
+                bsl::ut_check(reg.is_set<cr0_pe, cr0_ne, cr0_pg>());
+                bsl::ut_check(!reg.is_set<cr0_pe, cr0_mp>());
+                bsl::ut_check(reg.is_clear<cr0_mp>());
+                bsl::ut_check(reg.is_clear<cr0_mp, cr0_xx>());
+                bsl::ut_check(!reg.is_clear<cr0_mp, cr0_pg>());
+            };
+        };
+
+        bsl::ut_given{} = []() {
+            register_value<cr0> const reg{safe_uint64::zero(true)};
+            bsl::ut_then{} = [&reg]() {
+                bsl::ut_check(!reg.is_set<cr0_pe>());
+                bsl::ut_check(!reg.is_clear<cr0_pe>());
+            };
+        };
+    };
+
+    bsl::ut_scenario{"set and clear"} = []() {
+        bsl::ut_given{} = []() {
+            register_value<cr0> reg{};
+            bsl::ut_when{} = [&reg]() {
+                reg.set<cr0_pe, cr0_ne, cr0_pg>();
+                bsl::ut_then{} = [&reg]() {
+                    bsl::ut_check(reg.get() == to_u64(0x80000021));
+                };
+            };
+
+            bsl::ut_when{} = [&reg]() {
+                reg.clear<cr0_pe, cr0_pg>();
+                bsl::ut_then{} = [&reg]() {
+                    bsl::ut_check(reg.get() == to_u64(0x20));
+                };
+            };
+        };
+    };
+
+    bsl::ut_scenario{"write"} = []() {
+        bsl::ut_given{} = []() {
+            register_value<cr0> reg{to_u64(0xFFFF000000000F01)};
+            bsl::ut_when{} = [&reg]() {
+                bsl::ut_check(reg.write<cr0_xx, cr0_pg, cr0_pe>(to_u64(0x5), to_u64(1), to_u64(0)));
+                bsl::ut_then{} = [&reg]() {
+                    bsl::ut_check(reg.get() == to_u64(0xFFFF000080000500));
+                };
+            };
+
+            bsl::ut_when{} = [&reg]() {
+                bsl::ut_check(reg.write<cr0_hi>(to_u64(0x1234)));
+                bsl::ut_then{} = [&reg]() {
+                    bsl::ut_check(reg.get() == to_u64(0x1234000080000500));
+                };
+            };
+        };
+
+        bsl::ut_given{} = []() {
+            register_value<reg8> reg{to_u8(0x5A)};
+            bsl::ut_when{} = [&reg]() {
+                bsl::ut_check(reg.write<reg8_hi, reg8_lo>(to_u8(0xC), to_u8(0x3)));
+                bsl::ut_then{} = [&reg]() {
+                    bsl::ut_check(reg.get() == to_u8(0xC3));
+                };
+            };
+        };
+
+        bsl::ut_given_at_runtime{} = []() {
+            register_value<cr0> reg{to_u64(0x21)};
+            bsl::ut_when{} = [&reg]() {
+                bsl::ut_check(!reg.write<cr0_pg, cr0_xx>(to_u64(1), to_u64(0x10)));
+                bsl::ut_check(!reg.write<cr0_pg>(safe_uint64::zero(true)));
+                bsl::ut_then{} = [&reg]() {
+                    bsl::ut_check(reg.get() == to_u64(0x21));
+                };
+            };
+        };
+    };
+
+    return bsl::ut_success();
+}
+
+/// <!-- description -->
+///   @brief Main function for this unit test. If a call to ut_check() fails
+///     the application will fast fail. If all calls to ut_check() pass, this
+///     function will successfully return with bsl::exit_success.
+///
+/// <!-- inputs/outputs -->
+///   @return Always returns bsl::exit_success.
+///
+bsl::exit_code
+main() noexcept
+{
+    static_assert(tests() == bsl::ut_success());
+    return tests();
+}
@@ -0,0 +1,178 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+#include <bsl/reverse.hpp>
+#include <bsl/array.hpp>
+#include <bsl/convert.hpp>
+#include <bsl/cstdint.hpp>
+#include <bsl/iota.hpp>
+#include <bsl/safe_integral.hpp>
+#include <bsl/span.hpp>
+#include <bsl/ut.hpp>
+
+namespace
+{
+    /// <!-- description -->
+    ///   @brief Returns true if the elements of "vw" count down from
+    ///     vw.size() - 1 to 0.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @tparam VIEW the type of view to check
+    ///   @param vw the view to check
+    ///   @return Returns true if the elements of "vw" count down
+    ///
+    template<typename VIEW>
+    [[nodiscard]] constexpr bool
+    is_reversed(VIEW const &vw) noexcept
+    {
+        for (bsl::safe_uintmax i{}; i < vw.size(); ++i) {
+            bsl::safe_uintmax const expected{(vw.size() - i) - bsl::to_umax(1)};
+            if (bsl::to_umax(*vw.at_if(i)) != expected) {
+                return false;
+            }
+        }
+
+        return true;
+    }
+}
+
+/// <!-- description -->
+///   @brief Used to execute the actual checks. We put the checks in this
+///     function so that we can validate the tests both at compile-time
+///     and at run-time. If a bsl::ut_check fails, the tests will either
+///     fail fast at run-time, or will produce a compile-time error.
+///
+/// <!-- inputs/outputs -->
+///   @return Always returns bsl::exit_success.
+///
+constexpr bsl::exit_code
+tests() noexcept
+{
+    bsl::ut_scenario{"reverse empty and single element views"} = []() {
+        bsl::ut_given{} = []() {
+            bsl::span<bsl::uint8> spn{};
+            bsl::ut_then{} = [&spn]() {
+                bsl::reverse(spn);
+                bsl::ut_check(spn.empty());
+            };
+        };
+
+        bsl::ut_given{} = []() {
+            bsl::array<bsl::uint8, 1> arr{42U};
+            bsl::ut_then{} = [&arr]() {
+                bsl::reverse(arr);
+                bsl::ut_check(*arr.front_if() == 42U);
+            };
+        };
+    };
+
+    bsl::ut_scenario{"reverse bytes"} = []() {
+        bsl::ut_given{} = []() {
+            bsl::array<bsl::uint8, 2> arr{};
+            bsl::ut_when{} = [&arr]() {
+                bsl::iota(arr, bsl::uint8{});
+                bsl::reverse(arr);
+                bsl::ut_then{} = [&arr]() {
+                    bsl::ut_check(is_reversed(arr));
+                };
+            };
+        };
+
+        bsl::ut_given{} = []() {
+            bsl::array<bsl::uint8, 16> arr{};
+            bsl::ut_when{} = [&arr]() {
+                bsl::iota(arr, bsl::uint8{});
+                bsl::reverse(arr);
+                bsl::ut_then{} = [&arr]() {
+                    bsl::ut_check(is_reversed(arr));
+                };
+            };
+        };
+
+        bsl::ut_given{} = []() {
+            bsl::array<bsl::uint8, 37> arr{};
+            bsl::ut_when{} = [&arr]() {
+                bsl::iota(arr, bsl::uint8{});
+                bsl::reverse(arr);
+                bsl::ut_then{} = [&arr]() {
+                    bsl::ut_check(is_reversed(arr));
+                };
+            };
+        };
+
+        bsl::ut_given{} = []() {
+            bsl::array<bsl::uint8, 200> arr{};
+            bsl::ut_when{} = [&arr]() {
+                bsl::iota(arr, bsl::uint8{});
+                bsl::span<bsl::uint8> spn{arr.data(), bsl::to_umax(199)};
+                bsl::reverse(spn);
+                bsl::ut_then{} = [&spn, &arr]() {
+                    bsl::ut_check(is_reversed(spn));
+                    bsl::ut_check(*arr.back_if() == 199U);
+                };
+            };
+        };
+    };
+
+    bsl::ut_scenario{"reverse wider elements"} = []() {
+        bsl::ut_given{} = []() {
+            bsl::array<bsl::safe_uint64, 9> arr{};
+            bsl::ut_when{} = [&arr]() {
+                bsl::iota(arr, bsl::safe_uint64{});
+                bsl::reverse(arr);
+                bsl::ut_then{} = [&arr]() {
+                    bsl::ut_check(is_reversed(arr));
+                };
+            };
+        };
+
+        bsl::ut_given{} = []() {
+            bsl::array<bsl::uint32, 10> arr{};
+            bsl::ut_when{} = [&arr]() {
+                bsl::iota(arr, bsl::uint32{});
+                bsl::reverse(arr);
+                bsl::ut_then{} = [&arr]() {
+                    bsl::ut_check(is_reversed(arr));
+                };
+            };
+        };
+    };
+
+    return bsl::ut_success();
+}
+
+/// <!-- description -->
+///   @brief Main function for this unit test. If a call to ut_check() fails
+///     the application will fast fail. If all calls to ut_check() pass, this
+///     function will successfully return with bsl::exit_success.
+///
+/// <!-- inputs/outputs -->
+///   @return Always returns bsl::exit_success.
+///
+bsl::exit_code
+main() noexcept
+{
+    static_assert(tests() == bsl::ut_success());
+    return tests();
+}
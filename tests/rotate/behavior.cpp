@@ -0,0 +1,164 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+#include <bsl/rotate.hpp>
+#include <bsl/array.hpp>
+#include <bsl/convert.hpp>
+#include <bsl/cstdint.hpp>
+#include <bsl/iota.hpp>
+#include <bsl/safe_integral.hpp>
+#include <bsl/span.hpp>
+#include <bsl/ut.hpp>
+
+namespace
+{
+    /// <!-- description -->
+    ///   @brief Returns true if "vw" holds 0, 1, ..., vw.size() - 1
+    ///     rotated left by "mid" positions.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @tparam VIEW the type of view to check
+    ///   @param vw the view to check
+    ///   @param mid the number of positions the view was rotated by
+    ///   @return Returns true if "vw" was rotated left by "mid" positions
+    ///
+    template<typename VIEW>
+    [[nodiscard]] constexpr bool
+    is_rotated(VIEW const &vw, bsl::safe_uintmax const &mid) noexcept
+    {
+        for (bsl::safe_uintmax i{}; i < vw.size(); ++i) {
+            bsl::safe_uintmax const expected{(i + mid) % vw.size()};
+            if (bsl::to_umax(*vw.at_if(i)) != expected) {
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    /// <!-- description -->
+    ///   @brief Rotates a view of N elements of type T, holding 0 to
+    ///     N - 1, by every possible "mid" and returns true if every
+    ///     rotation is correct.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @tparam T the type of element to rotate
+    ///   @tparam N the number of elements to rotate
+    ///   @return Returns true if every rotation is correct
+    ///
+    template<typename T, bsl::uintmax N>
+    [[nodiscard]] constexpr bool
+    rotate_all() noexcept
+    {
+        for (bsl::safe_uintmax mid{}; mid <= bsl::to_umax(N); ++mid) {
+            bsl::array<T, N> arr{};
+            bsl::iota(arr, T{});
+
+            bsl::safe_uintmax const ret{bsl::rotate(arr, mid)};
+            if (ret != (bsl::to_umax(N) - mid)) {
+                return false;
+            }
+
+            if (!is_rotated(arr, mid % bsl::to_umax(N))) {
+                return false;
+            }
+        }
+
+        return true;
+    }
+}
+
+/// <!-- description -->
+///   @brief Used to execute the actual checks. We put the checks in this
+///     function so that we can validate the tests both at compile-time
+///     and at run-time. If a bsl::ut_check fails, the tests will either
+///     fail fast at run-time, or will produce a compile-time error.
+///
+/// <!-- inputs/outputs -->
+///   @return Always returns bsl::exit_success.
+///
+constexpr bsl::exit_code
+tests() noexcept
+{
+    bsl::ut_scenario{"rotate invalid args"} = []() {
+        bsl::ut_given{} = []() {
+            bsl::span<bsl::uint8> spn{};
+            bsl::ut_then{} = [&spn]() {
+                bsl::ut_check(bsl::rotate(spn, bsl::to_umax(0)).is_zero());
+            };
+        };
+
+        bsl::ut_given_at_runtime{} = []() {
+            bsl::array<bsl::uint8, 4> arr{};
+            bsl::ut_then{} = [&arr]() {
+                bsl::ut_check(!bsl::rotate(arr, bsl::to_umax(5)));
+                bsl::ut_check(!bsl::rotate(arr, bsl::safe_uintmax::zero(true)));
+            };
+        };
+    };
+
+    bsl::ut_scenario{"rotate by every mid"} = []() {
+        bsl::ut_then{} = []() {
+            bsl::ut_check(rotate_all<bsl::uint8, 1>());
+            bsl::ut_check(rotate_all<bsl::uint8, 7>());
+            bsl::ut_check(rotate_all<bsl::uint8, 100>());
+            bsl::ut_check(rotate_all<bsl::uint64, 12>());
+            bsl::ut_check(rotate_all<bsl::safe_uint32, 13>());
+        };
+    };
+
+    bsl::ut_scenario{"rotate a subspan"} = []() {
+        bsl::ut_given{} = []() {
+            bsl::array<bsl::uint32, 8> arr{};
+            bsl::ut_when{} = [&arr]() {
+                bsl::iota(arr, bsl::uint32{});
+                bsl::span<bsl::uint32> spn{arr.at_if(bsl::to_umax(2)), bsl::to_umax(4)};
+                bsl::ut_check(bsl::rotate(spn, bsl::to_umax(1)) == bsl::to_umax(3));
+                bsl::ut_then{} = [&arr]() {
+                    bsl::ut_check(*arr.at_if(bsl::to_umax(1)) == 1U);
+                    bsl::ut_check(*arr.at_if(bsl::to_umax(2)) == 3U);
+                    bsl::ut_check(*arr.at_if(bsl::to_umax(5)) == 2U);
+                    bsl::ut_check(*arr.at_if(bsl::to_umax(6)) == 6U);
+                };
+            };
+        };
+    };
+
+    return bsl::ut_success();
+}
+
+/// <!-- description -->
+///   @brief Main function for this unit test. If a call to ut_check() fails
+///     the application will fast fail. If all calls to ut_check() pass, this
+///     function will successfully return with bsl::exit_success.
+///
+/// <!-- inputs/outputs -->
+///   @return Always returns bsl::exit_success.
+///
+bsl::exit_code
+main() noexcept
+{
+    static_assert(tests() == bsl::ut_success());
+    return tests();
+}
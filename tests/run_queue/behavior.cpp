@@ -0,0 +1,171 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+#include <bsl/run_queue.hpp>
+#include <bsl/array.hpp>
+#include <bsl/convert.hpp>
+#include <bsl/frame_pool.hpp>
+#include <bsl/safe_integral.hpp>
+#include <bsl/task.hpp>
+#include <bsl/ut.hpp>
+
+namespace
+{
+    using queue_t = bsl::run_queue<2>;
+
+    template<typename QUEUE>
+    [[nodiscard]] bsl::task<bsl::safe_uintmax>
+    worker(
+        bsl::frame_pool &pool,
+        QUEUE &rq,
+        bsl::safe_uintmax &shared,
+        bsl::safe_uintmax const steps) noexcept
+    {
+        bsl::discard(pool);
+        for (bsl::safe_uintmax i{}; i < steps; ++i) {
+            shared = (shared * bsl::to_umax(10)) + steps;
+            co_await rq.schedule();
+        }
+
+        co_return steps;
+    }
+}
+
+/// <!-- description -->
+///   @brief Used to execute the actual checks. We put the checks in this
+///     function so that we can validate the tests both at compile-time
+///     and at run-time. If a bsl::ut_check fails, the tests will either
+///     fail fast at run-time, or will produce a compile-time error.
+///
+/// <!-- inputs/outputs -->
+///   @return Always returns bsl::exit_success.
+///
+constexpr bsl::exit_code
+tests() noexcept
+{
+    bsl::ut_scenario{"empty queue"} = []() {
+        bsl::ut_given_at_runtime{} = []() {
+            queue_t rq{};
+            bsl::ut_then{} = [&rq]() {
+                bsl::ut_check(rq.empty());
+                bsl::ut_check(rq.size().is_zero());
+                bsl::ut_check(!rq.run_one());
+                bsl::ut_check(rq.run().is_zero());
+            };
+        };
+    };
+
+    bsl::ut_scenario{"spawn"} = []() {
+        bsl::ut_given_at_runtime{} = []() {
+            queue_t rq{};
+            bsl::task<bool> tsk{};
+            bsl::ut_then{} = [&rq, &tsk]() {
+                bsl::ut_check(!rq.spawn(tsk));
+                bsl::ut_check(rq.empty());
+            };
+        };
+
+        bsl::ut_given_at_runtime{} = []() {
+            alignas(64) bsl::array<bsl::byte, 4096> buf{};
+            bsl::frame_pool pool{{buf.data(), buf.size()}, bsl::to_umax(1008)};
+            queue_t rq{};
+            bsl::safe_uintmax shared{};
+            bsl::ut_when{} = [&pool, &rq, &shared]() {
+                auto tsk1{worker(pool, rq, shared, bsl::to_umax(1))};
+                auto tsk2{worker(pool, rq, shared, bsl::to_umax(2))};
+                auto tsk3{worker(pool, rq, shared, bsl::to_umax(3))};
+                bsl::ut_then{} = [&rq, &tsk1, &tsk2, &tsk3]() {
+                    bsl::ut_check(rq.spawn(tsk1));
+                    bsl::ut_check(rq.spawn(tsk2));
+                    bsl::ut_check(!rq.spawn(tsk3));
+                    bsl::ut_check(rq.size() == bsl::to_umax(2));
+                };
+            };
+        };
+    };
+
+    bsl::ut_scenario{"run"} = []() {
+        bsl::ut_given_at_runtime{} = []() {
+            alignas(64) bsl::array<bsl::byte, 4096> buf{};
+            bsl::frame_pool pool{{buf.data(), buf.size()}, bsl::to_umax(1008)};
+            queue_t rq{};
+            bsl::safe_uintmax shared{};
+            bsl::ut_when{} = [&pool, &rq, &shared]() {
+                auto tsk1{worker(pool, rq, shared, bsl::to_umax(1))};
+                auto tsk2{worker(pool, rq, shared, bsl::to_umax(2))};
+                bsl::ut_then{} = [&rq, &shared, &tsk1, &tsk2]() {
+                    bsl::ut_check(rq.spawn(tsk1));
+                    bsl::ut_check(rq.spawn(tsk2));
+                    bsl::ut_check(rq.run() == bsl::to_umax(5));
+                    bsl::ut_check(rq.empty());
+                    bsl::ut_check(tsk1.done());
+                    bsl::ut_check(tsk2.done());
+                    bsl::ut_check(tsk1.get() == bsl::result<bsl::safe_uintmax>{bsl::to_umax(1)});
+                    bsl::ut_check(tsk2.get() == bsl::result<bsl::safe_uintmax>{bsl::to_umax(2)});
+                    bsl::ut_check(shared == bsl::to_umax(122));
+                };
+            };
+        };
+    };
+
+    bsl::ut_scenario{"schedule when full"} = []() {
+        bsl::ut_given_at_runtime{} = []() {
+            alignas(64) bsl::array<bsl::byte, 4096> buf{};
+            bsl::frame_pool pool{{buf.data(), buf.size()}, bsl::to_umax(1008)};
+            bsl::run_queue<1> rq{};
+            bsl::safe_uintmax shared{};
+            bsl::ut_when{} = [&pool, &rq, &shared]() {
+                auto tsk1{worker(pool, rq, shared, bsl::to_umax(2))};
+                auto tsk2{worker(pool, rq, shared, bsl::to_umax(1))};
+                bsl::ut_then{} = [&rq, &shared, &tsk1, &tsk2]() {
+                    bsl::ut_check(rq.spawn(tsk2));
+                    bsl::ut_check(!rq.post(tsk1.handle()));
+                    bsl::ut_check(tsk1.resume());
+                    bsl::ut_check(shared == bsl::to_umax(22));
+                    bsl::ut_check(rq.run() == bsl::to_umax(2));
+                    bsl::ut_check(tsk2.done());
+                    bsl::ut_check(shared == bsl::to_umax(221));
+                    bsl::ut_check(!rq.post(tsk2.handle()));
+                };
+            };
+        };
+    };
+
+    return bsl::ut_success();
+}
+
+/// <!-- description -->
+///   @brief Main function for this unit test. If a call to ut_check() fails
+///     the application will fast fail. If all calls to ut_check() pass, this
+///     function will successfully return with bsl::exit_success.
+///
+/// <!-- inputs/outputs -->
+///   @return Always returns bsl::exit_success.
+///
+bsl::exit_code
+main() noexcept
+{
+    static_assert(tests() == bsl::ut_success());
+    return tests();
+}
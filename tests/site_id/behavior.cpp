@@ -0,0 +1,103 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+#include <bsl/site_id.hpp>
+#include <bsl/ut.hpp>
+
+/// <!-- description -->
+///   @brief Used to execute the actual checks. We put the checks in this
+///     function so that we can validate the tests both at compile-time
+///     and at run-time. If a bsl::ut_check fails, the tests will either
+///     fail fast at run-time, or will produce a compile-time error.
+///
+/// <!-- inputs/outputs -->
+///   @return Always returns bsl::exit_success.
+///
+constexpr bsl::exit_code
+tests() noexcept
+{
+    using namespace bsl;
+
+    bsl::ut_scenario{"default constructor"} = []() {
+        bsl::ut_given{} = []() {
+            site_id const id{};
+            bsl::ut_then{} = [&id]() {
+                bsl::ut_check(id.get() == 0U);
+                bsl::ut_check(!id.valid());
+            };
+        };
+    };
+
+    bsl::ut_scenario{"value constructor"} = []() {
+        bsl::ut_given{} = []() {
+            site_id const id{42U};
+            bsl::ut_then{} = [&id]() {
+                bsl::ut_check(id.get() == 42U);
+                bsl::ut_check(id.valid());
+                bsl::ut_check(id == site_id{42U});
+                bsl::ut_check(id != site_id{43U});
+            };
+        };
+    };
+
+    bsl::ut_scenario{"current"} = []() {
+        bsl::ut_given{} = []() {
+            site_id const id1{site_id::current()};
+            site_id const id2{site_id::current()};
+            bsl::ut_then{} = [&id1, &id2]() {
+                bsl::ut_check(id1.valid());
+                bsl::ut_check(id2.valid());
+                bsl::ut_check(id1 != id2);
+            };
+        };
+    };
+
+    bsl::ut_scenario{"same file and line give the same id"} = []() {
+        bsl::ut_then{} = []() {
+            bsl::ut_check(site_id::current("file.cpp", 42) == site_id::current("file.cpp", 42));
+            bsl::ut_check(site_id::current("file.cpp", 42) != site_id::current("file.cpp", 43));
+            bsl::ut_check(site_id::current("file.cpp", 42) != site_id::current("file.hpp", 42));
+            bsl::ut_check(site_id::current(nullptr, 42).valid());
+            bsl::ut_check(
+                site_id::current() == site_id::current(__builtin_FILE(), __builtin_LINE()));
+        };
+    };
+
+    return bsl::ut_success();
+}
+
+/// <!-- description -->
+///   @brief Main function for this unit test. If a call to ut_check() fails
+///     the application will fast fail. If all calls to ut_check() pass, this
+///     function will successfully return with bsl::exit_success.
+///
+/// <!-- inputs/outputs -->
+///   @return Always returns bsl::exit_success.
+///
+bsl::exit_code
+main() noexcept
+{
+    static_assert(tests() == bsl::ut_success());
+    return tests();
+}
@@ -0,0 +1,172 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+#include <bsl/array.hpp>
+#include <bsl/convert.hpp>
+#include <bsl/cstdint.hpp>
+#include <bsl/site_id.hpp>
+#include <bsl/site_table.hpp>
+#include <bsl/ut.hpp>
+
+namespace
+{
+    /// @brief defines the type used to store the entries of a full table
+    using entries_type = bsl::array<bsl::site_entry, bsl::site_table_size + 1U>;
+
+    /// <!-- description -->
+    ///   @brief Returns site_table_size + 1 different sites, one for each
+    ///     line of "file.cpp". bsl::site_entry can only be created by the
+    ///     compiler, so this is done in a consteval function.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @return Returns site_table_size + 1 different sites
+    ///
+    [[nodiscard]] BSL_CONSTEVAL entries_type
+    make_entries() noexcept
+    {
+        entries_type entries{};
+        for (bsl::uintmax i{}; i < entries.size(); ++i) {
+            *entries.at_if(bsl::to_umax(i)) =
+                bsl::site_entry{"file.cpp", "func", static_cast<bsl::int32>(i)};
+        }
+
+        return entries;
+    }
+}
+
+/// <!-- description -->
+///   @brief Used to execute the actual checks. We put the checks in this
+///     function so that we can validate the tests both at compile-time
+///     and at run-time. If a bsl::ut_check fails, the tests will either
+///     fail fast at run-time, or will produce a compile-time error.
+///
+/// <!-- inputs/outputs -->
+///   @return Always returns bsl::exit_success.
+///
+constexpr bsl::exit_code
+tests() noexcept
+{
+    using namespace bsl;
+
+    bsl::ut_scenario{"site_entry"} = []() {
+        bsl::ut_given{} = []() {
+            site_entry const entry{};
+            bsl::ut_then{} = [&entry]() {
+                bsl::ut_check(entry.id().valid());
+                bsl::ut_check(site_entry{}.id() == site_id::current());
+                bsl::ut_check(nullptr != entry.file_name());
+                bsl::ut_check(nullptr != entry.function_name());
+                bsl::ut_check(entry.line() > 0);
+            };
+        };
+
+        bsl::ut_given{} = []() {
+            site_entry const entry{"file.cpp", "func", 42};
+            bsl::ut_then{} = [&entry]() {
+                bsl::ut_check(entry.id() == site_id::current("file.cpp", 42));
+                bsl::ut_check(entry.line() == 42);
+            };
+        };
+
+        bsl::ut_given{} = []() {
+            site_entry const entry{site_entry::current()};
+            bsl::ut_then{} = [&entry]() {
+                bsl::ut_check(site_entry::current().id() == site_id::current());
+                bsl::ut_check(entry.line() > 0);
+            };
+        };
+    };
+
+    bsl::ut_scenario{"add and find"} = []() {
+        bsl::ut_given_at_runtime{} = []() {
+            site_table table{};
+            site_entry const entry1{"file.cpp", "func1", 1};
+            site_entry const entry2{"file.cpp", "func2", 2};
+            bsl::ut_when{} = [&table, &entry1, &entry2]() {
+                bsl::ut_check(table.add(entry1));
+                bsl::ut_check(table.add(entry2));
+                bsl::ut_check(table.add(entry1));
+                bsl::ut_then{} = [&table, &entry1, &entry2]() {
+                    site_entry const *const found1{table.find(entry1.id())};
+                    site_entry const *const found2{table.find(entry2.id())};
+                    bsl::ut_check(nullptr != found1);
+                    bsl::ut_check(nullptr != found2);
+                    bsl::ut_check(found1->line() == 1);
+                    bsl::ut_check(found2->line() == 2);
+                    bsl::ut_check(nullptr == table.find(site_id::current("file.cpp", 3)));
+                    bsl::ut_check(nullptr == table.find(site_id{}));
+                    bsl::ut_check(nullptr == table.find(site_id{0xFFFFFFFFU}));
+                };
+            };
+        };
+    };
+
+    bsl::ut_scenario{"full table"} = []() {
+        bsl::ut_given_at_runtime{} = []() {
+            site_table table{};
+            constexpr entries_type entries{make_entries()};
+            bsl::ut_when{} = [&table, &entries]() {
+                for (bsl::uintmax i{}; i < site_table_size; ++i) {
+                    bsl::ut_check(table.add(*entries.at_if(bsl::to_umax(i))));
+                }
+
+                bsl::ut_then{} = [&table, &entries]() {
+                    constexpr auto max{static_cast<bsl::int32>(site_table_size)};
+                    bsl::ut_check(!table.add(*entries.at_if(bsl::to_umax(site_table_size))));
+                    bsl::ut_check(nullptr != table.find(site_id::current("file.cpp", 0)));
+                    bsl::ut_check(nullptr != table.find(site_id::current("file.cpp", max - 1)));
+                    bsl::ut_check(nullptr == table.find(site_id::current("file.cpp", max)));
+                };
+            };
+        };
+    };
+
+    bsl::ut_scenario{"global table"} = []() {
+        bsl::ut_given_at_runtime{} = []() {
+            site_entry const entry{site_entry::current()};
+            bsl::ut_then{} = [&entry]() {
+                bsl::ut_check(sites().add(entry));
+                bsl::ut_check(nullptr != sites().find(entry.id()));
+                bsl::ut_check(&sites() == &sites());
+            };
+        };
+    };
+
+    return bsl::ut_success();
+}
+
+/// <!-- description -->
+///   @brief Main function for this unit test. If a call to ut_check() fails
+///     the application will fast fail. If all calls to ut_check() pass, this
+///     function will successfully return with bsl::exit_success.
+///
+/// <!-- inputs/outputs -->
+///   @return Always returns bsl::exit_success.
+///
+bsl::exit_code
+main() noexcept
+{
+    static_assert(tests() == bsl::ut_success());
+    return tests();
+}
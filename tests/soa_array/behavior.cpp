@@ -0,0 +1,209 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+#include <bsl/soa_array.hpp>
+#include <bsl/convert.hpp>
+#include <bsl/discard.hpp>
+#include <bsl/for_each.hpp>
+#include <bsl/is_same.hpp>
+#include <bsl/safe_integral.hpp>
+#include <bsl/soa_reference.hpp>
+#include <bsl/span.hpp>
+#include <bsl/ut.hpp>
+
+namespace
+{
+    /// @brief the soa_array type used by the tests (exits, cycles, flags)
+    using soa_type = bsl::soa_array<8, bsl::safe_uint64, bsl::safe_uint64, bool>;
+
+    /// @brief the address of x as an integer, used to check alignment
+    template<typename T>
+    [[nodiscard]] bsl::uintmax
+    addr(T const *const x) noexcept
+    {
+        return reinterpret_cast<bsl::uintmax>(x);    // NOLINT
+    }
+}
+
+/// <!-- description -->
+///   @brief Used to execute the actual checks. We put the checks in this
+///     function so that we can validate the tests both at compile-time
+///     and at run-time. If a bsl::ut_check fails, the tests will either
+///     fail fast at run-time, or will produce a compile-time error.
+///
+/// <!-- inputs/outputs -->
+///   @return Always returns bsl::exit_success.
+///
+constexpr bsl::exit_code
+tests() noexcept
+{
+    bsl::ut_scenario{"properties"} = []() {
+        bsl::ut_then{} = []() {
+            bsl::ut_check(soa_type::size() == bsl::to_umax(8));
+            bsl::ut_check(soa_type::columns() == bsl::to_umax(3));
+            bsl::ut_check(bsl::is_same<soa_type::column_type<2>, bool>::value);
+        };
+    };
+
+    bsl::ut_scenario{"columns are separate and aligned"} = []() {
+        bsl::ut_given_at_runtime{} = []() {
+            soa_type soa{};
+            bsl::ut_then{} = [&soa]() {
+                constexpr bsl::uintmax cache_line{64U};
+                bsl::ut_check(addr(soa.column<0>().data()) % cache_line == 0U);
+                bsl::ut_check(addr(soa.column<1>().data()) % cache_line == 0U);
+                bsl::ut_check(addr(soa.column<2>().data()) % cache_line == 0U);
+                bsl::ut_check(soa.column<0>().data() != soa.column<1>().data());
+            };
+        };
+    };
+
+    bsl::ut_scenario{"at_if"} = []() {
+        bsl::ut_given{} = []() {
+            soa_type soa{};
+            bsl::ut_when{} = [&soa]() {
+                *soa.at_if<0>(bsl::to_umax(1)) = bsl::to_u64(42);
+                *soa.at_if<1>(bsl::to_umax(1)) = bsl::to_u64(23);
+                *soa.at_if<2>(bsl::to_umax(7)) = true;
+                bsl::ut_then{} = [&soa]() {
+                    bsl::ut_check(*soa.at_if<0>(bsl::to_umax(1)) == bsl::to_u64(42));
+                    bsl::ut_check(*soa.at_if<1>(bsl::to_umax(1)) == bsl::to_u64(23));
+                    bsl::ut_check(soa.at_if<0>(bsl::to_umax(0))->is_zero());
+                    bsl::ut_check(*soa.at_if<2>(bsl::to_umax(7)));
+                    bsl::ut_check(*soa.column<0>().at_if(bsl::to_umax(1)) == bsl::to_u64(42));
+                    bsl::ut_check(nullptr == soa.at_if<0>(bsl::to_umax(8)));
+                    bsl::ut_check(nullptr == soa.at_if<0>(bsl::safe_uintmax::zero(true)));
+                };
+            };
+        };
+    };
+
+    bsl::ut_scenario{"element"} = []() {
+        bsl::ut_given{} = []() {
+            soa_type soa{};
+            bsl::ut_when{} = [&soa]() {
+                auto const elem{soa.element(bsl::to_umax(3))};
+                *elem.get_if<0>() = bsl::to_u64(1);
+                *elem.get_if<1>() = bsl::to_u64(2);
+                *elem.get_if<2>() = true;
+                bsl::ut_then{} = [&soa, &elem]() {
+                    bsl::ut_check(!!elem);
+                    bsl::ut_check(elem.index() == bsl::to_umax(3));
+                    bsl::ut_check(*soa.at_if<0>(bsl::to_umax(3)) == bsl::to_u64(1));
+                    bsl::ut_check(*soa.at_if<1>(bsl::to_umax(3)) == bsl::to_u64(2));
+                    bsl::ut_check(*soa.at_if<2>(bsl::to_umax(3)));
+                };
+            };
+        };
+
+        bsl::ut_given{} = []() {
+            soa_type const soa{};
+            bsl::ut_then{} = [&soa]() {
+                auto const elem{soa.element(bsl::to_umax(8))};
+                bsl::ut_check(!elem);
+                bsl::ut_check(nullptr == elem.get_if<0>());
+                bsl::ut_check(!soa.element(bsl::safe_uintmax::zero(true)));
+            };
+        };
+    };
+
+    bsl::ut_scenario{"for_each over selected columns"} = []() {
+        bsl::ut_given{} = []() {
+            soa_type soa{};
+            bsl::ut_when{} = [&soa]() {
+                bsl::for_each<1>(
+                    soa, [](bsl::safe_uint64 &cycles, bsl::safe_uintmax const &i) noexcept {
+                        cycles = i;
+                    });
+                bsl::for_each<0, 1>(
+                    soa, [](bsl::safe_uint64 &exits, bsl::safe_uint64 &cycles) noexcept {
+                        exits = cycles + bsl::to_u64(1);
+                    });
+
+                bsl::ut_then{} = [&soa]() {
+                    bsl::safe_uint64 sum{};
+                    bsl::for_each<0>(soa, [&sum](bsl::safe_uint64 const &exits) noexcept {
+                        sum += exits;
+                    });
+                    bsl::ut_check(sum == bsl::to_u64(36));
+                    bsl::ut_check(*soa.at_if<1>(bsl::to_umax(7)) == bsl::to_u64(7));
+                    bsl::ut_check(*soa.at_if<0>(bsl::to_umax(7)) == bsl::to_u64(8));
+                };
+            };
+        };
+
+        bsl::ut_given{} = []() {
+            soa_type soa{};
+            bsl::ut_when{} = [&soa]() {
+                bsl::safe_uintmax count{};
+                bsl::for_each<2, 0>(soa, [&count](bool &flag, bsl::safe_uint64 &exits) noexcept {
+                    flag = true;
+                    bsl::discard(exits);
+                    ++count;
+                    return count < bsl::to_umax(3);
+                });
+
+                bsl::ut_then{} = [&soa, &count]() {
+                    bsl::ut_check(count == bsl::to_umax(3));
+                    bsl::ut_check(*soa.at_if<2>(bsl::to_umax(2)));
+                    bsl::ut_check(!*soa.at_if<2>(bsl::to_umax(3)));
+                };
+            };
+        };
+
+        bsl::ut_given{} = []() {
+            soa_type const soa{};
+            bsl::ut_when{} = [&soa]() {
+                bsl::safe_uintmax last{};
+                bsl::for_each<2>(
+                    soa, [&last](bool const &flag, bsl::safe_uintmax const &i) noexcept {
+                        bsl::discard(flag);
+                        last = i;
+                        return i < bsl::to_umax(4);
+                    });
+
+                bsl::ut_then{} = [&last]() {
+                    bsl::ut_check(last == bsl::to_umax(4));
+                };
+            };
+        };
+    };
+
+    return bsl::ut_success();
+}
+
+/// <!-- description -->
+///   @brief Main function for this unit test. If a call to ut_check() fails
+///     the application will fast fail. If all calls to ut_check() pass, this
+///     function will successfully return with bsl::exit_success.
+///
+/// <!-- inputs/outputs -->
+///   @return Always returns bsl::exit_success.
+///
+bsl::exit_code
+main() noexcept
+{
+    static_assert(tests() == bsl::ut_success());
+    return tests();
+}
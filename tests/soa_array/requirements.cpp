@@ -0,0 +1,82 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+#include <bsl/soa_array.hpp>
+#include <bsl/convert.hpp>
+#include <bsl/for_each.hpp>
+#include <bsl/safe_integral.hpp>
+#include <bsl/ut.hpp>
+
+namespace
+{
+    /// @brief the soa_array type used by the tests
+    using soa_type = bsl::soa_array<4, bsl::safe_uint64, bool>;
+}
+
+/// <!-- description -->
+///   @brief Main function for this unit test. If a call to ut_check() fails
+///     the application will fast fail. If all calls to ut_check() pass, this
+///     function will successfully return with bsl::exit_success.
+///
+/// <!-- inputs/outputs -->
+///   @return Always returns bsl::exit_success.
+///
+bsl::exit_code
+main() noexcept
+{
+    using namespace bsl;
+
+    bsl::ut_scenario{"verify noexcept"} = []() {
+        bsl::ut_given_at_runtime{} = []() {
+            soa_type soa{};
+            bsl::ut_then{} = [&soa]() {
+                static_assert(noexcept(soa_type{}));
+                static_assert(noexcept(soa.column<0>()));
+                static_assert(noexcept(soa.at_if<0>(to_umax(0))));
+                static_assert(noexcept(soa.element(to_umax(0))));
+                static_assert(noexcept(soa.element(to_umax(0)).get_if<1>()));
+                static_assert(noexcept(soa.element(to_umax(0)).index()));
+                static_assert(noexcept(!!soa.element(to_umax(0))));
+                static_assert(noexcept(soa_type::size()));
+                static_assert(noexcept(soa_type::columns()));
+                static_assert(noexcept(for_each<0>(soa, [](safe_uint64 &) noexcept {})));
+            };
+        };
+    };
+
+    bsl::ut_scenario{"verify constness"} = []() {
+        bsl::ut_given_at_runtime{} = []() {
+            soa_type const soa{};
+            bsl::ut_then{} = [&soa]() {
+                bsl::ut_check(!soa.column<0>().empty());
+                bsl::ut_check(nullptr != soa.at_if<1>(to_umax(0)));
+                bsl::ut_check(!!soa.element(to_umax(0)));
+                bsl::ut_check(soa_type::size() == to_umax(4));
+                bsl::ut_check(soa_type::columns() == to_umax(2));
+            };
+        };
+    };
+
+    return bsl::ut_success();
+}
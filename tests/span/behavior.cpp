@@ -1369,6 +1369,38 @@ tests() noexcept
         };
     };
 
+    bsl::ut_scenario{"as_span"} = []() {
+        bsl::ut_given_at_runtime{} = []() {
+            array<safe_int32, 6> arr = test_arr;
+            bsl::ut_then{} = [&arr]() {
+                bsl::ut_check(!as_span<safe_int32>(nullptr, arr.size_bytes()));
+                bsl::ut_check(!as_span<safe_int32>(arr.data(), to_umax(0)));
+                bsl::ut_check(!as_span<safe_int32>(arr.data(), to_umax(sizeof(safe_int32) - 1U)));
+            };
+        };
+
+        bsl::ut_given_at_runtime{} = []() {
+            array<safe_int32, 6> arr = test_arr;
+            bsl::ut_then{} = [&arr]() {
+                auto const bytes{as_bytes(arr.data(), arr.size_bytes())};
+                auto const spn{as_span<safe_int32>(bytes.data(), bytes.size())};
+                bsl::ut_check(spn.size() == arr.size());
+                bsl::ut_check(*spn.back_if() == *arr.back_if());
+                bsl::ut_check(
+                    as_span<safe_int32>(arr.data(), arr.size_bytes() - to_umax(1)).size() ==
+                    arr.size() - to_umax(1));
+            };
+        };
+
+        bsl::ut_given_at_runtime{} = []() {
+            array<bsl::uint32, 6> arr{};
+            bsl::ut_then{} = [&arr]() {
+                auto const bytes{as_bytes(arr.data(), arr.size_bytes())};
+                bsl::ut_check(!as_span<bsl::uint32>(bytes.at_if(to_umax(1)), to_umax(4)));
+            };
+        };
+    };
+
     bsl::ut_scenario{"as_writable_bytes"} = []() {
         bsl::ut_given_at_runtime{} = []() {
             array<safe_int32, 6> arr = test_arr;
@@ -1473,6 +1505,120 @@ tests() noexcept
         };
     };
 
+    bsl::ut_scenario{"static extent default constructor"} = []() {
+        bsl::ut_given{} = []() {
+            span<bool, 6> const spn{};
+            bsl::ut_then{} = [&spn]() {
+                bsl::ut_check(spn.empty());
+                bsl::ut_check(!spn);
+                bsl::ut_check(spn.size().is_zero());
+                bsl::ut_check(nullptr == spn.data());
+                bsl::ut_check(nullptr == spn.at_if(to_umax(0)));
+                bsl::ut_check(nullptr == spn.front_if());
+                bsl::ut_check(nullptr == spn.back_if());
+                bsl::ut_check(spn.begin() == spn.end());
+                bsl::ut_check(!span<bool>{spn});
+                bsl::ut_check(!spn.first<2>());
+            };
+        };
+    };
+
+    bsl::ut_scenario{"static extent access"} = []() {
+        bsl::ut_given{} = []() {
+            array<safe_int32, 6> arr = test_arr;
+            span<safe_int32, 6> spn{arr.data()};
+            bsl::ut_then{} = [&spn]() {
+                bsl::ut_check(!!spn);
+                bsl::ut_check(spn.size() == to_umax(6));
+                bsl::ut_check(spn.size_bytes() == to_umax(6 * sizeof(safe_int32)));
+                bsl::ut_check(*spn.at_if(to_umax(0)) == to_i32(4));
+                bsl::ut_check(*spn.at_if(to_umax(5)) == to_i32(42));
+                bsl::ut_check(nullptr == spn.at_if(to_umax(6)));
+                bsl::ut_check(nullptr == spn.at_if(npos));
+                bsl::ut_check(nullptr == spn.at_if(safe_uintmax::zero(true)));
+                bsl::ut_check(*spn.front_if() == to_i32(4));
+                bsl::ut_check(*spn.back_if() == to_i32(42));
+
+                *spn.front_if() = to_i32(5);
+                bsl::ut_check(*spn.front_if() == to_i32(5));
+
+                safe_int32 sum{};
+                for (auto iter{spn.begin()}; iter != spn.end(); ++iter) {
+                    sum += *iter.get_if();
+                }
+
+                bsl::ut_check(sum == to_i32(109));
+            };
+        };
+
+        bsl::ut_given{} = []() {
+            array<safe_int32, 6> const arr = test_arr;
+            span<safe_int32 const, 6> const spn{arr.data()};
+            bsl::ut_then{} = [&spn]() {
+                bsl::ut_check(*spn.at_if(to_umax(3)) == to_i32(16));
+                bsl::ut_check(*spn.front_if() == to_i32(4));
+                bsl::ut_check(*spn.back_if() == to_i32(42));
+                bsl::ut_check(*spn.cbegin().get_if() == to_i32(4));
+                bsl::ut_check(spn.cend().index() == to_umax(6));
+            };
+        };
+    };
+
+    bsl::ut_scenario{"static extent subspans"} = []() {
+        bsl::ut_given{} = []() {
+            array<safe_int32, 6> const arr = test_arr;
+            span<safe_int32 const, 6> const spn{arr.data()};
+            bsl::ut_then{} = [&spn]() {
+                auto const first{spn.first<2>()};
+                auto const last{spn.last<2>()};
+                auto const mid{spn.subspan<2, 3>()};
+                static_assert(decltype(first)::extent == 2U);
+                static_assert(decltype(mid)::extent == 3U);
+                bsl::ut_check(*first.back_if() == to_i32(8));
+                bsl::ut_check(*last.front_if() == to_i32(23));
+                bsl::ut_check(*mid.front_if() == to_i32(15));
+                bsl::ut_check(*mid.back_if() == to_i32(23));
+            };
+        };
+    };
+
+    bsl::ut_scenario{"static extent conversions"} = []() {
+        bsl::ut_given{} = []() {
+            array<safe_int32, 6> const arr = test_arr;
+            span<safe_int32 const, 6> const spn{arr.data()};
+            bsl::ut_then{} = [&spn, &arr]() {
+                span<safe_int32 const> const dyn{spn};
+                bsl::ut_check(dyn.size() == to_umax(6));
+                bsl::ut_check(dyn.data() == arr.data());
+                bsl::ut_check(dyn == span{arr.data(), arr.size()});
+
+                span<safe_int32 const, 6> const back{dyn};
+                bsl::ut_check(back.data() == arr.data());
+
+                span<safe_int32 const, 5> const wrong{dyn};
+                bsl::ut_check(!wrong);
+                bsl::ut_check(!span<safe_int32 const, 6>{span<safe_int32 const>{}});
+                bsl::ut_check(!span<safe_int32 const, 6>{nullptr});
+            };
+        };
+    };
+
+    bsl::ut_scenario{"static extent as_bytes"} = []() {
+        bsl::ut_given_at_runtime{} = []() {
+            array<bsl::uint32, 4> arr{};
+            span<bsl::uint32, 4> spn{arr.data()};
+            bsl::ut_then{} = [&spn]() {
+                auto const bytes{as_bytes(spn)};
+                auto wbytes{as_writable_bytes(spn)};
+                static_assert(decltype(bytes)::extent == 16U);
+                static_assert(decltype(wbytes)::extent == 16U);
+                bsl::ut_check(bytes.size() == to_umax(16));
+                *wbytes.front_if() = byte{static_cast<bsl::uint8>(1U)};
+                bsl::ut_check(bytes.front_if()->to_integer() == static_cast<bsl::uint8>(1U));
+            };
+        };
+    };
+
     bsl::ut_scenario{"output doesn't crash"} = []() {
         bsl::ut_given{} = []() {
             span<bool> spn{};
@@ -156,12 +156,48 @@ main() noexcept
                 static_assert(noexcept(spn1.subspan(bsl::to_umax(0))));
                 static_assert(noexcept(bsl::as_bytes(nullptr, bsl::to_umax(0))));
                 static_assert(noexcept(bsl::as_bytes(bsl::span<bool>{})));
+                static_assert(noexcept(bsl::as_span<bool>(nullptr, bsl::to_umax(0))));
                 static_assert(noexcept(bsl::as_writable_bytes(nullptr, bsl::to_umax(0))));
                 static_assert(noexcept(bsl::as_writable_bytes(bsl::span<bool>{})));
             };
         };
     };
 
+    bsl::ut_scenario{"verify static extent is pointer sized"} = []() {
+        static_assert(sizeof(bsl::span<bool, 5>) == sizeof(bool *));
+        static_assert(is_pod<bsl::span<bool, 5>>::value);
+        static_assert(bsl::span<bool, 5>::extent == 5U);
+    };
+
+    bsl::ut_scenario{"verify static extent noexcept"} = []() {
+        bsl::ut_given{} = []() {
+            bsl::span<bool, 5> spn{};
+            bsl::ut_then{} = []() {
+                static_assert(noexcept(bsl::span<bool, 5>{}));
+                static_assert(noexcept(bsl::span<bool, 5>{nullptr}));
+                static_assert(noexcept(bsl::span<bool, 5>{bsl::span<bool>{}}));
+                static_assert(noexcept(bsl::span<bool>{spn}));
+                static_assert(noexcept(spn.at_if(bsl::to_umax(0))));
+                static_assert(noexcept(spn.front_if()));
+                static_assert(noexcept(spn.back_if()));
+                static_assert(noexcept(spn.data()));
+                static_assert(noexcept(spn.begin()));
+                static_assert(noexcept(spn.cbegin()));
+                static_assert(noexcept(spn.end()));
+                static_assert(noexcept(spn.cend()));
+                static_assert(noexcept(spn.empty()));
+                static_assert(noexcept(!!spn));
+                static_assert(noexcept(spn.size()));
+                static_assert(noexcept(spn.size_bytes()));
+                static_assert(noexcept(spn.first<1>()));
+                static_assert(noexcept(spn.last<1>()));
+                static_assert(noexcept(spn.subspan<1, 1>()));
+                static_assert(noexcept(bsl::as_bytes(spn)));
+                static_assert(noexcept(bsl::as_writable_bytes(spn)));
+            };
+        };
+    };
+
     bsl::ut_scenario{"verify constness"} = []() {
         bsl::ut_given{} = []() {
             fixture_t fixture2{};
@@ -0,0 +1,193 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+#include <bsl/strided_span.hpp>
+#include <bsl/array.hpp>
+#include <bsl/convert.hpp>
+#include <bsl/for_each.hpp>
+#include <bsl/safe_integral.hpp>
+#include <bsl/span.hpp>
+#include <bsl/ut.hpp>
+
+namespace
+{
+    constexpr bsl::array<bsl::safe_int32, 7> test_arr{
+        bsl::to_i32(4),
+        bsl::to_i32(8),
+        bsl::to_i32(15),
+        bsl::to_i32(16),
+        bsl::to_i32(23),
+        bsl::to_i32(42),
+        bsl::to_i32(108)};
+}
+
+/// <!-- description -->
+///   @brief Used to execute the actual checks. We put the checks in this
+///     function so that we can validate the tests both at compile-time
+///     and at run-time. If a bsl::ut_check fails, the tests will either
+///     fail fast at run-time, or will produce a compile-time error.
+///
+/// <!-- inputs/outputs -->
+///   @return Always returns bsl::exit_success.
+///
+constexpr bsl::exit_code
+tests() noexcept
+{
+    bsl::ut_scenario{"default constructor"} = []() {
+        bsl::ut_given{} = []() {
+            bsl::strided_span<bsl::safe_int32 const> const spn{};
+            bsl::ut_then{} = [&spn]() {
+                bsl::ut_check(spn.empty());
+                bsl::ut_check(!spn);
+                bsl::ut_check(spn.data() == nullptr);
+                bsl::ut_check(spn.size().is_zero());
+                bsl::ut_check(spn.stride().is_zero());
+                bsl::ut_check(nullptr == spn.at_if(bsl::to_umax(0)));
+                bsl::ut_check(nullptr == spn.front_if());
+                bsl::ut_check(nullptr == spn.back_if());
+            };
+        };
+    };
+
+    bsl::ut_scenario{"ptr/count/stride constructor"} = []() {
+        bsl::ut_given_at_runtime{} = []() {
+            bsl::ut_then{} = []() {
+                bsl::strided_span<bsl::safe_int32 const> const spn1{
+                    nullptr, bsl::to_umax(3), bsl::to_umax(2)};
+                bsl::ut_check(spn1.empty());
+                bsl::strided_span<bsl::safe_int32 const> const spn2{
+                    test_arr.data(), bsl::to_umax(0), bsl::to_umax(2)};
+                bsl::ut_check(spn2.empty());
+                bsl::strided_span<bsl::safe_int32 const> const spn3{
+                    test_arr.data(), bsl::to_umax(3), bsl::to_umax(0)};
+                bsl::ut_check(spn3.empty());
+                bsl::strided_span<bsl::safe_int32 const> const spn4{
+                    test_arr.data(), bsl::safe_uintmax::zero(true), bsl::to_umax(2)};
+                bsl::ut_check(spn4.empty());
+                bsl::strided_span<bsl::safe_int32 const> const spn5{
+                    test_arr.data(), bsl::to_umax(3), bsl::to_umax(bsl::safe_uintmax::max())};
+                bsl::ut_check(spn5.empty());
+            };
+        };
+
+        bsl::ut_given{} = []() {
+            bsl::strided_span<bsl::safe_int32 const> const spn{
+                test_arr.data(), bsl::to_umax(3), bsl::to_umax(3)};
+            bsl::ut_then{} = [&spn]() {
+                bsl::ut_check(!spn.empty());
+                bsl::ut_check(!!spn);
+                bsl::ut_check(spn.data() == test_arr.data());
+                bsl::ut_check(spn.size() == bsl::to_umax(3));
+                bsl::ut_check(spn.stride() == bsl::to_umax(3));
+                bsl::ut_check(*spn.front_if() == bsl::to_i32(4));
+                bsl::ut_check(*spn.at_if(bsl::to_umax(1)) == bsl::to_i32(16));
+                bsl::ut_check(*spn.back_if() == bsl::to_i32(108));
+                bsl::ut_check(nullptr == spn.at_if(bsl::to_umax(3)));
+                bsl::ut_check(nullptr == spn.at_if(bsl::safe_uintmax::zero(true)));
+            };
+        };
+    };
+
+    bsl::ut_scenario{"span/stride constructor"} = []() {
+        bsl::ut_given_at_runtime{} = []() {
+            bsl::ut_then{} = []() {
+                bsl::strided_span<bsl::safe_int32 const> const spn1{{}, bsl::to_umax(2)};
+                bsl::ut_check(spn1.empty());
+                bsl::span<bsl::safe_int32 const> const s{test_arr.data(), test_arr.size()};
+                bsl::strided_span<bsl::safe_int32 const> const spn2{s, bsl::to_umax(0)};
+                bsl::ut_check(spn2.empty());
+            };
+        };
+
+        bsl::ut_given{} = []() {
+            bsl::span<bsl::safe_int32 const> const s{test_arr.data(), test_arr.size()};
+            bsl::ut_then{} = [&s]() {
+                bsl::strided_span<bsl::safe_int32 const> const spn1{s, bsl::to_umax(1)};
+                bsl::ut_check(spn1.size() == bsl::to_umax(7));
+                bsl::strided_span<bsl::safe_int32 const> const spn2{s, bsl::to_umax(2)};
+                bsl::ut_check(spn2.size() == bsl::to_umax(4));
+                bsl::ut_check(*spn2.back_if() == bsl::to_i32(108));
+                bsl::strided_span<bsl::safe_int32 const> const spn3{s, bsl::to_umax(3)};
+                bsl::ut_check(spn3.size() == bsl::to_umax(3));
+                bsl::strided_span<bsl::safe_int32 const> const spn4{s, bsl::to_umax(4)};
+                bsl::ut_check(spn4.size() == bsl::to_umax(2));
+                bsl::ut_check(*spn4.back_if() == bsl::to_i32(23));
+                bsl::strided_span<bsl::safe_int32 const> const spn5{s, bsl::to_umax(100)};
+                bsl::ut_check(spn5.size() == bsl::to_umax(1));
+                bsl::ut_check(*spn5.back_if() == bsl::to_i32(4));
+            };
+        };
+    };
+
+    bsl::ut_scenario{"write through a column"} = []() {
+        bsl::ut_given{} = []() {
+            bsl::array<bsl::safe_int32, 6> arr{};
+            bsl::ut_when{} = [&arr]() {
+                bsl::strided_span<bsl::safe_int32> spn{
+                    arr.at_if(bsl::to_umax(1)), bsl::to_umax(2), bsl::to_umax(3)};
+                *spn.front_if() = bsl::to_i32(1);
+                *spn.back_if() = bsl::to_i32(2);
+                bsl::ut_then{} = [&arr]() {
+                    bsl::ut_check(*arr.at_if(bsl::to_umax(1)) == bsl::to_i32(1));
+                    bsl::ut_check(*arr.at_if(bsl::to_umax(4)) == bsl::to_i32(2));
+                    bsl::ut_check(arr.at_if(bsl::to_umax(0))->is_zero());
+                };
+            };
+        };
+    };
+
+    bsl::ut_scenario{"for_each"} = []() {
+        bsl::ut_given{} = []() {
+            bsl::span<bsl::safe_int32 const> const s{test_arr.data(), test_arr.size()};
+            bsl::strided_span<bsl::safe_int32 const> const spn{s, bsl::to_umax(2)};
+            bsl::ut_when{} = [&spn]() {
+                bsl::safe_int32 sum{};
+                bsl::for_each(spn, [&sum](bsl::safe_int32 const &elem) noexcept {
+                    sum += elem;
+                });
+
+                bsl::ut_then{} = [&sum]() {
+                    bsl::ut_check(sum == bsl::to_i32(150));
+                };
+            };
+        };
+    };
+
+    return bsl::ut_success();
+}
+
+/// <!-- description -->
+///   @brief Main function for this unit test. If a call to ut_check() fails
+///     the application will fast fail. If all calls to ut_check() pass, this
+///     function will successfully return with bsl::exit_success.
+///
+/// <!-- inputs/outputs -->
+///   @return Always returns bsl::exit_success.
+///
+bsl::exit_code
+main() noexcept
+{
+    static_assert(tests() == bsl::ut_success());
+    return tests();
+}
@@ -0,0 +1,85 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+#include <bsl/strided_span.hpp>
+#include <bsl/array.hpp>
+#include <bsl/convert.hpp>
+#include <bsl/safe_integral.hpp>
+#include <bsl/span.hpp>
+#include <bsl/ut.hpp>
+
+/// <!-- description -->
+///   @brief Main function for this unit test. If a call to ut_check() fails
+///     the application will fast fail. If all calls to ut_check() pass, this
+///     function will successfully return with bsl::exit_success.
+///
+/// <!-- inputs/outputs -->
+///   @return Always returns bsl::exit_success.
+///
+bsl::exit_code
+main() noexcept
+{
+    using namespace bsl;
+
+    bsl::ut_scenario{"verify noexcept"} = []() {
+        bsl::ut_given_at_runtime{} = []() {
+            bsl::array<safe_int32, 6> arr{};
+            strided_span<safe_int32> spn{arr.data(), to_umax(2), to_umax(3)};
+            span<safe_int32> const all{arr.data(), arr.size()};
+            bsl::ut_then{} = [&spn, &arr, &all]() {
+                static_assert(noexcept(strided_span<safe_int32>{}));
+                static_assert(
+                    noexcept(strided_span<safe_int32>{arr.data(), to_umax(2), to_umax(3)}));
+                static_assert(noexcept(strided_span<safe_int32>{all, to_umax(3)}));
+                static_assert(noexcept(spn.at_if(to_umax(0))));
+                static_assert(noexcept(spn.front_if()));
+                static_assert(noexcept(spn.back_if()));
+                static_assert(noexcept(spn.data()));
+                static_assert(noexcept(spn.empty()));
+                static_assert(noexcept(!!spn));
+                static_assert(noexcept(spn.size()));
+                static_assert(noexcept(spn.stride()));
+            };
+        };
+    };
+
+    bsl::ut_scenario{"verify constness"} = []() {
+        bsl::ut_given_at_runtime{} = []() {
+            bsl::array<safe_int32, 6> arr{};
+            strided_span<safe_int32> const spn{arr.data(), to_umax(2), to_umax(3)};
+            bsl::ut_then{} = [&spn]() {
+                bsl::ut_check(nullptr != spn.at_if(to_umax(0)));
+                bsl::ut_check(nullptr != spn.front_if());
+                bsl::ut_check(nullptr != spn.back_if());
+                bsl::ut_check(nullptr != spn.data());
+                bsl::ut_check(!spn.empty());
+                bsl::ut_check(!!spn);
+                bsl::ut_check(spn.size() == to_umax(2));
+                bsl::ut_check(spn.stride() == to_umax(3));
+            };
+        };
+    };
+
+    return bsl::ut_success();
+}
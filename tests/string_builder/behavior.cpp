@@ -0,0 +1,161 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+#include <bsl/string_builder.hpp>
+#include <bsl/convert.hpp>
+#include <bsl/fixed_string.hpp>
+#include <bsl/fmt.hpp>
+#include <bsl/safe_integral.hpp>
+#include <bsl/string_view.hpp>
+#include <bsl/ut.hpp>
+
+/// <!-- description -->
+///   @brief Used to execute the actual checks. We put the checks in this
+///     function so that we can validate the tests both at compile-time
+///     and at run-time. If a bsl::ut_check fails, the tests will either
+///     fail fast at run-time, or will produce a compile-time error.
+///
+/// <!-- inputs/outputs -->
+///   @return Always returns bsl::exit_success.
+///
+constexpr bsl::exit_code
+tests() noexcept
+{
+    bsl::ut_scenario{"default constructor"} = []() {
+        bsl::ut_given{} = []() {
+            bsl::string_builder<16> const sb{};
+            bsl::ut_then{} = [&sb]() {
+                bsl::ut_check(!!sb);
+                bsl::ut_check(sb.size().is_zero());
+                bsl::ut_check(sb.str().empty());
+                bsl::ut_check(sb.view().empty());
+                bsl::ut_check('\0' == *sb.c_str());
+            };
+        };
+    };
+
+    bsl::ut_scenario{"strings and characters"} = []() {
+        bsl::ut_given{} = []() {
+            bsl::string_builder<32> sb{};
+            bsl::fixed_string<8> const dev{"dev"};
+            bsl::string_view const name{"tty"};
+            bsl::ut_when{} = [&sb, &dev, &name]() {
+                sb << '/' << dev << "/" << name << 'S';
+                bsl::ut_then{} = [&sb]() {
+                    bsl::ut_check(!!sb);
+                    bsl::ut_check(sb.str() == "/dev/ttyS");
+                    bsl::ut_check(sb.size() == bsl::to_umax(9));
+                };
+            };
+        };
+    };
+
+    bsl::ut_scenario{"integrals and bools"} = []() {
+        bsl::ut_given{} = []() {
+            bsl::string_builder<64> sb{};
+            bsl::ut_when{} = [&sb]() {
+                sb << bsl::to_umax(42) << ' ' << bsl::to_i32(-42) << ' ' << true << ' ' << false;
+                bsl::ut_then{} = [&sb]() {
+                    bsl::ut_check(sb.str() == "42 -42 true false");
+                };
+            };
+        };
+
+        bsl::ut_given{} = []() {
+            bsl::string_builder<64> sb{};
+            bsl::ut_when{} = [&sb]() {
+                sb << bsl::safe_uintmax::zero(true);
+                bsl::ut_then{} = [&sb]() {
+                    bsl::ut_check(sb.str() == "[error]");
+                };
+            };
+        };
+    };
+
+    bsl::ut_scenario{"fmt"} = []() {
+        bsl::ut_given{} = []() {
+            bsl::string_builder<64> sb{};
+            bsl::ut_when{} = [&sb]() {
+                sb << bsl::fmt{"#010x", bsl::to_u32(42)} << ' ' << bsl::fmt{"<5s", "ab"} << '|';
+                bsl::ut_then{} = [&sb]() {
+                    bsl::ut_check(sb.str() == "0x0000002A ab   |");
+                };
+            };
+        };
+
+        bsl::ut_given{} = []() {
+            bsl::string_builder<64> sb{};
+            bsl::fixed_string<8> const str{"eth0"};
+            bsl::ut_when{} = [&sb, &str]() {
+                sb << bsl::fmt{">6", str};
+                bsl::ut_then{} = [&sb]() {
+                    bsl::ut_check(sb.str() == "  eth0");
+                };
+            };
+        };
+    };
+
+    bsl::ut_scenario{"truncation"} = []() {
+        bsl::ut_given{} = []() {
+            bsl::string_builder<8> sb{};
+            bsl::ut_when{} = [&sb]() {
+                sb << "Hello" << ' ' << "World";
+                bsl::ut_then{} = [&sb]() {
+                    bsl::ut_check(!sb);
+                    bsl::ut_check(sb.str() == "Hello Wo");
+                };
+            };
+        };
+
+        bsl::ut_given{} = []() {
+            bsl::string_builder<8> sb{};
+            bsl::ut_when{} = [&sb]() {
+                sb << "Hello World";
+                sb.clear();
+                sb << bsl::to_umax(1);
+                bsl::ut_then{} = [&sb]() {
+                    bsl::ut_check(!!sb);
+                    bsl::ut_check(sb.str() == "1");
+                };
+            };
+        };
+    };
+
+    return bsl::ut_success();
+}
+
+/// <!-- description -->
+///   @brief Main function for this unit test. If a call to ut_check() fails
+///     the application will fast fail. If all calls to ut_check() pass, this
+///     function will successfully return with bsl::exit_success.
+///
+/// <!-- inputs/outputs -->
+///   @return Always returns bsl::exit_success.
+///
+bsl::exit_code
+main() noexcept
+{
+    static_assert(tests() == bsl::ut_success());
+    return tests();
+}
@@ -0,0 +1,150 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+#include <bsl/swap_ranges.hpp>
+#include <bsl/array.hpp>
+#include <bsl/convert.hpp>
+#include <bsl/cstdint.hpp>
+#include <bsl/iota.hpp>
+#include <bsl/safe_integral.hpp>
+#include <bsl/span.hpp>
+#include <bsl/ut.hpp>
+
+namespace
+{
+    /// <!-- description -->
+    ///   @brief Returns true if the elements of "vw" count up from "first"
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @tparam VIEW the type of view to check
+    ///   @param vw the view to check
+    ///   @param first the expected value of the first element
+    ///   @return Returns true if the elements of "vw" count up from "first"
+    ///
+    template<typename VIEW>
+    [[nodiscard]] constexpr bool
+    counts_from(VIEW const &vw, bsl::safe_uintmax const &first) noexcept
+    {
+        for (bsl::safe_uintmax i{}; i < vw.size(); ++i) {
+            if (bsl::to_umax(*vw.at_if(i)) != (first + i)) {
+                return false;
+            }
+        }
+
+        return true;
+    }
+}
+
+/// <!-- description -->
+///   @brief Used to execute the actual checks. We put the checks in this
+///     function so that we can validate the tests both at compile-time
+///     and at run-time. If a bsl::ut_check fails, the tests will either
+///     fail fast at run-time, or will produce a compile-time error.
+///
+/// <!-- inputs/outputs -->
+///   @return Always returns bsl::exit_success.
+///
+constexpr bsl::exit_code
+tests() noexcept
+{
+    bsl::ut_scenario{"swap_ranges empty views"} = []() {
+        bsl::ut_given{} = []() {
+            bsl::span<bsl::uint8> spn{};
+            bsl::array<bsl::uint8, 4> arr{};
+            bsl::ut_then{} = [&spn, &arr]() {
+                bsl::ut_check(bsl::swap_ranges(spn, arr).is_zero());
+                bsl::ut_check(bsl::swap_ranges(arr, spn).is_zero());
+            };
+        };
+    };
+
+    bsl::ut_scenario{"swap_ranges"} = []() {
+        bsl::ut_given{} = []() {
+            bsl::array<bsl::uint8, 150> arr1{};
+            bsl::array<bsl::uint8, 150> arr2{};
+            bsl::ut_when{} = [&arr1, &arr2]() {
+                bsl::iota(arr1, bsl::uint8{});
+                bsl::iota(arr2, static_cast<bsl::uint8>(100U));
+                bsl::ut_check(bsl::swap_ranges(arr1, arr2) == bsl::to_umax(150));
+                bsl::ut_then{} = [&arr1, &arr2]() {
+                    bsl::ut_check(counts_from(arr1, bsl::to_umax(100)));
+                    bsl::ut_check(counts_from(arr2, bsl::to_umax(0)));
+                };
+            };
+        };
+
+        bsl::ut_given{} = []() {
+            bsl::array<bsl::safe_uint64, 20> arr1{};
+            bsl::array<bsl::safe_uint64, 5> arr2{};
+            bsl::ut_when{} = [&arr1, &arr2]() {
+                bsl::iota(arr1, bsl::safe_uint64{});
+                bsl::iota(arr2, bsl::to_u64(100));
+                bsl::ut_check(bsl::swap_ranges(arr1, arr2) == bsl::to_umax(5));
+                bsl::ut_then{} = [&arr1, &arr2]() {
+                    bsl::ut_check(*arr1.front_if() == bsl::to_u64(100));
+                    bsl::ut_check(*arr1.at_if(bsl::to_umax(4)) == bsl::to_u64(104));
+                    bsl::ut_check(*arr1.at_if(bsl::to_umax(5)) == bsl::to_u64(5));
+                    bsl::ut_check(counts_from(arr2, bsl::to_umax(0)));
+                };
+            };
+        };
+    };
+
+    bsl::ut_scenario{"swap_ranges overlapping views"} = []() {
+        bsl::ut_given{} = []() {
+            bsl::array<bsl::uint32, 6> arr{};
+            bsl::ut_when{} = [&arr]() {
+                bsl::iota(arr, bsl::uint32{});
+                bsl::span<bsl::uint32> spn1{arr.data(), bsl::to_umax(4)};
+                bsl::span<bsl::uint32> spn2{arr.at_if(bsl::to_umax(1)), bsl::to_umax(4)};
+                bsl::ut_check(bsl::swap_ranges(spn1, spn2) == bsl::to_umax(4));
+                bsl::ut_then{} = [&arr]() {
+                    bsl::ut_check(*arr.at_if(bsl::to_umax(0)) == 1U);
+                    bsl::ut_check(*arr.at_if(bsl::to_umax(1)) == 2U);
+                    bsl::ut_check(*arr.at_if(bsl::to_umax(2)) == 3U);
+                    bsl::ut_check(*arr.at_if(bsl::to_umax(3)) == 4U);
+                    bsl::ut_check(*arr.at_if(bsl::to_umax(4)) == 0U);
+                    bsl::ut_check(*arr.at_if(bsl::to_umax(5)) == 5U);
+                };
+            };
+        };
+    };
+
+    return bsl::ut_success();
+}
+
+/// <!-- description -->
+///   @brief Main function for this unit test. If a call to ut_check() fails
+///     the application will fast fail. If all calls to ut_check() pass, this
+///     function will successfully return with bsl::exit_success.
+///
+/// <!-- inputs/outputs -->
+///   @return Always returns bsl::exit_success.
+///
+bsl::exit_code
+main() noexcept
+{
+    static_assert(tests() == bsl::ut_success());
+    return tests();
+}
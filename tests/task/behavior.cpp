@@ -0,0 +1,274 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+#include <bsl/task.hpp>
+#include <bsl/array.hpp>
+#include <bsl/convert.hpp>
+#include <bsl/frame_pool.hpp>
+#include <bsl/safe_integral.hpp>
+#include <bsl/ut.hpp>
+
+namespace
+{
+    [[nodiscard]] bsl::task<bsl::safe_uintmax>
+    add(bsl::frame_pool &pool, bsl::safe_uintmax const lhs, bsl::safe_uintmax const rhs) noexcept
+    {
+        bsl::discard(pool);
+        co_return lhs + rhs;
+    }
+
+    [[nodiscard]] bsl::task<bsl::safe_uintmax>
+    fail(bsl::frame_pool &pool) noexcept
+    {
+        bsl::discard(pool);
+        co_return bsl::errc_invalid_argument;
+    }
+
+    [[nodiscard]] bsl::task<bsl::safe_uintmax>
+    chain(bsl::frame_pool &pool) noexcept
+    {
+        auto const res1{co_await add(pool, bsl::to_umax(1), bsl::to_umax(2))};
+        if (!res1) {
+            co_return res1.errc();
+        }
+
+        auto const res2{co_await add(pool, *res1.get_if(), bsl::to_umax(3))};
+        if (!res2) {
+            co_return res2.errc();
+        }
+
+        co_return *res2.get_if();
+    }
+
+    [[nodiscard]] bsl::task<bsl::safe_uintmax>
+    chain_fail(bsl::frame_pool &pool) noexcept
+    {
+        auto const res{co_await fail(pool)};
+        if (!res) {
+            co_return res.errc();
+        }
+
+        co_return *res.get_if();
+    }
+
+    [[nodiscard]] bsl::task<bsl::safe_uintmax>
+    deep(bsl::frame_pool &pool, bsl::safe_uintmax const n) noexcept
+    {
+        if (n.is_zero()) {
+            co_return n;
+        }
+
+        auto const res{co_await deep(pool, n - bsl::to_umax(1))};
+        if (!res) {
+            co_return res.errc();
+        }
+
+        co_return *res.get_if() + bsl::to_umax(1);
+    }
+
+    class device final
+    {
+        bsl::safe_uintmax m_val;
+
+    public:
+        [[nodiscard]] bsl::task<bsl::safe_uintmax>
+        step(bsl::frame_pool &pool) noexcept
+        {
+            bsl::discard(pool);
+            ++m_val;
+            co_return m_val;
+        }
+    };
+}
+
+/// <!-- description -->
+///   @brief Used to execute the actual checks. We put the checks in this
+///     function so that we can validate the tests both at compile-time
+///     and at run-time. If a bsl::ut_check fails, the tests will either
+///     fail fast at run-time, or will produce a compile-time error.
+///
+/// <!-- inputs/outputs -->
+///   @return Always returns bsl::exit_success.
+///
+constexpr bsl::exit_code
+tests() noexcept
+{
+    bsl::ut_scenario{"default constructor"} = []() {
+        bsl::ut_given_at_runtime{} = []() {
+            bsl::task<bsl::safe_uintmax> tsk{};
+            bsl::ut_then{} = [&tsk]() {
+                bsl::ut_check(!tsk);
+                bsl::ut_check(tsk.done());
+                bsl::ut_check(tsk.resume());
+                bsl::ut_check(tsk.get().errc() == bsl::errc_failure);
+                bsl::ut_check(!tsk.handle());
+            };
+        };
+    };
+
+    bsl::ut_scenario{"resume"} = []() {
+        bsl::ut_given_at_runtime{} = []() {
+            alignas(64) bsl::array<bsl::byte, 4096> buf{};
+            bsl::frame_pool pool{{buf.data(), buf.size()}, bsl::to_umax(1008)};
+            bsl::ut_when{} = [&pool]() {
+                auto tsk{add(pool, bsl::to_umax(23), bsl::to_umax(42))};
+                bsl::ut_then{} = [&pool, &tsk]() {
+                    bsl::ut_check(!!tsk);
+                    bsl::ut_check(!tsk.done());
+                    bsl::ut_check(tsk.get().errc() == bsl::errc_failure);
+                    bsl::ut_check(pool.available() == bsl::to_umax(3));
+                    bsl::ut_check(tsk.resume());
+                    bsl::ut_check(tsk.done());
+                    bsl::ut_check(tsk.get() == bsl::result<bsl::safe_uintmax>{bsl::to_umax(65)});
+                };
+            };
+            bsl::ut_then{} = [&pool]() {
+                bsl::ut_check(pool.available() == bsl::to_umax(4));
+            };
+        };
+
+        bsl::ut_given_at_runtime{} = []() {
+            alignas(64) bsl::array<bsl::byte, 4096> buf{};
+            bsl::frame_pool pool{{buf.data(), buf.size()}, bsl::to_umax(1008)};
+            bsl::ut_when{} = [&pool]() {
+                auto tsk{fail(pool)};
+                bsl::ut_then{} = [&tsk]() {
+                    bsl::ut_check(tsk.resume());
+                    bsl::ut_check(tsk.get().errc() == bsl::errc_invalid_argument);
+                };
+            };
+        };
+
+        bsl::ut_given_at_runtime{} = []() {
+            alignas(64) bsl::array<bsl::byte, 4096> buf{};
+            bsl::frame_pool pool{{buf.data(), buf.size()}, bsl::to_umax(1008)};
+            device dev{};
+            bsl::ut_when{} = [&pool, &dev]() {
+                auto tsk1{dev.step(pool)};
+                auto tsk2{dev.step(pool)};
+                bsl::ut_then{} = [&tsk1, &tsk2]() {
+                    bsl::ut_check(tsk1.resume());
+                    bsl::ut_check(tsk2.resume());
+                    bsl::ut_check(tsk1.get() == bsl::result<bsl::safe_uintmax>{bsl::to_umax(1)});
+                    bsl::ut_check(tsk2.get() == bsl::result<bsl::safe_uintmax>{bsl::to_umax(2)});
+                };
+            };
+        };
+    };
+
+    bsl::ut_scenario{"co_await"} = []() {
+        bsl::ut_given_at_runtime{} = []() {
+            alignas(64) bsl::array<bsl::byte, 4096> buf{};
+            bsl::frame_pool pool{{buf.data(), buf.size()}, bsl::to_umax(1008)};
+            bsl::ut_when{} = [&pool]() {
+                auto tsk{chain(pool)};
+                bsl::ut_then{} = [&tsk]() {
+                    bsl::ut_check(tsk.resume());
+                    bsl::ut_check(tsk.get() == bsl::result<bsl::safe_uintmax>{bsl::to_umax(6)});
+                };
+            };
+            bsl::ut_then{} = [&pool]() {
+                bsl::ut_check(pool.available() == bsl::to_umax(4));
+            };
+        };
+
+        bsl::ut_given_at_runtime{} = []() {
+            alignas(64) bsl::array<bsl::byte, 4096> buf{};
+            bsl::frame_pool pool{{buf.data(), buf.size()}, bsl::to_umax(1008)};
+            bsl::ut_when{} = [&pool]() {
+                auto tsk{chain_fail(pool)};
+                bsl::ut_then{} = [&tsk]() {
+                    bsl::ut_check(tsk.resume());
+                    bsl::ut_check(tsk.get().errc() == bsl::errc_invalid_argument);
+                };
+            };
+        };
+    };
+
+    bsl::ut_scenario{"out of frames"} = []() {
+        bsl::ut_given_at_runtime{} = []() {
+            alignas(64) bsl::array<bsl::byte, 4096> buf{};
+            bsl::frame_pool pool{{buf.data(), buf.size()}, bsl::to_umax(1008)};
+            bsl::ut_when{} = [&pool]() {
+                auto tsk{deep(pool, bsl::to_umax(10))};
+                bsl::ut_then{} = [&tsk]() {
+                    bsl::ut_check(tsk.resume());
+                    bsl::ut_check(tsk.get().errc() == bsl::errc_failure);
+                };
+            };
+            bsl::ut_then{} = [&pool]() {
+                bsl::ut_check(pool.available() == bsl::to_umax(4));
+            };
+        };
+
+        bsl::ut_given_at_runtime{} = []() {
+            alignas(64) bsl::array<bsl::byte, 4096> buf{};
+            bsl::frame_pool pool{{buf.data(), buf.size()}, bsl::to_umax(1008)};
+            bsl::ut_when{} = [&pool]() {
+                auto tsk{deep(pool, bsl::to_umax(3))};
+                bsl::ut_then{} = [&tsk]() {
+                    bsl::ut_check(tsk.resume());
+                    bsl::ut_check(tsk.get() == bsl::result<bsl::safe_uintmax>{bsl::to_umax(3)});
+                };
+            };
+        };
+    };
+
+    bsl::ut_scenario{"move"} = []() {
+        bsl::ut_given_at_runtime{} = []() {
+            alignas(64) bsl::array<bsl::byte, 4096> buf{};
+            bsl::frame_pool pool{{buf.data(), buf.size()}, bsl::to_umax(1008)};
+            bsl::ut_when{} = [&pool]() {
+                auto tsk1{add(pool, bsl::to_umax(1), bsl::to_umax(1))};
+                auto tsk2{bsl::move(tsk1)};
+                bsl::ut_then{} = [&pool, &tsk1, &tsk2]() {
+                    bsl::ut_check(!tsk1);
+                    bsl::ut_check(!!tsk2);
+                    tsk1 = add(pool, bsl::to_umax(2), bsl::to_umax(2));
+                    tsk2 = bsl::move(tsk1);
+                    bsl::ut_check(pool.available() == bsl::to_umax(3));
+                    bsl::ut_check(tsk2.resume());
+                    bsl::ut_check(tsk2.get() == bsl::result<bsl::safe_uintmax>{bsl::to_umax(4)});
+                };
+            };
+        };
+    };
+
+    return bsl::ut_success();
+}
+
+/// <!-- description -->
+///   @brief Main function for this unit test. If a call to ut_check() fails
+///     the application will fast fail. If all calls to ut_check() pass, this
+///     function will successfully return with bsl::exit_success.
+///
+/// <!-- inputs/outputs -->
+///   @return Always returns bsl::exit_success.
+///
+bsl::exit_code
+main() noexcept
+{
+    static_assert(tests() == bsl::ut_success());
+    return tests();
+}
@@ -0,0 +1,77 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+#include <bsl/task.hpp>
+#include <bsl/frame_pool.hpp>
+#include <bsl/is_move_constructible.hpp>
+#include <bsl/is_copy_constructible.hpp>
+#include <bsl/ut.hpp>
+
+namespace
+{
+    [[nodiscard]] bsl::task<bool>
+    noop(bsl::frame_pool &pool) noexcept
+    {
+        bsl::discard(pool);
+        co_return true;
+    }
+}
+
+/// <!-- description -->
+///   @brief Main function for this unit test. If a call to ut_check() fails
+///     the application will fast fail. If all calls to ut_check() pass, this
+///     function will successfully return with bsl::exit_success.
+///
+/// <!-- inputs/outputs -->
+///   @return Always returns bsl::exit_success.
+///
+bsl::exit_code
+main() noexcept
+{
+    using namespace bsl;
+
+    bsl::ut_scenario{"verify move only"} = []() {
+        static_assert(is_move_constructible<task<bool>>::value);
+        static_assert(!is_copy_constructible<task<bool>>::value);
+    };
+
+    bsl::ut_scenario{"verify noexcept"} = []() {
+        bsl::ut_given{} = []() {
+            frame_pool pool{};
+            task<bool> tsk{};
+            bsl::ut_then{} = []() {
+                static_assert(noexcept(task<bool>{}));
+                static_assert(noexcept(noop(pool)));
+                static_assert(noexcept(tsk.operator co_await()));
+                static_assert(noexcept(tsk.resume()));
+                static_assert(noexcept(tsk.done()));
+                static_assert(noexcept(tsk.get()));
+                static_assert(noexcept(tsk.handle()));
+                static_assert(noexcept(!!tsk));
+            };
+        };
+    };
+
+    return bsl::ut_success();
+}
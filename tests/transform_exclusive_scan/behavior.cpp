@@ -0,0 +1,160 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+#include <bsl/transform_exclusive_scan.hpp>
+#include <bsl/array.hpp>
+#include <bsl/convert.hpp>
+#include <bsl/cstdint.hpp>
+#include <bsl/errc_type.hpp>
+#include <bsl/safe_integral.hpp>
+#include <bsl/span.hpp>
+#include <bsl/ut.hpp>
+
+namespace
+{
+    /// <!-- description -->
+    ///   @brief Rounds a record size up to a multiple of 8
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param size the size to round up
+    ///   @return Returns size rounded up to a multiple of 8
+    ///
+    [[nodiscard]] constexpr auto
+    align8(bsl::safe_uint64 const &size) noexcept -> bsl::safe_uint64
+    {
+        constexpr bsl::safe_uint64 mask{bsl::to_u64(7)};
+        return (size + mask) & ~mask;
+    }
+}
+
+/// <!-- description -->
+///   @brief Used to execute the actual checks. We put the checks in this
+///     function so that we can validate the tests both at compile-time
+///     and at run-time. If a bsl::ut_check fails, the tests will either
+///     fail fast at run-time, or will produce a compile-time error.
+///
+/// <!-- inputs/outputs -->
+///   @return Always returns bsl::exit_success.
+///
+constexpr bsl::exit_code
+tests() noexcept
+{
+    bsl::ut_scenario{"transform_exclusive_scan empty"} = []() {
+        bsl::ut_given{} = []() {
+            bsl::span<bsl::safe_uint64 const> src{};
+            bsl::span<bsl::safe_uint64> dst{};
+            bsl::ut_then{} = [&src, &dst]() {
+                auto const ret{bsl::transform_exclusive_scan(src, dst, bsl::to_u64(0), &align8)};
+                bsl::ut_check(ret.success());
+                bsl::ut_check(ret.get_if()->is_zero());
+            };
+        };
+    };
+
+    bsl::ut_scenario{"transform_exclusive_scan dst too small"} = []() {
+        bsl::ut_given_at_runtime{} = []() {
+            bsl::array<bsl::safe_uint64, 2> src{};
+            bsl::array<bsl::safe_uint64, 1> dst{};
+            bsl::ut_then{} = [&src, &dst]() {
+                auto const ret{bsl::transform_exclusive_scan(
+                    bsl::span<bsl::safe_uint64 const>{src.data(), src.size()},
+                    bsl::span<bsl::safe_uint64>{dst.data(), dst.size()},
+                    bsl::to_u64(0),
+                    &align8)};
+                bsl::ut_check(ret.errc() == bsl::errc_failure);
+            };
+        };
+    };
+
+    bsl::ut_scenario{"transform_exclusive_scan"} = []() {
+        bsl::ut_given{} = []() {
+            bsl::array<bsl::safe_uint64, 4> src{
+                bsl::to_u64(3), bsl::to_u64(8), bsl::to_u64(0), bsl::to_u64(9)};
+            bsl::array<bsl::safe_uint64, 4> dst{};
+            bsl::ut_then{} = [&src, &dst]() {
+                auto const ret{bsl::transform_exclusive_scan(
+                    bsl::span<bsl::safe_uint64 const>{src.data(), src.size()},
+                    bsl::span<bsl::safe_uint64>{dst.data(), dst.size()},
+                    bsl::to_u64(16),
+                    &align8)};
+                bsl::ut_check(*ret.get_if() == src.size());
+                bsl::ut_check(*dst.at_if(bsl::to_umax(0)) == bsl::to_u64(16));
+                bsl::ut_check(*dst.at_if(bsl::to_umax(1)) == bsl::to_u64(24));
+                bsl::ut_check(*dst.at_if(bsl::to_umax(2)) == bsl::to_u64(32));
+                bsl::ut_check(*dst.at_if(bsl::to_umax(3)) == bsl::to_u64(32));
+            };
+        };
+
+        bsl::ut_given{} = []() {
+            bsl::array<bsl::uint32, 40> src{};
+            bsl::array<bsl::uint32, 40> dst{};
+            bsl::ut_then{} = [&src, &dst]() {
+                auto const ret{bsl::transform_exclusive_scan(
+                    bsl::span<bsl::uint32 const>{src.data(), src.size()},
+                    bsl::span<bsl::uint32>{dst.data(), dst.size()},
+                    0U,
+                    [](bsl::uint32 const &val) noexcept -> bsl::uint32 {
+                        return val + 2U;
+                    })};
+                bsl::ut_check(ret.success());
+                for (bsl::safe_uintmax i{}; i < dst.size(); ++i) {
+                    bsl::ut_check(bsl::to_umax(*dst.at_if(i)) == i * bsl::to_umax(2));
+                }
+            };
+        };
+    };
+
+    bsl::ut_scenario{"transform_exclusive_scan overflow"} = []() {
+        bsl::ut_given_at_runtime{} = []() {
+            bsl::array<bsl::safe_uint64, 3> src{
+                bsl::to_u64(1), bsl::to_u64(bsl::safe_uint64::max()), bsl::to_u64(1)};
+            bsl::array<bsl::safe_uint64, 3> dst{};
+            bsl::ut_then{} = [&src, &dst]() {
+                auto const ret{bsl::transform_exclusive_scan(
+                    bsl::span<bsl::safe_uint64 const>{src.data(), src.size()},
+                    bsl::span<bsl::safe_uint64>{dst.data(), dst.size()},
+                    bsl::to_u64(0),
+                    &align8)};
+                bsl::ut_check(ret.errc() == bsl::errc_unsigned_wrap);
+            };
+        };
+    };
+
+    return bsl::ut_success();
+}
+
+/// <!-- description -->
+///   @brief Main function for this unit test. If a call to ut_check() fails
+///     the application will fast fail. If all calls to ut_check() pass, this
+///     function will successfully return with bsl::exit_success.
+///
+/// <!-- inputs/outputs -->
+///   @return Always returns bsl::exit_success.
+///
+bsl::exit_code
+main() noexcept
+{
+    static_assert(tests() == bsl::ut_success());
+    return tests();
+}
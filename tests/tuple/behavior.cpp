@@ -0,0 +1,215 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+#include <bsl/tuple.hpp>
+#include <bsl/convert.hpp>
+#include <bsl/cstdint.hpp>
+#include <bsl/is_same.hpp>
+#include <bsl/is_trivially_copyable.hpp>
+#include <bsl/move.hpp>
+#include <bsl/safe_integral.hpp>
+#include <bsl/tuple_element.hpp>
+#include <bsl/tuple_size.hpp>
+#include <bsl/ut.hpp>
+
+namespace
+{
+    /// @class empty_cmp
+    ///
+    /// <!-- description -->
+    ///   @brief A stateless comparator used to test the empty member
+    ///     optimization.
+    ///
+    class empty_cmp final
+    {
+    public:
+        /// <!-- description -->
+        ///   @brief Returns lhs < rhs
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param lhs the left hand side of the comparison
+        ///   @param rhs the right hand side of the comparison
+        ///   @return Returns lhs < rhs
+        ///
+        [[nodiscard]] constexpr bool
+        operator()(bsl::safe_uint64 const &lhs, bsl::safe_uint64 const &rhs) const noexcept
+        {
+            return lhs < rhs;
+        }
+    };
+
+    /// <!-- description -->
+    ///   @brief Returns a quotient and a remainder, used to test multi-value
+    ///     returns using a braced list.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param n the numerator
+    ///   @param d the denominator
+    ///   @return Returns n / d and n % d
+    ///
+    [[nodiscard]] constexpr auto
+    divmod(bsl::safe_uint64 const &n, bsl::safe_uint64 const &d) noexcept
+        -> bsl::tuple<bsl::safe_uint64, bsl::safe_uint64>
+    {
+        return {n / d, n % d};
+    }
+}
+
+/// <!-- description -->
+///   @brief Used to execute the actual checks. We put the checks in this
+///     function so that we can validate the tests both at compile-time
+///     and at run-time. If a bsl::ut_check fails, the tests will either
+///     fail fast at run-time, or will produce a compile-time error.
+///
+/// <!-- inputs/outputs -->
+///   @return Always returns bsl::exit_success.
+///
+constexpr bsl::exit_code
+tests() noexcept
+{
+    bsl::ut_scenario{"tuple_size and tuple_element"} = []() {
+        bsl::ut_then{} = []() {
+            using tuple_type = bsl::tuple<bool, bsl::safe_uint64, empty_cmp>;
+            static_assert(bsl::tuple_size<tuple_type>::value == 3U);
+            static_assert(bsl::tuple_size<tuple_type const>::value == 3U);
+            static_assert(bsl::tuple_size<bsl::tuple<>>::value == 0U);
+            static_assert(bsl::is_same<bsl::tuple_element_t<0U, tuple_type>, bool>::value);
+            static_assert(
+                bsl::is_same<bsl::tuple_element_t<1U, tuple_type>, bsl::safe_uint64>::value);
+            static_assert(bsl::is_same<bsl::tuple_element_t<2U, tuple_type>, empty_cmp>::value);
+            static_assert(
+                bsl::is_same<bsl::tuple_element_t<0U, tuple_type const>, bool const>::value);
+        };
+    };
+
+    bsl::ut_scenario{"empty elements take no space"} = []() {
+        bsl::ut_then{} = []() {
+            static_assert(sizeof(bsl::tuple<empty_cmp, bsl::uint64>) == sizeof(bsl::uint64));
+            static_assert(sizeof(bsl::tuple<bsl::uint64, empty_cmp>) == sizeof(bsl::uint64));
+            static_assert(
+                sizeof(bsl::tuple<bsl::uint32, bsl::uint32>) == (sizeof(bsl::uint32) * 2U));
+        };
+    };
+
+    bsl::ut_scenario{"trivially copyable"} = []() {
+        bsl::ut_then{} = []() {
+            static_assert(bsl::is_trivially_copyable<bsl::tuple<bsl::uint64, bool>>::value);
+            static_assert(bsl::is_trivially_copyable<bsl::tuple<empty_cmp, bsl::uint64>>::value);
+            static_assert(bsl::is_trivially_copyable<bsl::tuple<bsl::safe_uint64>>::value);
+        };
+    };
+
+    bsl::ut_scenario{"default constructor"} = []() {
+        bsl::ut_given{} = []() {
+            bsl::tuple<bool, bsl::safe_uint64> const t{};
+            bsl::ut_then{} = [&t]() {
+                bsl::ut_check(!t.get<0>());
+                bsl::ut_check(t.get<1>().is_zero());
+            };
+        };
+
+        bsl::ut_given{} = []() {
+            bsl::tuple<bool, bsl::safe_uint64> const t;
+            bsl::ut_then{} = [&t]() {
+                bsl::ut_check(!t.get<0>());
+                bsl::ut_check(t.get<1>().is_zero());
+            };
+        };
+    };
+
+    bsl::ut_scenario{"get"} = []() {
+        bsl::ut_given{} = []() {
+            bsl::tuple<bool, bsl::safe_uint64> t{true, bsl::to_u64(42)};
+            bsl::ut_when{} = [&t]() {
+                t.get<1>() = bsl::to_u64(23);
+                bsl::ut_then{} = [&t]() {
+                    bsl::ut_check(t.get<0>());
+                    bsl::ut_check(t.get<1>() == bsl::to_u64(23));
+                    bsl::ut_check(bsl::get<1>(t) == bsl::to_u64(23));
+                };
+            };
+        };
+
+        bsl::ut_given{} = []() {
+            bsl::tuple<bool, bsl::safe_uint64> const t{true, bsl::to_u64(42)};
+            bsl::ut_then{} = [&t]() {
+                bsl::ut_check(bsl::get<0>(t));
+                bsl::ut_check(bsl::get<1>(t) == bsl::to_u64(42));
+                bsl::ut_check(bsl::get<0>(bsl::tuple{bsl::to_u64(8)}) == bsl::to_u64(8));
+            };
+        };
+    };
+
+    bsl::ut_scenario{"return using a braced list"} = []() {
+        bsl::ut_given{} = []() {
+            bsl::ut_then{} = []() {
+                bsl::tuple<bsl::safe_uint64, bsl::safe_uint64> const t{
+                    divmod(bsl::to_u64(42), bsl::to_u64(8))};
+                bsl::ut_check(t.get<0>() == bsl::to_u64(5));
+                bsl::ut_check(t.get<1>() == bsl::to_u64(2));
+            };
+        };
+    };
+
+    bsl::ut_scenario{"structured bindings"} = []() {
+        bsl::ut_given{} = []() {
+            bsl::ut_then{} = []() {
+                auto const [q, r]{divmod(bsl::to_u64(42), bsl::to_u64(8))};
+                bsl::ut_check(q == bsl::to_u64(5));
+                bsl::ut_check(r == bsl::to_u64(2));
+            };
+        };
+
+        bsl::ut_given{} = []() {
+            bsl::tuple<bool, bsl::safe_uint64, empty_cmp> t{true, bsl::to_u64(1), {}};
+            bsl::ut_when{} = [&t]() {
+                auto &[flag, val, cmp]{t};
+                flag = false;
+                val = bsl::to_u64(2);
+                bsl::ut_then{} = [&t, &cmp]() {
+                    bsl::ut_check(!t.get<0>());
+                    bsl::ut_check(t.get<1>() == bsl::to_u64(2));
+                    bsl::ut_check(cmp(bsl::to_u64(1), t.get<1>()));
+                };
+            };
+        };
+    };
+
+    return bsl::ut_success();
+}
+
+/// <!-- description -->
+///   @brief Main function for this unit test. If a call to ut_check() fails
+///     the application will fast fail. If all calls to ut_check() pass, this
+///     function will successfully return with bsl::exit_success.
+///
+/// <!-- inputs/outputs -->
+///   @return Always returns bsl::exit_success.
+///
+bsl::exit_code
+main() noexcept
+{
+    static_assert(tests() == bsl::ut_success());
+    return tests();
+}
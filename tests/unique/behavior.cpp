@@ -0,0 +1,158 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+#include <bsl/unique.hpp>
+#include <bsl/array.hpp>
+#include <bsl/convert.hpp>
+#include <bsl/cstdint.hpp>
+#include <bsl/is_trivially_copyable.hpp>
+#include <bsl/safe_integral.hpp>
+#include <bsl/span.hpp>
+#include <bsl/ut.hpp>
+
+namespace
+{
+    /// @class nontrivial
+    ///
+    /// <!-- description -->
+    ///   @brief A type that is not trivially copyable, which is used to
+    ///     test the portable version of the algorithm.
+    ///
+    class nontrivial final
+    {
+    public:
+        /// @brief stores the value of the element
+        bsl::uint32 val;
+
+        /// <!-- description -->
+        ///   @brief copy assignment
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param o the object being copied
+        ///   @return a reference to *this
+        ///
+        [[maybe_unused]] constexpr auto
+        operator=(nontrivial const &o) &noexcept -> nontrivial &
+        {
+            val = o.val;
+            return *this;
+        }
+    };
+
+    /// <!-- description -->
+    ///   @brief Returns true if the val of lhs and rhs are equal
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param lhs the left hand side of the operator
+    ///   @param rhs the right hand side of the operator
+    ///   @return Returns true if the val of lhs and rhs are equal
+    ///
+    [[nodiscard]] constexpr auto
+    operator==(nontrivial const &lhs, nontrivial const &rhs) noexcept -> bool
+    {
+        return lhs.val == rhs.val;
+    }
+
+    static_assert(!bsl::is_trivially_copyable<nontrivial>::value);
+}
+
+/// <!-- description -->
+///   @brief Used to execute the actual checks. We put the checks in this
+///     function so that we can validate the tests both at compile-time
+///     and at run-time. If a bsl::ut_check fails, the tests will either
+///     fail fast at run-time, or will produce a compile-time error.
+///
+/// <!-- inputs/outputs -->
+///   @return Always returns bsl::exit_success.
+///
+constexpr bsl::exit_code
+tests() noexcept
+{
+    bsl::ut_scenario{"unique empty"} = []() {
+        bsl::ut_given{} = []() {
+            bsl::span<bsl::uint32> spn{};
+            bsl::ut_then{} = [&spn]() {
+                bsl::ut_check(bsl::unique(spn).is_zero());
+            };
+        };
+    };
+
+    bsl::ut_scenario{"unique trivially copyable"} = []() {
+        bsl::ut_given{} = []() {
+            bsl::array<bsl::uint32, 9> arr{1U, 1U, 2U, 3U, 3U, 3U, 1U, 4U, 4U};
+            bsl::ut_then{} = [&arr]() {
+                bsl::ut_check(bsl::unique(arr) == bsl::to_umax(5));
+                bsl::ut_check(*arr.at_if(bsl::to_umax(0)) == 1U);
+                bsl::ut_check(*arr.at_if(bsl::to_umax(1)) == 2U);
+                bsl::ut_check(*arr.at_if(bsl::to_umax(2)) == 3U);
+                bsl::ut_check(*arr.at_if(bsl::to_umax(3)) == 1U);
+                bsl::ut_check(*arr.at_if(bsl::to_umax(4)) == 4U);
+            };
+        };
+
+        bsl::ut_given{} = []() {
+            bsl::array<bsl::uint32, 5> arr{10U, 11U, 20U, 25U, 31U};
+            bsl::ut_then{} = [&arr]() {
+                auto const size{bsl::unique(
+                    arr, [](bsl::uint32 const &lhs, bsl::uint32 const &rhs) noexcept {
+                        return (lhs / 10U) == (rhs / 10U);
+                    })};
+                bsl::ut_check(size == bsl::to_umax(3));
+                bsl::ut_check(*arr.at_if(bsl::to_umax(0)) == 10U);
+                bsl::ut_check(*arr.at_if(bsl::to_umax(1)) == 20U);
+                bsl::ut_check(*arr.at_if(bsl::to_umax(2)) == 31U);
+            };
+        };
+    };
+
+    bsl::ut_scenario{"unique not trivially copyable"} = []() {
+        bsl::ut_given{} = []() {
+            bsl::array<nontrivial, 5> arr{
+                nontrivial{1U}, nontrivial{1U}, nontrivial{2U}, nontrivial{2U}, nontrivial{3U}};
+            bsl::ut_then{} = [&arr]() {
+                bsl::ut_check(bsl::unique(arr) == bsl::to_umax(3));
+                bsl::ut_check(arr.at_if(bsl::to_umax(0))->val == 1U);
+                bsl::ut_check(arr.at_if(bsl::to_umax(1))->val == 2U);
+                bsl::ut_check(arr.at_if(bsl::to_umax(2))->val == 3U);
+            };
+        };
+    };
+
+    return bsl::ut_success();
+}
+
+/// <!-- description -->
+///   @brief Main function for this unit test. If a call to ut_check() fails
+///     the application will fast fail. If all calls to ut_check() pass, this
+///     function will successfully return with bsl::exit_success.
+///
+/// <!-- inputs/outputs -->
+///   @return Always returns bsl::exit_success.
+///
+bsl::exit_code
+main() noexcept
+{
+    static_assert(tests() == bsl::ut_success());
+    return tests();
+}